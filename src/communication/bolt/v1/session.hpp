@@ -59,11 +59,14 @@ class Session {
 
   /**
    * Process the given `query` with `params`.
+   * @param extra The extra fields of the RUN message, e.g. the `bookmarks`
+   * the query should wait for. Empty for Bolt v1.
    * @return A pair which contains list of headers and qid which is set only
    * if an explicit transaction was started.
    */
   virtual std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, Value> &params) = 0;
+      const std::string &query, const std::map<std::string, Value> &params,
+      const std::map<std::string, Value> &extra) = 0;
 
   /**
    * Put results of the processed query in the `encoder`.
@@ -85,8 +88,19 @@ class Session {
    */
   virtual std::map<std::string, Value> Discard(std::optional<int> n, std::optional<int> qid) = 0;
 
-  virtual void BeginTransaction() = 0;
-  virtual void CommitTransaction() = 0;
+  /**
+   * Begin an explicit transaction.
+   * @param extra The extra fields of the BEGIN message, e.g. the `bookmarks`
+   * the transaction should wait for.
+   */
+  virtual void BeginTransaction(const std::map<std::string, Value> &extra) = 0;
+
+  /**
+   * Commit the explicit transaction.
+   * @return The metadata sent to the client in the SUCCESS message, e.g. the
+   * `bookmark` of the committed transaction.
+   */
+  virtual std::map<std::string, Value> CommitTransaction() = 0;
   virtual void RollbackTransaction() = 0;
 
   /** Aborts currently running query. */
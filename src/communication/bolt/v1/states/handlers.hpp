@@ -73,7 +73,8 @@ inline std::pair<std::string, std::string> ExceptionToErrorMessage(const std::ex
 namespace details {
 
 template <typename TSession>
-State HandleRun(TSession &session, const State state, const Value &query, const Value &params) {
+State HandleRun(TSession &session, const State state, const Value &query, const Value &params,
+                const std::map<std::string, Value> &extra) {
   if (state != State::Idle) {
     // Client could potentially recover if we move to error state, but there is
     // no legitimate situation in which well working client would end up in this
@@ -88,7 +89,7 @@ State HandleRun(TSession &session, const State state, const Value &query, const
 
   try {
     // Interpret can throw.
-    const auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap());
+    const auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap(), extra);
     // Convert std::string to Value
     std::vector<Value> vec;
     std::map<std::string, Value> data;
@@ -227,7 +228,7 @@ State HandleRunV1(TSession &session, const State state, const Marker marker) {
     return State::Close;
   }
 
-  return details::HandleRun(session, state, query, params);
+  return details::HandleRun(session, state, query, params, {});
 }
 
 template <typename TSession>
@@ -251,9 +252,10 @@ State HandleRunV4(TSession &session, const State state, const Marker marker) {
   // Even though this part seems unnecessary it is needed to move the buffer
   if (!session.decoder_.ReadValue(&extra, Value::Type::Map)) {
     spdlog::trace("Couldn't read extra field!");
+    return details::HandleRun(session, state, query, params, {});
   }
 
-  return details::HandleRun(session, state, query, params);
+  return details::HandleRun(session, state, query, params, extra.ValueMap());
 }
 
 template <typename TSession>
@@ -325,17 +327,19 @@ State HandleBegin(TSession &session, const State state, const Marker marker) {
 
   DMG_ASSERT(!session.encoder_buffer_.HasData(), "There should be no data to write in this state");
 
-  if (!session.encoder_.MessageSuccess({})) {
-    spdlog::trace("Couldn't send success message!");
-    return State::Close;
-  }
-
+  // The transaction is started before the response is sent because it can
+  // fail, e.g. if the bookmarks aren't reached in time.
   try {
-    session.BeginTransaction();
+    session.BeginTransaction(extra.ValueMap());
   } catch (const std::exception &e) {
     return HandleFailure(session, e);
   }
 
+  if (!session.encoder_.MessageSuccess({})) {
+    spdlog::trace("Couldn't send success message!");
+    return State::Close;
+  }
+
   return State::Idle;
 }
 
@@ -354,11 +358,13 @@ State HandleCommit(TSession &session, const State state, const Marker marker) {
   DMG_ASSERT(!session.encoder_buffer_.HasData(), "There should be no data to write in this state");
 
   try {
-    if (!session.encoder_.MessageSuccess({})) {
+    // The metadata of the response contains the bookmark of the committed
+    // transaction.
+    const auto metadata = session.CommitTransaction();
+    if (!session.encoder_.MessageSuccess(metadata)) {
       spdlog::trace("Couldn't send success message!");
       return State::Close;
     }
-    session.CommitTransaction();
     return State::Idle;
   } catch (const std::exception &e) {
     return HandleFailure(session, e);
@@ -178,6 +178,15 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24 * 3600));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_thread_count, memgraph::storage::Config::Gc().thread_count,
+                        "The number of threads used by the storage garbage collector to unlink deltas and clean up "
+                        "the indices.",
+                        FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_unlink_time_budget_ms, memgraph::storage::Config::Gc().unlink_time_budget.count(),
+              "The time (in milliseconds) a single garbage collector cycle may spend unlinking deltas before "
+              "leaving the rest to the next cycle. Set to 0 for no limit.");
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
 // `mg_import_csv`. If you change it, make sure to change it there as well.
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -207,7 +216,47 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit, memgraph::storage::Config::Durability().wal_group_commit,
+            "Make every transaction durable before its commit returns and before its changes become visible. When "
+            "enabled, --storage-wal-file-flush-every-n-tx is ignored.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit_visible_before_durable,
+            memgraph::storage::Config::Durability().wal_group_commit_visible_before_durable,
+            "Used with --storage-wal-group-commit. Let the changes of a transaction become visible before they are "
+            "durable, so that the 'fsync' calls of concurrently committing transactions are batched together. Other "
+            "transactions can read changes that are lost on a crash.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_items_per_batch, memgraph::storage::Config::Durability().items_per_batch,
+                        "The number of vertices and edges written to a single batch of the snapshot. Batches are "
+                        "created and recovered in parallel.",
+                        FLAG_IN_RANGE(1, std::numeric_limits<uint64_t>::max()));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_thread_count, memgraph::storage::Config::Durability().snapshot_thread_count,
+                        "The number of threads used to create snapshot batches.", FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_recovery_thread_count, memgraph::storage::Config::Durability().recovery_thread_count,
+                        "The number of threads used to recover snapshot batches.", FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_snapshot_recovery_mmap, memgraph::storage::Config::Durability().snapshot_recovery_mmap,
+            "Set to true to map the snapshot into memory and decode it directly from the mapping during recovery.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_batch_size_kib, memgraph::storage::Config::Replication().batch_size_kibibytes,
+              "Transactions committed while a replica is receiving the previous ones are coalesced into batches "
+              "of up to this size.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_max_pending_batches, memgraph::storage::Config::Replication().max_pending_batches,
+              "The number of batches that can wait while another batch is being sent to a replica. Commits wait for "
+              "SYNC replicas with no room left and ASYNC replicas fall behind and are recovered.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(replication_compress_batches, memgraph::storage::Config::Replication().compress_batches,
+            "Set to true to compress the batches of transactions sent to the replicas.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(replication_visible_before_sync_ack, memgraph::storage::Config::Replication().visible_before_sync_ack,
+            "Let the changes of a transaction become visible before the SYNC replicas acknowledge it, so that "
+            "concurrently committing transactions are sent to them in the same batches. Other transactions can read "
+            "changes that are lost on a failover.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(telemetry_enabled, false,
@@ -252,6 +301,17 @@ DEFINE_double(query_execution_timeout_sec, 600,
               "Maximum allowed query execution time. Queries exceeding this "
               "limit will be aborted. Value of 0 means no limit.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_spill_threshold_kib, memgraph::query::InterpreterConfig().spill_threshold_kibibytes,
+              "Aggregations, ORDER BY and DISTINCT spill their intermediate results to temporary files in the data "
+              "directory once they use more than this many kibibytes of memory. Value of 0 disables spilling.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(bookmark_wait_timeout_ms,
+              memgraph::query::InterpreterConfig().bookmark_wait_timeout.count(),
+              "Maximum time in milliseconds a transaction waits for the instance to reach the bookmarks sent by the "
+              "client. Used on REPLICA instances to read the writes made on the MAIN instance.");
+
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(
     memory_limit, 0,
@@ -861,14 +921,21 @@ class BoltSession final : public memgraph::communication::bolt::Session<memgraph
   using memgraph::communication::bolt::Session<memgraph::communication::InputStream,
                                                memgraph::communication::OutputStream>::TEncoder;
 
-  void BeginTransaction() override { interpreter_.BeginTransaction(); }
+  void BeginTransaction(const std::map<std::string, memgraph::communication::bolt::Value> &extra) override {
+    WaitForBookmarks(extra);
+    interpreter_.BeginTransaction();
+  }
 
-  void CommitTransaction() override { interpreter_.CommitTransaction(); }
+  std::map<std::string, memgraph::communication::bolt::Value> CommitTransaction() override {
+    interpreter_.CommitTransaction();
+    return {{"bookmark", interpreter_.GetBookmark()}};
+  }
 
   void RollbackTransaction() override { interpreter_.RollbackTransaction(); }
 
   std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, memgraph::communication::bolt::Value> &params) override {
+      const std::string &query, const std::map<std::string, memgraph::communication::bolt::Value> &params,
+      const std::map<std::string, memgraph::communication::bolt::Value> &extra) override {
     std::map<std::string, memgraph::storage::PropertyValue> params_pv;
     for (const auto &kv : params) params_pv.emplace(kv.first, memgraph::glue::ToPropertyValue(kv.second));
     const std::string *username{nullptr};
@@ -880,6 +947,7 @@ class BoltSession final : public memgraph::communication::bolt::Session<memgraph
       audit_log_->Record(endpoint_.address, user_ ? *username : "", query, memgraph::storage::PropertyValue(params_pv));
     }
 #endif
+    WaitForBookmarks(extra);
     try {
       auto result = interpreter_.Prepare(query, params_pv, username);
       if (user_ && !AuthChecker::IsUserAuthorized(*user_, result.privileges)) {
@@ -926,6 +994,32 @@ class BoltSession final : public memgraph::communication::bolt::Session<memgraph
   }
 
  private:
+  /// Waits until the instance reaches the `bookmarks` that the client sent in
+  /// the extra fields of a BEGIN or RUN message, so that a REPLICA serves the
+  /// reads only after it has applied the writes the client made on the MAIN.
+  void WaitForBookmarks(const std::map<std::string, memgraph::communication::bolt::Value> &extra) {
+    auto it = extra.find("bookmarks");
+    if (it == extra.end()) return;
+    if (!it->second.IsList()) {
+      throw memgraph::communication::bolt::ClientError("The bookmarks must be a list of strings.");
+    }
+    std::vector<std::string> bookmarks;
+    bookmarks.reserve(it->second.ValueList().size());
+    for (const auto &bookmark : it->second.ValueList()) {
+      if (!bookmark.IsString()) {
+        throw memgraph::communication::bolt::ClientError("The bookmarks must be a list of strings.");
+      }
+      bookmarks.push_back(bookmark.ValueString());
+    }
+    try {
+      interpreter_.WaitForBookmarks(bookmarks);
+    } catch (const memgraph::query::QueryException &e) {
+      // Wrap QueryException into ClientError, because we want to allow the
+      // client to fix the bookmarks.
+      throw memgraph::communication::bolt::ClientError(e.what());
+    }
+  }
+
   template <typename TStream>
   std::map<std::string, memgraph::communication::bolt::Value> PullResults(TStream &stream, std::optional<int> n,
                                                                           std::optional<int> qid) {
@@ -1165,14 +1259,26 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .thread_count = FLAGS_storage_gc_thread_count,
+             .unlink_time_budget = std::chrono::milliseconds(FLAGS_storage_gc_unlink_time_budget_ms)},
       .items = {.properties_on_edges = FLAGS_storage_properties_on_edges},
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_storage_recover_on_startup,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
-                     .snapshot_on_exit = FLAGS_storage_snapshot_on_exit},
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
+                     .wal_group_commit_visible_before_durable = FLAGS_storage_wal_group_commit_visible_before_durable,
+                     .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
+                     .items_per_batch = FLAGS_storage_items_per_batch,
+                     .snapshot_thread_count = FLAGS_storage_snapshot_thread_count,
+                     .recovery_thread_count = FLAGS_storage_recovery_thread_count,
+                     .snapshot_recovery_mmap = FLAGS_storage_snapshot_recovery_mmap},
+      .replication = {.batch_size_kibibytes = FLAGS_replication_batch_size_kib,
+                      .max_pending_batches = FLAGS_replication_max_pending_batches,
+                      .compress_batches = FLAGS_replication_compress_batches,
+                      .visible_before_sync_ack = FLAGS_replication_visible_before_sync_ack},
       .transaction = {.isolation_level = ParseIsolationLevel()}};
   if (FLAGS_storage_snapshot_interval_sec == 0) {
     if (FLAGS_storage_wal_enabled) {
@@ -1201,7 +1307,9 @@ int main(int argc, char **argv) {
        .default_kafka_bootstrap_servers = FLAGS_kafka_bootstrap_servers,
        .default_pulsar_service_url = FLAGS_pulsar_service_url,
        .stream_transaction_conflict_retries = FLAGS_stream_transaction_conflict_retries,
-       .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval)},
+       .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval),
+       .bookmark_wait_timeout = std::chrono::milliseconds(FLAGS_bookmark_wait_timeout_ms),
+       .spill_threshold_kibibytes = FLAGS_query_spill_threshold_kib},
       FLAGS_data_directory};
 #ifdef MG_ENTERPRISE
   SessionData session_data{&db, &interpreter_context, &auth, &audit_log};
@@ -1223,7 +1331,7 @@ int main(int argc, char **argv) {
     auto storage_accessor = interpreter_context.db->Access();
     auto dba = memgraph::query::DbAccessor{&storage_accessor};
     interpreter_context.trigger_store.RestoreTriggers(&interpreter_context.ast_cache, &dba,
-                                                      &interpreter_context.antlr_lock, interpreter_context.config.query,
+                                                      interpreter_context.config.query,
                                                       interpreter_context.auth_checker);
   }
 
@@ -12,15 +12,22 @@
 #include <gflags/gflags.h>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <mutex>
 #include <optional>
+#include <queue>
 #include <regex>
+#include <sstream>
+#include <thread>
 #include <unordered_map>
 
 #include "helpers.hpp"
 #include "storage/v2/storage.hpp"
+#include "utils/csv_parsing.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/logging.hpp"
 #include "utils/message.hpp"
@@ -49,6 +56,14 @@ bool ValidateIdTypeOptions(const char *flagname, const std::string &value) {
   return true;
 }
 
+bool ValidatePositive(const char *flagname, uint64_t value) {
+  if (value == 0) {
+    printf("The argument '%s' must be positive\n", flagname);
+    return false;
+  }
+  return true;
+}
+
 // Memgraph flags.
 // NOTE: These flags must be identical as the flags in the main Memgraph binary.
 // They are used to automatically load the same configuration as the main
@@ -77,6 +92,13 @@ DEFINE_string(id_type, "STRING",
               "Which data type should be used to store the supplied node IDs. "
               "Possible options are: STRING/INTEGER");
 DEFINE_validator(id_type, &ValidateIdTypeOptions);
+DEFINE_uint64(threads, std::max(1U, std::thread::hardware_concurrency()),
+              "Number of threads that parse the CSV files and insert the data.");
+DEFINE_validator(threads, &ValidatePositive);
+DEFINE_uint64(chunk_size_kibibytes, 4096,
+              "The CSV files are split into chunks of whole rows of about this size, which are processed in "
+              "parallel.");
+DEFINE_validator(chunk_size_kibibytes, &ValidatePositive);
 // Arguments `--nodes` and `--relationships` can be input multiple times and are
 // handled with custom parsing.
 DEFINE_string(nodes, "",
@@ -174,6 +196,101 @@ bool SubstringStartsWith(const std::string_view &str, size_t pos, const std::str
   return memgraph::utils::StartsWith(memgraph::utils::Substr(str, pos), what);
 }
 
+/// Returns the finder of the characters that can end a run of ordinary
+/// characters in a field. It is created on the first use, after the flags are
+/// parsed.
+const memgraph::csv::CharacterFinder &FieldEndFinder() {
+  static const memgraph::csv::CharacterFinder finder(
+      std::string{'\n', '\r', '\0', FLAGS_delimiter.front(), FLAGS_quote.front()});
+  return finder;
+}
+
+/// Copies the run of ordinary field characters that starts at `pos` to
+/// `column` (unless it is null) and returns the position of its last
+/// character.
+size_t SkipOrdinaryCharacters(const std::string &line, size_t pos, std::string *column) {
+  const auto end = std::min(FieldEndFinder().Find(line, pos + 1), line.size());
+  if (column) column->append(line, pos, end - pos);
+  return end - 1;
+}
+
+/// Parses a line of a CSV row, which begins in the given parser state, and
+/// returns the parser state at the end of the line. The fields that end on the
+/// line are appended to `row` and the unfinished field is kept in `column`.
+/// When `row` and `column` are null the line is only scanned, which is used to
+/// find where the rows end without parsing them.
+///
+/// @throw LoadException
+CsvParserState ParseLine(const std::string &line, CsvParserState state, std::vector<std::string> *row,
+                         std::string *column) {
+  for (size_t i = 0; i < line.size(); ++i) {
+    auto c = line[i];
+
+    // Line feeds and carriage returns are ignored in CSVs.
+    if (c == '\n' || c == '\r') continue;
+    // Null bytes aren't allowed in CSVs.
+    if (c == '\0') throw LoadException("Line contains NULL byte");
+
+    switch (state) {
+      case CsvParserState::INITIAL_FIELD:
+      case CsvParserState::NEXT_FIELD: {
+        if (SubstringStartsWith(line, i, FLAGS_quote)) {
+          // The current field is a quoted field.
+          state = CsvParserState::QUOTING;
+          i += FLAGS_quote.size() - 1;
+        } else if (SubstringStartsWith(line, i, FLAGS_delimiter)) {
+          // The current field has an empty value.
+          if (row) row->emplace_back("");
+          state = CsvParserState::NEXT_FIELD;
+          i += FLAGS_delimiter.size() - 1;
+        } else {
+          // The current field is a regular field.
+          i = SkipOrdinaryCharacters(line, i, column);
+          state = CsvParserState::NOT_QUOTING;
+        }
+        break;
+      }
+      case CsvParserState::QUOTING: {
+        auto quote_now = SubstringStartsWith(line, i, FLAGS_quote);
+        auto quote_next = SubstringStartsWith(line, i + FLAGS_quote.size(), FLAGS_quote);
+        if (quote_now && quote_next) {
+          // This is an escaped quote character.
+          if (column) *column += FLAGS_quote;
+          i += FLAGS_quote.size() * 2 - 1;
+        } else if (quote_now && !quote_next) {
+          // This is the end of the quoted field.
+          if (row) row->emplace_back(std::move(*column));
+          state = CsvParserState::EXPECT_DELIMITER;
+          i += FLAGS_quote.size() - 1;
+        } else {
+          i = SkipOrdinaryCharacters(line, i, column);
+        }
+        break;
+      }
+      case CsvParserState::NOT_QUOTING: {
+        if (SubstringStartsWith(line, i, FLAGS_delimiter)) {
+          if (row) row->emplace_back(std::move(*column));
+          state = CsvParserState::NEXT_FIELD;
+          i += FLAGS_delimiter.size() - 1;
+        } else {
+          i = SkipOrdinaryCharacters(line, i, column);
+        }
+        break;
+      }
+      case CsvParserState::EXPECT_DELIMITER: {
+        if (SubstringStartsWith(line, i, FLAGS_delimiter)) {
+          state = CsvParserState::NEXT_FIELD;
+          i += FLAGS_delimiter.size() - 1;
+        } else {
+          throw LoadException("Expected '{}' after '{}', but got '{}'", FLAGS_delimiter, FLAGS_quote, c);
+        }
+        break;
+      }
+    }
+  }
+  return state;
+}
+
 /// This function reads a row from a CSV stream.
 ///
 /// Each CSV field must be divided using the `delimiter` and each CSV field can
@@ -231,71 +348,7 @@ std::pair<std::vector<std::string>, uint64_t> ReadRow(std::istream &stream) {
     }
     ++lines_count;
 
-    for (size_t i = 0; i < line.size(); ++i) {
-      auto c = line[i];
-
-      // Line feeds and carriage returns are ignored in CSVs.
-      if (c == '\n' || c == '\r') continue;
-      // Null bytes aren't allowed in CSVs.
-      if (c == '\0') throw LoadException("Line contains NULL byte");
-
-      switch (state) {
-        case CsvParserState::INITIAL_FIELD:
-        case CsvParserState::NEXT_FIELD: {
-          if (SubstringStartsWith(line, i, FLAGS_quote)) {
-            // The current field is a quoted field.
-            state = CsvParserState::QUOTING;
-            i += FLAGS_quote.size() - 1;
-          } else if (SubstringStartsWith(line, i, FLAGS_delimiter)) {
-            // The current field has an empty value.
-            row.emplace_back("");
-            state = CsvParserState::NEXT_FIELD;
-            i += FLAGS_delimiter.size() - 1;
-          } else {
-            // The current field is a regular field.
-            column.push_back(c);
-            state = CsvParserState::NOT_QUOTING;
-          }
-          break;
-        }
-        case CsvParserState::QUOTING: {
-          auto quote_now = SubstringStartsWith(line, i, FLAGS_quote);
-          auto quote_next = SubstringStartsWith(line, i + FLAGS_quote.size(), FLAGS_quote);
-          if (quote_now && quote_next) {
-            // This is an escaped quote character.
-            column += FLAGS_quote;
-            i += FLAGS_quote.size() * 2 - 1;
-          } else if (quote_now && !quote_next) {
-            // This is the end of the quoted field.
-            row.emplace_back(std::move(column));
-            state = CsvParserState::EXPECT_DELIMITER;
-            i += FLAGS_quote.size() - 1;
-          } else {
-            column.push_back(c);
-          }
-          break;
-        }
-        case CsvParserState::NOT_QUOTING: {
-          if (SubstringStartsWith(line, i, FLAGS_delimiter)) {
-            row.emplace_back(std::move(column));
-            state = CsvParserState::NEXT_FIELD;
-            i += FLAGS_delimiter.size() - 1;
-          } else {
-            column.push_back(c);
-          }
-          break;
-        }
-        case CsvParserState::EXPECT_DELIMITER: {
-          if (SubstringStartsWith(line, i, FLAGS_delimiter)) {
-            state = CsvParserState::NEXT_FIELD;
-            i += FLAGS_delimiter.size() - 1;
-          } else {
-            throw LoadException("Expected '{}' after '{}', but got '{}'", FLAGS_delimiter, FLAGS_quote, c);
-          }
-          break;
-        }
-      }
-    }
+    state = ParseLine(line, state, &row, &column);
   } while (state == CsvParserState::QUOTING);
 
   switch (state) {
@@ -415,34 +468,177 @@ std::string GetIdSpace(const std::string &type) {
   return res[3];
 }
 
+// Part of a CSV file that contains only whole rows.
+struct Chunk {
+  std::string data;
+  // Number of the line of the file on which the chunk begins.
+  uint64_t row_number;
+  // Position of the chunk among the chunks of the file.
+  uint64_t index;
+};
+
+// Bounded queue through which the reading thread hands the chunks to the
+// workers, so that the reading thread can't get too far ahead of them.
+class ChunkQueue {
+ public:
+  explicit ChunkQueue(size_t capacity) : capacity_(capacity) {}
+
+  void Push(Chunk chunk) {
+    std::unique_lock guard(lock_);
+    not_full_.wait(guard, [&] { return chunks_.size() < capacity_; });
+    chunks_.push(std::move(chunk));
+    guard.unlock();
+    not_empty_.notify_one();
+  }
+
+  // Returns `std::nullopt` once the queue is closed and empty.
+  std::optional<Chunk> Pop() {
+    std::unique_lock guard(lock_);
+    not_empty_.wait(guard, [&] { return !chunks_.empty() || closed_; });
+    if (chunks_.empty()) return std::nullopt;
+    auto chunk = std::move(chunks_.front());
+    chunks_.pop();
+    guard.unlock();
+    not_full_.notify_one();
+    return chunk;
+  }
+
+  void Close() {
+    {
+      std::lock_guard guard(lock_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+  }
+
+ private:
+  size_t capacity_;
+  std::queue<Chunk> chunks_;
+  bool closed_{false};
+  std::mutex lock_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+// Lets the chunks of a file through a section one at a time, in the order in
+// which they appear in the file.
+class ChunkSequencer {
+ public:
+  void WaitForTurn(uint64_t index) {
+    std::unique_lock guard(lock_);
+    turn_.wait(guard, [&] { return next_index_ == index; });
+  }
+
+  void Done() {
+    {
+      std::lock_guard guard(lock_);
+      ++next_index_;
+    }
+    turn_.notify_all();
+  }
+
+ private:
+  uint64_t next_index_{0};
+  std::mutex lock_;
+  std::condition_variable turn_;
+};
+
+/// Splits the rest of the CSV file into chunks of whole rows and calls
+/// `process_chunk` for each chunk on `FLAGS_threads` worker threads. The file
+/// is read on the calling thread, which only scans the lines to find where the
+/// rows end, so the rows are parsed by the workers in parallel.
+void ProcessChunks(std::istream &file, uint64_t row_number, const std::string &path,
+                   const std::function<void(Chunk *)> &process_chunk) {
+  ChunkQueue queue(2 * FLAGS_threads);
+  std::vector<std::thread> workers;
+  workers.reserve(FLAGS_threads);
+  for (uint64_t i = 0; i < FLAGS_threads; ++i) {
+    workers.emplace_back([&] {
+      while (auto chunk = queue.Pop()) {
+        process_chunk(&*chunk);
+      }
+    });
+  }
+
+  const uint64_t chunk_size = FLAGS_chunk_size_kibibytes * 1024;
+  Chunk chunk{.data = {}, .row_number = row_number, .index = 0};
+  auto state = CsvParserState::INITIAL_FIELD;
+  std::string line;
+  try {
+    while (std::getline(file, line)) {
+      state = ParseLine(line, state, nullptr, nullptr);
+      chunk.data += line;
+      chunk.data += '\n';
+      ++row_number;
+      // The row continues in the next line.
+      if (state == CsvParserState::QUOTING) continue;
+      state = CsvParserState::INITIAL_FIELD;
+      if (chunk.data.size() >= chunk_size) {
+        auto index = chunk.index;
+        queue.Push(std::move(chunk));
+        chunk = Chunk{.data = {}, .row_number = row_number, .index = index + 1};
+      }
+    }
+  } catch (const LoadException &e) {
+    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, path, e.what());
+  }
+  // An unfinished row is left to the workers, which report the error.
+  if (!chunk.data.empty()) queue.Push(std::move(chunk));
+  queue.Close();
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
 /// @throw LoadException
-void ProcessNodeRow(memgraph::storage::Storage *store, const std::vector<std::string> &row,
-                    const std::vector<Field> &fields, const std::vector<std::string> &additional_labels,
-                    std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map) {
+void CheckRowSize(std::vector<std::string> *row, const std::vector<Field> &header) {
+  if ((!FLAGS_ignore_extra_columns && row->size() != header.size()) ||
+      (FLAGS_ignore_extra_columns && row->size() < header.size()))
+    throw LoadException(
+        "Expected as many values as there are header fields (found {}, "
+        "expected {})",
+        row->size(), header.size());
+  if (row->size() > header.size()) {
+    row->resize(header.size());
+  }
+}
+
+// A node that was parsed from a CSV row, but isn't in the storage yet.
+struct ParsedNode {
   std::optional<NodeId> id;
-  auto acc = store->Access();
-  auto node = acc.CreateVertex();
+  std::vector<memgraph::storage::LabelId> labels;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> properties;
+  uint64_t row_number;
+  // Assigned once the node ID is known to be unique.
+  std::optional<memgraph::storage::Gid> gid;
+};
+
+/// @throw LoadException
+ParsedNode ParseNodeRow(memgraph::storage::Storage *store, const std::vector<std::string> &row,
+                        const std::vector<Field> &fields, const std::vector<std::string> &additional_labels) {
+  ParsedNode node;
+  auto add_label = [&](const std::string &label) {
+    auto label_id = store->NameToLabel(label);
+    if (std::find(node.labels.begin(), node.labels.end(), label_id) != node.labels.end()) {
+      throw LoadException("The label '{}' already exists", label);
+    }
+    node.labels.push_back(label_id);
+  };
+  auto add_property = [&](const std::string &name, memgraph::storage::PropertyValue value) {
+    auto [it, inserted] = node.properties.emplace(store->NameToProperty(name), std::move(value));
+    if (!inserted) throw LoadException("The property '{}' already exists", name);
+  };
   for (size_t i = 0; i < row.size(); ++i) {
     const auto &field = fields[i];
     const auto &value = row[i];
     if (memgraph::utils::StartsWith(field.type, "ID")) {
-      if (id) throw LoadException("Only one node ID must be specified");
+      if (node.id) throw LoadException("Only one node ID must be specified");
       if (FLAGS_id_type == "INTEGER") {
         // Call `StringToInt` to verify that the ID is a valid integer.
         StringToInt(value);
       }
       NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map->find(node_id);
-      if (it != node_id_map->end()) {
-        if (FLAGS_skip_duplicate_nodes) {
-          spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", node_id,
-                                                        "https://memgr.ph/csv"));
-          return;
-        } else {
-          throw LoadException("Node with ID '{}' already exists", node_id);
-        }
-      }
-      node_id_map->emplace(node_id, node.Gid());
       if (!field.name.empty()) {
         memgraph::storage::PropertyValue pv_id;
         if (FLAGS_id_type == "INTEGER") {
@@ -450,33 +646,46 @@ void ProcessNodeRow(memgraph::storage::Storage *store, const std::vector<std::st
         } else {
           pv_id = memgraph::storage::PropertyValue(node_id.id);
         }
-        auto old_node_property = node.SetProperty(acc.NameToProperty(field.name), pv_id);
-        if (!old_node_property.HasValue()) throw LoadException("Couldn't add property '{}' to the node", field.name);
-        if (!old_node_property->IsNull()) throw LoadException("The property '{}' already exists", field.name);
+        add_property(field.name, std::move(pv_id));
       }
-      id = node_id;
+      node.id = std::move(node_id);
     } else if (field.type == "LABEL") {
       for (const auto &label : memgraph::utils::Split(value, FLAGS_array_delimiter)) {
-        auto node_label = node.AddLabel(acc.NameToLabel(label));
-        if (!node_label.HasValue()) throw LoadException("Couldn't add label '{}' to the node", label);
-        if (!*node_label) throw LoadException("The label '{}' already exists", label);
+        add_label(label);
       }
     } else if (field.type != "IGNORE") {
-      auto old_node_property = node.SetProperty(acc.NameToProperty(field.name), StringToValue(value, field.type));
-      if (!old_node_property.HasValue()) throw LoadException("Couldn't add property '{}' to the node", field.name);
-      if (!old_node_property->IsNull()) throw LoadException("The property '{}' already exists", field.name);
+      add_property(field.name, StringToValue(value, field.type));
     }
   }
   for (const auto &label : additional_labels) {
-    auto node_label = node.AddLabel(acc.NameToLabel(label));
-    if (!node_label.HasValue()) throw LoadException("Couldn't add label '{}' to the node", label);
-    if (!*node_label) throw LoadException("The label '{}' already exists", label);
+    add_label(label);
+  }
+  return node;
+}
+
+/// Assigns the gid to the node and registers its ID. Must be called for the
+/// nodes in the order of the rows.
+///
+/// @throw LoadException
+void RegisterNode(memgraph::storage::Storage::BulkLoadAccessor *acc, ParsedNode *node,
+                  std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map) {
+  if (node->id) {
+    if (node_id_map->find(*node->id) != node_id_map->end()) {
+      if (FLAGS_skip_duplicate_nodes) {
+        spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", *node->id,
+                                                      "https://memgr.ph/csv"));
+        return;
+      } else {
+        throw LoadException("Node with ID '{}' already exists", *node->id);
+      }
+    }
   }
-  if (acc.Commit().HasError()) throw LoadException("Couldn't store the node");
+  node->gid = acc->ReserveVertexGids(1);
+  if (node->id) node_id_map->emplace(*node->id, *node->gid);
 }
 
-void ProcessNodes(memgraph::storage::Storage *store, const std::string &nodes_path,
-                  std::optional<std::vector<Field>> *header,
+void ProcessNodes(memgraph::storage::Storage *store, memgraph::storage::Storage::BulkLoadAccessor *acc,
+                  const std::string &nodes_path, std::optional<std::vector<Field>> *header,
                   std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map,
                   const std::vector<std::string> &additional_labels) {
   std::ifstream nodes_file(nodes_path);
@@ -488,33 +697,56 @@ void ProcessNodes(memgraph::storage::Storage *store, const std::string &nodes_pa
       row_number += header_lines;
       header->emplace(std::move(fields));
     }
-    while (true) {
-      auto [row, lines_count] = ReadRow(nodes_file);
-      if (lines_count == 0) break;
-      if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
-          (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
-        throw LoadException(
-            "Expected as many values as there are header fields (found {}, "
-            "expected {})",
-            row.size(), (*header)->size());
-      if (row.size() > (*header)->size()) {
-        row.resize((*header)->size());
-      }
-      ProcessNodeRow(store, row, **header, additional_labels, node_id_map);
-      row_number += lines_count;
-    }
   } catch (const LoadException &e) {
     LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, nodes_path, e.what());
   }
+
+  // The chunks are parsed in parallel, but the node IDs are registered in the
+  // order of the rows, so that the first of the duplicate nodes is kept and
+  // the nodes get the same gids as if the file was loaded sequentially. Only
+  // then are the nodes created, again in parallel.
+  ChunkSequencer sequencer;
+  ProcessChunks(nodes_file, row_number, nodes_path, [&](Chunk *chunk) {
+    std::istringstream stream(std::move(chunk->data));
+    uint64_t chunk_row_number = chunk->row_number;
+    std::vector<ParsedNode> nodes;
+    try {
+      while (true) {
+        auto [row, lines_count] = ReadRow(stream);
+        if (lines_count == 0) break;
+        CheckRowSize(&row, **header);
+        nodes.push_back(ParseNodeRow(store, row, **header, additional_labels));
+        nodes.back().row_number = chunk_row_number;
+        chunk_row_number += lines_count;
+      }
+    } catch (const LoadException &e) {
+      LOG_FATAL("Couldn't process row {} of '{}' because of: {}", chunk_row_number, nodes_path, e.what());
+    }
+
+    sequencer.WaitForTurn(chunk->index);
+    for (auto &node : nodes) {
+      try {
+        RegisterNode(acc, &node, node_id_map);
+      } catch (const LoadException &e) {
+        LOG_FATAL("Couldn't process row {} of '{}' because of: {}", node.row_number, nodes_path, e.what());
+      }
+    }
+    sequencer.Done();
+
+    for (const auto &node : nodes) {
+      if (node.gid) acc->CreateVertex(*node.gid, node.labels, node.properties);
+    }
+  });
 }
 
 /// @throw LoadException
-void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vector<Field> &fields,
+void ProcessRelationshipsRow(memgraph::storage::Storage *store, memgraph::storage::Storage::BulkLoadAccessor *acc,
+                             const std::vector<Field> &fields,
                              const std::vector<std::string> &row, std::optional<std::string> relationship_type,
                              const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
   std::optional<memgraph::storage::Gid> start_id;
   std::optional<memgraph::storage::Gid> end_id;
-  std::map<std::string, memgraph::storage::PropertyValue> properties;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> properties;
   for (size_t i = 0; i < row.size(); ++i) {
     const auto &field = fields[i];
     const auto &value = row[i];
@@ -558,7 +790,7 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
       if (relationship_type) throw LoadException("Only one relationship TYPE must be specified");
       relationship_type = value;
     } else if (field.type != "IGNORE") {
-      auto [it, inserted] = properties.emplace(field.name, StringToValue(value, field.type));
+      auto [it, inserted] = properties.emplace(store->NameToProperty(field.name), StringToValue(value, field.type));
       if (!inserted) throw LoadException("The property '{}' already exists", field.name);
     }
   }
@@ -566,34 +798,20 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
   if (!end_id) throw LoadException("END_ID must be set");
   if (!relationship_type) throw LoadException("Relationship TYPE must be set");
 
-  auto acc = store->Access();
-  auto from_node = acc.FindVertex(*start_id, memgraph::storage::View::NEW);
-  if (!from_node) throw LoadException("From node must be in the storage");
-  auto to_node = acc.FindVertex(*end_id, memgraph::storage::View::NEW);
-  if (!to_node) throw LoadException("To node must be in the storage");
-
-  auto relationship = acc.CreateEdge(&*from_node, &*to_node, acc.NameToEdgeType(*relationship_type));
-  if (!relationship.HasValue()) throw LoadException("Couldn't create the relationship");
-
-  for (const auto &property : properties) {
-    auto ret = relationship->SetProperty(acc.NameToProperty(property.first), property.second);
-    if (!ret.HasValue()) {
-      if (ret.GetError() != memgraph::storage::Error::PROPERTIES_DISABLED) {
-        throw LoadException("Couldn't add property '{}' to the relationship", property.first);
-      } else {
-        throw LoadException(
-            "Couldn't add property '{}' to the relationship because properties "
-            "on edges are disabled",
-            property.first);
-      }
+  auto relationship = acc->CreateEdge(*start_id, *end_id, store->NameToEdgeType(*relationship_type), properties);
+  if (!relationship.HasValue()) {
+    if (relationship.GetError() != memgraph::storage::Error::PROPERTIES_DISABLED) {
+      throw LoadException("Couldn't create the relationship");
+    } else {
+      throw LoadException(
+          "Couldn't add properties to the relationship because properties "
+          "on edges are disabled");
     }
   }
-
-  if (acc.Commit().HasError()) throw LoadException("Couldn't store the relationship");
 }
 
-void ProcessRelationships(memgraph::storage::Storage *store, const std::string &relationships_path,
-                          const std::optional<std::string> &relationship_type,
+void ProcessRelationships(memgraph::storage::Storage *store, memgraph::storage::Storage::BulkLoadAccessor *acc,
+                          const std::string &relationships_path, const std::optional<std::string> &relationship_type,
                           std::optional<std::vector<Field>> *header,
                           const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
   std::ifstream relationships_file(relationships_path);
@@ -605,24 +823,27 @@ void ProcessRelationships(memgraph::storage::Storage *store, const std::string &
       row_number += header_lines;
       header->emplace(std::move(fields));
     }
-    while (true) {
-      auto [row, lines_count] = ReadRow(relationships_file);
-      if (lines_count == 0) break;
-      if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
-          (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
-        throw LoadException(
-            "Expected as many values as there are header fields (found {}, "
-            "expected {})",
-            row.size(), (*header)->size());
-      if (row.size() > (*header)->size()) {
-        row.resize((*header)->size());
-      }
-      ProcessRelationshipsRow(store, **header, row, relationship_type, node_id_map);
-      row_number += lines_count;
-    }
   } catch (const LoadException &e) {
     LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, relationships_path, e.what());
   }
+
+  // All nodes are already loaded, so the node IDs are only looked up and the
+  // relationships can be created in any order.
+  ProcessChunks(relationships_file, row_number, relationships_path, [&](Chunk *chunk) {
+    std::istringstream stream(std::move(chunk->data));
+    uint64_t chunk_row_number = chunk->row_number;
+    try {
+      while (true) {
+        auto [row, lines_count] = ReadRow(stream);
+        if (lines_count == 0) break;
+        CheckRowSize(&row, **header);
+        ProcessRelationshipsRow(store, acc, **header, row, relationship_type, node_id_map);
+        chunk_row_number += lines_count;
+      }
+    } catch (const LoadException &e) {
+      LOG_FATAL("Couldn't process row {} of '{}' because of: {}", chunk_row_number, relationships_path, e.what());
+    }
+  });
 }
 
 struct NodesArgument {
@@ -709,13 +930,19 @@ int main(int argc, char *argv[]) {
 
   memgraph::utils::Timer load_timer;
 
+  // The data is loaded without transactions, the indices and the snapshot are
+  // built once everything is loaded.
+  auto bulk_load = store.BulkLoad();
+  MG_ASSERT(bulk_load.HasValue(), "Couldn't start the bulk load!");
+  auto &acc = *bulk_load;
+
   // Process all nodes files.
   for (const auto &value : nodes) {
     auto [files, additional_labels] = ParseNodesArgument(value);
     std::optional<std::vector<Field>> header;
     for (const auto &nodes_file : files) {
       spdlog::info("Loading {}", nodes_file);
-      ProcessNodes(&store, nodes_file, &header, &node_id_map, additional_labels);
+      ProcessNodes(&store, &acc, nodes_file, &header, &node_id_map, additional_labels);
     }
   }
 
@@ -725,10 +952,12 @@ int main(int argc, char *argv[]) {
     std::optional<std::vector<Field>> header;
     for (const auto &relationships_file : files) {
       spdlog::info("Loading {}", relationships_file);
-      ProcessRelationships(&store, relationships_file, type, &header, node_id_map);
+      ProcessRelationships(&store, &acc, relationships_file, type, &header, node_id_map);
     }
   }
 
+  acc.Finish();
+
   double load_sec = load_timer.Elapsed().count();
   spdlog::info("Loaded all data in {:.3f}s", load_sec);
 
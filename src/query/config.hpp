@@ -11,6 +11,7 @@
 
 #pragma once
 #include <chrono>
+#include <cstdint>
 #include <string>
 
 namespace memgraph::query {
@@ -26,5 +27,14 @@ struct InterpreterConfig {
   std::string default_pulsar_service_url;
   uint32_t stream_transaction_conflict_retries;
   std::chrono::milliseconds stream_transaction_retry_interval;
+
+  // How long a transaction waits for the instance to reach the bookmarks
+  // that the client sent when starting it.
+  std::chrono::milliseconds bookmark_wait_timeout{30000};
+
+  // Aggregations, ORDER BY and DISTINCT spill their intermediate results to
+  // disk once they use more than this many kibibytes of memory. Zero disables
+  // spilling.
+  uint64_t spill_threshold_kibibytes{0};
 };
 }  // namespace memgraph::query
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <filesystem>
+#include <optional>
 #include <type_traits>
 
 #include "query/common.hpp"
@@ -60,6 +62,13 @@ inline std::vector<storage::LabelId> NamesToLabels(const std::vector<std::string
   return labels;
 }
 
+/// Range of vertex gids `[lower, upper)` scanned by a single worker of the
+/// `Gather` operator. A missing bound means the range is unbounded on that side.
+struct ScanRange {
+  std::optional<storage::Gid> lower;
+  std::optional<storage::Gid> upper;
+};
+
 struct ExecutionContext {
   DbAccessor *db_accessor{nullptr};
   SymbolTable symbol_table;
@@ -72,6 +81,14 @@ struct ExecutionContext {
   ExecutionStats execution_stats;
   TriggerContextCollector *trigger_context_collector{nullptr};
   utils::AsyncTimer timer;
+  /// Set only in contexts of `Gather` workers, restricts `ScanAll` to the
+  /// vertices of the worker's range.
+  std::optional<ScanRange> scan_range;
+  /// The operators which accumulate their whole input (`Aggregate`, `OrderBy`
+  /// and `Distinct`) spill it to temporary files in `spill_directory` once it
+  /// uses more than `spill_threshold_bytes` of memory. Zero disables spilling.
+  std::filesystem::path spill_directory;
+  uint64_t spill_threshold_bytes{0};
 };
 
 static_assert(std::is_move_assignable_v<ExecutionContext>, "ExecutionContext must be move assignable!");
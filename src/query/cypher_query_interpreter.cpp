@@ -16,13 +16,68 @@ DEFINE_HIDDEN_bool(query_cost_planner, true, "Use the cost-estimating query plan
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(query_plan_cache_ttl, 60, "Time to live for cached query plans, in seconds.",
                        FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_ast_cache_max_size_kib, 64 * 1024,
+              "Maximum estimated size of the cached query ASTs, in kibibytes. The least recently used ASTs are "
+              "evicted when the cache is full.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_plan_cache_max_size_kib, 256 * 1024,
+              "Maximum estimated size of the cached query plans, in kibibytes. The least recently used plans are "
+              "evicted when the cache is full.");
+
+namespace EventCounter {
+extern const Event AstCacheHit;
+extern const Event AstCacheMiss;
+extern const Event AstCacheEviction;
+extern const Event PlanCacheHit;
+extern const Event PlanCacheMiss;
+extern const Event PlanCacheEviction;
+}  // namespace EventCounter
 
 namespace memgraph::query {
+
+namespace {
+// The AST nodes are allocated one by one and their size depends on their
+// type, so the memory used by them is estimated from their number.
+constexpr uint64_t kAstNodeSizeEstimate = 128;
+// Memory used by the logical operators, which aren't counted one by one.
+constexpr uint64_t kPlanSizeEstimate = 4096;
+
+uint64_t EstimateSize(const AstStorage &ast_storage) {
+  uint64_t size = sizeof(AstStorage) + ast_storage.storage_.size() * kAstNodeSizeEstimate;
+  for (const auto *names : {&ast_storage.labels_, &ast_storage.edge_types_, &ast_storage.properties_}) {
+    for (const auto &name : *names) {
+      size += sizeof(std::string) + name.capacity();
+    }
+  }
+  return size;
+}
+
+uint64_t EstimateSize(const CachedPlan &plan) {
+  uint64_t size = kPlanSizeEstimate + EstimateSize(plan.ast_storage());
+  for (const auto &[position, symbol] : plan.symbol_table().table()) {
+    size += sizeof(std::pair<const int32_t, Symbol>) + symbol.name().capacity();
+  }
+  return size;
+}
+}  // namespace
+
+AstCache::AstCache() : AstCache(FLAGS_query_ast_cache_max_size_kib * 1024) {}
+
+AstCache::AstCache(uint64_t capacity_bytes)
+    : QueryCache(capacity_bytes,
+                 {EventCounter::AstCacheHit, EventCounter::AstCacheMiss, EventCounter::AstCacheEviction}) {}
+
+PlanCache::PlanCache() : PlanCache(FLAGS_query_plan_cache_max_size_kib * 1024) {}
+
+PlanCache::PlanCache(uint64_t capacity_bytes)
+    : QueryCache(capacity_bytes,
+                 {EventCounter::PlanCacheHit, EventCounter::PlanCacheMiss, EventCounter::PlanCacheEviction}) {}
+
 CachedPlan::CachedPlan(std::unique_ptr<LogicalPlan> plan) : plan_(std::move(plan)) {}
 
 ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::string, storage::PropertyValue> &params,
-                       utils::SkipList<QueryCacheEntry> *cache, utils::SpinLock *antlr_lock,
-                       const InterpreterConfig::Query &query_config) {
+                       AstCache *cache, const InterpreterConfig::Query &query_config) {
   // Strip the query for caching purposes. The process of stripping a query
   // "normalizes" it by replacing any literals with new parameters. This
   // results in just the *structure* of the query being taken into account for
@@ -45,8 +100,7 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
 
   // Cache the query's AST if it isn't already.
   auto hash = stripped_query.hash();
-  auto accessor = cache->access();
-  auto it = accessor.find(hash);
+  auto cached = cache->Find(hash);
   std::unique_ptr<frontend::opencypher::Parser> parser;
 
   // Return a copy of both the AST storage and the query.
@@ -62,21 +116,19 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
     result.required_privileges = cached_query.required_privileges;
   };
 
-  if (it == accessor.end()) {
-    {
-      std::unique_lock<utils::SpinLock> guard(*antlr_lock);
-
-      try {
-        parser = std::make_unique<frontend::opencypher::Parser>(stripped_query.query());
-      } catch (const SyntaxException &e) {
-        // There is a syntax exception in the stripped query. Re-run the parser
-        // on the original query to get an appropriate error messsage.
-        parser = std::make_unique<frontend::opencypher::Parser>(query_string);
-
-        // If an exception was not thrown here, the stripper messed something
-        // up.
-        LOG_FATAL("The stripped query can't be parsed, but the original can.");
-      }
+  if (!cached) {
+    // Every thread parses with its own DFA cache, so parsing doesn't need to
+    // be serialized.
+    try {
+      parser = std::make_unique<frontend::opencypher::Parser>(stripped_query.query());
+    } catch (const SyntaxException &e) {
+      // There is a syntax exception in the stripped query. Re-run the parser
+      // on the original query to get an appropriate error messsage.
+      parser = std::make_unique<frontend::opencypher::Parser>(query_string);
+
+      // If an exception was not thrown here, the stripper messed something
+      // up.
+      LOG_FATAL("The stripped query can't be parsed, but the original can.");
     }
 
     // Convert the ANTLR4 parse tree into an AST.
@@ -91,10 +143,13 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
     }
 
     if (visitor.GetQueryInfo().is_cacheable) {
-      CachedQuery cached_query{std::move(ast_storage), visitor.query(), query::GetRequiredPrivileges(visitor.query())};
-      it = accessor.insert({hash, std::move(cached_query)}).first;
+      auto size_bytes = EstimateSize(ast_storage);
+      cached = cache->Insert(hash,
+                             std::make_shared<CachedQuery>(CachedQuery{std::move(ast_storage), visitor.query(),
+                                                                       query::GetRequiredPrivileges(visitor.query())}),
+                             size_bytes);
 
-      get_information_from_cache(it->second);
+      get_information_from_cache(*cached);
     } else {
       result.ast_storage.properties_ = ast_storage.properties_;
       result.ast_storage.labels_ = ast_storage.labels_;
@@ -106,7 +161,7 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
       is_cacheable = false;
     }
   } else {
-    get_information_from_cache(it->second);
+    get_information_from_cache(*cached);
   }
 
   return ParsedQuery{query_string,
@@ -131,26 +186,19 @@ std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery
 }
 
 std::shared_ptr<CachedPlan> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
-                                              const Parameters &parameters, utils::SkipList<PlanCacheEntry> *plan_cache,
+                                              const Parameters &parameters, PlanCache *plan_cache,
                                               DbAccessor *db_accessor,
                                               const std::vector<Identifier *> &predefined_identifiers) {
-  std::optional<utils::SkipList<PlanCacheEntry>::Accessor> plan_cache_access;
   if (plan_cache) {
-    plan_cache_access.emplace(plan_cache->access());
-    auto it = plan_cache_access->find(hash);
-    if (it != plan_cache_access->end()) {
-      if (it->second->IsExpired()) {
-        plan_cache_access->remove(hash);
-      } else {
-        return it->second;
-      }
+    if (auto plan = plan_cache->Find(hash, [](const CachedPlan &plan) { return plan.IsExpired(); })) {
+      return plan;
     }
   }
 
   auto plan = std::make_shared<CachedPlan>(
       MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
-  if (plan_cache_access) {
-    plan_cache_access->insert({hash, plan});
+  if (plan_cache) {
+    plan_cache->Insert(hash, plan, EstimateSize(*plan));
   }
   return plan;
 }
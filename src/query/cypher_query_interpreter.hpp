@@ -18,6 +18,7 @@
 #include "query/frontend/semantic/symbol_generator.hpp"
 #include "query/frontend/stripped.hpp"
 #include "query/plan/planner.hpp"
+#include "query/query_cache.hpp"
 #include "utils/flag_validation.hpp"
 #include "utils/timer.hpp"
 
@@ -25,6 +26,10 @@
 DECLARE_bool(query_cost_planner);
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(query_plan_cache_ttl);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_ast_cache_max_size_kib);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_plan_cache_max_size_kib);
 
 namespace memgraph::query {
 
@@ -72,28 +77,23 @@ struct CachedQuery {
   std::vector<AuthQuery::Privilege> required_privileges;
 };
 
-struct QueryCacheEntry {
-  bool operator==(const QueryCacheEntry &other) const { return first == other.first; }
-  bool operator<(const QueryCacheEntry &other) const { return first < other.first; }
-  bool operator==(const uint64_t &other) const { return first == other; }
-  bool operator<(const uint64_t &other) const { return first < other; }
+// TODO: Maybe store the query string in the cache entries and use it as a key
+// with the hash so that we eliminate the risk of hash collisions.
 
-  uint64_t first;
-  // TODO: Maybe store the query string here and use it as a key with the hash
-  // so that we eliminate the risk of hash collisions.
-  CachedQuery second;
+/// Cache of the ASTs of the parsed queries, bounded by
+/// `FLAGS_query_ast_cache_max_size_kib` by default.
+class AstCache : public QueryCache<CachedQuery> {
+ public:
+  AstCache();
+  explicit AstCache(uint64_t capacity_bytes);
 };
 
-struct PlanCacheEntry {
-  bool operator==(const PlanCacheEntry &other) const { return first == other.first; }
-  bool operator<(const PlanCacheEntry &other) const { return first < other.first; }
-  bool operator==(const uint64_t &other) const { return first == other; }
-  bool operator<(const uint64_t &other) const { return first < other; }
-
-  uint64_t first;
-  // TODO: Maybe store the query string here and use it as a key with the hash
-  // so that we eliminate the risk of hash collisions.
-  std::shared_ptr<CachedPlan> second;
+/// Cache of the query plans, bounded by `FLAGS_query_plan_cache_max_size_kib`
+/// by default.
+class PlanCache : public QueryCache<CachedPlan> {
+ public:
+  PlanCache();
+  explicit PlanCache(uint64_t capacity_bytes);
 };
 
 /**
@@ -111,8 +111,7 @@ struct ParsedQuery {
 };
 
 ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::string, storage::PropertyValue> &params,
-                       utils::SkipList<QueryCacheEntry> *cache, utils::SpinLock *antlr_lock,
-                       const InterpreterConfig::Query &query_config);
+                       AstCache *cache, const InterpreterConfig::Query &query_config);
 
 class SingleNodeLogicalPlan final : public LogicalPlan {
  public:
@@ -145,7 +144,7 @@ std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery
  * because a predefined identifier can be used only in one scope.
  */
 std::shared_ptr<CachedPlan> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
-                                              const Parameters &parameters, utils::SkipList<PlanCacheEntry> *plan_cache,
+                                              const Parameters &parameters, PlanCache *plan_cache,
                                               DbAccessor *db_accessor,
                                               const std::vector<Identifier *> &predefined_identifiers = {});
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include <cppitertools/filter.hpp>
 #include <cppitertools/imap.hpp>
@@ -217,6 +218,35 @@ class DbAccessor final {
     Iterator end() { return Iterator(iterable_.end()); }
   };
 
+  class EdgesIterable final {
+    storage::EdgesIterable iterable_;
+
+   public:
+    class Iterator final {
+      storage::EdgesIterable::Iterator it_;
+
+     public:
+      explicit Iterator(storage::EdgesIterable::Iterator it) : it_(it) {}
+
+      EdgeAccessor operator*() const { return EdgeAccessor(*it_); }
+
+      Iterator &operator++() {
+        ++it_;
+        return *this;
+      }
+
+      bool operator==(const Iterator &other) const { return it_ == other.it_; }
+
+      bool operator!=(const Iterator &other) const { return !(other == *this); }
+    };
+
+    explicit EdgesIterable(storage::EdgesIterable iterable) : iterable_(std::move(iterable)) {}
+
+    Iterator begin() { return Iterator(iterable_.begin()); }
+
+    Iterator end() { return Iterator(iterable_.end()); }
+  };
+
  public:
   explicit DbAccessor(storage::Storage::Accessor *accessor) : accessor_(accessor) {}
 
@@ -230,6 +260,15 @@ class DbAccessor final {
 
   VerticesIterable Vertices(storage::View view) { return VerticesIterable(accessor_->Vertices(view)); }
 
+  std::vector<storage::Gid> VerticesPartitionPoints(uint64_t max_partitions) {
+    return accessor_->VerticesPartitionPoints(max_partitions);
+  }
+
+  VerticesIterable VerticesInRange(storage::View view, std::optional<storage::Gid> lower,
+                                   std::optional<storage::Gid> upper) {
+    return VerticesIterable(accessor_->VerticesInRange(lower, upper, view));
+  }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label) {
     return VerticesIterable(accessor_->Vertices(label, view));
   }
@@ -249,6 +288,29 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, property, lower, upper, view));
   }
 
+  VerticesIterable Vertices(storage::View view, storage::LabelId label,
+                            const std::vector<storage::PropertyId> &properties,
+                            const std::vector<storage::PropertyValue> &prefix,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return VerticesIterable(accessor_->Vertices(label, properties, prefix, lower, upper, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type) {
+    return EdgesIterable(accessor_->Edges(edge_type, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const storage::PropertyValue &value) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, value, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, lower, upper, view));
+  }
+
   VertexAccessor InsertVertex() { return VertexAccessor(accessor_->CreateVertex()); }
 
   storage::Result<EdgeAccessor> InsertEdge(VertexAccessor *from, VertexAccessor *to,
@@ -334,6 +396,34 @@ class DbAccessor final {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  bool LabelPropertyHashIndexExists(storage::LabelId label, storage::PropertyId prop) const {
+    return accessor_->LabelPropertyHashIndexExists(label, prop);
+  }
+
+  bool PropertyColumnExists(storage::LabelId label, storage::PropertyId prop) const {
+    return accessor_->PropertyColumnExists(label, prop);
+  }
+
+  bool LabelPropertyCompositeIndexExists(storage::LabelId label,
+                                         const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->LabelPropertyCompositeIndexExists(label, properties);
+  }
+
+  /// Returns the property lists of all composite indices on the given label.
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) const {
+    std::vector<std::vector<storage::PropertyId>> indices;
+    for (auto &[index_label, properties] : accessor_->ListAllIndices().label_property_composite) {
+      if (index_label == label) indices.push_back(std::move(properties));
+    }
+    return indices;
+  }
+
+  bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const { return accessor_->EdgeTypeIndexExists(edge_type); }
+
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return accessor_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
   int64_t VerticesCount() const { return accessor_->ApproximateVertexCount(); }
 
   int64_t VerticesCount(storage::LabelId label) const { return accessor_->ApproximateVertexCount(label); }
@@ -353,9 +443,29 @@ class DbAccessor final {
     return accessor_->ApproximateVertexCount(label, property, lower, upper);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) const {
+    return accessor_->ApproximateVertexCount(label, properties, prefix);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type) const { return accessor_->ApproximateEdgeCount(edge_type); }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                     const storage::PropertyValue &value) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property, value);
+  }
+
   storage::IndicesInfo ListAllIndices() const { return accessor_->ListAllIndices(); }
 
   storage::ConstraintsInfo ListAllConstraints() const { return accessor_->ListAllConstraints(); }
+
+  std::shared_ptr<const storage::GraphStatistics> GetGraphStatistics() const {
+    return accessor_->GetGraphStatistics();
+  }
 };
 
 }  // namespace memgraph::query
@@ -245,6 +245,52 @@ void DumpLabelPropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::L
       << ");";
 }
 
+void DumpLabelPropertyCompositeIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
+                                     const std::vector<storage::PropertyId> &properties) {
+  *os << "CREATE INDEX ON :" << EscapeName(dba->LabelToName(label)) << "(";
+  utils::PrintIterable(*os, properties, ", ",
+                       [&dba](auto &stream, const auto &property) { stream << EscapeName(dba->PropertyToName(property)); });
+  *os << ");";
+}
+
+void DumpLabelPropertyHashIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
+                                storage::PropertyId property) {
+  *os << "CREATE INDEX ON :" << EscapeName(dba->LabelToName(label)) << "(" << EscapeName(dba->PropertyToName(property))
+      << ") USING HASH;";
+}
+
+void DumpEdgeTypeIndex(std::ostream *os, query::DbAccessor *dba, storage::EdgeTypeId edge_type) {
+  *os << "CREATE EDGE INDEX ON :" << EscapeName(dba->EdgeTypeToName(edge_type)) << ";";
+}
+
+void DumpEdgeTypePropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::EdgeTypeId edge_type,
+                               storage::PropertyId property) {
+  *os << "CREATE EDGE INDEX ON :" << EscapeName(dba->EdgeTypeToName(edge_type)) << "("
+      << EscapeName(dba->PropertyToName(property)) << ");";
+}
+
+void DumpPropertyColumns(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
+                         const storage::PropertyColumns::Schema &schema) {
+  *os << "CREATE PROPERTY COLUMNS ON :" << EscapeName(dba->LabelToName(label)) << "(";
+  utils::PrintIterable(*os, schema, ", ", [&dba](auto &stream, const auto &column) {
+    stream << EscapeName(dba->PropertyToName(column.first)) << " ";
+    switch (column.second) {
+      case storage::PropertyValue::Type::Bool:
+        stream << "BOOL";
+        break;
+      case storage::PropertyValue::Type::Int:
+        stream << "INT";
+        break;
+      case storage::PropertyValue::Type::Double:
+        stream << "FLOAT";
+        break;
+      default:
+        LOG_FATAL("Unexpected property column type!");
+    }
+  });
+  *os << ");";
+}
+
 void DumpExistenceConstraint(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
                              storage::PropertyId property) {
   *os << "CREATE CONSTRAINT ON (u:" << EscapeName(dba->LabelToName(label)) << ") ASSERT EXISTS (u."
@@ -269,6 +315,10 @@ PullPlanDump::PullPlanDump(DbAccessor *dba)
                    CreateLabelIndicesPullChunk(),
                    // Dump all label property indices
                    CreateLabelPropertyIndicesPullChunk(),
+                   // Dump all edge indices
+                   CreateEdgeIndicesPullChunk(),
+                   // Dump all property columns
+                   CreatePropertyColumnsPullChunk(),
                    // Dump all existence constraints
                    CreateExistenceConstraintsPullChunk(),
                    // Dump all unique constraints
@@ -344,19 +394,91 @@ PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyIndicesPullChunk() {
       indices_info_.emplace(dba_->ListAllIndices());
     }
     const auto &label_property = indices_info_->label_property;
+    const auto &label_property_composite = indices_info_->label_property_composite;
+    const auto &label_property_hash = indices_info_->label_property_hash;
+    const auto total_size = label_property.size() + label_property_composite.size() + label_property_hash.size();
+
+    size_t local_counter = 0;
+    while (global_index < total_size && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      if (global_index < label_property.size()) {
+        const auto &label_property_index = label_property[global_index];
+        DumpLabelPropertyIndex(&os, dba_, label_property_index.first, label_property_index.second);
+      } else if (global_index < label_property.size() + label_property_composite.size()) {
+        const auto &composite_index = label_property_composite[global_index - label_property.size()];
+        DumpLabelPropertyCompositeIndex(&os, dba_, composite_index.first, composite_index.second);
+      } else {
+        const auto &hash_index =
+            label_property_hash[global_index - label_property.size() - label_property_composite.size()];
+        DumpLabelPropertyHashIndex(&os, dba_, hash_index.first, hash_index.second);
+      }
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == total_size) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreateEdgeIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &edge_type = indices_info_->edge_type;
+    const auto &edge_type_property = indices_info_->edge_type_property;
+    const auto total_size = edge_type.size() + edge_type_property.size();
+
+    size_t local_counter = 0;
+    while (global_index < total_size && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      if (global_index < edge_type.size()) {
+        DumpEdgeTypeIndex(&os, dba_, edge_type[global_index]);
+      } else {
+        const auto &edge_type_property_index = edge_type_property[global_index - edge_type.size()];
+        DumpEdgeTypePropertyIndex(&os, dba_, edge_type_property_index.first, edge_type_property_index.second);
+      }
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == total_size) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreatePropertyColumnsPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &property_columns = indices_info_->property_columns;
 
     size_t local_counter = 0;
-    while (global_index < label_property.size() && (!n || local_counter < *n)) {
+    while (global_index < property_columns.size() && (!n || local_counter < *n)) {
       std::ostringstream os;
-      const auto &label_property_index = label_property[global_index];
-      DumpLabelPropertyIndex(&os, dba_, label_property_index.first, label_property_index.second);
+      const auto &[label, schema] = property_columns[global_index];
+      DumpPropertyColumns(&os, dba_, label, schema);
       stream->Result({TypedValue(os.str())});
 
       ++global_index;
       ++local_counter;
     }
 
-    if (global_index == label_property.size()) {
+    if (global_index == property_columns.size()) {
       return local_counter;
     }
 
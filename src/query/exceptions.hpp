@@ -125,6 +125,18 @@ class HintedAbortError : public utils::BasicException {
             "--query-execution-timeout-sec flag.") {}
 };
 
+// Inherited from BasicException so it is treated as TransientError, the
+// instance may catch up with the bookmark by the time the client retries.
+class BookmarkTimeoutException : public utils::BasicException {
+ public:
+  using utils::BasicException::BasicException;
+  explicit BookmarkTimeoutException(uint64_t commit_timestamp)
+      : utils::BasicException(
+            "The instance didn't reach the bookmark {} within the time specified by the "
+            "--bookmark-wait-timeout-ms flag. Retry the transaction or run it on the MAIN instance.",
+            commit_timestamp) {}
+};
+
 class ExplicitTransactionUsageException : public QueryRuntimeException {
  public:
   using QueryRuntimeException::QueryRuntimeException;
@@ -188,6 +200,12 @@ class FreeMemoryModificationInMulticommandTxException : public QueryException {
       : QueryException("Free memory query not allowed in multicommand transactions.") {}
 };
 
+class AnalyzeGraphInMulticommandTxException : public QueryException {
+ public:
+  AnalyzeGraphInMulticommandTxException()
+      : QueryException("Analyze graph query not allowed in multicommand transactions.") {}
+};
+
 class TriggerModificationInMulticommandTxException : public QueryException {
  public:
   TriggerModificationInMulticommandTxException()
@@ -87,6 +87,9 @@ class ReplicationQuery;
 class LockPathQuery;
 class LoadCsv;
 class FreeMemoryQuery;
+class AnalyzeGraphQuery;
+class EdgeIndexQuery;
+class PropertyColumnsQuery;
 class TriggerQuery;
 class IsolationLevelQuery;
 class CreateSnapshotQuery;
@@ -127,6 +130,7 @@ template <class TResult>
 class QueryVisitor
     : public utils::Visitor<TResult, CypherQuery, ExplainQuery, ProfileQuery, IndexQuery, AuthQuery, InfoQuery,
                             ConstraintQuery, DumpQuery, ReplicationQuery, LockPathQuery, FreeMemoryQuery, TriggerQuery,
-                            IsolationLevelQuery, CreateSnapshotQuery, StreamQuery, SettingQuery, VersionQuery> {};
+                            IsolationLevelQuery, CreateSnapshotQuery, StreamQuery, SettingQuery, VersionQuery,
+                            AnalyzeGraphQuery, EdgeIndexQuery, PropertyColumnsQuery> {};
 
 }  // namespace memgraph::query
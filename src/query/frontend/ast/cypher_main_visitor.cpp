@@ -34,6 +34,7 @@
 #include "query/interpret/awesome_memgraph_functions.hpp"
 #include "query/procedure/module.hpp"
 #include "query/stream/common.hpp"
+#include "utils/algorithm.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/logging.hpp"
 #include "utils/string.hpp"
@@ -204,9 +205,12 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::CREATE;
   index_query->label_ = AddLabel(ctx->labelName()->accept(this));
-  if (ctx->propertyKeyName()) {
-    PropertyIx name_key = ctx->propertyKeyName()->accept(this);
-    index_query->properties_ = {name_key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    PropertyIx name_key = property_key_name->accept(this);
+    index_query->properties_.push_back(name_key);
+  }
+  if (ctx->indexType()) {
+    index_query->index_type_ = IndexQuery::IndexType::HASH;
   }
   return index_query;
 }
@@ -214,14 +218,86 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
 antlrcpp::Any CypherMainVisitor::visitDropIndex(MemgraphCypher::DropIndexContext *ctx) {
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::DROP;
-  if (ctx->propertyKeyName()) {
-    PropertyIx key = ctx->propertyKeyName()->accept(this);
-    index_query->properties_ = {key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    PropertyIx key = property_key_name->accept(this);
+    index_query->properties_.push_back(key);
   }
   index_query->label_ = AddLabel(ctx->labelName()->accept(this));
+  if (ctx->indexType()) {
+    index_query->index_type_ = IndexQuery::IndexType::HASH;
+  }
   return index_query;
 }
 
+antlrcpp::Any CypherMainVisitor::visitEdgeIndexQuery(MemgraphCypher::EdgeIndexQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "EdgeIndexQuery should have exactly one child!");
+  auto *edge_index_query = ctx->children[0]->accept(this).as<EdgeIndexQuery *>();
+  query_ = edge_index_query;
+  return edge_index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreateEdgeIndex(MemgraphCypher::CreateEdgeIndexContext *ctx) {
+  auto *edge_index_query = storage_->Create<EdgeIndexQuery>();
+  edge_index_query->action_ = EdgeIndexQuery::Action::CREATE;
+  edge_index_query->edge_type_ = AddEdgeType(ctx->relTypeName()->accept(this));
+  if (ctx->propertyKeyName()) {
+    PropertyIx key = ctx->propertyKeyName()->accept(this);
+    edge_index_query->properties_.push_back(key);
+  }
+  return edge_index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropEdgeIndex(MemgraphCypher::DropEdgeIndexContext *ctx) {
+  auto *edge_index_query = storage_->Create<EdgeIndexQuery>();
+  edge_index_query->action_ = EdgeIndexQuery::Action::DROP;
+  edge_index_query->edge_type_ = AddEdgeType(ctx->relTypeName()->accept(this));
+  if (ctx->propertyKeyName()) {
+    PropertyIx key = ctx->propertyKeyName()->accept(this);
+    edge_index_query->properties_.push_back(key);
+  }
+  return edge_index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitPropertyColumnsQuery(MemgraphCypher::PropertyColumnsQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "PropertyColumnsQuery should have exactly one child!");
+  auto *property_columns_query = ctx->children[0]->accept(this).as<PropertyColumnsQuery *>();
+  query_ = property_columns_query;
+  return property_columns_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreatePropertyColumns(MemgraphCypher::CreatePropertyColumnsContext *ctx) {
+  auto *property_columns_query = storage_->Create<PropertyColumnsQuery>();
+  property_columns_query->action_ = PropertyColumnsQuery::Action::CREATE;
+  property_columns_query->label_ = AddLabel(ctx->labelName()->accept(this));
+  for (auto *column : ctx->propertyColumn()) {
+    PropertyIx key = column->propertyKeyName()->accept(this);
+    const auto type_name = utils::ToUpperCase(column->symbolicName()->accept(this).as<std::string>());
+    PropertyColumnsQuery::ColumnType type;
+    if (type_name == "BOOL" || type_name == "BOOLEAN") {
+      type = PropertyColumnsQuery::ColumnType::BOOL;
+    } else if (type_name == "INT" || type_name == "INTEGER") {
+      type = PropertyColumnsQuery::ColumnType::INT;
+    } else if (type_name == "FLOAT" || type_name == "DOUBLE") {
+      type = PropertyColumnsQuery::ColumnType::DOUBLE;
+    } else {
+      throw SemanticException("Property columns can only be of type BOOL, INT or FLOAT.");
+    }
+    if (utils::Contains(property_columns_query->properties_, key)) {
+      throw SemanticException("Property {} appears more than once in the column list.", key.name);
+    }
+    property_columns_query->properties_.push_back(key);
+    property_columns_query->column_types_.push_back(type);
+  }
+  return property_columns_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropPropertyColumns(MemgraphCypher::DropPropertyColumnsContext *ctx) {
+  auto *property_columns_query = storage_->Create<PropertyColumnsQuery>();
+  property_columns_query->action_ = PropertyColumnsQuery::Action::DROP;
+  property_columns_query->label_ = AddLabel(ctx->labelName()->accept(this));
+  return property_columns_query;
+}
+
 antlrcpp::Any CypherMainVisitor::visitAuthQuery(MemgraphCypher::AuthQueryContext *ctx) {
   MG_ASSERT(ctx->children.size() == 1, "AuthQuery should have exactly one child!");
   auto *auth_query = ctx->children[0]->accept(this).as<AuthQuery *>();
@@ -375,6 +451,14 @@ antlrcpp::Any CypherMainVisitor::visitFreeMemoryQuery(MemgraphCypher::FreeMemory
   return free_memory_query;
 }
 
+antlrcpp::Any CypherMainVisitor::visitAnalyzeGraphQuery(MemgraphCypher::AnalyzeGraphQueryContext *ctx) {
+  auto *analyze_graph_query = storage_->Create<AnalyzeGraphQuery>();
+  analyze_graph_query->action_ =
+      ctx->DELETE() ? AnalyzeGraphQuery::Action::DELETE_STATISTICS : AnalyzeGraphQuery::Action::ANALYZE;
+  query_ = analyze_graph_query;
+  return analyze_graph_query;
+}
+
 antlrcpp::Any CypherMainVisitor::visitTriggerQuery(MemgraphCypher::TriggerQueryContext *ctx) {
   MG_ASSERT(ctx->children.size() == 1, "TriggerQuery should have exactly one child!");
   auto *trigger_query = ctx->children[0]->accept(this).as<TriggerQuery *>();
@@ -228,6 +228,11 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
    */
   antlrcpp::Any visitFreeMemoryQuery(MemgraphCypher::FreeMemoryQueryContext *ctx) override;
 
+  /**
+   * @return AnalyzeGraphQuery*
+   */
+  antlrcpp::Any visitAnalyzeGraphQuery(MemgraphCypher::AnalyzeGraphQueryContext *ctx) override;
+
   /**
    * @return TriggerQuery*
    */
@@ -423,6 +428,36 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
    */
   antlrcpp::Any visitDropIndex(MemgraphCypher::DropIndexContext *ctx) override;
 
+  /**
+   * @return EdgeIndexQuery*
+   */
+  antlrcpp::Any visitEdgeIndexQuery(MemgraphCypher::EdgeIndexQueryContext *ctx) override;
+
+  /**
+   * @return EdgeIndexQuery*
+   */
+  antlrcpp::Any visitCreateEdgeIndex(MemgraphCypher::CreateEdgeIndexContext *ctx) override;
+
+  /**
+   * @return EdgeIndexQuery*
+   */
+  antlrcpp::Any visitDropEdgeIndex(MemgraphCypher::DropEdgeIndexContext *ctx) override;
+
+  /**
+   * @return PropertyColumnsQuery*
+   */
+  antlrcpp::Any visitPropertyColumnsQuery(MemgraphCypher::PropertyColumnsQueryContext *ctx) override;
+
+  /**
+   * @return PropertyColumnsQuery*
+   */
+  antlrcpp::Any visitCreatePropertyColumns(MemgraphCypher::CreatePropertyColumnsContext *ctx) override;
+
+  /**
+   * @return PropertyColumnsQuery*
+   */
+  antlrcpp::Any visitDropPropertyColumns(MemgraphCypher::DropPropertyColumnsContext *ctx) override;
+
   /**
    * @return AuthQuery*
    */
@@ -310,9 +310,11 @@ integerLiteral : DecimalLiteral
                | HexadecimalLiteral
                ;
 
-createIndex : CREATE INDEX ON ':' labelName ( '(' propertyKeyName ')' )? ;
+createIndex : CREATE INDEX ON ':' labelName ( '(' propertyKeyName ( ',' propertyKeyName )* ')' )? indexType? ;
 
-dropIndex : DROP INDEX ON ':' labelName ( '(' propertyKeyName ')' )? ;
+dropIndex : DROP INDEX ON ':' labelName ( '(' propertyKeyName ( ',' propertyKeyName )* ')' )? indexType? ;
+
+indexType : USING HASH ;
 
 doubleLiteral : FloatingLiteral ;
 
@@ -345,6 +347,7 @@ cypherKeyword : ALL
               | EXTRACT
               | FALSE
               | FILTER
+              | HASH
               | IN
               | INDEX
               | INFO
@@ -377,6 +380,7 @@ cypherKeyword : ALL
               | UNION
               | UNIQUE
               | UNWIND
+              | USING
               | WHEN
               | WHERE
               | WITH
@@ -99,6 +99,7 @@ EXPLAIN        : E X P L A I N ;
 EXTRACT        : E X T R A C T ;
 FALSE          : F A L S E ;
 FILTER         : F I L T E R ;
+HASH           : H A S H ;
 IN             : I N ;
 INDEX          : I N D E X ;
 INFO           : I N F O ;
@@ -135,6 +136,7 @@ UNION          : U N I O N ;
 UNIQUE         : U N I Q U E ;
 UNLIMITED      : U N L I M I T E D ;
 UNWIND         : U N W I N D ;
+USING          : U S I N G ;
 WHEN           : W H E N ;
 WHERE          : W H E R E ;
 WITH           : W I T H ;
@@ -22,6 +22,7 @@ import Cypher ;
 memgraphCypherKeyword : cypherKeyword
                       | AFTER
                       | ALTER
+                      | ANALYZE
                       | ASYNC
                       | AUTH
                       | BAD
@@ -32,6 +33,7 @@ memgraphCypherKeyword : cypherKeyword
                       | BOOTSTRAP_SERVERS
                       | CHECK
                       | CLEAR
+                      | COLUMNS
                       | COMMIT
                       | COMMITTED
                       | CONFIG
@@ -45,12 +47,14 @@ memgraphCypherKeyword : cypherKeyword
                       | DENY
                       | DROP
                       | DUMP
+                      | EDGE
                       | EXECUTE
                       | FOR
                       | FREE
                       | FROM
                       | GLOBAL
                       | GRANT
+                      | GRAPH
                       | HEADER
                       | IDENTIFIED
                       | ISOLATION
@@ -66,6 +70,7 @@ memgraphCypherKeyword : cypherKeyword
                       | PULSAR
                       | PORT
                       | PRIVILEGES
+                      | PROPERTY
                       | READ
                       | REGISTER
                       | REPLICA
@@ -80,6 +85,7 @@ memgraphCypherKeyword : cypherKeyword
                       | SETTINGS
                       | SNAPSHOT
                       | START
+                      | STATISTICS
                       | STATS
                       | STREAM
                       | STREAMS
@@ -121,6 +127,9 @@ query : cypherQuery
       | streamQuery
       | settingQuery
       | versionQuery
+      | analyzeGraphQuery
+      | edgeIndexQuery
+      | propertyColumnsQuery
       ;
 
 authQuery : createRole
@@ -275,6 +284,22 @@ lockPathQuery : ( LOCK | UNLOCK ) DATA DIRECTORY ;
 
 freeMemoryQuery : FREE MEMORY ;
 
+analyzeGraphQuery : ANALYZE GRAPH ( DELETE STATISTICS ) ? ;
+
+edgeIndexQuery : createEdgeIndex | dropEdgeIndex ;
+
+createEdgeIndex : CREATE EDGE INDEX ON ':' relTypeName ( '(' propertyKeyName ')' )? ;
+
+dropEdgeIndex : DROP EDGE INDEX ON ':' relTypeName ( '(' propertyKeyName ')' )? ;
+
+propertyColumnsQuery : createPropertyColumns | dropPropertyColumns ;
+
+propertyColumn : propertyKeyName symbolicName ;
+
+createPropertyColumns : CREATE PROPERTY COLUMNS ON ':' labelName '(' propertyColumn ( ',' propertyColumn )* ')' ;
+
+dropPropertyColumns : DROP PROPERTY COLUMNS ON ':' labelName ;
+
 triggerName : symbolicName ;
 
 triggerStatement : .*? ;
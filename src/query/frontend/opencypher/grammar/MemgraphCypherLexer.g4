@@ -27,6 +27,7 @@ UNDERSCORE : '_' ;
 
 AFTER               : A F T E R ;
 ALTER               : A L T E R ;
+ANALYZE             : A N A L Y Z E ;
 ASYNC               : A S Y N C ;
 AUTH                : A U T H ;
 BAD                 : B A D ;
@@ -37,6 +38,7 @@ BEFORE              : B E F O R E ;
 BOOTSTRAP_SERVERS   : B O O T S T R A P UNDERSCORE S E R V E R S ;
 CHECK               : C H E C K ;
 CLEAR               : C L E A R ;
+COLUMNS             : C O L U M N S ;
 COMMIT              : C O M M I T ;
 COMMITTED           : C O M M I T T E D ;
 CONFIG              : C O N F I G ;
@@ -52,6 +54,7 @@ DIRECTORY           : D I R E C T O R Y ;
 DROP                : D R O P ;
 DUMP                : D U M P ;
 DURABILITY          : D U R A B I L I T Y ;
+EDGE                : E D G E ;
 EXECUTE             : E X E C U T E ;
 FOR                 : F O R ;
 FREE                : F R E E ;
@@ -60,6 +63,7 @@ FROM                : F R O M ;
 GLOBAL              : G L O B A L ;
 GRANT               : G R A N T ;
 GRANTS              : G R A N T S ;
+GRAPH               : G R A P H ;
 HEADER              : H E A D E R ;
 IDENTIFIED          : I D E N T I F I E D ;
 IGNORE              : I G N O R E ;
@@ -77,6 +81,7 @@ NO                  : N O ;
 PASSWORD            : P A S S W O R D ;
 PORT                : P O R T ;
 PRIVILEGES          : P R I V I L E G E S ;
+PROPERTY            : P R O P E R T Y ;
 PULSAR              : P U L S A R ;
 READ                : R E A D ;
 READ_FILE           : R E A D UNDERSCORE F I L E ;
@@ -94,6 +99,7 @@ SETTING             : S E T T I N G ;
 SETTINGS            : S E T T I N G S ;
 SNAPSHOT            : S N A P S H O T ;
 START               : S T A R T ;
+STATISTICS          : S T A T I S T I C S ;
 STATS               : S T A T S ;
 STOP                : S T O P ;
 STREAM              : S T R E A M ;
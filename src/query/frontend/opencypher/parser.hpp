@@ -12,6 +12,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "antlr4-runtime.h"
 #include "query/exceptions.hpp"
@@ -20,6 +21,41 @@
 
 namespace memgraph::query::frontend::opencypher {
 
+/**
+ * DFA cache of a recognizer. The generated recognizers share a single cache
+ * among all instances, which isn't safe to use from multiple threads at once,
+ * so every thread builds its own cache instead. The ATN itself is read-only
+ * and stays shared.
+ */
+struct DfaCache {
+  explicit DfaCache(const antlr4::atn::ATN &atn) {
+    decision_to_dfa.reserve(atn.getNumberOfDecisions());
+    for (size_t i = 0; i < atn.getNumberOfDecisions(); ++i) {
+      decision_to_dfa.emplace_back(atn.getDecisionState(i), i);
+    }
+  }
+
+  std::vector<antlr4::dfa::DFA> decision_to_dfa;
+  antlr4::atn::PredictionContextCache context_cache;
+};
+
+/// Makes the lexer use the DFA cache of the calling thread.
+inline antlropencypher::MemgraphCypherLexer *UseThreadLocalDfa(antlropencypher::MemgraphCypherLexer *lexer) {
+  thread_local DfaCache cache(lexer->getATN());
+  delete lexer->getInterpreter<antlr4::atn::LexerATNSimulator>();
+  lexer->setInterpreter(
+      new antlr4::atn::LexerATNSimulator(lexer, lexer->getATN(), cache.decision_to_dfa, cache.context_cache));
+  return lexer;
+}
+
+/// Makes the parser use the DFA cache of the calling thread.
+inline void UseThreadLocalDfa(antlropencypher::MemgraphCypher *parser) {
+  thread_local DfaCache cache(parser->getATN());
+  delete parser->getInterpreter<antlr4::atn::ParserATNSimulator>();
+  parser->setInterpreter(
+      new antlr4::atn::ParserATNSimulator(parser, parser->getATN(), cache.decision_to_dfa, cache.context_cache));
+}
+
 /**
  * Generates openCypher AST
  * This thing must me a class since parser.cypher() returns pointer and there is
@@ -32,6 +68,7 @@ class Parser {
    *        the first step is to generate AST
    */
   Parser(const std::string query) : query_(std::move(query)) {
+    UseThreadLocalDfa(&parser_);
     parser_.removeErrorListeners();
     parser_.addErrorListener(&error_listener_);
     tree_ = parser_.cypher();
@@ -59,7 +96,8 @@ class Parser {
   std::string query_;
   antlr4::ANTLRInputStream input_{query_};
   antlropencypher::MemgraphCypherLexer lexer_{&input_};
-  antlr4::CommonTokenStream tokens_{&lexer_};
+  // The token stream starts lexing as soon as the parser is constructed.
+  antlr4::CommonTokenStream tokens_{UseThreadLocalDfa(&lexer_)};
 
   // generate ast
   antlropencypher::MemgraphCypher parser_{&tokens_};
@@ -66,6 +66,12 @@ class PrivilegeExtractor : public QueryVisitor<void>, public HierarchicalTreeVis
 
   void Visit(FreeMemoryQuery &free_memory_query) override { AddPrivilege(AuthQuery::Privilege::FREE_MEMORY); }
 
+  void Visit(AnalyzeGraphQuery &analyze_graph_query) override { AddPrivilege(AuthQuery::Privilege::INDEX); }
+
+  void Visit(EdgeIndexQuery &edge_index_query) override { AddPrivilege(AuthQuery::Privilege::INDEX); }
+
+  void Visit(PropertyColumnsQuery &property_columns_query) override { AddPrivilege(AuthQuery::Privilege::INDEX); }
+
   void Visit(TriggerQuery &trigger_query) override { AddPrivilege(AuthQuery::Privilege::TRIGGER); }
 
   void Visit(StreamQuery &stream_query) override { AddPrivilege(AuthQuery::Privilege::STREAM); }
@@ -204,7 +204,15 @@ const trie::Trie kKeywords = {"union",
                               "pulsar",
                               "service_url",
                               "version",
-                              "websocket"};
+                              "websocket",
+                              "analyze",
+                              "graph",
+                              "statistics",
+                              "edge",
+                              "using",
+                              "hash",
+                              "property",
+                              "columns"};
 
 // Unicode codepoints that are allowed at the start of the unescaped name.
 const std::bitset<kBitsetSize> kUnescapedNameAllowedStarts(
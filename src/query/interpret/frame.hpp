@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "query/frontend/semantic/symbol_table.hpp"
@@ -35,6 +36,7 @@ class Frame {
   const TypedValue &at(const Symbol &symbol) const { return elems_.at(symbol.position()); }
 
   auto &elems() { return elems_; }
+  const auto &elems() const { return elems_; }
 
   utils::MemoryResource *GetMemoryResource() const { return elems_.get_allocator().GetMemoryResource(); }
 
@@ -42,4 +44,51 @@ class Frame {
   utils::pmr::vector<TypedValue> elems_;
 };
 
+/// Block of rows exchanged between cursors during a batched pull.
+///
+/// Each row is a full frame, but only the values of `symbols` (the symbols
+/// modified by the cursors that fill the batch) differ between the rows and are
+/// kept up to date. All frames share the memory resource of the frame that the
+/// batch was created from, so values can be moved between them cheaply.
+class FrameBatch {
+ public:
+  FrameBatch(const Frame &frame, std::vector<Symbol> symbols, size_t capacity) : symbols_(std::move(symbols)) {
+    MG_ASSERT(capacity > 0);
+    frames_.reserve(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+      // Copy assignment keeps the memory resource of the assigned-to frame,
+      // unlike copy construction.
+      auto &row = frames_.emplace_back(frame.elems().size(), frame.GetMemoryResource());
+      row.elems() = frame.elems();
+    }
+  }
+
+  Frame &operator[](size_t index) { return frames_[index]; }
+  const Frame &operator[](size_t index) const { return frames_[index]; }
+
+  size_t capacity() const { return frames_.size(); }
+
+  const std::vector<Symbol> &symbols() const { return symbols_; }
+
+  /// Copies the values of the batch symbols from `frame` to the row at `index`.
+  void CopyRow(const Frame &frame, size_t index) {
+    auto &row = frames_[index];
+    for (const auto &symbol : symbols_) {
+      row[symbol] = frame[symbol];
+    }
+  }
+
+  /// Moves the values of the batch symbols from the row at `index` to `frame`.
+  void MoveRow(size_t index, Frame *frame) {
+    auto &row = frames_[index];
+    for (const auto &symbol : symbols_) {
+      (*frame)[symbol] = std::move(row[symbol]);
+    }
+  }
+
+ private:
+  std::vector<Symbol> symbols_;
+  std::vector<Frame> frames_;
+};
+
 }  // namespace memgraph::query
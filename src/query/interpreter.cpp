@@ -14,12 +14,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <charconv>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <optional>
+#include <set>
 
 #include "glue/communication.hpp"
 #include "memory/memory_control.hpp"
@@ -48,6 +50,7 @@
 #include "utils/csv_parsing.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/exceptions.hpp"
+#include "utils/file.hpp"
 #include "utils/flag_validation.hpp"
 #include "utils/license.hpp"
 #include "utils/likely.hpp"
@@ -67,6 +70,10 @@ extern Event ReadWriteQuery;
 
 extern const Event LabelIndexCreated;
 extern const Event LabelPropertyIndexCreated;
+extern const Event LabelPropertyCompositeIndexCreated;
+extern const Event LabelPropertyHashIndexCreated;
+extern const Event EdgeTypeIndexCreated;
+extern const Event EdgeTypePropertyIndexCreated;
 
 extern const Event StreamsCreated;
 extern const Event TriggersCreated;
@@ -891,6 +898,8 @@ PullPlan::PullPlan(const std::shared_ptr<CachedPlan> plan, const Parameters &par
   ctx_.is_shutting_down = &interpreter_context->is_shutting_down;
   ctx_.is_profile_query = is_profile_query;
   ctx_.trigger_context_collector = trigger_context_collector;
+  ctx_.spill_directory = interpreter_context->spill_directory;
+  ctx_.spill_threshold_bytes = interpreter_context->config.spill_threshold_kibibytes * 1024;
 }
 
 std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
@@ -987,7 +996,15 @@ using RWType = plan::ReadWriteTypeChecker::RWType;
 
 InterpreterContext::InterpreterContext(storage::Storage *db, const InterpreterConfig config,
                                        const std::filesystem::path &data_directory)
-    : db(db), trigger_store(data_directory / "triggers"), config(config), streams{this, data_directory / "streams"} {}
+    : db(db),
+      trigger_store(data_directory / "triggers"),
+      config(config),
+      spill_directory(data_directory / "query_spill"),
+      streams{this, data_directory / "streams"} {
+  // The spill files of the queries that were running when the database was
+  // stopped aren't needed anymore.
+  utils::DeleteDir(spill_directory);
+}
 
 Interpreter::Interpreter(InterpreterContext *interpreter_context) : interpreter_context_(interpreter_context) {
   MG_ASSERT(interpreter_context_, "Interpreter context must not be NULL");
@@ -1129,7 +1146,7 @@ PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string
   // full query string) when given just the inner query to execute.
   ParsedQuery parsed_inner_query =
       ParseQuery(parsed_query.query_string.substr(kExplainQueryStart.size()), parsed_query.user_parameters,
-                 &interpreter_context->ast_cache, &interpreter_context->antlr_lock, interpreter_context->config.query);
+                 &interpreter_context->ast_cache, interpreter_context->config.query);
 
   auto *cypher_query = utils::Downcast<CypherQuery>(parsed_inner_query.query);
   MG_ASSERT(cypher_query, "Cypher grammar should not allow other queries in EXPLAIN");
@@ -1196,7 +1213,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
   // full query string) when given just the inner query to execute.
   ParsedQuery parsed_inner_query =
       ParseQuery(parsed_query.query_string.substr(kProfileQueryStart.size()), parsed_query.user_parameters,
-                 &interpreter_context->ast_cache, &interpreter_context->antlr_lock, interpreter_context->config.query);
+                 &interpreter_context->ast_cache, interpreter_context->config.query);
 
   auto *cypher_query = utils::Downcast<CypherQuery>(parsed_inner_query.query);
   MG_ASSERT(cypher_query, "Cypher grammar should not allow other queries in PROFILE");
@@ -1267,12 +1284,7 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   std::function<void(Notification &)> handler;
 
   // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] {
-    auto access = plan_cache->access();
-    for (auto &kv : access) {
-      access.remove(kv.first);
-    }
-  };
+  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] { plan_cache->Clear(); };
 
   auto label = interpreter_context->db->NameToLabel(index_query->label_.name);
 
@@ -1286,8 +1298,12 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   }
   auto properties_stringified = utils::Join(properties_string, ", ");
 
-  if (properties.size() > 1) {
-    throw utils::NotYetImplemented("index on multiple properties");
+  if (std::set<storage::PropertyId>(properties.begin(), properties.end()).size() != properties.size()) {
+    throw SemanticException("The same property can't be used more than once in an index.");
+  }
+  const bool is_hash_index = index_query->index_type_ == IndexQuery::IndexType::HASH;
+  if (is_hash_index && properties.size() != 1U) {
+    throw SemanticException("A hash index has to be on exactly one property.");
   }
 
   Notification index_notification(SeverityLevel::INFO);
@@ -1298,23 +1314,36 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
           fmt::format("Created index on label {} on properties {}.", index_query->label_.name, properties_stringified);
 
       handler = [interpreter_context, label, properties_stringified = std::move(properties_stringified),
-                 label_name = index_query->label_.name, properties = std::move(properties),
+                 label_name = index_query->label_.name, properties = std::move(properties), is_hash_index,
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        if (properties.empty()) {
+        if (is_hash_index) {
+          if (!interpreter_context->db->CreateHashIndex(label, properties[0])) {
+            index_notification.code = NotificationCode::EXISTANT_INDEX;
+            index_notification.title = fmt::format("Hash index on label {} on properties {} already exists.",
+                                                   label_name, properties_stringified);
+          }
+          EventCounter::IncrementCounter(EventCounter::LabelPropertyHashIndexCreated);
+        } else if (properties.empty()) {
           if (!interpreter_context->db->CreateIndex(label)) {
             index_notification.code = NotificationCode::EXISTANT_INDEX;
             index_notification.title =
                 fmt::format("Index on label {} on properties {} already exists.", label_name, properties_stringified);
           }
           EventCounter::IncrementCounter(EventCounter::LabelIndexCreated);
-        } else {
-          MG_ASSERT(properties.size() == 1U);
+        } else if (properties.size() == 1U) {
           if (!interpreter_context->db->CreateIndex(label, properties[0])) {
             index_notification.code = NotificationCode::EXISTANT_INDEX;
             index_notification.title =
                 fmt::format("Index on label {} on properties {} already exists.", label_name, properties_stringified);
           }
           EventCounter::IncrementCounter(EventCounter::LabelPropertyIndexCreated);
+        } else {
+          if (!interpreter_context->db->CreateCompositeIndex(label, properties)) {
+            index_notification.code = NotificationCode::EXISTANT_INDEX;
+            index_notification.title =
+                fmt::format("Index on label {} on properties {} already exists.", label_name, properties_stringified);
+          }
+          EventCounter::IncrementCounter(EventCounter::LabelPropertyCompositeIndexCreated);
         }
         invalidate_plan_cache();
       };
@@ -1325,21 +1354,192 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       index_notification.title = fmt::format("Dropped index on label {} on properties {}.", index_query->label_.name,
                                              utils::Join(properties_string, ", "));
       handler = [interpreter_context, label, properties_stringified = std::move(properties_stringified),
-                 label_name = index_query->label_.name, properties = std::move(properties),
+                 label_name = index_query->label_.name, properties = std::move(properties), is_hash_index,
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        if (properties.empty()) {
+        if (is_hash_index) {
+          if (!interpreter_context->db->DropHashIndex(label, properties[0])) {
+            index_notification.code = NotificationCode::NONEXISTANT_INDEX;
+            index_notification.title = fmt::format("Hash index on label {} on properties {} doesn't exist.",
+                                                   label_name, properties_stringified);
+          }
+        } else if (properties.empty()) {
           if (!interpreter_context->db->DropIndex(label)) {
             index_notification.code = NotificationCode::NONEXISTANT_INDEX;
             index_notification.title =
                 fmt::format("Index on label {} on properties {} doesn't exist.", label_name, properties_stringified);
           }
-        } else {
-          MG_ASSERT(properties.size() == 1U);
+        } else if (properties.size() == 1U) {
           if (!interpreter_context->db->DropIndex(label, properties[0])) {
             index_notification.code = NotificationCode::NONEXISTANT_INDEX;
             index_notification.title =
                 fmt::format("Index on label {} on properties {} doesn't exist.", label_name, properties_stringified);
           }
+        } else {
+          if (!interpreter_context->db->DropCompositeIndex(label, properties)) {
+            index_notification.code = NotificationCode::NONEXISTANT_INDEX;
+            index_notification.title =
+                fmt::format("Index on label {} on properties {} doesn't exist.", label_name, properties_stringified);
+          }
+        }
+        invalidate_plan_cache();
+      };
+      break;
+    }
+  }
+
+  return PreparedQuery{
+      {},
+      std::move(parsed_query.required_privileges),
+      [handler = std::move(handler), notifications, index_notification = std::move(index_notification)](
+          AnyStream * /*stream*/, std::optional<int> /*unused*/) mutable {
+        handler(index_notification);
+        notifications->push_back(index_notification);
+        return QueryHandlerResult::NOTHING;
+      },
+      RWType::W};
+}
+
+PreparedQuery PrepareEdgeIndexQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
+                                    std::vector<Notification> *notifications, InterpreterContext *interpreter_context) {
+  if (in_explicit_transaction) {
+    throw IndexInMulticommandTxException();
+  }
+
+  auto *edge_index_query = utils::Downcast<EdgeIndexQuery>(parsed_query.query);
+  MG_ASSERT(edge_index_query->properties_.size() <= 1U, "Edge indices have at most one property");
+  std::function<void(Notification &)> handler;
+
+  // Creating an index influences computed plan costs.
+  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] { plan_cache->Clear(); };
+
+  auto edge_type = interpreter_context->db->NameToEdgeType(edge_index_query->edge_type_.name);
+  std::optional<storage::PropertyId> property;
+  std::string property_name;
+  if (!edge_index_query->properties_.empty()) {
+    property_name = edge_index_query->properties_[0].name;
+    property = interpreter_context->db->NameToProperty(property_name);
+  }
+  auto index_description =
+      property ? fmt::format("edge type {} on property {}", edge_index_query->edge_type_.name, property_name)
+               : fmt::format("edge type {}", edge_index_query->edge_type_.name);
+
+  Notification index_notification(SeverityLevel::INFO);
+  switch (edge_index_query->action_) {
+    case EdgeIndexQuery::Action::CREATE: {
+      index_notification.code = NotificationCode::CREATE_INDEX;
+      index_notification.title = fmt::format("Created index on {}.", index_description);
+
+      handler = [interpreter_context, edge_type, property, index_description = std::move(index_description),
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
+        auto *db = interpreter_context->db;
+        if (!property) {
+          if (!db->CreateEdgeIndex(edge_type)) {
+            index_notification.code = NotificationCode::EXISTANT_INDEX;
+            index_notification.title = fmt::format("Index on {} already exists.", index_description);
+          }
+          EventCounter::IncrementCounter(EventCounter::EdgeTypeIndexCreated);
+        } else {
+          if (!db->CreateEdgeIndex(edge_type, *property)) {
+            if (!utils::Contains(db->ListAllIndices().edge_type_property, std::make_pair(edge_type, *property))) {
+              throw QueryRuntimeException("Edge property indices require properties on edges to be enabled.");
+            }
+            index_notification.code = NotificationCode::EXISTANT_INDEX;
+            index_notification.title = fmt::format("Index on {} already exists.", index_description);
+          }
+          EventCounter::IncrementCounter(EventCounter::EdgeTypePropertyIndexCreated);
+        }
+        invalidate_plan_cache();
+      };
+      break;
+    }
+    case EdgeIndexQuery::Action::DROP: {
+      index_notification.code = NotificationCode::DROP_INDEX;
+      index_notification.title = fmt::format("Dropped index on {}.", index_description);
+      handler = [interpreter_context, edge_type, property, index_description = std::move(index_description),
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
+        auto *db = interpreter_context->db;
+        if (!(property ? db->DropEdgeIndex(edge_type, *property) : db->DropEdgeIndex(edge_type))) {
+          index_notification.code = NotificationCode::NONEXISTANT_INDEX;
+          index_notification.title = fmt::format("Index on {} doesn't exist.", index_description);
+        }
+        invalidate_plan_cache();
+      };
+      break;
+    }
+  }
+
+  return PreparedQuery{
+      {},
+      std::move(parsed_query.required_privileges),
+      [handler = std::move(handler), notifications, index_notification = std::move(index_notification)](
+          AnyStream * /*stream*/, std::optional<int> /*unused*/) mutable {
+        handler(index_notification);
+        notifications->push_back(index_notification);
+        return QueryHandlerResult::NOTHING;
+      },
+      RWType::W};
+}
+
+PreparedQuery PreparePropertyColumnsQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
+                                          std::vector<Notification> *notifications,
+                                          InterpreterContext *interpreter_context) {
+  if (in_explicit_transaction) {
+    throw IndexInMulticommandTxException();
+  }
+
+  auto *property_columns_query = utils::Downcast<PropertyColumnsQuery>(parsed_query.query);
+  MG_ASSERT(property_columns_query->properties_.size() == property_columns_query->column_types_.size(),
+            "Every property column should have a type");
+  std::function<void(Notification &)> handler;
+
+  // Scans fall back to the columns when there is no label-property index, so
+  // creating them influences computed plans.
+  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] { plan_cache->Clear(); };
+
+  auto label = interpreter_context->db->NameToLabel(property_columns_query->label_.name);
+  auto columns_description = fmt::format("label {}", property_columns_query->label_.name);
+
+  Notification index_notification(SeverityLevel::INFO);
+  switch (property_columns_query->action_) {
+    case PropertyColumnsQuery::Action::CREATE: {
+      storage::PropertyColumns::Schema schema;
+      schema.reserve(property_columns_query->properties_.size());
+      for (size_t i = 0; i < property_columns_query->properties_.size(); ++i) {
+        auto property = interpreter_context->db->NameToProperty(property_columns_query->properties_[i].name);
+        switch (property_columns_query->column_types_[i]) {
+          case PropertyColumnsQuery::ColumnType::BOOL:
+            schema.emplace_back(property, storage::PropertyValue::Type::Bool);
+            break;
+          case PropertyColumnsQuery::ColumnType::INT:
+            schema.emplace_back(property, storage::PropertyValue::Type::Int);
+            break;
+          case PropertyColumnsQuery::ColumnType::DOUBLE:
+            schema.emplace_back(property, storage::PropertyValue::Type::Double);
+            break;
+        }
+      }
+      index_notification.code = NotificationCode::CREATE_INDEX;
+      index_notification.title = fmt::format("Created property columns on {}.", columns_description);
+
+      handler = [interpreter_context, label, schema = std::move(schema),
+                 columns_description = std::move(columns_description),
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
+        if (!interpreter_context->db->CreatePropertyColumns(label, schema)) {
+          index_notification.code = NotificationCode::EXISTANT_INDEX;
+          index_notification.title = fmt::format("Property columns on {} already exist.", columns_description);
+        }
+        invalidate_plan_cache();
+      };
+      break;
+    }
+    case PropertyColumnsQuery::Action::DROP: {
+      index_notification.code = NotificationCode::DROP_INDEX;
+      index_notification.title = fmt::format("Dropped property columns on {}.", columns_description);
+      handler = [interpreter_context, label, columns_description = std::move(columns_description),
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
+        if (!interpreter_context->db->DropPropertyColumns(label)) {
+          index_notification.code = NotificationCode::NONEXISTANT_INDEX;
+          index_notification.title = fmt::format("Property columns on {} don't exist.", columns_description);
         }
         invalidate_plan_cache();
       };
@@ -1469,6 +1669,67 @@ PreparedQuery PrepareFreeMemoryQuery(ParsedQuery parsed_query, const bool in_exp
       RWType::NONE};
 }
 
+PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, const bool in_explicit_transaction,
+                                       InterpreterContext *interpreter_context) {
+  if (in_explicit_transaction) {
+    throw AnalyzeGraphInMulticommandTxException();
+  }
+
+  auto *analyze_graph_query = utils::Downcast<AnalyzeGraphQuery>(parsed_query.query);
+  MG_ASSERT(analyze_graph_query);
+
+  // Statistics influence computed plan costs.
+  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] { plan_cache->Clear(); };
+
+  std::vector<std::string> header;
+  std::function<std::vector<std::vector<TypedValue>>()> handler;
+
+  switch (analyze_graph_query->action_) {
+    case AnalyzeGraphQuery::Action::ANALYZE:
+      header = {"label", "property", "count", "distinct_values"};
+      handler = [interpreter_context, invalidate_plan_cache = std::move(invalidate_plan_cache)] {
+        auto *db = interpreter_context->db;
+        auto statistics = db->AnalyzeGraph();
+        invalidate_plan_cache();
+
+        std::vector<std::vector<TypedValue>> results;
+        results.reserve(statistics->label_counts.size() + statistics->label_properties.size());
+        for (const auto &[label, count] : statistics->label_counts) {
+          results.push_back({TypedValue(db->LabelToName(label)), TypedValue(), TypedValue(static_cast<int64_t>(count)),
+                             TypedValue()});
+        }
+        for (const auto &[key, property_statistics] : statistics->label_properties) {
+          results.push_back({TypedValue(db->LabelToName(key.first)), TypedValue(db->PropertyToName(key.second)),
+                             TypedValue(static_cast<int64_t>(property_statistics.count)),
+                             TypedValue(static_cast<int64_t>(property_statistics.distinct_values))});
+        }
+        return results;
+      };
+      break;
+    case AnalyzeGraphQuery::Action::DELETE_STATISTICS:
+      handler = [interpreter_context, invalidate_plan_cache = std::move(invalidate_plan_cache)] {
+        interpreter_context->db->ClearGraphStatistics();
+        invalidate_plan_cache();
+        return std::vector<std::vector<TypedValue>>();
+      };
+      break;
+  }
+
+  return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
+                       [handler = std::move(handler), pull_plan = std::shared_ptr<PullPlanVector>(nullptr)](
+                           AnyStream *stream, std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
+                         if (!pull_plan) {
+                           pull_plan = std::make_shared<PullPlanVector>(handler());
+                         }
+
+                         if (pull_plan->Pull(stream, n)) {
+                           return QueryHandlerResult::COMMIT;
+                         }
+                         return std::nullopt;
+                       },
+                       RWType::NONE};
+}
+
 TriggerEventType ToTriggerEventType(const TriggerQuery::EventType event_type) {
   switch (event_type) {
     case TriggerQuery::EventType::ANY:
@@ -1514,8 +1775,7 @@ Callback CreateTrigger(TriggerQuery *trigger_query,
         interpreter_context->trigger_store.AddTrigger(
             std::move(trigger_name), trigger_statement, user_parameters, ToTriggerEventType(event_type),
             before_commit ? TriggerPhase::BEFORE_COMMIT : TriggerPhase::AFTER_COMMIT, &interpreter_context->ast_cache,
-            dba, &interpreter_context->antlr_lock, interpreter_context->config.query, std::move(owner),
-            interpreter_context->auth_checker);
+            dba, interpreter_context->config.query, std::move(owner), interpreter_context->auth_checker);
         return {};
       }};
 }
@@ -1777,7 +2037,9 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
         auto *db = interpreter_context->db;
         auto info = db->ListAllIndices();
         std::vector<std::vector<TypedValue>> results;
-        results.reserve(info.label.size() + info.label_property.size());
+        results.reserve(info.label.size() + info.label_property.size() + info.label_property_composite.size() +
+                        info.label_property_hash.size() + info.edge_type.size() + info.edge_type_property.size() +
+                        info.property_columns.size());
         for (const auto &item : info.label) {
           results.push_back({TypedValue("label"), TypedValue(db->LabelToName(item)), TypedValue()});
         }
@@ -1785,6 +2047,35 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
           results.push_back({TypedValue("label+property"), TypedValue(db->LabelToName(item.first)),
                              TypedValue(db->PropertyToName(item.second))});
         }
+        for (const auto &[label, properties] : info.label_property_composite) {
+          std::vector<std::string> property_names;
+          property_names.reserve(properties.size());
+          for (const auto &property : properties) {
+            property_names.push_back(db->PropertyToName(property));
+          }
+          results.push_back({TypedValue("label+properties"), TypedValue(db->LabelToName(label)),
+                             TypedValue(utils::Join(property_names, ", "))});
+        }
+        for (const auto &item : info.label_property_hash) {
+          results.push_back({TypedValue("label+property (hash)"), TypedValue(db->LabelToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second))});
+        }
+        for (const auto &item : info.edge_type) {
+          results.push_back({TypedValue("edge-type"), TypedValue(db->EdgeTypeToName(item)), TypedValue()});
+        }
+        for (const auto &item : info.edge_type_property) {
+          results.push_back({TypedValue("edge-type+property"), TypedValue(db->EdgeTypeToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second))});
+        }
+        for (const auto &[label, schema] : info.property_columns) {
+          std::vector<std::string> property_names;
+          property_names.reserve(schema.size());
+          for (const auto &[property, type] : schema) {
+            property_names.push_back(db->PropertyToName(property));
+          }
+          results.push_back({TypedValue("property columns"), TypedValue(db->LabelToName(label)),
+                             TypedValue(utils::Join(property_names, ", "))});
+        }
         return std::pair{results, QueryHandlerResult::NOTHING};
       };
       break;
@@ -2007,8 +2298,10 @@ PreparedQuery PrepareConstraintQuery(ParsedQuery parsed_query, bool in_explicit_
   return PreparedQuery{{},
                        std::move(parsed_query.required_privileges),
                        [handler = std::move(handler), constraint_notification = std::move(constraint_notification),
-                        notifications](AnyStream * /*stream*/, std::optional<int> /*n*/) mutable {
+                        notifications, interpreter_context](AnyStream * /*stream*/, std::optional<int> /*n*/) mutable {
                          handler(constraint_notification);
+                         // The cached plans were made with the old constraints.
+                         interpreter_context->plan_cache.Clear();
                          notifications->push_back(constraint_notification);
                          return QueryHandlerResult::COMMIT;
                        },
@@ -2026,6 +2319,41 @@ void Interpreter::CommitTransaction() {
   query_executions_.clear();
 }
 
+namespace {
+// Bookmarks are the commit timestamps with a prefix, so that they can be told
+// apart from the bookmarks of other databases.
+constexpr std::string_view kBookmarkPrefix = "memgraph:";
+
+std::optional<uint64_t> ParseBookmark(std::string_view bookmark) {
+  if (!utils::StartsWith(bookmark, kBookmarkPrefix)) return std::nullopt;
+  bookmark.remove_prefix(kBookmarkPrefix.size());
+  uint64_t commit_timestamp = 0;
+  const auto *end = bookmark.data() + bookmark.size();
+  const auto [ptr, ec] = std::from_chars(bookmark.data(), end, commit_timestamp);
+  if (bookmark.empty() || ec != std::errc() || ptr != end) return std::nullopt;
+  return commit_timestamp;
+}
+}  // namespace
+
+std::string Interpreter::GetBookmark() const {
+  return fmt::format("{}{}", kBookmarkPrefix, interpreter_context_->db->LastCommitTimestamp());
+}
+
+void Interpreter::WaitForBookmarks(const std::vector<std::string> &bookmarks) {
+  uint64_t commit_timestamp = 0;
+  for (const auto &bookmark : bookmarks) {
+    const auto maybe_commit_timestamp = ParseBookmark(bookmark);
+    if (!maybe_commit_timestamp) {
+      throw InvalidArgumentsException("bookmarks", fmt::format("'{}' isn't a Memgraph bookmark", bookmark));
+    }
+    commit_timestamp = std::max(commit_timestamp, *maybe_commit_timestamp);
+  }
+  if (!interpreter_context_->db->WaitForCommitTimestamp(commit_timestamp,
+                                                         interpreter_context_->config.bookmark_wait_timeout)) {
+    throw BookmarkTimeoutException(commit_timestamp);
+  }
+}
+
 void Interpreter::RollbackTransaction() {
   const auto prepared_query = PrepareTransactionQuery("ROLLBACK");
   prepared_query.query_handler(nullptr, {});
@@ -2071,8 +2399,8 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     query_execution->summary["cost_estimate"] = 0.0;
 
     utils::Timer parsing_timer;
-    ParsedQuery parsed_query = ParseQuery(query_string, params, &interpreter_context_->ast_cache,
-                                          &interpreter_context_->antlr_lock, interpreter_context_->config.query);
+    ParsedQuery parsed_query =
+        ParseQuery(query_string, params, &interpreter_context_->ast_cache, interpreter_context_->config.query);
     query_execution->summary["parsing_time"] = parsing_timer.Elapsed().count();
 
     // Some queries require an active transaction in order to be prepared.
@@ -2130,6 +2458,15 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
                                             &*execution_db_accessor_);
     } else if (utils::Downcast<FreeMemoryQuery>(parsed_query.query)) {
       prepared_query = PrepareFreeMemoryQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
+    } else if (utils::Downcast<EdgeIndexQuery>(parsed_query.query)) {
+      prepared_query = PrepareEdgeIndexQuery(std::move(parsed_query), in_explicit_transaction_,
+                                             &query_execution->notifications, interpreter_context_);
+    } else if (utils::Downcast<PropertyColumnsQuery>(parsed_query.query)) {
+      prepared_query = PreparePropertyColumnsQuery(std::move(parsed_query), in_explicit_transaction_,
+                                                   &query_execution->notifications, interpreter_context_);
+    } else if (utils::Downcast<AnalyzeGraphQuery>(parsed_query.query)) {
+      prepared_query =
+          PrepareAnalyzeGraphQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
     } else if (utils::Downcast<TriggerQuery>(parsed_query.query)) {
       prepared_query =
           PrepareTriggerQuery(std::move(parsed_query), in_explicit_transaction_, &query_execution->notifications,
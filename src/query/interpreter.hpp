@@ -169,26 +169,22 @@ struct InterpreterContext {
 
   storage::Storage *db;
 
-  // ANTLR has singleton instance that is shared between threads. It is
-  // protected by locks inside of ANTLR. Unfortunately, they are not protected
-  // in a very good way. Once we have ANTLR version without race conditions we
-  // can remove this lock. This will probably never happen since ANTLR
-  // developers introduce more bugs in each version. Fortunately, we have
-  // cache so this lock probably won't impact performance much...
-  utils::SpinLock antlr_lock;
   std::optional<double> tsc_frequency{utils::GetTSCFrequency()};
   std::atomic<bool> is_shutting_down{false};
 
   AuthQueryHandler *auth{nullptr};
   AuthChecker *auth_checker{nullptr};
 
-  utils::SkipList<QueryCacheEntry> ast_cache;
-  utils::SkipList<PlanCacheEntry> plan_cache;
+  AstCache ast_cache;
+  PlanCache plan_cache;
 
   TriggerStore trigger_store;
   utils::ThreadPool after_commit_trigger_pool{1};
 
   const InterpreterConfig config;
+  // Directory in which the queries create the files for spilling their
+  // intermediate results. It's emptied when the context is created.
+  const std::filesystem::path spill_directory;
 
   query::stream::Streams streams;
 };
@@ -269,6 +265,23 @@ class Interpreter final {
 
   void CommitTransaction();
 
+  /**
+   * Return a bookmark of the current state of the database. All transactions
+   * committed before the call, including the last transaction committed by
+   * this interpreter, are visible once an instance reaches the bookmark.
+   */
+  std::string GetBookmark() const;
+
+  /**
+   * Block until the database reaches all of the given bookmarks. Used on
+   * REPLICA instances so that the next transaction sees the writes the client
+   * made on the MAIN instance.
+   *
+   * @throw query::InvalidArgumentsException if a bookmark is malformed
+   * @throw query::BookmarkTimeoutException if a bookmark isn't reached in time
+   */
+  void WaitForBookmarks(const std::vector<std::string> &bookmarks);
+
   void RollbackTransaction();
 
   void SetNextTransactionIsolationLevel(storage::IsolationLevel isolation_level);
@@ -391,6 +404,7 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
         switch (*maybe_res) {
           case QueryHandlerResult::COMMIT:
             Commit();
+            maybe_summary->insert_or_assign("bookmark", GetBookmark());
             break;
           case QueryHandlerResult::ABORT:
             Abort();
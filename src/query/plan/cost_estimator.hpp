@@ -11,10 +11,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
 #include "query/frontend/ast/ast.hpp"
 #include "query/parameters.hpp"
 #include "query/plan/operator.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/graph_statistics.hpp"
 
 namespace memgraph::query::plan {
 
@@ -42,6 +49,13 @@ namespace memgraph::query::plan {
  * for all plans for a single query part, and query part reordering is not
  * allowed.
  *
+ * When the graph was analyzed (see `storage::Storage::AnalyzeGraph`), the
+ * collected statistics replace the constant cardinality parameters for label
+ * filters, property value lookups without a known value, filters comparing a
+ * property of a vertex with known labels to a constant and expansions. Range
+ * scans over an index whose bounds aren't constant still use the filtering
+ * constant, because the histogram can't be used without the bound values.
+ *
  * This kind of cost estimation can only be used for comparing logical plans.
  * It's aim is to estimate cost(A) to be less then cost(B) in every case where
  * actual query execution for plan A is less then that of plan B. It can NOT be
@@ -56,6 +70,9 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     static constexpr double MakeScanAllByLabelPropertyValue{1.1};
     static constexpr double MakeScanAllByLabelPropertyRange{1.1};
     static constexpr double MakeScanAllByLabelProperty{1.1};
+    static constexpr double MakeScanAllByLabelProperties{1.1};
+    static constexpr double kScanAllEdgesByType{1.1};
+    static constexpr double kScanAllEdgesByTypeProperty{1.1};
     static constexpr double kExpand{2.0};
     static constexpr double kExpandVariable{3.0};
     static constexpr double kFilter{1.5};
@@ -72,13 +89,16 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
 
   struct MiscParam {
     static constexpr double kUnwindNoLiteral{10.0};
+    // Upper bound on the number of hops of a variable expansion used when the
+    // bound isn't a constant.
+    static constexpr int64_t kExpandVariableMaxHops{5};
   };
 
   using HierarchicalLogicalOperatorVisitor::PostVisit;
   using HierarchicalLogicalOperatorVisitor::PreVisit;
 
   CostEstimator(TDbAccessor *db_accessor, const Parameters &parameters)
-      : db_accessor_(db_accessor), parameters(parameters) {}
+      : db_accessor_(db_accessor), parameters(parameters), statistics_(db_accessor->GetGraphStatistics()) {}
 
   bool PostVisit(ScanAll &) override {
     cardinality_ *= db_accessor_->VerticesCount();
@@ -88,6 +108,7 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   }
 
   bool PostVisit(ScanAllByLabel &scan_all_by_label) override {
+    AddSymbolLabel(scan_all_by_label.output_symbol_, scan_all_by_label.label_);
     cardinality_ *= db_accessor_->VerticesCount(scan_all_by_label.label_);
     // ScanAll performs some work for every element that is produced
     IncrementCost(CostParam::kScanAllByLabel);
@@ -98,11 +119,16 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     // This cardinality estimation depends on the property value (expression).
     // If it's a constant, we can evaluate cardinality exactly, otherwise
     // we estimate
+    AddSymbolLabel(logical_op.output_symbol_, logical_op.label_);
     auto property_value = ConstPropertyValue(logical_op.expression_);
     double factor = 1.0;
     if (property_value)
       // get the exact influence based on ScanAll(label, property, value)
       factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, property_value.value());
+    else if (const auto *property_statistics = FindPropertyStatistics(logical_op.label_, logical_op.property_))
+      // estimate the influence from the number of distinct values
+      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_) *
+               property_statistics->EqualSelectivity();
     else
       // estimate the influence as ScanAll(label, property) * filtering
       factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_) * CardParam::kFilter;
@@ -117,6 +143,7 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   bool PostVisit(ScanAllByLabelPropertyRange &logical_op) override {
     // this cardinality estimation depends on Bound expressions.
     // if they are literals we can evaluate cardinality properly
+    AddSymbolLabel(logical_op.output_symbol_, logical_op.label_);
     auto lower = BoundToPropertyValue(logical_op.lower_bound_);
     auto upper = BoundToPropertyValue(logical_op.upper_bound_);
 
@@ -140,26 +167,73 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   }
 
   bool PostVisit(ScanAllByLabelProperty &logical_op) override {
+    AddSymbolLabel(logical_op.output_symbol_, logical_op.label_);
     const auto factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_);
     cardinality_ *= factor;
     IncrementCost(CostParam::MakeScanAllByLabelProperty);
     return true;
   }
 
+  bool PostVisit(ScanAllByLabelProperties &logical_op) override {
+    // The composite index can count the vertices matching the longest prefix
+    // of constant values. Every other filter of the operator is estimated
+    // using the filtering constant.
+    AddSymbolLabel(logical_op.output_symbol_, logical_op.label_);
+    std::vector<storage::PropertyValue> prefix;
+    for (auto *expression : logical_op.expressions_) {
+      auto property_value = ConstPropertyValue(expression);
+      if (!property_value) break;
+      prefix.push_back(std::move(*property_value));
+    }
+    double factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_, prefix);
+    for (auto i = prefix.size(); i < logical_op.expressions_.size(); ++i) factor *= CardParam::kFilter;
+    if (logical_op.lower_bound_ || logical_op.upper_bound_) factor *= CardParam::kFilter;
+
+    cardinality_ *= factor;
+    IncrementCost(CostParam::MakeScanAllByLabelProperties);
+    return true;
+  }
+
   // TODO: Cost estimate ScanAllById?
 
-// For the given op first increments the cardinality and then cost.
-#define POST_VISIT_CARD_FIRST(NAME)     \
-  bool PostVisit(NAME &) override {     \
-    cardinality_ *= CardParam::k##NAME; \
-    IncrementCost(CostParam::k##NAME);  \
-    return true;                        \
+  bool PostVisit(ScanAllEdgesByType &logical_op) override {
+    cardinality_ *= db_accessor_->EdgesCount(logical_op.edge_type_);
+    IncrementCost(CostParam::kScanAllEdgesByType);
+    return true;
+  }
+
+  bool PostVisit(ScanAllEdgesByTypeProperty &logical_op) override {
+    // Only a constant value can be counted exactly, everything else is
+    // estimated using the filtering constant.
+    auto property_value = ConstPropertyValue(logical_op.expression_);
+    double factor = 1.0;
+    if (property_value)
+      factor = db_accessor_->EdgesCount(logical_op.edge_type_, logical_op.property_, property_value.value());
+    else
+      factor = db_accessor_->EdgesCount(logical_op.edge_type_, logical_op.property_) * CardParam::kFilter;
+
+    cardinality_ *= factor;
+    IncrementCost(CostParam::kScanAllEdgesByTypeProperty);
+    return true;
   }
 
-  POST_VISIT_CARD_FIRST(Expand);
-  POST_VISIT_CARD_FIRST(ExpandVariable);
+  bool PostVisit(Expand &expand) override {
+    cardinality_ *= statistics_ ? ExpandFanOut(expand.common_) : CardParam::kExpand;
+    IncrementCost(CostParam::kExpand);
+    return true;
+  }
 
-#undef POST_VISIT_CARD_FIRST
+  bool PostVisit(ExpandVariable &expand) override {
+    cardinality_ *= statistics_ ? ExpandVariableFanOut(expand) : CardParam::kExpandVariable;
+    IncrementCost(CostParam::kExpandVariable);
+    return true;
+  }
+
+  bool PostVisit(Filter &filter) override {
+    IncrementCost(CostParam::kFilter);
+    cardinality_ *= statistics_ ? FilterSelectivity(filter.expression_) : CardParam::kFilter;
+    return true;
+  }
 
 // For the given op first increments the cost and then cardinality.
 #define POST_VISIT_COST_FIRST(LOGICAL_OP, PARAM_NAME) \
@@ -169,7 +243,6 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;                                      \
   }
 
-  POST_VISIT_COST_FIRST(Filter, kFilter)
   POST_VISIT_COST_FIRST(EdgeUniquenessFilter, kEdgeUniquenessFilter);
 
 #undef POST_VISIT_COST_FIRST
@@ -211,8 +284,216 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   TDbAccessor *db_accessor_;
   const Parameters &parameters;
 
+  // statistics collected by analyzing the graph, nullptr if the graph wasn't
+  // analyzed
+  std::shared_ptr<const storage::GraphStatistics> statistics_;
+
+  // labels that the vertices bound to a symbol are known to have, from the
+  // scans and filters visited so far, keyed by the symbol position
+  std::map<int, std::vector<storage::LabelId>> symbol_labels_;
+
+  enum class Comparison { EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
   void IncrementCost(double param) { cost_ += param * cardinality_; }
 
+  void AddSymbolLabel(const Symbol &symbol, storage::LabelId label) {
+    symbol_labels_[symbol.position()].push_back(label);
+  }
+
+  const storage::PropertyStatistics *FindPropertyStatistics(storage::LabelId label, storage::PropertyId property) {
+    if (!statistics_) return nullptr;
+    auto found = statistics_->label_properties.find({label, property});
+    if (found == statistics_->label_properties.end()) return nullptr;
+    return &found->second;
+  }
+
+  // Fraction of all vertices that have the label. Labels which weren't seen
+  // when analyzing the graph are assumed to be on a single vertex, so that
+  // the cardinality never drops to 0.
+  double LabelSelectivity(storage::LabelId label) {
+    if (statistics_->vertex_count == 0) return 1.0;
+    auto found = statistics_->label_counts.find(label);
+    auto count = found == statistics_->label_counts.end() ? 1U : std::max<uint64_t>(found->second, 1U);
+    return static_cast<double>(count) / static_cast<double>(statistics_->vertex_count);
+  }
+
+  // The label tests of the filter are estimated using the label counts and
+  // the comparisons of a property with a constant using the property
+  // statistics, while all other conditions together are estimated with
+  // `CardParam::kFilter`.
+  double FilterSelectivity(Expression *expression) {
+    double selectivity = 1.0;
+    bool has_other_conditions = false;
+    std::vector<Expression *> conditions{expression};
+    std::vector<Expression *> other_conditions;
+    while (!conditions.empty()) {
+      auto *condition = conditions.back();
+      conditions.pop_back();
+      if (auto *and_operator = utils::Downcast<AndOperator>(condition)) {
+        conditions.push_back(and_operator->expression1_);
+        conditions.push_back(and_operator->expression2_);
+      } else if (auto *labels_test = utils::Downcast<LabelsTest>(condition)) {
+        auto *identifier = utils::Downcast<Identifier>(labels_test->expression_);
+        for (const auto &label : labels_test->labels_) {
+          auto label_id = db_accessor_->NameToLabel(label.name);
+          selectivity *= LabelSelectivity(label_id);
+          if (identifier) symbol_labels_[identifier->symbol_pos_].push_back(label_id);
+        }
+      } else {
+        other_conditions.push_back(condition);
+      }
+    }
+    // The label tests are handled first, because they determine which
+    // property statistics apply.
+    for (auto *condition : other_conditions) {
+      if (auto property_selectivity = PropertySelectivity(condition)) {
+        selectivity *= *property_selectivity;
+      } else {
+        has_other_conditions = true;
+      }
+    }
+    if (has_other_conditions) selectivity *= CardParam::kFilter;
+    return selectivity;
+  }
+
+  // Estimates the selectivity of a comparison between a property of a vertex
+  // and a constant using the property statistics of any of the labels the
+  // vertex is known to have. Returns nullopt if the condition isn't such a
+  // comparison or if there are no statistics for it.
+  std::optional<double> PropertySelectivity(Expression *condition) {
+    Expression *lhs = nullptr;
+    Expression *rhs = nullptr;
+    Comparison comparison;
+    if (auto *op = utils::Downcast<EqualOperator>(condition)) {
+      lhs = op->expression1_, rhs = op->expression2_, comparison = Comparison::EQUAL;
+    } else if (auto *op = utils::Downcast<LessOperator>(condition)) {
+      lhs = op->expression1_, rhs = op->expression2_, comparison = Comparison::LESS;
+    } else if (auto *op = utils::Downcast<LessEqualOperator>(condition)) {
+      lhs = op->expression1_, rhs = op->expression2_, comparison = Comparison::LESS_EQUAL;
+    } else if (auto *op = utils::Downcast<GreaterOperator>(condition)) {
+      lhs = op->expression1_, rhs = op->expression2_, comparison = Comparison::GREATER;
+    } else if (auto *op = utils::Downcast<GreaterEqualOperator>(condition)) {
+      lhs = op->expression1_, rhs = op->expression2_, comparison = Comparison::GREATER_EQUAL;
+    } else {
+      return std::nullopt;
+    }
+
+    auto *property_lookup = utils::Downcast<PropertyLookup>(lhs);
+    auto value = ConstPropertyValue(rhs);
+    if (!property_lookup || !value) {
+      // The constant is on the left hand side, so the comparison is mirrored.
+      property_lookup = utils::Downcast<PropertyLookup>(rhs);
+      value = ConstPropertyValue(lhs);
+      if (!property_lookup || !value) return std::nullopt;
+      switch (comparison) {
+        case Comparison::EQUAL:
+          break;
+        case Comparison::LESS:
+          comparison = Comparison::GREATER;
+          break;
+        case Comparison::LESS_EQUAL:
+          comparison = Comparison::GREATER_EQUAL;
+          break;
+        case Comparison::GREATER:
+          comparison = Comparison::LESS;
+          break;
+        case Comparison::GREATER_EQUAL:
+          comparison = Comparison::LESS_EQUAL;
+          break;
+      }
+    }
+    auto *identifier = utils::Downcast<Identifier>(property_lookup->expression_);
+    if (!identifier || value->IsNull()) return std::nullopt;
+    auto labels = symbol_labels_.find(identifier->symbol_pos_);
+    if (labels == symbol_labels_.end()) return std::nullopt;
+
+    const auto property = db_accessor_->NameToProperty(property_lookup->property_.name);
+    for (const auto &label : labels->second) {
+      const auto *property_statistics = FindPropertyStatistics(label, property);
+      if (!property_statistics) continue;
+      // Vertices with the label that don't have the property never pass the
+      // comparison.
+      double with_property = 1.0;
+      auto label_count = statistics_->label_counts.find(label);
+      if (label_count != statistics_->label_counts.end() && label_count->second > 0) {
+        with_property = std::min(
+            static_cast<double>(property_statistics->count) / static_cast<double>(label_count->second), 1.0);
+      }
+      switch (comparison) {
+        case Comparison::EQUAL:
+          return with_property * property_statistics->EqualSelectivity();
+        case Comparison::LESS:
+          return with_property * property_statistics->RangeSelectivity(std::nullopt, utils::MakeBoundExclusive(*value));
+        case Comparison::LESS_EQUAL:
+          return with_property * property_statistics->RangeSelectivity(std::nullopt, utils::MakeBoundInclusive(*value));
+        case Comparison::GREATER:
+          return with_property * property_statistics->RangeSelectivity(utils::MakeBoundExclusive(*value), std::nullopt);
+        case Comparison::GREATER_EQUAL:
+          return with_property * property_statistics->RangeSelectivity(utils::MakeBoundInclusive(*value), std::nullopt);
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Average number of edges of the given types per vertex from which the
+  // expansion starts. Only vertices that have at least one such edge are taken
+  // into account, since the expansion usually starts from vertices that are
+  // expected to have them. Expansions over edges of any type use the average
+  // degree of all vertices.
+  double ExpandFanOut(const ExpandCommon &common) {
+    auto degree = [](uint64_t edges, uint64_t vertices) {
+      if (vertices == 0) return 0.0;
+      return static_cast<double>(edges) / static_cast<double>(vertices);
+    };
+    double fan_out = 0.0;
+    if (common.edge_types.empty()) {
+      fan_out = degree(statistics_->edge_count, statistics_->vertex_count);
+      if (common.direction == EdgeAtom::Direction::BOTH) fan_out *= 2;
+      return fan_out;
+    }
+    bool any_edge_type_found = false;
+    for (const auto &edge_type : common.edge_types) {
+      auto found = statistics_->edge_types.find(edge_type);
+      if (found == statistics_->edge_types.end()) continue;
+      any_edge_type_found = true;
+      const auto &edge_type_statistics = found->second;
+      if (common.direction != EdgeAtom::Direction::IN) {
+        fan_out += degree(edge_type_statistics.count, edge_type_statistics.from_vertices);
+      }
+      if (common.direction != EdgeAtom::Direction::OUT) {
+        fan_out += degree(edge_type_statistics.count, edge_type_statistics.to_vertices);
+      }
+    }
+    // Edge types which weren't seen when analyzing the graph could have been
+    // created since, so the default fan-out is used instead of assuming that
+    // there are no such edges.
+    if (!any_edge_type_found) return CardParam::kExpand;
+    return fan_out;
+  }
+
+  // Sums the fan-outs of all expansion lengths within the bounds. The result
+  // is capped at the number of vertices, because even variable expansions that
+  // yield many paths to the same vertex are usually bounded by it in practice.
+  double ExpandVariableFanOut(const ExpandVariable &expand) {
+    auto hops = [this](const Expression *bound, int64_t default_hops) {
+      if (!bound) return default_hops;
+      auto value = ConstPropertyValue(bound);
+      if (!value || !value->IsInt()) return MiscParam::kExpandVariableMaxHops;
+      return std::min(value->ValueInt(), MiscParam::kExpandVariableMaxHops);
+    };
+    auto lower = hops(expand.lower_bound_, 1);
+    auto upper = hops(expand.upper_bound_, MiscParam::kExpandVariableMaxHops);
+    auto fan_out = ExpandFanOut(expand.common_);
+    double paths = 0.0;
+    double paths_of_length = 1.0;
+    for (int64_t length = 1; length <= upper; ++length) {
+      paths_of_length *= fan_out;
+      if (length >= lower) paths += paths_of_length;
+    }
+    if (lower == 0) paths += 1.0;
+    return std::min(paths, std::max(static_cast<double>(statistics_->vertex_count), 1.0));
+  }
+
   // converts an optional ScanAll range bound into a property value
   // if the bound is present and is a constant expression convertible to
   // a property value. otherwise returns nullopt
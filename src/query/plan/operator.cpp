@@ -12,11 +12,21 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
 #include <random>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -34,6 +44,7 @@
 #include "query/interpret/eval.hpp"
 #include "query/path.hpp"
 #include "query/plan/scoped_profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/procedure/cypher_types.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
@@ -42,15 +53,18 @@
 #include "utils/csv_parsing.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/exceptions.hpp"
+#include "utils/flag_validation.hpp"
 #include "utils/fnv.hpp"
 #include "utils/likely.hpp"
 #include "utils/logging.hpp"
+#include "utils/pmr/map.hpp"
 #include "utils/pmr/unordered_map.hpp"
 #include "utils/pmr/unordered_set.hpp"
 #include "utils/pmr/vector.hpp"
 #include "utils/readable_size.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread_pool.hpp"
 
 // macro for the default implementation of LogicalOperator::Accept
 // that accepts the visitor and visits it's input_ operator
@@ -71,6 +85,15 @@
     LOG_FATAL("Operator " #class_name " has no single input!");  \
   }
 
+DEFINE_VALIDATED_uint64(query_bfs_workers, 0,
+                        "Number of threads used by breadth-first expansions to expand large frontiers and to "
+                        "search from several source vertices at once, and by weighted shortest path expansions "
+                        "to relax the edges with the delta-stepping search. Default is 0, which disables them.",
+                        FLAG_IN_RANGE(0, 1024));
+
+// Defined by the rewrite which inserts the `Gather` operators.
+DECLARE_uint64(query_parallel_scan_workers);
+
 namespace EventCounter {
 extern const Event OnceOperator;
 extern const Event CreateNodeOperator;
@@ -80,7 +103,10 @@ extern const Event ScanAllByLabelOperator;
 extern const Event ScanAllByLabelPropertyRangeOperator;
 extern const Event ScanAllByLabelPropertyValueOperator;
 extern const Event ScanAllByLabelPropertyOperator;
+extern const Event ScanAllByLabelPropertiesOperator;
 extern const Event ScanAllByIdOperator;
+extern const Event ScanAllEdgesByTypeOperator;
+extern const Event ScanAllEdgesByTypePropertyOperator;
 extern const Event ExpandOperator;
 extern const Event ExpandVariableOperator;
 extern const Event ConstructNamedPathOperator;
@@ -135,6 +161,42 @@ bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
   return result.ValueBool();
 }
 
+// Number of rows that are pulled at once by cursors which consume their input
+// in batches.
+constexpr size_t kPullBatchSize = 1024;
+
+// Number of partitions to which the rows are spilled by their hash once an
+// operator which accumulates its input uses too much memory.
+constexpr size_t kSpillPartitions = 32;
+
+// Returns true if the operator and all of its inputs can be pulled in batches.
+// Only read-only operators that don't depend on values set on the frame by
+// their consumer are batched, so that pulling ahead doesn't change the results.
+bool SupportsBatchPull(const LogicalOperator &op) {
+  // Gather workers never modify the graph, so pulling ahead is always safe.
+  if (op.GetTypeInfo() == Once::kType || op.GetTypeInfo() == Gather::kType) return true;
+  if (utils::IsSubtype(op, ScanAll::kType) || op.GetTypeInfo() == Filter::kType) {
+    return SupportsBatchPull(*op.input());
+  }
+  return false;
+}
+
+// Makes the cursor of an input which the caller always pulls until it's
+// exhausted. Only such a caller lets a Produce pull its input ahead in batches
+// and a breadth-first search run the searches from a batch of sources at once,
+// because otherwise rows past a LIMIT or rows the client never pulls would be
+// scanned, filtered and expanded, and errors raised while filtering them would
+// fail the query.
+UniqueCursorPtr MakeExhaustedInputCursor(const LogicalOperator &input, utils::MemoryResource *mem) {
+  if (input.GetTypeInfo() == Produce::kType) {
+    return static_cast<const Produce &>(input).MakeBatchedCursor(mem);
+  }
+  if (input.GetTypeInfo() == ExpandVariable::kType) {
+    return static_cast<const ExpandVariable &>(input).MakeBatchedCursor(mem);
+  }
+  return input.MakeCursor(mem);
+}
+
 template <typename T>
 uint64_t ComputeProfilingKey(const T *obj) {
   static_assert(sizeof(T *) == sizeof(uint64_t));
@@ -145,6 +207,14 @@ uint64_t ComputeProfilingKey(const T *obj) {
 
 #define SCOPED_PROFILE_OP(name) ScopedProfile profile{ComputeProfilingKey(this), name, &context};
 
+size_t Cursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  size_t count = 0;
+  while (count < batch.capacity() && Pull(frame, context)) {
+    batch.CopyRow(frame, count++);
+  }
+  return count;
+}
+
 bool Once::OnceCursor::Pull(Frame &, ExecutionContext &context) {
   SCOPED_PROFILE_OP("Once");
 
@@ -408,6 +478,29 @@ class ScanAllCursor : public Cursor {
     return true;
   }
 
+  size_t PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP(op_name_);
+
+    size_t count = 0;
+    while (count < batch.capacity()) {
+      if (MustAbort(context)) throw HintedAbortError();
+      if (!vertices_ || vertices_it_.value() == vertices_.value().end()) {
+        if (!input_cursor_->Pull(frame, context)) break;
+        auto next_vertices = get_vertices_(frame, context);
+        if (!next_vertices) continue;
+        vertices_.emplace(std::move(next_vertices.value()));
+        vertices_it_.emplace(vertices_.value().begin());
+        continue;
+      }
+      frame[output_symbol_] = *vertices_it_.value();
+      ++vertices_it_.value();
+      batch.CopyRow(frame, count++);
+    }
+    // Every row counts as a hit, the call itself already counted as one.
+    if (count > 0) profile.AddHits(count - 1);
+    return count;
+  }
+
   void Shutdown() override { input_cursor_->Shutdown(); }
 
   void Reset() override {
@@ -435,6 +528,9 @@ UniqueCursorPtr ScanAll::MakeCursor(utils::MemoryResource *mem) const {
 
   auto vertices = [this](Frame &, ExecutionContext &context) {
     auto *db = context.db_accessor;
+    if (context.scan_range) {
+      return std::make_optional(db->VerticesInRange(view_, context.scan_range->lower, context.scan_range->upper));
+    }
     return std::make_optional(db->Vertices(view_));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, output_symbol_, input_->MakeCursor(mem),
@@ -467,6 +563,39 @@ UniqueCursorPtr ScanAllByLabel::MakeCursor(utils::MemoryResource *mem) const {
 // TODO(buda): Implement ScanAllByLabelProperty operator to iterate over
 // vertices that have the label and some value for the given property.
 
+namespace {
+
+std::optional<utils::Bound<storage::PropertyValue>> EvaluateRangeBound(
+    const std::optional<utils::Bound<Expression *>> &bound, ExpressionEvaluator *evaluator) {
+  if (!bound) return std::nullopt;
+  const auto &value = bound->value()->Accept(*evaluator);
+  try {
+    const auto &property_value = storage::PropertyValue(value);
+    switch (property_value.type()) {
+      case storage::PropertyValue::Type::Bool:
+      case storage::PropertyValue::Type::List:
+      case storage::PropertyValue::Type::Map:
+        // Prevent indexed lookup with something that would fail if we did
+        // the original filter with `operator<`. Note, for some reason,
+        // Cypher does not support comparing boolean values.
+        throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
+      case storage::PropertyValue::Type::Null:
+      case storage::PropertyValue::Type::Int:
+      case storage::PropertyValue::Type::Double:
+      case storage::PropertyValue::Type::String:
+      case storage::PropertyValue::Type::TemporalData:
+        // These are all fine, there's also Point, Date and Time data types
+        // which were added to Cypher, but we don't have support for those
+        // yet.
+        return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
+    }
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+  }
+}
+
+}  // namespace
+
 ScanAllByLabelPropertyRange::ScanAllByLabelPropertyRange(const std::shared_ptr<LogicalOperator> &input,
                                                          Symbol output_symbol, storage::LabelId label,
                                                          storage::PropertyId property, const std::string &property_name,
@@ -490,35 +619,8 @@ UniqueCursorPtr ScanAllByLabelPropertyRange::MakeCursor(utils::MemoryResource *m
       -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, property_, std::nullopt, std::nullopt))> {
     auto *db = context.db_accessor;
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
-    auto convert = [&evaluator](const auto &bound) -> std::optional<utils::Bound<storage::PropertyValue>> {
-      if (!bound) return std::nullopt;
-      const auto &value = bound->value()->Accept(evaluator);
-      try {
-        const auto &property_value = storage::PropertyValue(value);
-        switch (property_value.type()) {
-          case storage::PropertyValue::Type::Bool:
-          case storage::PropertyValue::Type::List:
-          case storage::PropertyValue::Type::Map:
-            // Prevent indexed lookup with something that would fail if we did
-            // the original filter with `operator<`. Note, for some reason,
-            // Cypher does not support comparing boolean values.
-            throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
-          case storage::PropertyValue::Type::Null:
-          case storage::PropertyValue::Type::Int:
-          case storage::PropertyValue::Type::Double:
-          case storage::PropertyValue::Type::String:
-          case storage::PropertyValue::Type::TemporalData:
-            // These are all fine, there's also Point, Date and Time data types
-            // which were added to Cypher, but we don't have support for those
-            // yet.
-            return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
-        }
-      } catch (const TypedValueException &) {
-        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
-      }
-    };
-    auto maybe_lower = convert(lower_bound_);
-    auto maybe_upper = convert(upper_bound_);
+    auto maybe_lower = EvaluateRangeBound(lower_bound_, &evaluator);
+    auto maybe_upper = EvaluateRangeBound(upper_bound_, &evaluator);
     // If any bound is null, then the comparison would result in nulls. This
     // is treated as not satisfying the filter, so return no vertices.
     if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
@@ -579,6 +681,54 @@ UniqueCursorPtr ScanAllByLabelProperty::MakeCursor(utils::MemoryResource *mem) c
                                                                 std::move(vertices), "ScanAllByLabelProperty");
 }
 
+ScanAllByLabelProperties::ScanAllByLabelProperties(const std::shared_ptr<LogicalOperator> &input,
+                                                   Symbol output_symbol, storage::LabelId label,
+                                                   const std::vector<storage::PropertyId> &properties,
+                                                   const std::vector<Expression *> &expressions,
+                                                   std::optional<Bound> lower_bound, std::optional<Bound> upper_bound,
+                                                   storage::View view)
+    : ScanAll(input, output_symbol, view),
+      label_(label),
+      properties_(properties),
+      expressions_(expressions),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(expressions_.size() <= properties_.size(), "The prefix is longer than the index");
+  MG_ASSERT(expressions_.size() < properties_.size() || (!lower_bound_ && !upper_bound_),
+            "A range can only be given for a property following the prefix");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByLabelProperties)
+
+UniqueCursorPtr ScanAllByLabelProperties::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ScanAllByLabelPropertiesOperator);
+
+  auto vertices = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, properties_, {}, std::nullopt,
+                                                              std::nullopt))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    std::vector<storage::PropertyValue> prefix;
+    prefix.reserve(expressions_.size());
+    for (auto *expression : expressions_) {
+      auto value = expression->Accept(evaluator);
+      // Null is never equal to anything, so no vertices satisfy the filter.
+      if (value.IsNull()) return std::nullopt;
+      if (!value.IsPropertyValue()) {
+        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+      }
+      prefix.emplace_back(value);
+    }
+    auto maybe_lower = EvaluateRangeBound(lower_bound_, &evaluator);
+    auto maybe_upper = EvaluateRangeBound(upper_bound_, &evaluator);
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return std::make_optional(db->Vertices(view_, label_, properties_, prefix, maybe_lower, maybe_upper));
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, output_symbol_, input_->MakeCursor(mem),
+                                                                std::move(vertices), "ScanAllByLabelProperties");
+}
+
 ScanAllById::ScanAllById(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, Expression *expression,
                          storage::View view)
     : ScanAll(input, output_symbol, view), expression_(expression) {
@@ -605,6 +755,126 @@ UniqueCursorPtr ScanAllById::MakeCursor(utils::MemoryResource *mem) const {
                                                                 std::move(vertices), "ScanAllById");
 }
 
+template <class TEdgesFun>
+class ScanAllEdgesCursor : public Cursor {
+ public:
+  explicit ScanAllEdgesCursor(const ScanAllEdgesByType &self, UniqueCursorPtr input_cursor, TEdgesFun get_edges,
+                              const char *op_name)
+      : self_(self), input_cursor_(std::move(input_cursor)), get_edges_(std::move(get_edges)), op_name_(op_name) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP(op_name_);
+
+    if (MustAbort(context)) throw HintedAbortError();
+
+    while (!edges_ || edges_it_.value() == edges_.value().end()) {
+      if (!input_cursor_->Pull(frame, context)) return false;
+      auto next_edges = get_edges_(frame, context);
+      if (!next_edges) continue;
+      edges_.emplace(std::move(next_edges.value()));
+      edges_it_.emplace(edges_.value().begin());
+    }
+
+    auto edge = *edges_it_.value();
+    frame[self_.from_symbol_] = edge.From();
+    frame[self_.to_symbol_] = edge.To();
+    frame[self_.edge_symbol_] = edge;
+    ++edges_it_.value();
+    return true;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    edges_ = std::nullopt;
+    edges_it_ = std::nullopt;
+  }
+
+ private:
+  const ScanAllEdgesByType &self_;
+  const UniqueCursorPtr input_cursor_;
+  TEdgesFun get_edges_;
+  std::optional<typename std::result_of<TEdgesFun(Frame &, ExecutionContext &)>::type::value_type> edges_;
+  std::optional<decltype(edges_.value().begin())> edges_it_;
+  const char *op_name_;
+};
+
+ScanAllEdgesByType::ScanAllEdgesByType(const std::shared_ptr<LogicalOperator> &input, Symbol edge_symbol,
+                                       Symbol from_symbol, Symbol to_symbol, storage::EdgeTypeId edge_type,
+                                       storage::View view)
+    : input_(input ? input : std::make_shared<Once>()),
+      edge_symbol_(edge_symbol),
+      from_symbol_(from_symbol),
+      to_symbol_(to_symbol),
+      edge_type_(edge_type),
+      view_(view) {}
+
+ACCEPT_WITH_INPUT(ScanAllEdgesByType)
+
+UniqueCursorPtr ScanAllEdgesByType::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ScanAllEdgesByTypeOperator);
+
+  auto edges = [this](Frame &, ExecutionContext &context) {
+    auto *db = context.db_accessor;
+    return std::make_optional(db->Edges(view_, edge_type_));
+  };
+  return MakeUniqueCursorPtr<ScanAllEdgesCursor<decltype(edges)>>(mem, *this, input_->MakeCursor(mem),
+                                                                  std::move(edges), "ScanAllEdgesByType");
+}
+
+std::vector<Symbol> ScanAllEdgesByType::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  symbols.emplace_back(edge_symbol_);
+  symbols.emplace_back(from_symbol_);
+  symbols.emplace_back(to_symbol_);
+  return symbols;
+}
+
+ScanAllEdgesByTypeProperty::ScanAllEdgesByTypeProperty(const std::shared_ptr<LogicalOperator> &input,
+                                                       Symbol edge_symbol, Symbol from_symbol, Symbol to_symbol,
+                                                       storage::EdgeTypeId edge_type, storage::PropertyId property,
+                                                       const std::string &property_name, Expression *expression,
+                                                       std::optional<Bound> lower_bound,
+                                                       std::optional<Bound> upper_bound, storage::View view)
+    : ScanAllEdgesByType(input, edge_symbol, from_symbol, to_symbol, edge_type, view),
+      property_(property),
+      property_name_(property_name),
+      expression_(expression),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(expression_ || lower_bound_ || upper_bound_, "Either a value or a range is required");
+  MG_ASSERT(!expression_ || (!lower_bound_ && !upper_bound_), "A value and a range can't be used together");
+}
+
+ACCEPT_WITH_INPUT(ScanAllEdgesByTypeProperty)
+
+UniqueCursorPtr ScanAllEdgesByTypeProperty::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ScanAllEdgesByTypePropertyOperator);
+
+  auto edges = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Edges(view_, edge_type_, property_, std::nullopt,
+                                                           std::nullopt))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    if (expression_) {
+      auto value = expression_->Accept(evaluator);
+      if (value.IsNull()) return std::nullopt;
+      if (!value.IsPropertyValue()) {
+        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+      }
+      return std::make_optional(db->Edges(view_, edge_type_, property_, storage::PropertyValue(value)));
+    }
+    auto maybe_lower = EvaluateRangeBound(lower_bound_, &evaluator);
+    auto maybe_upper = EvaluateRangeBound(upper_bound_, &evaluator);
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return std::make_optional(db->Edges(view_, edge_type_, property_, maybe_lower, maybe_upper));
+  };
+  return MakeUniqueCursorPtr<ScanAllEdgesCursor<decltype(edges)>>(mem, *this, input_->MakeCursor(mem),
+                                                                  std::move(edges), "ScanAllEdgesByTypeProperty");
+}
+
 namespace {
 bool CheckExistingNode(const VertexAccessor &new_node, const Symbol &existing_node_sym, Frame &frame) {
   const TypedValue &existing_node = frame[existing_node_sym];
@@ -1053,10 +1323,217 @@ class ExpandVariableCursor : public Cursor {
   }
 };
 
+namespace {
+
+// Frontiers with fewer vertices than this are expanded by the query thread
+// alone, because handing them over to the BFS workers costs more than it
+// saves.
+constexpr size_t kParallelBfsMinFrontier = 1024;
+// Number of frontier vertices which a BFS worker expands at once.
+constexpr size_t kParallelBfsChunkSize = 256;
+
+utils::ThreadPool &BfsThreadPool() {
+  // The calling thread also takes part in the work, so one thread less is
+  // needed in the pool.
+  static utils::ThreadPool pool(std::max<uint64_t>(FLAGS_query_bfs_workers, 1) - 1);
+  return pool;
+}
+
+// Calls `func(i)` for every `i` in [0, count) on the BFS worker pool and the
+// calling thread and returns once all calls have finished. The first
+// exception thrown by any of the calls is rethrown and the calls which didn't
+// start yet are skipped.
+template <typename TFunc>
+void ParallelBfsFor(size_t count, const TFunc &func) {
+  if (count == 0) return;
+  std::atomic<size_t> next{0};
+  std::mutex lock;
+  std::condition_variable cv;
+  std::exception_ptr error;
+  auto run = [&] {
+    try {
+      for (auto i = next.fetch_add(1); i < count; i = next.fetch_add(1)) func(i);
+    } catch (...) {
+      std::lock_guard guard(lock);
+      if (!error) error = std::current_exception();
+      next.store(count);
+    }
+  };
+  const auto helpers = std::min<size_t>(std::max<uint64_t>(FLAGS_query_bfs_workers, 1) - 1, count - 1);
+  size_t running = helpers;
+  for (size_t i = 0; i < helpers; ++i) {
+    BfsThreadPool().AddTask([&] {
+      run();
+      // Notifying while holding the lock guarantees that the waiting thread
+      // can't destroy the condition variable before the notification is done.
+      std::lock_guard guard(lock);
+      --running;
+      cv.notify_one();
+    });
+  }
+  run();
+  std::unique_lock guard(lock);
+  cv.wait(guard, [&] { return running == 0; });
+  if (error) std::rethrow_exception(error);
+}
+
+// Set of the vertices reached by a breadth-first search. Gids are assigned
+// from a counter, so the set is a bitmap indexed by the gid, which is a lot
+// smaller and faster than a hash set of vertex accessors. The bitmap only
+// covers the gids up to a bound proportional to the number of vertices, so
+// that its size doesn't depend on how many vertices were ever created. The
+// vertices with larger gids are kept in a hash set. Lookups may run
+// concurrently, but insertions must not run concurrently with anything else.
+class VisitedVertices {
+ public:
+  explicit VisitedVertices(utils::MemoryResource *memory) : bits_(memory), overflow_(memory) {}
+
+  // Sets the gid bound of the bitmap for the graph with `vertex_count`
+  // vertices. May only be called when the set is empty.
+  void SetVertexCount(int64_t vertex_count) {
+    bitmap_gids_ = static_cast<uint64_t>(std::max<int64_t>(vertex_count, 0)) * kBitmapGidsPerVertex + kMinBitmapGids;
+  }
+
+  bool Contains(const VertexAccessor &vertex) const {
+    const auto gid = vertex.Gid().AsUint();
+    if (gid >= bitmap_gids_) return overflow_.count(gid) != 0;
+    return gid / 64 < bits_.size() && (bits_[gid / 64] & (uint64_t{1} << (gid % 64))) != 0;
+  }
+
+  void Insert(const VertexAccessor &vertex) {
+    const auto gid = vertex.Gid().AsUint();
+    if (gid >= bitmap_gids_) {
+      overflow_.insert(gid);
+      return;
+    }
+    if (gid / 64 >= bits_.size()) {
+      bits_.resize(std::min<size_t>(std::max<size_t>(gid / 64 + 1, 2 * bits_.size()), (bitmap_gids_ + 63) / 64));
+    }
+    bits_[gid / 64] |= uint64_t{1} << (gid % 64);
+  }
+
+  // Removes the vertices of the given search tree. This is cheaper than
+  // clearing the whole bitmap when only a few vertices were reached.
+  template <typename TTree>
+  void Erase(const TTree &tree) {
+    for (const auto &node : tree) {
+      const auto gid = node.vertex.Gid().AsUint();
+      if (gid >= bitmap_gids_) {
+        overflow_.erase(gid);
+      } else if (gid / 64 < bits_.size()) {
+        bits_[gid / 64] = 0;
+      }
+    }
+  }
+
+ private:
+  // The bitmap takes at most a byte per vertex, but the first 64Ki gids are
+  // always kept in it.
+  static constexpr uint64_t kBitmapGidsPerVertex = 8;
+  static constexpr uint64_t kMinBitmapGids = 64 * 1024;
+
+  uint64_t bitmap_gids_{kMinBitmapGids};
+  utils::pmr::vector<uint64_t> bits_;
+  utils::pmr::unordered_set<uint64_t> overflow_;
+};
+
+// Vertex reached by a breadth-first search. The reached vertices form a tree
+// in which every vertex points to the vertex from which it was reached.
+struct BfsNode {
+  VertexAccessor vertex;
+  // The edge through which the vertex was reached, nullopt for the root.
+  std::optional<EdgeAccessor> edge;
+  // Index of the vertex from which the vertex was reached.
+  size_t parent;
+};
+
+// Edge through which the tree node at index `parent` can be expanded to
+// `vertex`.
+struct BfsExpansion {
+  EdgeAccessor edge;
+  VertexAccessor vertex;
+  size_t parent;
+};
+
+EdgeAtom::Direction ReverseDirection(EdgeAtom::Direction direction) {
+  if (direction == EdgeAtom::Direction::IN) return EdgeAtom::Direction::OUT;
+  if (direction == EdgeAtom::Direction::OUT) return EdgeAtom::Direction::IN;
+  return direction;
+}
+
+void CollectBfsExpansions(const BfsNode &node, size_t index, EdgeAtom::Direction direction,
+                          const std::vector<storage::EdgeTypeId> &edge_types, const VisitedVertices &visited,
+                          std::vector<BfsExpansion> *expansions) {
+  if (direction != EdgeAtom::Direction::IN) {
+    auto out_edges = UnwrapEdgesResult(node.vertex.OutEdges(storage::View::OLD, edge_types));
+    for (const auto &edge : out_edges) {
+      if (!visited.Contains(edge.To())) expansions->push_back(BfsExpansion{edge, edge.To(), index});
+    }
+  }
+  if (direction != EdgeAtom::Direction::OUT) {
+    auto in_edges = UnwrapEdgesResult(node.vertex.InEdges(storage::View::OLD, edge_types));
+    for (const auto &edge : in_edges) {
+      if (!visited.Contains(edge.From())) expansions->push_back(BfsExpansion{edge, edge.From(), index});
+    }
+  }
+}
+
+// Collects the edges through which the `frontier` nodes of the `tree` can be
+// expanded to vertices which aren't `visited` yet. The expansions are returned
+// in the order of the frontier nodes and their edges. When `parallel` is set,
+// large frontiers are split into chunks which are expanded by the BFS workers.
+std::vector<BfsExpansion> CollectBfsExpansions(const std::vector<BfsNode> &tree, const std::vector<size_t> &frontier,
+                                               EdgeAtom::Direction direction,
+                                               const std::vector<storage::EdgeTypeId> &edge_types,
+                                               const VisitedVertices &visited, bool parallel) {
+  std::vector<BfsExpansion> expansions;
+  if (!parallel || FLAGS_query_bfs_workers <= 1 || frontier.size() < kParallelBfsMinFrontier) {
+    for (auto index : frontier) CollectBfsExpansions(tree[index], index, direction, edge_types, visited, &expansions);
+    return expansions;
+  }
+  std::vector<std::vector<BfsExpansion>> chunks((frontier.size() + kParallelBfsChunkSize - 1) / kParallelBfsChunkSize);
+  ParallelBfsFor(chunks.size(), [&](size_t chunk) {
+    const auto end = std::min(frontier.size(), (chunk + 1) * kParallelBfsChunkSize);
+    for (auto i = chunk * kParallelBfsChunkSize; i < end; ++i) {
+      CollectBfsExpansions(tree[frontier[i]], frontier[i], direction, edge_types, visited, &chunks[chunk]);
+    }
+  });
+  for (auto &chunk : chunks) {
+    expansions.insert(expansions.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+  }
+  return expansions;
+}
+
+// Expands the `level` nodes of the breadth-first search `tree` and returns the
+// indices of the newly reached nodes in the order in which they were reached.
+// Each vertex is reached through the first edge for which `should_expand`
+// returns true, in the order of the level nodes and their edges.
+template <typename TShouldExpand>
+std::vector<size_t> ExpandBfsLevel(std::vector<BfsNode> *tree, const std::vector<size_t> &level,
+                                   EdgeAtom::Direction direction, const std::vector<storage::EdgeTypeId> &edge_types,
+                                   VisitedVertices *visited, bool parallel, const TShouldExpand &should_expand) {
+  std::vector<size_t> reached;
+  for (auto &expansion : CollectBfsExpansions(*tree, level, direction, edge_types, *visited, parallel)) {
+    if (visited->Contains(expansion.vertex) || !should_expand(expansion.edge, expansion.vertex)) continue;
+    visited->Insert(expansion.vertex);
+    tree->push_back(BfsNode{std::move(expansion.vertex), std::move(expansion.edge), expansion.parent});
+    reached.push_back(tree->size() - 1);
+  }
+  return reached;
+}
+
+// Appends the edges on the path from the node at `index` to the root of the
+// `tree`.
+void AppendBfsPath(const std::vector<BfsNode> &tree, size_t index, utils::pmr::vector<TypedValue> *edges) {
+  for (; tree[index].edge; index = tree[index].parent) edges->emplace_back(*tree[index].edge);
+}
+
+}  // namespace
+
 class STShortestPathCursor : public query::plan::Cursor {
  public:
   STShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input()->MakeCursor(mem)) {
+      : self_(self), input_cursor_(self_.input()->MakeCursor(mem)), source_visited_(mem), sink_visited_(mem) {
     MG_ASSERT(self_.common_.existing_node,
               "s-t shortest path algorithm should only "
               "be used when `existing_node` flag is "
@@ -1087,7 +1564,7 @@ class STShortestPathCursor : public query::plan::Cursor {
 
       if (upper_bound < 1 || lower_bound > upper_bound) continue;
 
-      if (FindPath(*context.db_accessor, source, sink, lower_bound, upper_bound, &frame, &evaluator, context)) {
+      if (FindPath(source, sink, lower_bound, upper_bound, &frame, &evaluator, context)) {
         return true;
       }
     }
@@ -1096,32 +1573,44 @@ class STShortestPathCursor : public query::plan::Cursor {
 
   void Shutdown() override { input_cursor_->Shutdown(); }
 
-  void Reset() override { input_cursor_->Reset(); }
+  void Reset() override {
+    input_cursor_->Reset();
+    ClearSearch();
+  }
 
  private:
   const ExpandVariable &self_;
   UniqueCursorPtr input_cursor_;
 
-  using VertexEdgeMapT = utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>>;
+  // Vertices reached expanding from the source (sink), their visited sets
+  // and the indices of the vertices at the current level of expansion. The
+  // trees are kept between the searches so that the visited sets can be
+  // cleared cheaply.
+  std::vector<BfsNode> source_tree_;
+  std::vector<BfsNode> sink_tree_;
+  VisitedVertices source_visited_;
+  VisitedVertices sink_visited_;
+  std::vector<size_t> source_frontier_;
+  std::vector<size_t> sink_frontier_;
+
+  void ClearSearch() {
+    source_visited_.Erase(source_tree_);
+    sink_visited_.Erase(sink_tree_);
+    source_tree_.clear();
+    sink_tree_.clear();
+    source_frontier_.clear();
+    sink_frontier_.clear();
+  }
 
-  void ReconstructPath(const VertexAccessor &midpoint, const VertexEdgeMapT &in_edge, const VertexEdgeMapT &out_edge,
-                       Frame *frame, utils::MemoryResource *pull_memory) {
+  void ReconstructPath(const VertexAccessor &midpoint, Frame *frame, utils::MemoryResource *pull_memory) {
+    auto find_midpoint = [&midpoint](const std::vector<BfsNode> &tree) {
+      return std::find_if(tree.begin(), tree.end(), [&midpoint](const auto &node) { return node.vertex == midpoint; }) -
+             tree.begin();
+    };
     utils::pmr::vector<TypedValue> result(pull_memory);
-    auto last_vertex = midpoint;
-    while (true) {
-      const auto &last_edge = in_edge.at(last_vertex);
-      if (!last_edge) break;
-      last_vertex = last_edge->From() == last_vertex ? last_edge->To() : last_edge->From();
-      result.emplace_back(*last_edge);
-    }
+    AppendBfsPath(source_tree_, find_midpoint(source_tree_), &result);
     std::reverse(result.begin(), result.end());
-    last_vertex = midpoint;
-    while (true) {
-      const auto &last_edge = out_edge.at(last_vertex);
-      if (!last_edge) break;
-      last_vertex = last_edge->From() == last_vertex ? last_edge->To() : last_edge->From();
-      result.emplace_back(*last_edge);
-    }
+    AppendBfsPath(sink_tree_, find_midpoint(sink_tree_), &result);
     frame->at(self_.common_.edge_symbol) = std::move(result);
   }
 
@@ -1139,10 +1628,45 @@ class STShortestPathCursor : public query::plan::Cursor {
     throw QueryRuntimeException("Expansion condition must evaluate to boolean or null");
   }
 
-  bool FindPath(const DbAccessor &dba, const VertexAccessor &source, const VertexAccessor &sink, int64_t lower_bound,
-                int64_t upper_bound, Frame *frame, ExpressionEvaluator *evaluator, const ExecutionContext &context) {
-    using utils::Contains;
+  // Expands the frontier of the source (sink) side by one level. Returns
+  // whether the path was found once the expansions meet or once the frontier
+  // can't be expanded anymore and nullopt otherwise.
+  std::optional<bool> ExpandFrontier(bool from_source, int64_t current_length, int64_t lower_bound, Frame *frame,
+                                     ExpressionEvaluator *evaluator) {
+    auto &tree = from_source ? source_tree_ : sink_tree_;
+    auto &visited = from_source ? source_visited_ : sink_visited_;
+    const auto &other_visited = from_source ? sink_visited_ : source_visited_;
+    auto &frontier = from_source ? source_frontier_ : sink_frontier_;
+    const auto direction = from_source ? self_.common_.direction : ReverseDirection(self_.common_.direction);
+
+    // The edges of the frontier are collected in parallel, while the visited
+    // sets are updated, the filter evaluated and the meeting point searched
+    // for in the order of the serial expansion, so the result is the same.
+    auto expansions = CollectBfsExpansions(tree, frontier, direction, self_.common_.edge_types, visited, true);
+    frontier.clear();
+    for (auto &expansion : expansions) {
+      // When expanding from the sink we have to be careful which edge
+      // endpoint we pass to `should_expand`, because everything is
+      // reversed.
+      const auto &filter_vertex = from_source ? expansion.vertex : tree[expansion.parent].vertex;
+      if (!ShouldExpand(filter_vertex, expansion.edge, frame, evaluator) || visited.Contains(expansion.vertex)) {
+        continue;
+      }
+      visited.Insert(expansion.vertex);
+      tree.push_back(BfsNode{expansion.vertex, std::move(expansion.edge), expansion.parent});
+      if (other_visited.Contains(expansion.vertex)) {
+        if (current_length < lower_bound) return false;
+        ReconstructPath(expansion.vertex, frame, evaluator->GetMemoryResource());
+        return true;
+      }
+      frontier.push_back(tree.size() - 1);
+    }
+    if (frontier.empty()) return false;
+    return std::nullopt;
+  }
 
+  bool FindPath(const VertexAccessor &source, const VertexAccessor &sink, int64_t lower_bound, int64_t upper_bound,
+                Frame *frame, ExpressionEvaluator *evaluator, const ExecutionContext &context) {
     if (source == sink) return false;
 
     // We expand from both directions, both from the source and the sink.
@@ -1150,135 +1674,48 @@ class STShortestPathCursor : public query::plan::Cursor {
     // perform better for real-world like graphs where the expansion front
     // grows exponentially, effectively reducing the exponent by half.
 
-    auto *pull_memory = evaluator->GetMemoryResource();
-    // Holds vertices at the current level of expansion from the source
-    // (sink).
-    utils::pmr::vector<VertexAccessor> source_frontier(pull_memory);
-    utils::pmr::vector<VertexAccessor> sink_frontier(pull_memory);
-
-    // Holds vertices we can expand to from `source_frontier`
-    // (`sink_frontier`).
-    utils::pmr::vector<VertexAccessor> source_next(pull_memory);
-    utils::pmr::vector<VertexAccessor> sink_next(pull_memory);
-
-    // Maps each vertex we visited expanding from the source (sink) to the
-    // edge used. Necessary for path reconstruction.
-    VertexEdgeMapT in_edge(pull_memory);
-    VertexEdgeMapT out_edge(pull_memory);
-
-    size_t current_length = 0;
-
-    source_frontier.emplace_back(source);
-    in_edge[source] = std::nullopt;
-    sink_frontier.emplace_back(sink);
-    out_edge[sink] = std::nullopt;
-
+    ClearSearch();
+    const auto vertex_count = context.db_accessor->VerticesCount();
+    source_visited_.SetVertexCount(vertex_count);
+    sink_visited_.SetVertexCount(vertex_count);
+    source_tree_.push_back(BfsNode{source, std::nullopt, 0});
+    source_visited_.Insert(source);
+    source_frontier_.push_back(0);
+    sink_tree_.push_back(BfsNode{sink, std::nullopt, 0});
+    sink_visited_.Insert(sink);
+    sink_frontier_.push_back(0);
+
+    int64_t current_length = 0;
     while (true) {
       if (MustAbort(context)) throw HintedAbortError();
       // Top-down step (expansion from the source).
       ++current_length;
       if (current_length > upper_bound) return false;
-
-      for (const auto &vertex : source_frontier) {
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : out_edges) {
-            if (ShouldExpand(edge.To(), edge, frame, evaluator) && !Contains(in_edge, edge.To())) {
-              in_edge.emplace(edge.To(), edge);
-              if (Contains(out_edge, edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.To());
-            }
-          }
-        }
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : in_edges) {
-            if (ShouldExpand(edge.From(), edge, frame, evaluator) && !Contains(in_edge, edge.From())) {
-              in_edge.emplace(edge.From(), edge);
-              if (Contains(out_edge, edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.From());
-            }
-          }
-        }
-      }
-
-      if (source_next.empty()) return false;
-      source_frontier.clear();
-      std::swap(source_frontier, source_next);
+      if (auto found = ExpandFrontier(true, current_length, lower_bound, frame, evaluator)) return *found;
 
       // Bottom-up step (expansion from the sink).
       ++current_length;
       if (current_length > upper_bound) return false;
-
-      // When expanding from the sink we have to be careful which edge
-      // endpoint we pass to `should_expand`, because everything is
-      // reversed.
-      for (const auto &vertex : sink_frontier) {
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : out_edges) {
-            if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.To())) {
-              out_edge.emplace(edge.To(), edge);
-              if (Contains(in_edge, edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.To());
-            }
-          }
-        }
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : in_edges) {
-            if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.From())) {
-              out_edge.emplace(edge.From(), edge);
-              if (Contains(in_edge, edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.From());
-            }
-          }
-        }
-      }
-
-      if (sink_next.empty()) return false;
-      sink_frontier.clear();
-      std::swap(sink_frontier, sink_next);
+      if (auto found = ExpandFrontier(false, current_length, lower_bound, frame, evaluator)) return *found;
     }
   }
 };
 
 class SingleSourceShortestPathCursor : public query::plan::Cursor {
  public:
-  SingleSourceShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
+  SingleSourceShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem, bool batch_sources)
       : self_(self),
         input_cursor_(self_.input()->MakeCursor(mem)),
-        processed_(mem),
-        to_visit_current_(mem),
-        to_visit_next_(mem) {
+        // Without a filter lambda the searches don't touch the frame, so
+        // the searches from a batch of sources can run on the BFS workers
+        // at once. The input and the searches only see the old state of
+        // the graph, so the changes made by the consumer can't affect the
+        // rows pulled ahead. The searches are run ahead of the consumer, so
+        // this is only done when the consumer pulls all rows.
+        batched_(batch_sources && FLAGS_query_bfs_workers > 1 && !self_.filter_lambda_.expression &&
+                 SupportsBatchPull(*self_.input())),
+        visited_memory_(128, 1024, mem),
+        search_(&visited_memory_) {
     MG_ASSERT(!self_.common_.existing_node,
               "Single source shortest path algorithm "
               "should not be used when `existing_node` "
@@ -1289,144 +1726,482 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("SingleSourceShortestPath");
 
+    if (batched_) return PullBatched(frame, context);
+
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                   storage::View::OLD);
 
-    // for the given (edge, vertex) pair checks if they satisfy the
-    // "where" condition. if so, places them in the to_visit_ structure.
-    auto expand_pair = [this, &evaluator, &frame](EdgeAccessor edge, VertexAccessor vertex) {
-      // if we already processed the given vertex it doesn't get expanded
-      if (processed_.find(vertex) != processed_.end()) return;
+    // checks if the given (edge, vertex) pair satisfies the "where"
+    // condition.
+    auto should_expand = [this, &evaluator, &frame](const EdgeAccessor &edge, const VertexAccessor &vertex) {
+      if (!self_.filter_lambda_.expression) return true;
 
       frame[self_.filter_lambda_.inner_edge_symbol] = edge;
       frame[self_.filter_lambda_.inner_node_symbol] = vertex;
 
-      if (self_.filter_lambda_.expression) {
-        TypedValue result = self_.filter_lambda_.expression->Accept(evaluator);
-        switch (result.type()) {
-          case TypedValue::Type::Null:
-            return;
-          case TypedValue::Type::Bool:
-            if (!result.ValueBool()) return;
-            break;
-          default:
-            throw QueryRuntimeException("Expansion condition must evaluate to boolean or null.");
-        }
-      }
-      to_visit_next_.emplace_back(edge, vertex);
-      processed_.emplace(vertex, edge);
-    };
-
-    // populates the to_visit_next_ structure with expansions
-    // from the given vertex. skips expansions that don't satisfy
-    // the "where" condition.
-    auto expand_from_vertex = [this, &expand_pair](const auto &vertex) {
-      if (self_.common_.direction != EdgeAtom::Direction::IN) {
-        auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
-        for (const auto &edge : out_edges) expand_pair(edge, edge.To());
-      }
-      if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-        auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
-        for (const auto &edge : in_edges) expand_pair(edge, edge.From());
+      TypedValue result = self_.filter_lambda_.expression->Accept(evaluator);
+      switch (result.type()) {
+        case TypedValue::Type::Null:
+          return false;
+        case TypedValue::Type::Bool:
+          return result.ValueBool();
+        default:
+          throw QueryRuntimeException("Expansion condition must evaluate to boolean or null.");
       }
     };
 
     // do it all in a loop because we skip some elements
     while (true) {
       if (MustAbort(context)) throw HintedAbortError();
-      // if we have nothing to visit on the current depth, switch to next
-      if (to_visit_current_.empty()) to_visit_current_.swap(to_visit_next_);
 
-      // if current is still empty, it means both are empty, so pull from
-      // input
-      if (to_visit_current_.empty()) {
-        if (!input_cursor_->Pull(frame, context)) return false;
+      // yield the vertices of the current depth
+      if (yield_index_ < search_.level.size()) {
+        Yield(search_.tree, search_.level[yield_index_++], frame, context);
+        return true;
+      }
 
-        to_visit_current_.clear();
-        to_visit_next_.clear();
-        processed_.clear();
+      // expand the current depth if it is less than max depth
+      if (!search_.level.empty() && search_.depth < search_.upper_bound) {
+        ExpandLevel(&search_, true, should_expand);
+        yield_index_ = search_.depth < search_.lower_bound ? search_.level.size() : 0;
+        continue;
+      }
 
-        const auto &vertex_value = frame[self_.input_symbol_];
-        // it is possible that the vertex is Null due to optional matching
-        if (vertex_value.IsNull()) continue;
-        lower_bound_ = self_.lower_bound_
-                           ? EvaluateInt(&evaluator, self_.lower_bound_, "Min depth in breadth-first expansion")
-                           : 1;
-        upper_bound_ = self_.upper_bound_
-                           ? EvaluateInt(&evaluator, self_.upper_bound_, "Max depth in breadth-first expansion")
-                           : std::numeric_limits<int64_t>::max();
+      // nothing left to expand, so pull from input
+      if (!input_cursor_->Pull(frame, context)) return false;
+      search_.Clear();
+      yield_index_ = 0;
+
+      const auto &vertex_value = frame[self_.input_symbol_];
+      // it is possible that the vertex is Null due to optional matching
+      if (vertex_value.IsNull()) continue;
+      if (!EvaluateBounds(&evaluator, &search_)) continue;
+      search_.Start(vertex_value.ValueVertex(), context.db_accessor->VerticesCount());
+      // the source itself isn't yielded
+      yield_index_ = search_.level.size();
+    }
+  }
 
-        if (upper_bound_ < 1 || lower_bound_ > upper_bound_) continue;
+  void Shutdown() override { input_cursor_->Shutdown(); }
 
-        const auto &vertex = vertex_value.ValueVertex();
-        processed_.emplace(vertex, std::nullopt);
-        expand_from_vertex(vertex);
+  void Reset() override {
+    input_cursor_->Reset();
+    search_.Clear();
+    yield_index_ = 0;
+    for (auto &search : searches_) search.Clear();
+    batch_size_ = 0;
+    batch_index_ = 0;
+  }
 
-        // go back to loop start and see if we expanded anything
-        continue;
+ private:
+  // Breadth-first search from a single source vertex.
+  struct Search {
+    explicit Search(utils::MemoryResource *memory) : visited(memory) {}
+
+    // Depth bounds. Calculated on each pull from the input, the initial
+    // value is irrelevant.
+    int64_t lower_bound{-1};
+    int64_t upper_bound{-1};
+
+    // all the vertices reached so far with the edges they got reached
+    // through, and their visited set.
+    std::vector<BfsNode> tree;
+    VisitedVertices visited;
+    // indices of the tree nodes at the current depth, in the order in which
+    // they are yielded and expanded.
+    std::vector<size_t> level;
+    int64_t depth{0};
+    // used in batched mode, indices of all the tree nodes in the order in
+    // which they are yielded.
+    std::vector<size_t> yielded;
+
+    void Start(const VertexAccessor &source, int64_t vertex_count) {
+      visited.SetVertexCount(vertex_count);
+      tree.push_back(BfsNode{source, std::nullopt, 0});
+      visited.Insert(source);
+      level.push_back(0);
+      depth = 0;
+    }
+
+    void Clear() {
+      visited.Erase(tree);
+      tree.clear();
+      level.clear();
+      yielded.clear();
+    }
+  };
+
+  const ExpandVariable &self_;
+  const UniqueCursorPtr input_cursor_;
+  const bool batched_;
+
+  // The visited sets are allocated from the query memory. The searches of a
+  // batch run on the BFS workers at once, so the allocations are
+  // synchronized.
+  utils::SynchronizedPoolResource visited_memory_;
+
+  Search search_;
+  size_t yield_index_{0};
+
+  // The state of the batched mode, in which a search is done for each row of
+  // the input batch.
+  std::optional<FrameBatch> batch_;
+  std::vector<Search> searches_;
+  size_t batch_size_{0};
+  size_t batch_index_{0};
+
+  bool EvaluateBounds(ExpressionEvaluator *evaluator, Search *search) {
+    search->lower_bound = self_.lower_bound_
+                              ? EvaluateInt(evaluator, self_.lower_bound_, "Min depth in breadth-first expansion")
+                              : 1;
+    search->upper_bound = self_.upper_bound_
+                              ? EvaluateInt(evaluator, self_.upper_bound_, "Max depth in breadth-first expansion")
+                              : std::numeric_limits<int64_t>::max();
+    return search->upper_bound >= 1 && search->lower_bound <= search->upper_bound;
+  }
+
+  template <typename TShouldExpand>
+  void ExpandLevel(Search *search, bool parallel, const TShouldExpand &should_expand) {
+    auto reached = ExpandBfsLevel(&search->tree, search->level, self_.common_.direction, self_.common_.edge_types,
+                                  &search->visited, parallel, should_expand);
+    // The vertices are yielded and expanded in the reverse order of reaching
+    // them, which was the order of the stack used before.
+    std::reverse(reached.begin(), reached.end());
+    search->level = std::move(reached);
+    ++search->depth;
+  }
+
+  // Runs the whole search, collecting the vertices to yield.
+  void RunSearch(Search *search, bool parallel, const ExecutionContext &context) {
+    auto should_expand = [](const EdgeAccessor &, const VertexAccessor &) { return true; };
+    while (!search->level.empty() && search->depth < search->upper_bound) {
+      if (MustAbort(context)) throw HintedAbortError();
+      ExpandLevel(search, parallel, should_expand);
+      if (search->depth >= search->lower_bound) {
+        search->yielded.insert(search->yielded.end(), search->level.begin(), search->level.end());
       }
+    }
+  }
 
-      // take the next expansion from the queue
-      auto expansion = to_visit_current_.back();
-      to_visit_current_.pop_back();
+  void Yield(const std::vector<BfsNode> &tree, size_t index, Frame &frame, ExecutionContext &context) {
+    // create the frame value for the edges
+    utils::pmr::vector<TypedValue> edge_list(context.evaluation_context.memory);
+    AppendBfsPath(tree, index, &edge_list);
+    frame[self_.common_.node_symbol] = tree[index].vertex;
 
-      // create the frame value for the edges
-      auto *pull_memory = context.evaluation_context.memory;
-      utils::pmr::vector<TypedValue> edge_list(pull_memory);
-      edge_list.emplace_back(expansion.first);
-      auto last_vertex = expansion.second;
-      while (true) {
-        const EdgeAccessor &last_edge = edge_list.back().ValueEdge();
-        last_vertex = last_edge.From() == last_vertex ? last_edge.To() : last_edge.From();
-        // origin_vertex must be in processed
-        const auto &previous_edge = processed_.find(last_vertex)->second;
-        if (!previous_edge) break;
+    // place edges on the frame in the correct order
+    std::reverse(edge_list.begin(), edge_list.end());
+    frame[self_.common_.edge_symbol] = std::move(edge_list);
+  }
 
-        edge_list.emplace_back(previous_edge.value());
+  bool PullBatched(Frame &frame, ExecutionContext &context) {
+    while (true) {
+      if (batch_index_ < batch_size_) {
+        auto &search = searches_[batch_index_];
+        if (yield_index_ < search.yielded.size()) {
+          Yield(search.tree, search.yielded[yield_index_++], frame, context);
+          return true;
+        }
+        yield_index_ = 0;
+        if (++batch_index_ < batch_size_) batch_->MoveRow(batch_index_, &frame);
+        continue;
       }
 
-      // expand only if what we've just expanded is less then max depth
-      if (static_cast<int64_t>(edge_list.size()) < upper_bound_) expand_from_vertex(expansion.second);
+      if (!batch_) {
+        batch_.emplace(frame, self_.input()->ModifiedSymbols(context.symbol_table), FLAGS_query_bfs_workers);
+      }
+      batch_size_ = input_cursor_->PullBatch(frame, *batch_, context);
+      if (batch_size_ == 0) return false;
+      while (searches_.size() < batch_size_) searches_.emplace_back(&visited_memory_);
+      const auto vertex_count = context.db_accessor->VerticesCount();
+      for (size_t i = 0; i < batch_size_; ++i) {
+        auto &search = searches_[i];
+        search.Clear();
+        const auto &vertex_value = (*batch_)[i][self_.input_symbol_];
+        ExpressionEvaluator evaluator(&(*batch_)[i], context.symbol_table, context.evaluation_context,
+                                      context.db_accessor, storage::View::OLD);
+        // it is possible that the vertex is Null due to optional matching
+        if (vertex_value.IsNull() || !EvaluateBounds(&evaluator, &search)) continue;
+        search.Start(vertex_value.ValueVertex(), vertex_count);
+      }
+      // A single search is better off expanding its frontiers in parallel.
+      if (batch_size_ == 1) {
+        RunSearch(&searches_[0], true, context);
+      } else {
+        ParallelBfsFor(batch_size_, [&](size_t i) { RunSearch(&searches_[i], false, context); });
+      }
+      batch_index_ = 0;
+      yield_index_ = 0;
+      batch_->MoveRow(0, &frame);
+    }
+  }
+};
 
-      if (static_cast<int64_t>(edge_list.size()) < lower_bound_) continue;
+namespace {
 
-      frame[self_.common_.node_symbol] = expansion.second;
+// Returns the edge property used as the weight if the weight lambda only
+// looks up a property of the inner edge. Such weights are read directly from
+// the edges instead of evaluating the lambda for each edge.
+std::optional<storage::PropertyId> GetWeightProperty(const ExpansionLambda &weight_lambda,
+                                                     const EvaluationContext &evaluation_context) {
+  auto *lookup = utils::Downcast<PropertyLookup>(weight_lambda.expression);
+  if (!lookup) return std::nullopt;
+  auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+  if (!identifier || identifier->symbol_pos_ != weight_lambda.inner_edge_symbol.position()) return std::nullopt;
+  return evaluation_context.properties[lookup->property_.ix];
+}
 
-      // place edges on the frame in the correct order
-      std::reverse(edge_list.begin(), edge_list.end());
-      frame[self_.common_.edge_symbol] = std::move(edge_list);
+// Reads the weight of the edge in the same way as evaluating the property
+// lookup of the weight lambda does.
+TypedValue GetEdgeWeight(const EdgeAccessor &edge, storage::PropertyId property, utils::MemoryResource *memory) {
+  auto maybe_prop = edge.GetProperty(storage::View::OLD, property);
+  if (maybe_prop.HasError() && maybe_prop.GetError() == storage::Error::NONEXISTENT_OBJECT) {
+    maybe_prop = edge.GetProperty(storage::View::NEW, property);
+  }
+  if (maybe_prop.HasError()) {
+    switch (maybe_prop.GetError()) {
+      case storage::Error::DELETED_OBJECT:
+        throw QueryRuntimeException("Trying to get a property from a deleted object.");
+      case storage::Error::NONEXISTENT_OBJECT:
+        throw query::QueryRuntimeException("Trying to get a property from an object that doesn't exist.");
+      case storage::Error::SERIALIZATION_ERROR:
+      case storage::Error::VERTEX_HAS_EDGES:
+      case storage::Error::PROPERTIES_DISABLED:
+        throw QueryRuntimeException("Unexpected error when getting a property.");
+    }
+  }
+  return TypedValue(std::move(*maybe_prop), memory);
+}
 
-      return true;
+void ValidateWeight(const TypedValue &weight, utils::MemoryResource *memory) {
+  if (!weight.IsNumeric() && !weight.IsDuration()) {
+    throw QueryRuntimeException("Calculated weight must be numeric or a Duration, got {}.", weight.type());
+  }
+
+  const auto is_valid_numeric = [&] {
+    return weight.IsNumeric() && (weight >= TypedValue(0, memory)).ValueBool();
+  };
+
+  const auto is_valid_duration = [&] {
+    return weight.IsDuration() && (weight >= TypedValue(utils::Duration(0), memory)).ValueBool();
+  };
+
+  if (!is_valid_numeric() && !is_valid_duration()) {
+    throw QueryRuntimeException("Calculated weight must be non-negative!");
+  }
+}
+
+[[noreturn]] void ThrowMixedWeightTypes() {
+  throw QueryRuntimeException(utils::MessageWithLink(
+      "All weights should be of the same type, either numeric or a Duration. Please update the weight "
+      "expression or the filter expression.",
+      "https://memgr.ph/wsp"));
+}
+
+// Delta-stepping search for the weighted shortest paths from a single source
+// vertex. The reached vertices are kept in buckets of width `delta` by their
+// tentative distance. The edges of the vertices in the lowest bucket are
+// relaxed, on the BFS workers if there are many of them, until the bucket
+// stays empty. The distances of the vertices which were in the bucket are
+// final at that point, so they are returned in the order of their distances
+// before the next bucket is processed.
+class DeltaSteppingSearch {
+ public:
+  struct Node {
+    VertexAccessor vertex;
+    // The edge through which the vertex was reached and its weight, nullopt
+    // and Null for the source.
+    std::optional<EdgeAccessor> edge;
+    TypedValue weight;
+    size_t parent;
+    double distance;
+    uint64_t bucket;
+    // Set while the edges of the vertex have to be relaxed.
+    bool queued;
+    // Set once the vertex was returned or is about to be returned.
+    bool settled;
+  };
+
+  DeltaSteppingSearch(EdgeAtom::Direction direction, const std::vector<storage::EdgeTypeId> &edge_types,
+                      storage::PropertyId weight_property, utils::MemoryResource *memory)
+      : direction_(direction),
+        edge_types_(edge_types),
+        weight_property_(weight_property),
+        memory_(128, 1024, memory),
+        nodes_(&memory_),
+        index_(&memory_),
+        buckets_(&memory_),
+        settled_(&memory_) {}
+
+  void Start(const VertexAccessor &source) {
+    Clear();
+    nodes_.push_back(Node{source, std::nullopt, TypedValue(&memory_), 0, 0.0, 0, true, true});
+    index_.emplace(source.Gid(), 0);
+    buckets_[0].push_back(0);
+  }
+
+  // Returns the index of the next vertex in the order of the distances or
+  // nullopt once all the reachable vertices were returned. The source itself
+  // isn't returned.
+  std::optional<size_t> Next(const ExecutionContext &context) {
+    while (settled_pos_ == settled_.size()) {
+      if (buckets_.empty()) return std::nullopt;
+      SettleBucket(context);
     }
+    return settled_[settled_pos_++];
   }
 
-  void Shutdown() override { input_cursor_->Shutdown(); }
+  const Node &node(size_t index) const { return nodes_[index]; }
 
-  void Reset() override {
-    input_cursor_->Reset();
-    processed_.clear();
-    to_visit_next_.clear();
-    to_visit_current_.clear();
+  void Clear() {
+    nodes_.clear();
+    index_.clear();
+    buckets_.clear();
+    delta_ = 0.0;
+    durations_ = std::nullopt;
+    settled_.clear();
+    settled_pos_ = 0;
   }
 
  private:
-  const ExpandVariable &self_;
-  const UniqueCursorPtr input_cursor_;
+  struct Relaxation {
+    EdgeAccessor edge;
+    VertexAccessor vertex;
+    TypedValue weight;
+    size_t parent;
+    double distance;
+  };
 
-  // Depth bounds. Calculated on each pull from the input, the initial value
-  // is irrelevant.
-  int64_t lower_bound_{-1};
-  int64_t upper_bound_{-1};
+  static double WeightAsDouble(const TypedValue &weight) {
+    if (weight.IsInt()) return static_cast<double>(weight.ValueInt());
+    if (weight.IsDouble()) return weight.ValueDouble();
+    return static_cast<double>(weight.ValueDuration().microseconds);
+  }
+
+  void SettleBucket(const ExecutionContext &context) {
+    const auto bucket = buckets_.begin()->first;
+    settled_.clear();
+    settled_pos_ = 0;
+    // Relaxing the edges may put vertices back into the same bucket.
+    for (auto found = buckets_.find(bucket); found != buckets_.end(); found = buckets_.find(bucket)) {
+      if (MustAbort(context)) throw HintedAbortError();
+      auto entries = std::move(found->second);
+      buckets_.erase(found);
+      utils::pmr::vector<size_t> frontier(&memory_);
+      for (auto index : entries) {
+        auto &node = nodes_[index];
+        // Vertices which moved to a lower bucket or are already in the
+        // frontier leave stale entries behind.
+        if (!node.queued || node.bucket != bucket) continue;
+        node.queued = false;
+        if (!node.settled) {
+          node.settled = true;
+          settled_.push_back(index);
+        }
+        frontier.push_back(index);
+      }
+      Relax(frontier);
+    }
+    std::stable_sort(settled_.begin(), settled_.end(),
+                     [this](auto lhs, auto rhs) { return nodes_[lhs].distance < nodes_[rhs].distance; });
+  }
+
+  void CollectRelaxations(size_t index, utils::pmr::vector<Relaxation> *relaxations) {
+    const auto &node = nodes_[index];
+    auto relax = [&](const EdgeAccessor &edge, const VertexAccessor &vertex) {
+      auto weight = GetEdgeWeight(edge, weight_property_, &memory_);
+      ValidateWeight(weight, &memory_);
+      const auto distance = node.distance + WeightAsDouble(weight);
+      auto found = index_.find(vertex.Gid());
+      if (found != index_.end() && nodes_[found->second].distance <= distance) return;
+      relaxations->push_back(Relaxation{edge, vertex, std::move(weight), index, distance});
+    };
+    if (direction_ != EdgeAtom::Direction::IN) {
+      auto out_edges = UnwrapEdgesResult(node.vertex.OutEdges(storage::View::OLD, edge_types_));
+      for (const auto &edge : out_edges) relax(edge, edge.To());
+    }
+    if (direction_ != EdgeAtom::Direction::OUT) {
+      auto in_edges = UnwrapEdgesResult(node.vertex.InEdges(storage::View::OLD, edge_types_));
+      for (const auto &edge : in_edges) relax(edge, edge.From());
+    }
+  }
+
+  // Relaxes the edges of the frontier vertices. The relaxations are collected
+  // in parallel and applied in the order of the frontier, so the resulting
+  // paths don't depend on the number of workers.
+  void Relax(const utils::pmr::vector<size_t> &frontier) {
+    utils::pmr::vector<Relaxation> relaxations(&memory_);
+    if (FLAGS_query_bfs_workers <= 1 || frontier.size() < kParallelBfsMinFrontier) {
+      for (auto index : frontier) CollectRelaxations(index, &relaxations);
+    } else {
+      utils::pmr::vector<utils::pmr::vector<Relaxation>> chunks(
+          (frontier.size() + kParallelBfsChunkSize - 1) / kParallelBfsChunkSize, &memory_);
+      ParallelBfsFor(chunks.size(), [&](size_t chunk) {
+        const auto end = std::min(frontier.size(), (chunk + 1) * kParallelBfsChunkSize);
+        for (auto i = chunk * kParallelBfsChunkSize; i < end; ++i) CollectRelaxations(frontier[i], &chunks[chunk]);
+      });
+      for (auto &chunk : chunks) {
+        relaxations.insert(relaxations.end(), std::make_move_iterator(chunk.begin()),
+                           std::make_move_iterator(chunk.end()));
+      }
+    }
+
+    if (delta_ == 0.0) {
+      // The bucket width is the mean weight of the edges of the source, which
+      // keeps the number of vertices in a bucket close to the degree.
+      double sum = 0.0;
+      for (const auto &relaxation : relaxations) sum += relaxation.distance;
+      delta_ = sum > 0.0 ? sum / static_cast<double>(relaxations.size()) : 1.0;
+    }
 
-  // maps vertices to the edge they got expanded from. it is an optional
-  // edge because the root does not get expanded from anything.
-  // contains visited vertices as well as those scheduled to be visited.
-  utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>> processed_;
-  // edge/vertex pairs we have yet to visit, for current and next depth
-  utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_current_;
-  utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_next_;
+    for (auto &relaxation : relaxations) {
+      if (!durations_) {
+        durations_ = relaxation.weight.IsDuration();
+      } else if (*durations_ != relaxation.weight.IsDuration()) {
+        ThrowMixedWeightTypes();
+      }
+      auto [found, inserted] = index_.try_emplace(relaxation.vertex.Gid(), nodes_.size());
+      if (inserted) {
+        nodes_.push_back(Node{relaxation.vertex, std::nullopt, TypedValue(&memory_), 0, 0.0, 0, false, false});
+      } else if (nodes_[found->second].distance <= relaxation.distance) {
+        continue;
+      }
+      auto &node = nodes_[found->second];
+      node.edge = std::move(relaxation.edge);
+      node.weight = std::move(relaxation.weight);
+      node.parent = relaxation.parent;
+      node.distance = relaxation.distance;
+      // Very distant vertices share the last bucket, which is still correct
+      // because a bucket is relaxed until it stays empty.
+      node.bucket = static_cast<uint64_t>(
+          std::min(relaxation.distance / delta_, static_cast<double>(std::numeric_limits<uint32_t>::max())));
+      node.queued = true;
+      buckets_[node.bucket].push_back(found->second);
+    }
+  }
+
+  const EdgeAtom::Direction direction_;
+  const std::vector<storage::EdgeTypeId> &edge_types_;
+  const storage::PropertyId weight_property_;
+
+  // The state of the search is allocated from the query memory. The edges are
+  // relaxed on the BFS workers, which allocate the relaxations and read the
+  // weights at once, so the allocations are synchronized.
+  utils::SynchronizedPoolResource memory_;
+  utils::pmr::vector<Node> nodes_;
+  utils::pmr::unordered_map<storage::Gid, size_t> index_;
+  utils::pmr::map<uint64_t, utils::pmr::vector<size_t>> buckets_;
+  double delta_{0.0};
+  // Whether the weights are durations, unknown until the first weight is read.
+  std::optional<bool> durations_;
+  // Vertices of the last settled bucket in the order of their distances and
+  // the position of the next one to return.
+  utils::pmr::vector<size_t> settled_;
+  size_t settled_pos_{0};
 };
 
+}  // namespace
+
 class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
  public:
   ExpandWeightedShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
@@ -1459,26 +2234,15 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         if (!EvaluateFilter(evaluator, self_.filter_lambda_.expression)) return;
       }
 
-      frame[self_.weight_lambda_->inner_edge_symbol] = edge;
-      frame[self_.weight_lambda_->inner_node_symbol] = vertex;
-
-      TypedValue current_weight = self_.weight_lambda_->expression->Accept(evaluator);
-
-      if (!current_weight.IsNumeric() && !current_weight.IsDuration()) {
-        throw QueryRuntimeException("Calculated weight must be numeric or a Duration, got {}.", current_weight.type());
-      }
-
-      const auto is_valid_numeric = [&] {
-        return current_weight.IsNumeric() && (current_weight >= TypedValue(0, memory)).ValueBool();
-      };
-
-      const auto is_valid_duration = [&] {
-        return current_weight.IsDuration() && (current_weight >= TypedValue(utils::Duration(0), memory)).ValueBool();
-      };
-
-      if (!is_valid_numeric() && !is_valid_duration()) {
-        throw QueryRuntimeException("Calculated weight must be non-negative!");
+      TypedValue current_weight;
+      if (weight_property_) {
+        current_weight = GetEdgeWeight(edge, *weight_property_, memory);
+      } else {
+        frame[self_.weight_lambda_->inner_edge_symbol] = edge;
+        frame[self_.weight_lambda_->inner_node_symbol] = vertex;
+        current_weight = self_.weight_lambda_->expression->Accept(evaluator);
       }
+      ValidateWeight(current_weight, memory);
 
       auto next_state = create_state(vertex, depth);
 
@@ -1520,6 +2284,10 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
 
     while (true) {
       if (MustAbort(context)) throw HintedAbortError();
+      if (delta_stepping_active_) {
+        if (PullDeltaStepping(frame, context)) return true;
+        delta_stepping_active_ = false;
+      }
       if (pq_.empty()) {
         if (!input_cursor_->Pull(frame, context)) return false;
         const auto &vertex_value = frame[self_.input_symbol_];
@@ -1548,6 +2316,23 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         total_cost_.clear();
         yielded_vertices_.clear();
 
+        weight_property_ = GetWeightProperty(*self_.weight_lambda_, context.evaluation_context);
+        // Without a filter lambda and an upper bound the weighted shortest
+        // paths are found by the delta-stepping search, which relaxes the
+        // edges on the BFS workers. It reads the weights directly from the
+        // edges, because the weight lambda can't be evaluated in parallel.
+        if (FLAGS_query_bfs_workers > 1 && weight_property_ && !self_.filter_lambda_.expression && !upper_bound_set_) {
+          // The search is reused for all the source vertices, so that its
+          // memory is reused as well.
+          if (!delta_stepping_) {
+            delta_stepping_.emplace(self_.common_.direction, self_.common_.edge_types, *weight_property_,
+                                    total_cost_.get_allocator().GetMemoryResource());
+          }
+          delta_stepping_->Start(vertex);
+          delta_stepping_active_ = true;
+          continue;
+        }
+
         pq_.push({TypedValue(), 0, vertex, std::nullopt});
         // We are adding the starting vertex to the set of yielded vertices
         // because we don't want to yield paths that end with the starting
@@ -1623,6 +2408,8 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
     total_cost_.clear();
     yielded_vertices_.clear();
     ClearQueue();
+    if (delta_stepping_) delta_stepping_->Clear();
+    delta_stepping_active_ = false;
   }
 
  private:
@@ -1633,6 +2420,51 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
   int64_t upper_bound_{-1};
   bool upper_bound_set_{false};
 
+  // Set when the weight lambda only looks up a property of the edge.
+  std::optional<storage::PropertyId> weight_property_;
+
+  std::optional<DeltaSteppingSearch> delta_stepping_;
+  bool delta_stepping_active_{false};
+
+  // Yields the next path found by the delta-stepping search.
+  bool PullDeltaStepping(Frame &frame, ExecutionContext &context) {
+    auto *pull_memory = context.evaluation_context.memory;
+    while (auto index = delta_stepping_->Next(context)) {
+      const auto *node = &delta_stepping_->node(*index);
+      if (self_.common_.existing_node &&
+          (frame[self_.common_.node_symbol] != TypedValue(node->vertex, pull_memory)).ValueBool()) {
+        continue;
+      }
+      if (!self_.common_.existing_node) frame[self_.common_.node_symbol] = node->vertex;
+
+      // The total weight is summed up from the source, like in the
+      // expansion above.
+      utils::pmr::vector<TypedValue> edge_list(pull_memory);
+      std::vector<const TypedValue *> weights;
+      for (; node->edge; node = &delta_stepping_->node(node->parent)) {
+        edge_list.emplace_back(*node->edge);
+        weights.push_back(&node->weight);
+      }
+      TypedValue total_weight(pull_memory);
+      for (auto it = weights.rbegin(); it != weights.rend(); ++it) {
+        TypedValue weight(**it, pull_memory);
+        total_weight = total_weight.IsNull() ? std::move(weight) : weight + total_weight;
+      }
+
+      if (!self_.is_reverse_) {
+        // Place edges on the frame in the correct order.
+        std::reverse(edge_list.begin(), edge_list.end());
+      }
+      frame[self_.common_.edge_symbol] = std::move(edge_list);
+      frame[self_.total_weight_.value()] = std::move(total_weight);
+      // Prevent expanding other paths, because we found the shortest to
+      // existing node.
+      if (self_.common_.existing_node) delta_stepping_->Clear();
+      return true;
+    }
+    return false;
+  }
+
   struct WspStateHash {
     size_t operator()(const std::pair<VertexAccessor, int64_t> &key) const {
       return utils::HashCombine<VertexAccessor, int64_t>{}(key.first, key.second);
@@ -1650,10 +2482,7 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
 
   static void ValidateWeightTypes(const TypedValue &lhs, const TypedValue &rhs) {
     if (!((lhs.IsNumeric() && lhs.IsNumeric()) || (rhs.IsDuration() && rhs.IsDuration()))) {
-      throw QueryRuntimeException(utils::MessageWithLink(
-          "All weights should be of the same type, either numeric or a Duration. Please update the weight "
-          "expression or the filter expression.",
-          "https://memgr.ph/wsp"));
+      ThrowMixedWeightTypes();
     }
   }
 
@@ -1696,7 +2525,7 @@ UniqueCursorPtr ExpandVariable::MakeCursor(utils::MemoryResource *mem) const {
       if (common_.existing_node) {
         return MakeUniqueCursorPtr<STShortestPathCursor>(mem, *this, mem);
       } else {
-        return MakeUniqueCursorPtr<SingleSourceShortestPathCursor>(mem, *this, mem);
+        return MakeUniqueCursorPtr<SingleSourceShortestPathCursor>(mem, *this, mem, false);
       }
     case EdgeAtom::Type::DEPTH_FIRST:
       return MakeUniqueCursorPtr<ExpandVariableCursor>(mem, *this, mem);
@@ -1707,6 +2536,13 @@ UniqueCursorPtr ExpandVariable::MakeCursor(utils::MemoryResource *mem) const {
   }
 }
 
+UniqueCursorPtr ExpandVariable::MakeBatchedCursor(utils::MemoryResource *mem) const {
+  if (type_ != EdgeAtom::Type::BREADTH_FIRST || common_.existing_node) return MakeCursor(mem);
+
+  EventCounter::IncrementCounter(EventCounter::ExpandVariableOperator);
+  return MakeUniqueCursorPtr<SingleSourceShortestPathCursor>(mem, *this, mem, true);
+}
+
 class ConstructNamedPathCursor : public Cursor {
  public:
   ConstructNamedPathCursor(const ConstructNamedPath &self, utils::MemoryResource *mem)
@@ -1830,6 +2666,31 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   return false;
 }
 
+size_t Filter::FilterCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  SCOPED_PROFILE_OP("Filter");
+
+  while (true) {
+    const auto count = input_cursor_->PullBatch(frame, batch, context);
+    if (count == 0) return 0;
+    if (MustAbort(context)) throw HintedAbortError();
+    // Rows that pass the filter are compacted to the front of the batch.
+    size_t passed = 0;
+    for (size_t i = 0; i < count; ++i) {
+      ExpressionEvaluator evaluator(&batch[i], context.symbol_table, context.evaluation_context, context.db_accessor,
+                                    storage::View::OLD);
+      if (!EvaluateFilter(evaluator, self_.expression_)) continue;
+      if (i != passed) std::swap(batch[i], batch[passed]);
+      ++passed;
+    }
+    if (passed > 0) {
+      // Every passed row counts as a hit, the call itself already counted as
+      // one.
+      profile.AddHits(passed - 1);
+      return passed;
+    }
+  }
+}
+
 void Filter::FilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Filter::FilterCursor::Reset() { input_cursor_->Reset(); }
@@ -1842,7 +2703,13 @@ ACCEPT_WITH_INPUT(Produce)
 UniqueCursorPtr Produce::MakeCursor(utils::MemoryResource *mem) const {
   EventCounter::IncrementCounter(EventCounter::ProduceOperator);
 
-  return MakeUniqueCursorPtr<ProduceCursor>(mem, *this, mem);
+  return MakeUniqueCursorPtr<ProduceCursor>(mem, *this, mem, false);
+}
+
+UniqueCursorPtr Produce::MakeBatchedCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ProduceOperator);
+
+  return MakeUniqueCursorPtr<ProduceCursor>(mem, *this, mem, true);
 }
 
 std::vector<Symbol> Produce::OutputSymbols(const SymbolTable &symbol_table) const {
@@ -1855,13 +2722,17 @@ std::vector<Symbol> Produce::OutputSymbols(const SymbolTable &symbol_table) cons
 
 std::vector<Symbol> Produce::ModifiedSymbols(const SymbolTable &table) const { return OutputSymbols(table); }
 
-Produce::ProduceCursor::ProduceCursor(const Produce &self, utils::MemoryResource *mem)
-    : self_(self), input_cursor_(self_.input_->MakeCursor(mem)) {}
+Produce::ProduceCursor::ProduceCursor(const Produce &self, utils::MemoryResource *mem, bool batch_input)
+    : self_(self),
+      // The consumer pulls all rows, so the input is pulled until it's
+      // exhausted as well.
+      input_cursor_(batch_input ? MakeExhaustedInputCursor(*self_.input_, mem) : self_.input_->MakeCursor(mem)),
+      batched_input_(batch_input && SupportsBatchPull(*self_.input_)) {}
 
 bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP("Produce");
 
-  if (input_cursor_->Pull(frame, context)) {
+  if (PullInput(frame, context)) {
     // Produce should always yield the latest results.
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                   storage::View::NEW);
@@ -1872,9 +2743,26 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   return false;
 }
 
+bool Produce::ProduceCursor::PullInput(Frame &frame, ExecutionContext &context) {
+  if (!batched_input_) return input_cursor_->Pull(frame, context);
+
+  if (!batch_) batch_.emplace(frame, self_.input_->ModifiedSymbols(context.symbol_table), kPullBatchSize);
+  if (batch_index_ == batch_size_) {
+    batch_size_ = input_cursor_->PullBatch(frame, *batch_, context);
+    batch_index_ = 0;
+    if (batch_size_ == 0) return false;
+  }
+  batch_->MoveRow(batch_index_++, &frame);
+  return true;
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
+void Produce::ProduceCursor::Reset() {
+  input_cursor_->Reset();
+  batch_size_ = 0;
+  batch_index_ = 0;
+}
 
 Delete::Delete(const std::shared_ptr<LogicalOperator> &input_, const std::vector<Expression *> &expressions,
                bool detach_)
@@ -2616,7 +3504,7 @@ TypedValue DefaultAggregationOpValue(const Aggregate::Element &element, utils::M
 class AggregateCursor : public Cursor {
  public:
   AggregateCursor(const Aggregate &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), aggregation_(mem) {}
+      : self_(self), input_cursor_(MakeExhaustedInputCursor(*self_.input_, mem)), aggregation_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("Aggregate");
@@ -2639,7 +3527,9 @@ class AggregateCursor : public Cursor {
       }
     }
 
-    if (aggregation_it_ == aggregation_.end()) return false;
+    while (aggregation_it_ == aggregation_.end()) {
+      if (!AggregateNextPartition(&context)) return false;
+    }
 
     // place aggregation values on the frame
     auto aggregation_values_it = aggregation_it_->second.values_.begin();
@@ -2661,6 +3551,9 @@ class AggregateCursor : public Cursor {
     aggregation_.clear();
     aggregation_it_ = aggregation_.begin();
     pulled_all_input_ = false;
+    aggregation_size_ = 0;
+    partitions_.clear();
+    partition_ = 0;
   }
 
  private:
@@ -2684,6 +3577,8 @@ class AggregateCursor : public Cursor {
     utils::pmr::vector<TypedValue> remember_;
   };
 
+  using GroupByHash = utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>;
+
   const Aggregate &self_;
   const UniqueCursorPtr input_cursor_;
   // storage for aggregated data
@@ -2692,7 +3587,7 @@ class AggregateCursor : public Cursor {
   utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
                             // use FNV collection hashing specialized for a
                             // vector of TypedValues
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
+                            GroupByHash,
                             // custom equality
                             TypedValueVectorEqual>
       aggregation_;
@@ -2701,6 +3596,16 @@ class AggregateCursor : public Cursor {
   // this LogicalOp pulls all from the input on it's first pull
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
+  // estimated memory used by the groups, tracked only when spilling is
+  // enabled
+  uint64_t aggregation_size_{0};
+  // If the groups grow over the spill threshold, the rows of the groups which
+  // aren't in memory yet are spilled to partitions by the hash of their
+  // group-by values. Each partition is aggregated on its own once the groups
+  // in memory were returned.
+  std::vector<std::unique_ptr<SpillFile>> partitions_;
+  // the next partition to aggregate
+  size_t partition_{0};
 
   /**
    * Pulls from the input operator until exhausted and aggregates the
@@ -2712,19 +3617,35 @@ class AggregateCursor : public Cursor {
    * aggregation results, and not on the number of inputs.
    */
   void ProcessAll(Frame *frame, ExecutionContext *context) {
-    ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
-                                  storage::View::NEW);
-    while (input_cursor_->Pull(*frame, *context)) {
-      ProcessOne(*frame, &evaluator);
+    if (SupportsBatchPull(*self_.input_)) {
+      FrameBatch batch(*frame, self_.input_->ModifiedSymbols(context->symbol_table), kPullBatchSize);
+      while (const auto count = input_cursor_->PullBatch(*frame, batch, *context)) {
+        for (size_t i = 0; i < count; ++i) {
+          ExpressionEvaluator evaluator(&batch[i], context->symbol_table, context->evaluation_context,
+                                        context->db_accessor, storage::View::NEW);
+          ProcessOne(batch[i], &evaluator, *context);
+        }
+      }
+    } else {
+      ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
+                                    storage::View::NEW);
+      while (input_cursor_->Pull(*frame, *context)) {
+        ProcessOne(*frame, &evaluator, *context);
+      }
     }
 
-    // calculate AVG aggregations (so far they have only been summed)
+    CalculateAverages(context->evaluation_context.memory);
+  }
+
+  /**
+   * Calculates AVG aggregations (so far they have only been summed).
+   */
+  void CalculateAverages(utils::MemoryResource *pull_memory) {
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
       if (self_.aggregations_[pos].op != Aggregation::Op::AVG) continue;
       for (auto &kv : aggregation_) {
         AggregationValue &agg_value = kv.second;
         auto count = agg_value.counts_[pos];
-        auto *pull_memory = context->evaluation_context.memory;
         if (count > 0) {
           agg_value.values_[pos] = agg_value.values_[pos] / TypedValue(static_cast<double>(count), pull_memory);
         }
@@ -2735,16 +3656,100 @@ class AggregateCursor : public Cursor {
   /**
    * Performs a single accumulation.
    */
-  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator, const ExecutionContext &context) {
     auto *mem = aggregation_.get_allocator().GetMemoryResource();
     utils::pmr::vector<TypedValue> group_by(mem);
     group_by.reserve(self_.group_by_.size());
     for (Expression *expression : self_.group_by_) {
       group_by.emplace_back(expression->Accept(*evaluator));
     }
-    auto &agg_value = aggregation_.try_emplace(std::move(group_by), mem).first->second;
+    const auto evaluate = [evaluator](Expression *expression) { return expression->Accept(*evaluator); };
+    if (!partitions_.empty()) {
+      // Once spilling, only the groups which are already in memory are
+      // updated.
+      auto found = aggregation_.find(group_by);
+      if (found == aggregation_.end()) {
+        SpillRow(frame, group_by, evaluate);
+      } else {
+        Update(evaluate, &found->second);
+      }
+      return;
+    }
+    auto [group, inserted] = aggregation_.try_emplace(std::move(group_by), mem);
+    auto &agg_value = group->second;
     EnsureInitialized(frame, &agg_value);
-    Update(evaluator, &agg_value);
+    Update(evaluate, &agg_value);
+    if (inserted && context.spill_threshold_bytes > 0) {
+      aggregation_size_ += EstimateGroupSize(group->first, agg_value);
+      if (aggregation_size_ > context.spill_threshold_bytes && !self_.group_by_.empty()) {
+        for (size_t i = 0; i < kSpillPartitions; ++i) {
+          partitions_.push_back(std::make_unique<SpillFile>(context.spill_directory));
+        }
+      }
+    }
+  }
+
+  // Only the size of a group when it's created is taken into account, so
+  // collecting into lists or maps can use more memory than estimated.
+  uint64_t EstimateGroupSize(const utils::pmr::vector<TypedValue> &group_by, const AggregationValue &agg_value) const {
+    uint64_t size = agg_value.counts_.size() * sizeof(int64_t);
+    for (const auto &value : group_by) size += EstimateMemoryUsage(value);
+    for (const auto &value : agg_value.values_) size += EstimateMemoryUsage(value);
+    for (const auto &value : agg_value.remember_) size += EstimateMemoryUsage(value);
+    return size;
+  }
+
+  /**
+   * Writes the group-by values, the remember values and the inputs of the
+   * aggregations to the partition of the group. The inputs are written in the
+   * order in which `Update` evaluates them, so the row is aggregated by
+   * calling `Update` with values read from the partition.
+   */
+  template <typename TEvaluate>
+  void SpillRow(const Frame &frame, const utils::pmr::vector<TypedValue> &group_by, const TEvaluate &evaluate) {
+    auto &partition = *partitions_[GroupByHash{}(group_by) % partitions_.size()];
+    for (const auto &value : group_by) partition.Write(value);
+    for (const Symbol &remember_sym : self_.remember_) partition.Write(frame[remember_sym]);
+    for (const auto &agg_elem : self_.aggregations_) {
+      if (!agg_elem.value) continue;
+      auto input_value = evaluate(agg_elem.value);
+      partition.Write(input_value);
+      if (!input_value.IsNull() && agg_elem.op == Aggregation::Op::COLLECT_MAP) {
+        partition.Write(evaluate(agg_elem.key));
+      }
+    }
+    partition.EndRow();
+  }
+
+  /**
+   * Replaces the aggregated groups with the groups of the next spilled
+   * partition. Returns false if there are no more partitions.
+   */
+  bool AggregateNextPartition(ExecutionContext *context) {
+    if (partition_ == partitions_.size()) return false;
+    auto partition = std::move(partitions_[partition_++]);
+    partition->StartReading();
+    aggregation_.clear();
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    const auto read = [&](Expression * /*expression*/) { return partition->Read(context->db_accessor, mem); };
+    for (uint64_t row = 0; row < partition->rows(); ++row) {
+      if (MustAbort(*context)) throw HintedAbortError();
+      utils::pmr::vector<TypedValue> group_by(mem);
+      group_by.reserve(self_.group_by_.size());
+      for (size_t i = 0; i < self_.group_by_.size(); ++i) group_by.emplace_back(read(nullptr));
+      utils::pmr::vector<TypedValue> remember(mem);
+      remember.reserve(self_.remember_.size());
+      for (size_t i = 0; i < self_.remember_.size(); ++i) remember.emplace_back(read(nullptr));
+      auto &agg_value = aggregation_.try_emplace(std::move(group_by), mem).first->second;
+      if (agg_value.values_.empty()) {
+        InitializeValues(&agg_value);
+        agg_value.remember_ = std::move(remember);
+      }
+      Update(read, &agg_value);
+    }
+    CalculateAverages(context->evaluation_context.memory);
+    aggregation_it_ = aggregation_.begin();
+    return true;
   }
 
   /** Ensures the new AggregationValue has been initialized. This means
@@ -2754,18 +3759,24 @@ class AggregateCursor : public Cursor {
   void EnsureInitialized(const Frame &frame, AggregateCursor::AggregationValue *agg_value) const {
     if (!agg_value->values_.empty()) return;
 
+    InitializeValues(agg_value);
+    for (const Symbol &remember_sym : self_.remember_) agg_value->remember_.push_back(frame[remember_sym]);
+  }
+
+  void InitializeValues(AggregateCursor::AggregationValue *agg_value) const {
     for (const auto &agg_elem : self_.aggregations_) {
       auto *mem = agg_value->values_.get_allocator().GetMemoryResource();
       agg_value->values_.emplace_back(DefaultAggregationOpValue(agg_elem, mem));
     }
     agg_value->counts_.resize(self_.aggregations_.size(), 0);
-
-    for (const Symbol &remember_sym : self_.remember_) agg_value->remember_.push_back(frame[remember_sym]);
   }
 
   /** Updates the given AggregationValue with new data. Assumes that
-   * the AggregationValue has been initialized */
-  void Update(ExpressionEvaluator *evaluator, AggregateCursor::AggregationValue *agg_value) {
+   * the AggregationValue has been initialized. The inputs of the
+   * aggregations are obtained by calling `evaluate` with their
+   * expressions. */
+  template <typename TEvaluate>
+  void Update(const TEvaluate &evaluate, AggregateCursor::AggregationValue *agg_value) {
     DMG_ASSERT(self_.aggregations_.size() == agg_value->values_.size(),
                "Expected as much AggregationValue.values_ as there are "
                "aggregations.");
@@ -2787,7 +3798,7 @@ class AggregateCursor : public Cursor {
         continue;
       }
 
-      TypedValue input_value = input_expr_ptr->Accept(*evaluator);
+      TypedValue input_value = evaluate(input_expr_ptr);
 
       // Aggregations skip Null input values.
       if (input_value.IsNull()) continue;
@@ -2813,7 +3824,7 @@ class AggregateCursor : public Cursor {
             value_it->ValueList().push_back(input_value);
             break;
           case Aggregation::Op::COLLECT_MAP:
-            auto key = agg_elem_it->key->Accept(*evaluator);
+            auto key = evaluate(agg_elem_it->key);
             if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
             value_it->ValueMap().emplace(key.ValueString(), input_value);
             break;
@@ -2861,7 +3872,7 @@ class AggregateCursor : public Cursor {
           value_it->ValueList().push_back(input_value);
           break;
         case Aggregation::Op::COLLECT_MAP:
-          auto key = agg_elem_it->key->Accept(*evaluator);
+          auto key = evaluate(agg_elem_it->key);
           if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
           value_it->ValueMap().emplace(key.ValueString(), input_value);
           break;
@@ -3038,7 +4049,7 @@ std::vector<Symbol> OrderBy::ModifiedSymbols(const SymbolTable &table) const { r
 class OrderByCursor : public Cursor {
  public:
   OrderByCursor(const OrderBy &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem) {}
+      : self_(self), input_cursor_(MakeExhaustedInputCursor(*self_.input_, mem)), cache_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("OrderBy");
@@ -3060,17 +4071,27 @@ class OrderByCursor : public Cursor {
         output.reserve(self_.output_symbols_.size());
         for (const Symbol &output_sym : self_.output_symbols_) output.emplace_back(frame[output_sym]);
 
+        if (context.spill_threshold_bytes > 0) {
+          for (const auto &value : order_by) cache_size_ += EstimateMemoryUsage(value);
+          for (const auto &value : output) cache_size_ += EstimateMemoryUsage(value);
+        }
         cache_.push_back(Element{std::move(order_by), std::move(output)});
+        if (context.spill_threshold_bytes > 0 && cache_size_ > context.spill_threshold_bytes) SpillRun(context);
       }
 
-      std::sort(cache_.begin(), cache_.end(), [this](const auto &pair1, const auto &pair2) {
-        return self_.compare_(pair1.order_by, pair2.order_by);
-      });
+      if (runs_.empty()) {
+        SortCache();
+      } else {
+        if (!cache_.empty()) SpillRun(context);
+        StartMerge(context);
+      }
 
       did_pull_all_ = true;
       cache_it_ = cache_.begin();
     }
 
+    if (!runs_.empty()) return PullMerged(frame, context);
+
     if (cache_it_ == cache_.end()) return false;
 
     if (MustAbort(context)) throw HintedAbortError();
@@ -3092,6 +4113,9 @@ class OrderByCursor : public Cursor {
     did_pull_all_ = false;
     cache_.clear();
     cache_it_ = cache_.begin();
+    cache_size_ = 0;
+    runs_.clear();
+    merge_heap_.clear();
   }
 
  private:
@@ -3100,6 +4124,85 @@ class OrderByCursor : public Cursor {
     utils::pmr::vector<TypedValue> remember;
   };
 
+  // A sorted run of elements spilled to disk and the smallest element of the
+  // run which wasn't returned yet.
+  struct Run {
+    std::unique_ptr<SpillFile> file;
+    uint64_t rows_left;
+    Element head;
+  };
+
+  void SortCache() {
+    std::sort(cache_.begin(), cache_.end(), [this](const auto &pair1, const auto &pair2) {
+      return self_.compare_(pair1.order_by, pair2.order_by);
+    });
+  }
+
+  // Sorts the cached elements and moves them to a new run on disk.
+  void SpillRun(const ExecutionContext &context) {
+    SortCache();
+    auto *mem = cache_.get_allocator().GetMemoryResource();
+    Element head{utils::pmr::vector<TypedValue>(mem), utils::pmr::vector<TypedValue>(mem)};
+    auto &run = runs_.emplace_back(Run{std::make_unique<SpillFile>(context.spill_directory), 0, std::move(head)});
+    for (const auto &element : cache_) {
+      for (const auto &value : element.order_by) run.file->Write(value);
+      for (const auto &value : element.remember) run.file->Write(value);
+      run.file->EndRow();
+    }
+    run.rows_left = run.file->rows();
+    cache_.clear();
+    cache_size_ = 0;
+  }
+
+  bool ReadHead(Run *run, const ExecutionContext &context) {
+    if (run->rows_left == 0) return false;
+    --run->rows_left;
+    auto *mem = cache_.get_allocator().GetMemoryResource();
+    run->head.order_by.clear();
+    for (size_t i = 0; i < self_.order_by_.size(); ++i) {
+      run->head.order_by.emplace_back(run->file->Read(context.db_accessor, mem));
+    }
+    run->head.remember.clear();
+    for (size_t i = 0; i < self_.output_symbols_.size(); ++i) {
+      run->head.remember.emplace_back(run->file->Read(context.db_accessor, mem));
+    }
+    return true;
+  }
+
+  // The heap of the runs which weren't exhausted yet has the run with the
+  // smallest head at the front.
+  bool MergeHeapCompare(size_t lhs, size_t rhs) const {
+    return self_.compare_(runs_[rhs].head.order_by, runs_[lhs].head.order_by);
+  }
+
+  void StartMerge(const ExecutionContext &context) {
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      runs_[i].file->StartReading();
+      if (ReadHead(&runs_[i], context)) merge_heap_.push_back(i);
+    }
+    std::make_heap(merge_heap_.begin(), merge_heap_.end(),
+                   [this](auto lhs, auto rhs) { return MergeHeapCompare(lhs, rhs); });
+  }
+
+  bool PullMerged(Frame &frame, ExecutionContext &context) {
+    if (merge_heap_.empty()) return false;
+
+    if (MustAbort(context)) throw HintedAbortError();
+
+    const auto compare = [this](auto lhs, auto rhs) { return MergeHeapCompare(lhs, rhs); };
+    std::pop_heap(merge_heap_.begin(), merge_heap_.end(), compare);
+    auto &run = runs_[merge_heap_.back()];
+    auto output_sym_it = self_.output_symbols_.begin();
+    for (auto &output : run.head.remember) frame[*output_sym_it++] = std::move(output);
+    if (ReadHead(&run, context)) {
+      std::push_heap(merge_heap_.begin(), merge_heap_.end(), compare);
+    } else {
+      merge_heap_.pop_back();
+      run.file.reset();
+    }
+    return true;
+  }
+
   const OrderBy &self_;
   const UniqueCursorPtr input_cursor_;
   bool did_pull_all_{false};
@@ -3108,6 +4211,12 @@ class OrderByCursor : public Cursor {
   utils::pmr::vector<Element> cache_;
   // iterator over the cache_, maintains state between Pulls
   decltype(cache_.begin()) cache_it_ = cache_.begin();
+  // estimated memory used by the cache, tracked only when spilling is enabled
+  uint64_t cache_size_{0};
+  // If the cache grows over the spill threshold, it's sorted and spilled to a
+  // run on disk. The runs are merged into the output.
+  std::vector<Run> runs_;
+  std::vector<size_t> merge_heap_;
 };
 
 UniqueCursorPtr OrderBy::MakeCursor(utils::MemoryResource *mem) const {
@@ -3351,14 +4460,64 @@ class DistinctCursor : public Cursor {
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("Distinct");
 
-    while (true) {
-      if (!input_cursor_->Pull(frame, context)) return false;
+    auto *mem = seen_rows_.get_allocator().GetMemoryResource();
+    while (!input_exhausted_) {
+      if (!input_cursor_->Pull(frame, context)) {
+        input_exhausted_ = true;
+        break;
+      }
 
-      utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().GetMemoryResource());
+      utils::pmr::vector<TypedValue> row(mem);
       row.reserve(self_.value_symbols_.size());
       for (const auto &symbol : self_.value_symbols_) row.emplace_back(frame[symbol]);
-      if (seen_rows_.insert(std::move(row)).second) return true;
+      if (!partitions_.empty()) {
+        // Once spilling, the rows which weren't seen yet are returned after
+        // the whole input was pulled.
+        if (!seen_rows_.contains(row)) SpillRow(row);
+        continue;
+      }
+      uint64_t row_size = 0;
+      if (context.spill_threshold_bytes > 0) {
+        for (const auto &value : row) row_size += EstimateMemoryUsage(value);
+      }
+      if (seen_rows_.insert(std::move(row)).second) {
+        seen_rows_size_ += row_size;
+        if (context.spill_threshold_bytes > 0 && seen_rows_size_ > context.spill_threshold_bytes) {
+          StartSpilling(context);
+        }
+        return true;
+      }
+    }
+
+    // The spilled rows are deduplicated one partition at a time. All the
+    // copies of a row are in the same partition.
+    while (partition_ < partitions_.size()) {
+      auto &partition = *partitions_[partition_];
+      if (partition_rows_read_ == 0) {
+        seen_rows_.clear();
+        partition.StartReading();
+      }
+      if (partition_rows_read_ == partition.rows()) {
+        partitions_[partition_].reset();
+        ++partition_;
+        partition_rows_read_ = 0;
+        continue;
+      }
+      if (MustAbort(context)) throw HintedAbortError();
+      ++partition_rows_read_;
+      utils::pmr::vector<TypedValue> row(mem);
+      row.reserve(self_.value_symbols_.size());
+      for (size_t i = 0; i < self_.value_symbols_.size(); ++i) {
+        row.emplace_back(partition.Read(context.db_accessor, mem));
+      }
+      auto [it, inserted] = seen_rows_.insert(std::move(row));
+      if (inserted) {
+        auto value_it = it->begin();
+        for (const auto &symbol : self_.value_symbols_) frame[symbol] = *value_it++;
+        return true;
+      }
     }
+    return false;
   }
 
   void Shutdown() override { input_cursor_->Shutdown(); }
@@ -3366,18 +4525,46 @@ class DistinctCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     seen_rows_.clear();
+    seen_rows_size_ = 0;
+    input_exhausted_ = false;
+    partitions_.clear();
+    partition_ = 0;
+    partition_rows_read_ = 0;
   }
 
  private:
+  using RowHash = utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>;
+
+  void StartSpilling(const ExecutionContext &context) {
+    for (size_t i = 0; i < kSpillPartitions; ++i) {
+      partitions_.push_back(std::make_unique<SpillFile>(context.spill_directory));
+    }
+  }
+
+  void SpillRow(const utils::pmr::vector<TypedValue> &row) {
+    auto &partition = *partitions_[RowHash{}(row) % partitions_.size()];
+    for (const auto &value : row) partition.Write(value);
+    partition.EndRow();
+  }
+
   const Distinct &self_;
   const UniqueCursorPtr input_cursor_;
   // a set of already seen rows
   utils::pmr::unordered_set<utils::pmr::vector<TypedValue>,
                             // use FNV collection hashing specialized for a
                             // vector of TypedValue
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            TypedValueVectorEqual>
+                            RowHash, TypedValueVectorEqual>
       seen_rows_;
+  // estimated memory used by the seen rows, tracked only when spilling is
+  // enabled
+  uint64_t seen_rows_size_{0};
+  bool input_exhausted_{false};
+  // If the seen rows grow over the spill threshold, the following rows are
+  // spilled to partitions by their hash.
+  std::vector<std::unique_ptr<SpillFile>> partitions_;
+  // the partition which is being read and the number of rows read from it
+  size_t partition_{0};
+  uint64_t partition_rows_read_{0};
 };
 
 Distinct::Distinct(const std::shared_ptr<LogicalOperator> &input, const std::vector<Symbol> &value_symbols)
@@ -4024,4 +5211,300 @@ UniqueCursorPtr LoadCsv::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<LoadCsvCursor>(mem, this, mem);
 };
 
+
+namespace {
+
+/// Rows are sent from the `Gather` workers to the consumer in chunks of this
+/// size to keep the contention on the shared queue low.
+constexpr size_t kGatherChunkSize = 1024;
+
+/// Maximum number of chunks per worker that wait in the queue. Workers block
+/// when the consumer can't keep up, which bounds the memory used for rows that
+/// were produced ahead.
+constexpr size_t kGatherMaxQueuedChunksPerWorker = 4;
+
+/// Size of the first block of memory of each `Gather` worker, which is taken
+/// from the query memory.
+constexpr size_t kGatherWorkerMemoryBlockSize = 64UL * 1024;
+
+utils::ThreadPool &GatherThreadPool() {
+  // The thread pulling the `Gather` also scans the ranges which weren't picked
+  // up by the pool, so one thread less is needed in the pool.
+  static utils::ThreadPool pool(std::max<uint64_t>(FLAGS_query_parallel_scan_workers, 1) - 1);
+  return pool;
+}
+
+}  // namespace
+
+class GatherCursor : public Cursor {
+  using Row = std::vector<TypedValue>;
+  using Chunk = std::vector<Row>;
+
+ public:
+  GatherCursor(const Gather &self, utils::MemoryResource *mem) : self_(self), mem_(mem) {}
+
+  GatherCursor(const GatherCursor &) = delete;
+  GatherCursor &operator=(const GatherCursor &) = delete;
+  GatherCursor(GatherCursor &&) = delete;
+  GatherCursor &operator=(GatherCursor &&) = delete;
+
+  ~GatherCursor() override { StopWorkers(); }
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP("Gather");
+
+    if (!started_) StartWorkers(context);
+
+    while (true) {
+      if (chunk_index_ < chunk_.size()) {
+        auto &row = chunk_[chunk_index_++];
+        for (size_t i = 0; i < symbols_.size(); ++i) {
+          frame[symbols_[i]] = std::move(row[i]);
+        }
+        return true;
+      }
+
+      if (!run_) return false;
+      if (MustAbort(context)) throw HintedAbortError();
+
+      std::unique_lock<std::mutex> guard(run_->lock);
+      if (run_->error) {
+        auto error = run_->error;
+        guard.unlock();
+        StopWorkers();
+        std::rethrow_exception(error);
+      }
+      if (!run_->chunks.empty()) {
+        chunk_ = std::move(run_->chunks.front());
+        run_->chunks.pop_front();
+        chunk_index_ = 0;
+        guard.unlock();
+        run_->chunk_consumed.notify_one();
+        continue;
+      }
+
+      // The ranges which none of the pool threads picked up yet are scanned
+      // by this thread, so that the query makes progress even when the pool
+      // is busy with other queries.
+      if (!local_worker_ && run_->next_worker < run_->workers.size()) {
+        local_worker_ = run_->workers[run_->next_worker++].get();
+      }
+      if (local_worker_) {
+        guard.unlock();
+        if (local_worker_->cursor->Pull(local_worker_->frame, local_worker_->context)) {
+          for (const auto &symbol : symbols_) frame[symbol] = local_worker_->frame[symbol];
+          return true;
+        }
+        local_worker_ = nullptr;
+        guard.lock();
+        ++run_->finished_workers;
+        continue;
+      }
+
+      if (run_->finished_workers == run_->workers.size()) {
+        guard.unlock();
+        StopWorkers();
+        return false;
+      }
+      // Wake up periodically so that the abort conditions are checked even if
+      // the workers don't produce any rows.
+      run_->chunk_ready.wait_for(guard, std::chrono::milliseconds(100), [this] {
+        return run_->error || !run_->chunks.empty() || run_->finished_workers == run_->workers.size();
+      });
+    }
+  }
+
+  void Shutdown() override { StopWorkers(); }
+
+  void Reset() override {
+    StopWorkers();
+    started_ = false;
+    chunk_.clear();
+    chunk_index_ = 0;
+  }
+
+ private:
+  struct Worker {
+    Worker(const Gather &self, const ExecutionContext &consumer_context, const ScanRange &range,
+           utils::MemoryResource *mem)
+        : initial_block(kGatherWorkerMemoryBlockSize, mem),
+          cursor(self.input_->MakeCursor(&memory)),
+          frame(consumer_context.symbol_table.max_position(), &pull_memory) {
+      // The evaluation context is copied because the workers evaluate the
+      // same expressions as the consumer would.
+      context.db_accessor = consumer_context.db_accessor;
+      context.symbol_table = consumer_context.symbol_table;
+      context.evaluation_context.memory = &pull_memory;
+      context.evaluation_context.timestamp = consumer_context.evaluation_context.timestamp;
+      context.evaluation_context.parameters = consumer_context.evaluation_context.parameters;
+      context.evaluation_context.properties = consumer_context.evaluation_context.properties;
+      context.evaluation_context.labels = consumer_context.evaluation_context.labels;
+      context.is_shutting_down = consumer_context.is_shutting_down;
+      context.timer = consumer_context.timer.Share();
+      context.scan_range = range;
+    }
+
+    // The query memory isn't thread-safe and the operators above the `Gather`
+    // keep allocating from it, so each worker only takes its first block of
+    // memory from it. The cursors and the values they produce are allocated
+    // from the worker's own memory, which grows like the query memory does.
+    utils::pmr::vector<char> initial_block;
+    utils::ResourceWithOutOfMemoryException memory_with_exception;
+    utils::MonotonicBufferResource memory{initial_block.data(), initial_block.size(), &memory_with_exception};
+    utils::PoolResource pull_memory{128, 1024, &memory};
+    UniqueCursorPtr cursor;
+    Frame frame;
+    ExecutionContext context;
+  };
+
+  // The state shared with the tasks on the thread pool. Tasks which start after
+  // the workers were stopped only look at the state, so it outlives the
+  // cursor.
+  struct Run {
+    std::vector<Symbol> symbols;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    std::mutex lock;
+    std::condition_variable chunk_ready;
+    std::condition_variable chunk_consumed;
+    std::deque<Chunk> chunks;
+    // Index of the next worker that isn't being run yet.
+    size_t next_worker{0};
+    // Number of workers being run by the pool.
+    size_t running_workers{0};
+    size_t finished_workers{0};
+    std::exception_ptr error;
+    std::atomic<bool> stop{false};
+  };
+
+  void StartWorkers(const ExecutionContext &context) {
+    started_ = true;
+    symbols_ = self_.input_->ModifiedSymbols(context.symbol_table);
+    run_ = std::make_shared<Run>();
+    run_->symbols = symbols_;
+
+    auto points = context.db_accessor->VerticesPartitionPoints(std::max<uint64_t>(self_.num_workers_, 1));
+    std::vector<ScanRange> ranges;
+    ranges.reserve(points.size() + 1);
+    std::optional<storage::Gid> lower;
+    for (const auto &point : points) {
+      ranges.push_back({lower, point});
+      lower = point;
+    }
+    ranges.push_back({lower, std::nullopt});
+
+    // The workers are completely set up before any of them starts, so that
+    // the vector of workers isn't modified while they are running.
+    run_->workers.reserve(ranges.size());
+    for (const auto &range : ranges) {
+      run_->workers.push_back(std::make_unique<Worker>(self_, context, range, mem_));
+    }
+    const auto tasks = std::min<size_t>(std::max<uint64_t>(FLAGS_query_parallel_scan_workers, 1) - 1, ranges.size());
+    for (size_t i = 0; i < tasks; ++i) {
+      GatherThreadPool().AddTask([run = run_] {
+        while (true) {
+          Worker *worker = nullptr;
+          {
+            std::lock_guard<std::mutex> guard(run->lock);
+            if (run->stop.load(std::memory_order_acquire) || run->next_worker == run->workers.size()) return;
+            worker = run->workers[run->next_worker++].get();
+            ++run->running_workers;
+          }
+          Work(run.get(), worker);
+        }
+      });
+    }
+  }
+
+  static void Work(Run *run, Worker *worker) {
+    try {
+      Chunk chunk;
+      chunk.reserve(kGatherChunkSize);
+      while (!run->stop.load(std::memory_order_acquire) && worker->cursor->Pull(worker->frame, worker->context)) {
+        auto &row = chunk.emplace_back();
+        row.reserve(run->symbols.size());
+        for (const auto &symbol : run->symbols) row.emplace_back(worker->frame[symbol]);
+        if (chunk.size() == kGatherChunkSize) {
+          if (!Push(run, std::move(chunk))) break;
+          chunk = Chunk();
+          chunk.reserve(kGatherChunkSize);
+        }
+      }
+      if (!chunk.empty()) Push(run, std::move(chunk));
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(run->lock);
+      if (!run->error) run->error = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> guard(run->lock);
+      ++run->finished_workers;
+      --run->running_workers;
+    }
+    run->chunk_ready.notify_one();
+  }
+
+  /// @return false if the workers were stopped and the chunk was dropped
+  static bool Push(Run *run, Chunk chunk) {
+    {
+      std::unique_lock<std::mutex> guard(run->lock);
+      run->chunk_consumed.wait(guard, [run] {
+        return run->stop.load(std::memory_order_acquire) ||
+               run->chunks.size() < run->workers.size() * kGatherMaxQueuedChunksPerWorker;
+      });
+      if (run->stop.load(std::memory_order_acquire)) return false;
+      run->chunks.push_back(std::move(chunk));
+    }
+    run->chunk_ready.notify_one();
+    return true;
+  }
+
+  void StopWorkers() {
+    if (!run_) return;
+    {
+      std::unique_lock<std::mutex> guard(run_->lock);
+      run_->stop.store(true, std::memory_order_release);
+      run_->chunk_consumed.notify_all();
+      // The workers run by the pool use the cursors and the memory of the
+      // workers, so they have to finish before those are destroyed.
+      run_->chunk_ready.wait(guard, [this] { return run_->running_workers == 0; });
+    }
+    for (auto &worker : run_->workers) {
+      worker->cursor->Shutdown();
+    }
+    run_->workers.clear();
+    run_->chunks.clear();
+    run_.reset();
+    local_worker_ = nullptr;
+  }
+
+  const Gather &self_;
+  utils::MemoryResource *mem_;
+  std::vector<Symbol> symbols_;
+  bool started_{false};
+  std::shared_ptr<Run> run_;
+  // The worker which is run by the consumer itself.
+  Worker *local_worker_{nullptr};
+  // The chunk whose rows are currently being yielded.
+  Chunk chunk_;
+  size_t chunk_index_{0};
+};
+
+Gather::Gather(const std::shared_ptr<LogicalOperator> &input, uint64_t num_workers)
+    : input_(input), num_workers_(num_workers) {}
+
+ACCEPT_WITH_INPUT(Gather)
+
+UniqueCursorPtr Gather::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::GatherOperator);
+
+  return MakeUniqueCursorPtr<GatherCursor>(mem, *this, mem);
+}
+
+std::vector<Symbol> Gather::OutputSymbols(const SymbolTable &symbol_table) const {
+  // Propagate this to potential Produce.
+  return input_->OutputSymbols(symbol_table);
+}
+
+std::vector<Symbol> Gather::ModifiedSymbols(const SymbolTable &table) const { return input_->ModifiedSymbols(table); }
+
 }  // namespace memgraph::query::plan
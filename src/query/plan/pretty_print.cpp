@@ -84,6 +84,17 @@ bool PlanPrinter::PreVisit(query::plan::ScanAllByLabelProperty &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::ScanAllByLabelProperties &op) {
+  WithPrintLn([&](auto &out) {
+    out << "* ScanAllByLabelProperties"
+        << " (" << op.output_symbol_.name() << " :" << dba_->LabelToName(op.label_) << " {";
+    utils::PrintIterable(out, op.properties_, ", ",
+                         [this](auto &stream, const auto &property) { stream << dba_->PropertyToName(property); });
+    out << "})";
+  });
+  return true;
+}
+
 bool PlanPrinter::PreVisit(ScanAllById &op) {
   WithPrintLn([&](auto &out) {
     out << "* ScanAllById"
@@ -92,6 +103,25 @@ bool PlanPrinter::PreVisit(ScanAllById &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::ScanAllEdgesByType &op) {
+  WithPrintLn([&](auto &out) {
+    out << "* ScanAllEdgesByType"
+        << " (" << op.from_symbol_.name() << ")-[" << op.edge_symbol_.name() << " :"
+        << dba_->EdgeTypeToName(op.edge_type_) << "]->(" << op.to_symbol_.name() << ")";
+  });
+  return true;
+}
+
+bool PlanPrinter::PreVisit(query::plan::ScanAllEdgesByTypeProperty &op) {
+  WithPrintLn([&](auto &out) {
+    out << "* ScanAllEdgesByTypeProperty"
+        << " (" << op.from_symbol_.name() << ")-[" << op.edge_symbol_.name() << " :"
+        << dba_->EdgeTypeToName(op.edge_type_) << " {" << dba_->PropertyToName(op.property_) << "}]->("
+        << op.to_symbol_.name() << ")";
+  });
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::Expand &op) {
   WithPrintLn([&](auto &out) {
     *out_ << "* Expand (" << op.input_symbol_.name() << ")"
@@ -223,6 +253,11 @@ bool PlanPrinter::PreVisit(query::plan::LoadCsv &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::Gather &op) {
+  WithPrintLn([&op](auto &out) { out << "* Gather {" << op.num_workers_ << "}"; });
+  return true;
+}
+
 bool PlanPrinter::Visit(query::plan::Once & /*op*/) {
   WithPrintLn([](auto &out) { out << "* Once"; });
   return true;
@@ -472,6 +507,23 @@ bool PlanToJsonVisitor::PreVisit(ScanAllByLabelProperty &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllByLabelProperties &op) {
+  json self;
+  self["name"] = "ScanAllByLabelProperties";
+  self["label"] = ToJson(op.label_, *dba_);
+  self["properties"] = ToJson(op.properties_, *dba_);
+  self["expressions"] = ToJson(op.expressions_);
+  self["lower_bound"] = op.lower_bound_ ? ToJson(*op.lower_bound_) : json();
+  self["upper_bound"] = op.upper_bound_ ? ToJson(*op.upper_bound_) : json();
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(ScanAllById &op) {
   json self;
   self["name"] = "ScanAllById";
@@ -482,6 +534,40 @@ bool PlanToJsonVisitor::PreVisit(ScanAllById &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllEdgesByType &op) {
+  json self;
+  self["name"] = "ScanAllEdgesByType";
+  self["edge_type"] = ToJson(op.edge_type_, *dba_);
+  self["edge_symbol"] = ToJson(op.edge_symbol_);
+  self["from_symbol"] = ToJson(op.from_symbol_);
+  self["to_symbol"] = ToJson(op.to_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(ScanAllEdgesByTypeProperty &op) {
+  json self;
+  self["name"] = "ScanAllEdgesByTypeProperty";
+  self["edge_type"] = ToJson(op.edge_type_, *dba_);
+  self["property"] = ToJson(op.property_, *dba_);
+  self["expression"] = op.expression_ ? ToJson(op.expression_) : json();
+  self["lower_bound"] = op.lower_bound_ ? ToJson(*op.lower_bound_) : json();
+  self["upper_bound"] = op.upper_bound_ ? ToJson(*op.upper_bound_) : json();
+  self["edge_symbol"] = ToJson(op.edge_symbol_);
+  self["from_symbol"] = ToJson(op.from_symbol_);
+  self["to_symbol"] = ToJson(op.to_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(CreateNode &op) {
   json self;
   self["name"] = "CreateNode";
@@ -839,6 +925,18 @@ bool PlanToJsonVisitor::PreVisit(query::plan::LoadCsv &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(query::plan::Gather &op) {
+  json self;
+  self["name"] = "Gather";
+  self["num_workers"] = op.num_workers_;
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(Distinct &op) {
   json self;
   self["name"] = "Distinct";
@@ -97,6 +97,11 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     if (expand.common_.existing_node) {
       return true;
     }
+    auto edge_scan = GenScanEdgesByIndex(expand);
+    if (edge_scan) {
+      SetOnParent(std::move(edge_scan));
+      return true;
+    }
     ScanAll dst_scan(expand.input(), expand.common_.node_symbol, expand.view_);
     auto indexed_scan = GenScanByIndex(dst_scan, FLAGS_query_vertex_count_to_expand_existing);
     if (indexed_scan) {
@@ -271,6 +276,15 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByLabelProperties &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByLabelProperties &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ScanAllById &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -280,6 +294,24 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllEdgesByType &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllEdgesByType &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(ScanAllEdgesByTypeProperty &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllEdgesByTypeProperty &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ConstructNamedPath &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -453,6 +485,18 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     int64_t vertex_count;
   };
 
+  struct LabelPropertyCompositeIndex {
+    LabelIx label;
+    std::vector<storage::PropertyId> properties;
+    // Equality filters on the leading properties of the index, in index order.
+    std::vector<FilterInfo> prefix_filters;
+    // Optional range filter on the property following the prefix.
+    std::optional<FilterInfo> range_filter;
+    int64_t vertex_count;
+
+    size_t UsedPropertiesCount() const { return prefix_filters.size() + (range_filter ? 1 : 0); }
+  };
+
   bool DefaultPreVisit() override { throw utils::NotYetImplemented("optimizing index lookup"); }
 
   void SetOnParent(const std::shared_ptr<LogicalOperator> &input) {
@@ -514,7 +558,15 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
           continue;
         }
         const auto &property = filter.property_filter->property_;
-        if (!db_->LabelPropertyIndexExists(GetLabel(label), GetProperty(property))) {
+        // A hash index can be used only for looking up single values, which
+        // `ScanAllByLabelPropertyValue` does for both of these filters.
+        const bool is_value_lookup = filter.property_filter->type_ == PropertyFilter::Type::EQUAL ||
+                                     filter.property_filter->type_ == PropertyFilter::Type::IN;
+        // Without a skip-list index the storage scans the label's property
+        // column, which supports every lookup type the skip-list index does.
+        if (!db_->LabelPropertyIndexExists(GetLabel(label), GetProperty(property)) &&
+            !(is_value_lookup && db_->LabelPropertyHashIndexExists(GetLabel(label), GetProperty(property))) &&
+            !db_->PropertyColumnExists(GetLabel(label), GetProperty(property))) {
           continue;
         }
         int64_t vertex_count = db_->VerticesCount(GetLabel(label), GetProperty(property));
@@ -535,6 +587,120 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return found;
   }
 
+  // Finds the composite index which can take the most property filters into
+  // account. Only indices which cover at least 2 filters are considered,
+  // otherwise a single property index is just as good. If there are multiple
+  // such indices, the one with the lowest amount of vertices is picked.
+  std::optional<LabelPropertyCompositeIndex> FindBestLabelPropertyCompositeIndex(
+      const Symbol &symbol, const std::unordered_set<Symbol> &bound_symbols) {
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    std::vector<FilterInfo> property_filters;
+    for (const auto &filter : filters_.PropertyFilters(symbol)) {
+      if (filter.property_filter->is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+      property_filters.push_back(filter);
+    }
+    auto find_filter = [&](storage::PropertyId property, PropertyFilter::Type type) -> std::optional<FilterInfo> {
+      for (const auto &filter : property_filters) {
+        if (filter.property_filter->type_ == type && GetProperty(filter.property_filter->property_) == property) {
+          return filter;
+        }
+      }
+      return std::nullopt;
+    };
+    std::optional<LabelPropertyCompositeIndex> found;
+    for (const auto &label : filters_.FilteredLabels(symbol)) {
+      for (auto &properties : db_->LabelPropertyCompositeIndices(GetLabel(label))) {
+        LabelPropertyCompositeIndex candidate{label, std::move(properties), {}, std::nullopt, 0};
+        for (const auto &property : candidate.properties) {
+          auto filter = find_filter(property, PropertyFilter::Type::EQUAL);
+          if (!filter) break;
+          candidate.prefix_filters.push_back(*filter);
+        }
+        if (candidate.prefix_filters.size() < candidate.properties.size()) {
+          candidate.range_filter =
+              find_filter(candidate.properties[candidate.prefix_filters.size()], PropertyFilter::Type::RANGE);
+        }
+        if (candidate.prefix_filters.empty() || candidate.UsedPropertiesCount() < 2) continue;
+        candidate.vertex_count = db_->VerticesCount(GetLabel(label), candidate.properties, {});
+        if (!found || candidate.UsedPropertiesCount() > found->UsedPropertiesCount() ||
+            (candidate.UsedPropertiesCount() == found->UsedPropertiesCount() &&
+             candidate.vertex_count < found->vertex_count)) {
+          found = std::move(candidate);
+        }
+      }
+    }
+    return found;
+  }
+
+  // Creates a scan of the edge indices replacing the given `expand` together
+  // with the plain ScanAll of its source node. This is only done when the
+  // ScanAll couldn't be replaced by a vertex index, i.e. when the edge is the
+  // only selective part of the pattern, and when the `expand` follows a
+  // single edge type in a single direction. An equality or range filter on
+  // an edge property is used if there's an index for it. Returns `nullptr` if
+  // no edge index can be used.
+  std::unique_ptr<LogicalOperator> GenScanEdgesByIndex(const Expand &expand) {
+    const auto &common = expand.common_;
+    if (common.edge_types.size() != 1 || common.direction == EdgeAtom::Direction::BOTH) return nullptr;
+    const auto &scan = expand.input();
+    if (scan->GetTypeInfo() != ScanAll::kType) return nullptr;
+    const auto &scan_symbol = static_cast<const ScanAll &>(*scan).output_symbol_;
+    if (scan_symbol != expand.input_symbol_ || scan_symbol == common.node_symbol) return nullptr;
+    const auto edge_type = common.edge_types[0];
+    const auto &input = scan->input();
+    const auto &from_symbol = common.direction == EdgeAtom::Direction::OUT ? scan_symbol : common.node_symbol;
+    const auto &to_symbol = common.direction == EdgeAtom::Direction::OUT ? common.node_symbol : scan_symbol;
+    // Values of the property filters must not depend on anything produced by
+    // the replaced operators.
+    const auto &modified_symbols = input->ModifiedSymbols(*symbol_table_);
+    std::unordered_set<Symbol> bound_symbols(modified_symbols.begin(), modified_symbols.end());
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    std::optional<FilterInfo> found_filter;
+    int64_t found_edge_count = 0;
+    for (const auto &filter : filters_.PropertyFilters(common.edge_symbol)) {
+      const auto &property_filter = *filter.property_filter;
+      if (property_filter.is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+      if (property_filter.type_ != PropertyFilter::Type::EQUAL && property_filter.type_ != PropertyFilter::Type::RANGE)
+        continue;
+      const auto property = GetProperty(property_filter.property_);
+      if (!db_->EdgeTypePropertyIndexExists(edge_type, property)) continue;
+      const auto edge_count = db_->EdgesCount(edge_type, property);
+      if (!found_filter || edge_count < found_edge_count ||
+          (edge_count == found_edge_count && property_filter.type_ == PropertyFilter::Type::EQUAL)) {
+        found_filter = filter;
+        found_edge_count = edge_count;
+      }
+    }
+    if (found_filter) {
+      const auto prop_filter = *found_filter->property_filter;
+      filter_exprs_for_removal_.insert(found_filter->expression);
+      filters_.EraseFilter(*found_filter);
+      Expression *value = prop_filter.type_ == PropertyFilter::Type::EQUAL ? prop_filter.value_ : nullptr;
+      return std::make_unique<ScanAllEdgesByTypeProperty>(
+          input, common.edge_symbol, from_symbol, to_symbol, edge_type, GetProperty(prop_filter.property_),
+          prop_filter.property_.name, value, prop_filter.lower_bound_, prop_filter.upper_bound_, expand.view_);
+    }
+    if (db_->EdgeTypeIndexExists(edge_type)) {
+      return std::make_unique<ScanAllEdgesByType>(input, common.edge_symbol, from_symbol, to_symbol, edge_type,
+                                                  expand.view_);
+    }
+    return nullptr;
+  }
+
   // Creates a ScanAll by the best possible index for the `node_symbol`. Best
   // index is defined as the index with least number of vertices. If the node
   // does not have at least a label, no indexed lookup can be created and
@@ -574,6 +740,30 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       // Without labels, we cannot generate any indexed ScanAll.
       return nullptr;
     }
+    auto found_composite_index = FindBestLabelPropertyCompositeIndex(node_symbol, bound_symbols);
+    if (found_composite_index &&
+        (!max_vertex_count || *max_vertex_count >= found_composite_index->vertex_count)) {
+      std::vector<Expression *> prefix;
+      for (const auto &filter : found_composite_index->prefix_filters) {
+        prefix.push_back(filter.property_filter->value_);
+        filter_exprs_for_removal_.insert(filter.expression);
+        filters_.EraseFilter(filter);
+      }
+      std::optional<ScanAllByLabelProperties::Bound> lower_bound;
+      std::optional<ScanAllByLabelProperties::Bound> upper_bound;
+      if (const auto &range_filter = found_composite_index->range_filter) {
+        lower_bound = range_filter->property_filter->lower_bound_;
+        upper_bound = range_filter->property_filter->upper_bound_;
+        filter_exprs_for_removal_.insert(range_filter->expression);
+        filters_.EraseFilter(*range_filter);
+      }
+      std::vector<Expression *> removed_expressions;
+      filters_.EraseLabelFilter(node_symbol, found_composite_index->label, &removed_expressions);
+      filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+      return std::make_unique<ScanAllByLabelProperties>(input, node_symbol, GetLabel(found_composite_index->label),
+                                                        found_composite_index->properties, prefix, lower_bound,
+                                                        upper_bound, view);
+    }
     auto found_index = FindBestLabelPropertyIndex(node_symbol, bound_symbols);
     if (found_index &&
         // Use label+property index if we satisfy max_vertex_count.
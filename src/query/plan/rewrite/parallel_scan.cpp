@@ -0,0 +1,125 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/rewrite/parallel_scan.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "utils/flag_validation.hpp"
+
+DEFINE_VALIDATED_uint64(query_parallel_scan_workers, 0,
+                        "Number of threads used to scan all vertices in read-only queries. "
+                        "Default is 0, which disables parallel scans.",
+                        FLAG_IN_RANGE(0, 1024));
+
+namespace memgraph::query::plan {
+
+namespace {
+
+// Operators which only read the graph and pass the rows from their single
+// input on, possibly modified. Rows may arrive in any order from `Gather`, so
+// operators whose result depends on the input order aren't included.
+bool IsReadOnlyPassThrough(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  return type == Produce::kType || type == Aggregate::kType || type == OrderBy::kType || type == Distinct::kType ||
+         type == Filter::kType || type == Expand::kType || type == ExpandVariable::kType ||
+         type == ConstructNamedPath::kType || type == EdgeUniquenessFilter::kType || type == Unwind::kType;
+}
+
+// Checks that the operator is a `ScanAll` over `Once`, optionally followed by
+// `Filter` operators.
+bool IsParallelizableScan(const LogicalOperator &op) {
+  const auto *curr = &op;
+  while (curr->GetTypeInfo() == Filter::kType) curr = curr->input().get();
+  return curr->GetTypeInfo() == ScanAll::kType && curr->input()->GetTypeInfo() == Once::kType;
+}
+
+// Checks that the value of the expression can be computed again from the
+// symbols which it uses.
+bool IsRecomputable(const Expression *expression) {
+  if (utils::Downcast<const Identifier>(expression)) return true;
+  if (const auto *lookup = utils::Downcast<const PropertyLookup>(expression)) {
+    return IsRecomputable(lookup->expression_);
+  }
+  return false;
+}
+
+// Checks that the aggregations of the workers' rows can be merged into the
+// aggregations of all rows. The groups are merged by computing the group-by
+// expressions again from the remembered symbols.
+bool SupportsPartialAggregation(const Aggregate &aggregate) {
+  for (const auto &element : aggregate.aggregations_) {
+    if (element.op != Aggregation::Op::COUNT && element.op != Aggregation::Op::SUM &&
+        element.op != Aggregation::Op::MIN && element.op != Aggregation::Op::MAX) {
+      return false;
+    }
+  }
+  return std::all_of(aggregate.group_by_.begin(), aggregate.group_by_.end(), IsRecomputable);
+}
+
+// Returns the aggregation which merges the partial results of `op`.
+Aggregation::Op MergeOp(Aggregation::Op op) { return op == Aggregation::Op::COUNT ? Aggregation::Op::SUM : op; }
+
+}  // namespace
+
+std::unique_ptr<LogicalOperator> RewriteWithParallelScan(std::unique_ptr<LogicalOperator> root_op,
+                                                         uint64_t num_workers, SymbolTable *symbol_table,
+                                                         AstStorage *ast_storage) {
+  if (num_workers <= 1) return root_op;
+
+  LogicalOperator *parent = nullptr;
+  LogicalOperator *op = root_op.get();
+  // Set while there is a `Skip` or `Limit` which isn't preceded by an operator
+  // that establishes the order of the rows.
+  bool order_dependent = false;
+  while (!IsParallelizableScan(*op)) {
+    const auto &type = op->GetTypeInfo();
+    if (type == Skip::kType || type == Limit::kType) {
+      order_dependent = true;
+    } else if (type == OrderBy::kType || type == Aggregate::kType) {
+      order_dependent = false;
+    } else if (!IsReadOnlyPassThrough(*op)) {
+      return root_op;
+    }
+    parent = op;
+    op = op->input().get();
+  }
+  // The root of a complete plan is never the scan itself, because the results
+  // have to be produced.
+  if (!parent || order_dependent) return root_op;
+
+  if (parent->GetTypeInfo() == Aggregate::kType && SupportsPartialAggregation(static_cast<Aggregate &>(*parent))) {
+    // Each worker aggregates its own rows and only the partial results are
+    // merged after the `Gather`.
+    auto &aggregate = static_cast<Aggregate &>(*parent);
+    std::vector<Aggregate::Element> partial_aggregations;
+    partial_aggregations.reserve(aggregate.aggregations_.size());
+    for (auto &element : aggregate.aggregations_) {
+      const auto &partial_symbol = symbol_table->CreateAnonymousSymbol();
+      partial_aggregations.push_back(Aggregate::Element{element.value, element.key, element.op, partial_symbol});
+      auto *partial_value = ast_storage->Create<Identifier>(partial_symbol.name());
+      partial_value->MapTo(partial_symbol);
+      element = Aggregate::Element{partial_value, nullptr, MergeOp(element.op), element.output_sym};
+    }
+    auto partial_aggregate = std::make_shared<Aggregate>(aggregate.input(), partial_aggregations,
+                                                         aggregate.group_by_, aggregate.remember_);
+    aggregate.set_input(std::make_shared<Gather>(partial_aggregate, num_workers));
+    return root_op;
+  }
+
+  parent->set_input(std::make_shared<Gather>(parent->input(), num_workers));
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,44 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides a plan rewriter which splits the vertex scan of
+/// read-only plans between multiple threads by inserting a `Gather` operator.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "query/plan/operator.hpp"
+
+DECLARE_uint64(query_parallel_scan_workers);
+
+namespace memgraph::query::plan {
+
+/// Wraps the `ScanAll` of a read-only plan, together with the `Filter`
+/// operators directly above it, into a `Gather` operator which runs the scan
+/// using `num_workers` threads. The plan is returned unchanged if it modifies
+/// the graph, if it doesn't start with a plain `ScanAll` or if parallelizing
+/// would change which rows are returned (e.g. `LIMIT` without `ORDER BY`).
+/// An `Aggregate` directly above the scan is split into partial aggregations
+/// which run in the workers and an `Aggregate` above the `Gather` which merges
+/// them, if its aggregations are `count`, `sum`, `min` and `max` and it groups
+/// by variables or their properties. The symbols and expressions of the
+/// partial aggregations are added to `symbol_table` and `ast_storage`. Other
+/// operators above the `Gather` still run on the thread that pulls the plan.
+std::unique_ptr<LogicalOperator> RewriteWithParallelScan(std::unique_ptr<LogicalOperator> root_op,
+                                                         uint64_t num_workers, SymbolTable *symbol_table,
+                                                         AstStorage *ast_storage);
+
+}  // namespace memgraph::query::plan
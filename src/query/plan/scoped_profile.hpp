@@ -60,6 +60,15 @@ class ScopedProfile {
     }
   }
 
+  /// Counts additional hits of the operator. Used by operators that produce
+  /// a whole batch of rows in a single call, so that every row counts as a
+  /// hit as if it was pulled on its own.
+  void AddHits(uint64_t hits) noexcept {
+    if (UNLIKELY(context_->is_profile_query)) {
+      stats_->actual_hits += hits;
+    }
+  }
+
   ~ScopedProfile() noexcept {
     if (UNLIKELY(context_->is_profile_query)) {
       stats_->num_cycles += utils::ReadTSC() - start_time_;
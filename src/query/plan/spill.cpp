@@ -0,0 +1,207 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/spill.hpp"
+
+#include <string>
+#include <utility>
+
+#include "query/exceptions.hpp"
+#include "query/path.hpp"
+#include "utils/file.hpp"
+#include "utils/uuid.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+
+constexpr std::string_view kSpillMagic{"MGsp"};
+constexpr uint64_t kSpillVersion{1};
+
+// Every value is written as its tag followed by the value. Values which can
+// be stored as properties are written as property values.
+enum class ValueTag : uint64_t { PROPERTY_VALUE, LIST, MAP, VERTEX, EDGE, PATH };
+
+[[noreturn]] void ThrowReadError() {
+  throw QueryRuntimeException("Couldn't read the intermediate results spilled to disk.");
+}
+
+}  // namespace
+
+SpillFile::SpillFile(const std::filesystem::path &directory) {
+  if (!utils::EnsureDir(directory)) {
+    throw QueryRuntimeException("Couldn't create the directory for spilling intermediate results to disk.");
+  }
+  path_ = directory / utils::GenerateUUID();
+  encoder_.Initialize(path_, kSpillMagic, kSpillVersion);
+}
+
+SpillFile::~SpillFile() {
+  encoder_.Close();
+  utils::DeleteFile(path_);
+}
+
+void SpillFile::Write(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::List:
+      encoder_.WriteUint(static_cast<uint64_t>(ValueTag::LIST));
+      encoder_.WriteUint(value.ValueList().size());
+      for (const auto &element : value.ValueList()) Write(element);
+      break;
+    case TypedValue::Type::Map:
+      encoder_.WriteUint(static_cast<uint64_t>(ValueTag::MAP));
+      encoder_.WriteUint(value.ValueMap().size());
+      for (const auto &[key, element] : value.ValueMap()) {
+        encoder_.WriteString(key);
+        Write(element);
+      }
+      break;
+    case TypedValue::Type::Vertex:
+      encoder_.WriteUint(static_cast<uint64_t>(ValueTag::VERTEX));
+      WriteVertex(value.ValueVertex());
+      break;
+    case TypedValue::Type::Edge:
+      encoder_.WriteUint(static_cast<uint64_t>(ValueTag::EDGE));
+      WriteEdge(value.ValueEdge());
+      break;
+    case TypedValue::Type::Path: {
+      const auto &path = value.ValuePath();
+      encoder_.WriteUint(static_cast<uint64_t>(ValueTag::PATH));
+      encoder_.WriteUint(path.edges().size());
+      WriteVertex(path.vertices()[0]);
+      for (size_t i = 0; i < path.edges().size(); ++i) {
+        WriteEdge(path.edges()[i]);
+        WriteVertex(path.vertices()[i + 1]);
+      }
+      break;
+    }
+    case TypedValue::Type::Null:
+    case TypedValue::Type::Bool:
+    case TypedValue::Type::Int:
+    case TypedValue::Type::Double:
+    case TypedValue::Type::String:
+    case TypedValue::Type::Date:
+    case TypedValue::Type::LocalTime:
+    case TypedValue::Type::LocalDateTime:
+    case TypedValue::Type::Duration:
+      encoder_.WriteUint(static_cast<uint64_t>(ValueTag::PROPERTY_VALUE));
+      encoder_.WritePropertyValue(storage::PropertyValue(value));
+      break;
+  }
+}
+
+void SpillFile::StartReading() {
+  encoder_.Close();
+  if (!decoder_.Initialize(path_, std::string(kSpillMagic))) ThrowReadError();
+}
+
+TypedValue SpillFile::Read(DbAccessor *dba, utils::MemoryResource *memory) {
+  switch (static_cast<ValueTag>(ReadUint())) {
+    case ValueTag::PROPERTY_VALUE: {
+      auto value = decoder_.ReadPropertyValue();
+      if (!value) ThrowReadError();
+      return TypedValue(std::move(*value), memory);
+    }
+    case ValueTag::LIST: {
+      const auto size = ReadUint();
+      TypedValue::TVector list(memory);
+      list.reserve(size);
+      for (uint64_t i = 0; i < size; ++i) list.emplace_back(Read(dba, memory));
+      return TypedValue(std::move(list), memory);
+    }
+    case ValueTag::MAP: {
+      const auto size = ReadUint();
+      TypedValue::TMap map(memory);
+      for (uint64_t i = 0; i < size; ++i) {
+        auto key = decoder_.ReadString();
+        if (!key) ThrowReadError();
+        map.emplace(TypedValue::TString(*key, memory), Read(dba, memory));
+      }
+      return TypedValue(std::move(map), memory);
+    }
+    case ValueTag::VERTEX:
+      return TypedValue(ReadVertex(dba), memory);
+    case ValueTag::EDGE:
+      return TypedValue(ReadEdge(dba), memory);
+    case ValueTag::PATH: {
+      const auto size = ReadUint();
+      Path path(ReadVertex(dba), memory);
+      for (uint64_t i = 0; i < size; ++i) {
+        path.Expand(ReadEdge(dba));
+        path.Expand(ReadVertex(dba));
+      }
+      return TypedValue(std::move(path), memory);
+    }
+  }
+  ThrowReadError();
+}
+
+void SpillFile::WriteVertex(const VertexAccessor &vertex) { encoder_.WriteUint(vertex.Gid().AsUint()); }
+
+// Edges are looked up among the out edges of their source vertex.
+void SpillFile::WriteEdge(const EdgeAccessor &edge) {
+  encoder_.WriteUint(edge.Gid().AsUint());
+  WriteVertex(edge.From());
+}
+
+VertexAccessor SpillFile::ReadVertex(DbAccessor *dba) {
+  const auto gid = storage::Gid::FromUint(ReadUint());
+  // The vertex could have been deleted after it was spilled.
+  for (auto view : {storage::View::NEW, storage::View::OLD}) {
+    if (auto vertex = dba->FindVertex(gid, view)) return *vertex;
+  }
+  throw QueryRuntimeException("Couldn't find a node spilled to disk.");
+}
+
+EdgeAccessor SpillFile::ReadEdge(DbAccessor *dba) {
+  const auto gid = storage::Gid::FromUint(ReadUint());
+  const auto from = ReadVertex(dba);
+  for (auto view : {storage::View::NEW, storage::View::OLD}) {
+    auto maybe_edges = from.OutEdges(view);
+    if (maybe_edges.HasError()) continue;
+    for (const auto &edge : *maybe_edges) {
+      if (edge.Gid() == gid) return edge;
+    }
+  }
+  throw QueryRuntimeException("Couldn't find a relationship spilled to disk.");
+}
+
+uint64_t SpillFile::ReadUint() {
+  auto value = decoder_.ReadUint();
+  if (!value) ThrowReadError();
+  return *value;
+}
+
+uint64_t EstimateMemoryUsage(const TypedValue &value) {
+  uint64_t size = sizeof(TypedValue);
+  switch (value.type()) {
+    case TypedValue::Type::String:
+      size += value.ValueString().size();
+      break;
+    case TypedValue::Type::List:
+      for (const auto &element : value.ValueList()) size += EstimateMemoryUsage(element);
+      break;
+    case TypedValue::Type::Map:
+      for (const auto &[key, element] : value.ValueMap()) {
+        size += sizeof(TypedValue::TString) + key.size() + EstimateMemoryUsage(element);
+      }
+      break;
+    case TypedValue::Type::Path:
+      size += value.ValuePath().vertices().size() * sizeof(VertexAccessor) +
+              value.ValuePath().edges().size() * sizeof(EdgeAccessor);
+      break;
+    default:
+      break;
+  }
+  return size;
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,73 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+#include "query/db_accessor.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/durability/serialization.hpp"
+
+namespace memgraph::query::plan {
+
+/// Temporary file to which the operators that accumulate their input spill
+/// rows of values once the input uses too much memory, see
+/// `ExecutionContext::spill_threshold_bytes`. All the rows are written before
+/// they are read back in the order in which they were written. The file is
+/// removed when the object is destroyed.
+///
+/// Vertices and edges are written by their gids and looked up again through
+/// the accessor when they are read, so the accessor must be the same one that
+/// was used while writing.
+class SpillFile {
+ public:
+  explicit SpillFile(const std::filesystem::path &directory);
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile(SpillFile &&) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile &operator=(SpillFile &&) = delete;
+  ~SpillFile();
+
+  void Write(const TypedValue &value);
+
+  /// Marks the end of a row, i.e. of the values written since the previous
+  /// row was ended.
+  void EndRow() { ++rows_; }
+
+  /// Stops writing and starts reading from the beginning of the file.
+  void StartReading();
+
+  TypedValue Read(DbAccessor *dba, utils::MemoryResource *memory);
+
+  /// Returns the number of written rows.
+  uint64_t rows() const { return rows_; }
+
+ private:
+  void WriteVertex(const VertexAccessor &vertex);
+  void WriteEdge(const EdgeAccessor &edge);
+  VertexAccessor ReadVertex(DbAccessor *dba);
+  EdgeAccessor ReadEdge(DbAccessor *dba);
+  uint64_t ReadUint();
+
+  std::filesystem::path path_;
+  storage::durability::Encoder encoder_;
+  storage::durability::Decoder decoder_;
+  uint64_t rows_{0};
+};
+
+/// Returns an estimate of the memory used by the value, which is compared to
+/// the spill threshold.
+uint64_t EstimateMemoryUsage(const TypedValue &value);
+
+}  // namespace memgraph::query::plan
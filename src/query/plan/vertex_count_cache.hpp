@@ -12,9 +12,12 @@
 /// @file
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "query/typed_value.hpp"
+#include "storage/v2/graph_statistics.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/bound.hpp"
@@ -72,12 +75,58 @@ class VertexCountCache {
     return bounds_vertex_count.at(bounds);
   }
 
+  /// Composite index counts are forwarded without memoization, because they
+  /// are only requested for the few composite index scans of a plan.
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) {
+    return db_->VerticesCount(label, properties, prefix);
+  }
+
+  /// Edge index counts are forwarded without memoization, because they are
+  /// only requested for the few edge index scans of a plan.
+  int64_t EdgesCount(storage::EdgeTypeId edge_type) { return db_->EdgesCount(edge_type); }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return db_->EdgesCount(edge_type, property);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property, const storage::PropertyValue &value) {
+    return db_->EdgesCount(edge_type, property, value);
+  }
+
+  /// Returns the graph statistics, which are read from the database only once
+  /// so that all plans are estimated using the same statistics.
+  std::shared_ptr<const storage::GraphStatistics> GetGraphStatistics() {
+    if (!graph_statistics_) graph_statistics_ = db_->GetGraphStatistics();
+    return *graph_statistics_;
+  }
+
   bool LabelIndexExists(storage::LabelId label) { return db_->LabelIndexExists(label); }
 
   bool LabelPropertyIndexExists(storage::LabelId label, storage::PropertyId property) {
     return db_->LabelPropertyIndexExists(label, property);
   }
 
+  bool LabelPropertyHashIndexExists(storage::LabelId label, storage::PropertyId property) {
+    return db_->LabelPropertyHashIndexExists(label, property);
+  }
+
+  bool PropertyColumnExists(storage::LabelId label, storage::PropertyId property) {
+    return db_->PropertyColumnExists(label, property);
+  }
+
+  bool LabelPropertyCompositeIndexExists(storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    return db_->LabelPropertyCompositeIndexExists(label, properties);
+  }
+
+  auto LabelPropertyCompositeIndices(storage::LabelId label) { return db_->LabelPropertyCompositeIndices(label); }
+
+  bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) { return db_->EdgeTypeIndexExists(edge_type); }
+
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return db_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
  private:
   typedef std::pair<storage::LabelId, storage::PropertyId> LabelPropertyKey;
 
@@ -120,6 +169,7 @@ class VertexCountCache {
 
   TDbAccessor *db_;
   std::optional<int64_t> vertices_count_;
+  std::optional<std::shared_ptr<const storage::GraphStatistics>> graph_statistics_;
   std::unordered_map<storage::LabelId, int64_t> label_vertex_count_;
   std::unordered_map<LabelPropertyKey, int64_t, LabelPropertyHash> label_property_vertex_count_;
   std::unordered_map<
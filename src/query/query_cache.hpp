@@ -0,0 +1,144 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "utils/event_counter.hpp"
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::query {
+
+/// Cache of parsed queries or query plans, keyed by the hash of the stripped
+/// query. Every entry is inserted with an estimate of the memory it uses and
+/// the least recently used entries are evicted once the total size exceeds
+/// the capacity. The entries are handed out as shared pointers, so an entry
+/// that is evicted stays valid while it is still being used. This class is
+/// thread safe.
+template <typename TValue>
+class QueryCache {
+ public:
+  struct Counters {
+    EventCounter::Event hit;
+    EventCounter::Event miss;
+    EventCounter::Event eviction;
+  };
+
+  QueryCache(uint64_t capacity_bytes, Counters counters) : capacity_bytes_(capacity_bytes), counters_(counters) {}
+
+  QueryCache(const QueryCache &) = delete;
+  QueryCache(QueryCache &&) = delete;
+  QueryCache &operator=(const QueryCache &) = delete;
+  QueryCache &operator=(QueryCache &&) = delete;
+  ~QueryCache() = default;
+
+  /// Returns the entry with the given key or nullptr if there is no such
+  /// entry. An entry for which `is_stale` returns true is removed from the
+  /// cache and isn't returned.
+  template <typename TFunc>
+  std::shared_ptr<TValue> Find(uint64_t key, const TFunc &is_stale) {
+    std::shared_ptr<TValue> value;
+    {
+      std::lock_guard guard(lock_);
+      auto found = entries_.find(key);
+      if (found != entries_.end()) {
+        if (is_stale(*found->second->value)) {
+          Remove(found);
+        } else {
+          // Move the entry to the front of the LRU order.
+          lru_order_.splice(lru_order_.begin(), lru_order_, found->second);
+          value = found->second->value;
+        }
+      }
+    }
+    EventCounter::IncrementCounter(value ? counters_.hit : counters_.miss);
+    return value;
+  }
+
+  std::shared_ptr<TValue> Find(uint64_t key) {
+    return Find(key, [](const TValue & /*value*/) { return false; });
+  }
+
+  /// Inserts the value which uses approximately `size_bytes` of memory and
+  /// evicts the least recently used entries to make room for it. If another
+  /// value was inserted with the same key in the meantime, that value is kept
+  /// and returned instead. A value larger than the whole cache isn't cached.
+  std::shared_ptr<TValue> Insert(uint64_t key, std::shared_ptr<TValue> value, uint64_t size_bytes) {
+    std::lock_guard guard(lock_);
+    if (auto found = entries_.find(key); found != entries_.end()) {
+      return found->second->value;
+    }
+    if (size_bytes > capacity_bytes_) return value;
+    uint64_t evicted = 0;
+    while (size_bytes_ + size_bytes > capacity_bytes_) {
+      Remove(entries_.find(lru_order_.back().key));
+      ++evicted;
+    }
+    if (evicted > 0) EventCounter::IncrementCounter(counters_.eviction, evicted);
+    lru_order_.push_front(Entry{key, value, size_bytes});
+    entries_.emplace(key, lru_order_.begin());
+    size_bytes_ += size_bytes;
+    return value;
+  }
+
+  /// Removes all entries, e.g. when the plans are invalidated by a change of
+  /// the indices or constraints.
+  void Clear() {
+    std::lock_guard guard(lock_);
+    entries_.clear();
+    lru_order_.clear();
+    size_bytes_ = 0;
+  }
+
+  /// Returns the number of cached entries.
+  size_t Size() const {
+    std::lock_guard guard(lock_);
+    return entries_.size();
+  }
+
+  /// Returns the estimated total size of the cached entries.
+  uint64_t SizeBytes() const {
+    std::lock_guard guard(lock_);
+    return size_bytes_;
+  }
+
+ private:
+  struct Entry {
+    uint64_t key;
+    std::shared_ptr<TValue> value;
+    uint64_t size_bytes;
+  };
+
+  using EntryMap = std::unordered_map<uint64_t, typename std::list<Entry>::iterator>;
+
+  void Remove(typename EntryMap::iterator found) {
+    size_bytes_ -= found->second->size_bytes;
+    lru_order_.erase(found->second);
+    entries_.erase(found);
+  }
+
+  const uint64_t capacity_bytes_;
+  const Counters counters_;
+
+  mutable utils::SpinLock lock_;
+  // The most recently used entry is at the front.
+  std::list<Entry> lru_order_;
+  EntryMap entries_;
+  uint64_t size_bytes_{0};
+};
+
+}  // namespace memgraph::query
@@ -0,0 +1,163 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::storage {
+
+// Forward declaration because we only store a pointer here.
+struct Vertex;
+
+/// Incoming or outgoing edges of a vertex grouped by edge type.
+///
+/// The edges are kept in a small directory of groups sorted by edge type, each
+/// group holding the edges of one type in a contiguous vector. Looking up the
+/// edges of a given type therefore costs O(log(types) + matching edges)
+/// instead of scanning all edges of the vertex, which matters for vertices
+/// with a large degree. Groups never stay empty, so the number of groups is
+/// bounded by the number of distinct edge types of the vertex.
+///
+/// Iteration yields `std::tuple<EdgeTypeId, Vertex *, EdgeRef>` values grouped
+/// by edge type. The order of edges within a group isn't stable across
+/// removals.
+class AdjacencyList {
+ public:
+  using Item = std::tuple<EdgeTypeId, Vertex *, EdgeRef>;
+  using Edges = std::vector<std::pair<Vertex *, EdgeRef>>;
+
+  struct Group {
+    EdgeTypeId edge_type;
+    Edges edges;
+  };
+
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Item;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Item *;
+    using reference = Item;
+
+    Iterator(const std::vector<Group> *groups, size_t group, size_t offset)
+        : groups_(groups), group_(group), offset_(offset) {}
+
+    Item operator*() const {
+      const auto &group = (*groups_)[group_];
+      const auto &[vertex, edge] = group.edges[offset_];
+      return {group.edge_type, vertex, edge};
+    }
+
+    Iterator &operator++() {
+      if (++offset_ == (*groups_)[group_].edges.size()) {
+        ++group_;
+        offset_ = 0;
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const { return group_ == other.group_ && offset_ == other.offset_; }
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+   private:
+    const std::vector<Group> *groups_;
+    size_t group_;
+    size_t offset_;
+  };
+
+  Iterator begin() const { return Iterator(&groups_, 0, 0); }
+  Iterator end() const { return Iterator(&groups_, groups_.size(), 0); }
+
+  size_t size() const {
+    size_t size = 0;
+    for (const auto &group : groups_) size += group.edges.size();
+    return size;
+  }
+
+  bool empty() const { return groups_.empty(); }
+
+  void clear() { groups_.clear(); }
+
+  /// Returns the edges of the given type or `nullptr` if there are none.
+  const Edges *edges(EdgeTypeId edge_type) const {
+    auto it = FindGroup(edge_type);
+    if (it == groups_.end() || it->edge_type != edge_type) return nullptr;
+    return &it->edges;
+  }
+
+  const std::vector<Group> &groups() const { return groups_; }
+
+  /// Adds the edge without checking whether it is already in the list.
+  void emplace_back(EdgeTypeId edge_type, Vertex *vertex, EdgeRef edge) {
+    auto it = FindGroup(edge_type);
+    if (it == groups_.end() || it->edge_type != edge_type) {
+      it = groups_.insert(it, Group{edge_type, {}});
+    }
+    it->edges.emplace_back(vertex, edge);
+  }
+
+  void push_back(const Item &item) {
+    const auto &[edge_type, vertex, edge] = item;
+    emplace_back(edge_type, vertex, edge);
+  }
+
+  bool contains(const Item &item) const {
+    const auto &[edge_type, vertex, edge] = item;
+    const auto *group = edges(edge_type);
+    if (!group) return false;
+    return std::find(group->begin(), group->end(), std::make_pair(vertex, edge)) != group->end();
+  }
+
+  /// Removes the edge from the list.
+  /// @return false if the edge isn't in the list
+  bool erase(const Item &item) {
+    const auto &[edge_type, vertex, edge] = item;
+    auto group = FindGroup(edge_type);
+    if (group == groups_.end() || group->edge_type != edge_type) return false;
+    auto &edges = group->edges;
+    auto it = std::find(edges.begin(), edges.end(), std::make_pair(vertex, edge));
+    if (it == edges.end()) return false;
+    std::swap(*it, edges.back());
+    edges.pop_back();
+    if (edges.empty()) groups_.erase(group);
+    return true;
+  }
+
+ private:
+  std::vector<Group>::iterator FindGroup(EdgeTypeId edge_type) {
+    return std::lower_bound(groups_.begin(), groups_.end(), edge_type,
+                            [](const Group &group, EdgeTypeId edge_type) { return group.edge_type < edge_type; });
+  }
+
+  std::vector<Group>::const_iterator FindGroup(EdgeTypeId edge_type) const {
+    return std::lower_bound(groups_.begin(), groups_.end(), edge_type,
+                            [](const Group &group, EdgeTypeId edge_type) { return group.edge_type < edge_type; });
+  }
+
+  std::vector<Group> groups_;
+};
+
+}  // namespace memgraph::storage
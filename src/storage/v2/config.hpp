@@ -27,6 +27,14 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+
+    // Undo buffer unlinking and index cleanup are split into independent
+    // tasks that are run by this many threads (including the GC thread).
+    uint64_t thread_count{1};
+
+    // The GC stops unlinking undo buffers once a cycle spends this much time
+    // on them and continues in the next cycle. Zero means no limit.
+    std::chrono::milliseconds unlink_time_budget{0};
   } gc;
 
   struct Items {
@@ -48,10 +56,58 @@ struct Config {
     uint64_t wal_file_size_kibibytes{20 * 1024};
     uint64_t wal_file_flush_every_n_tx{100000};
 
+    // When enabled, every commit waits until its WAL data is synced to disk
+    // and `wal_file_flush_every_n_tx` is ignored. The WAL is synced before the
+    // changes of the commit become visible to other transactions.
+    bool wal_group_commit{false};
+
+    // Lets the changes of a commit become visible before its WAL data is
+    // synced when `wal_group_commit` is enabled. The commit still returns only
+    // once the data is durable, but the syncs of concurrent commits are then
+    // batched together by a dedicated writer thread. A transaction can read
+    // data that is lost if the database crashes before the sync.
+    bool wal_group_commit_visible_before_durable{false};
+
     bool snapshot_on_exit{false};
 
+    // Vertices and edges are written to (and read from) the snapshot in
+    // independently decodable batches of this many objects. The batches are
+    // processed in parallel by `snapshot_thread_count` threads during
+    // snapshot creation and by `recovery_thread_count` threads during
+    // snapshot recovery. The WAL deltas of different vertices and edges are
+    // also applied in parallel by `recovery_thread_count` threads. During
+    // snapshot creation every thread holds one encoded batch in memory.
+    uint64_t items_per_batch{1000000};
+    uint64_t snapshot_thread_count{8};
+    uint64_t recovery_thread_count{8};
+
+    // Snapshots are recovered by decoding the data directly from the file
+    // mapped into memory instead of reading the file through a buffer.
+    bool snapshot_recovery_mmap{true};
   } durability;
 
+  struct Replication {
+    // Transactions committed while a replica is receiving the previous batch
+    // are coalesced into batches that are sent in a single AppendDeltasRpc.
+    // A batch isn't extended once it holds this many kibibytes of deltas.
+    uint64_t batch_size_kibibytes{1024};
+
+    // At most this many batches wait for a replica while another one is being
+    // sent. Further commits wait for a SYNC replica, while an ASYNC replica
+    // falls behind and is recovered from the durability files.
+    uint64_t max_pending_batches{16};
+
+    // Batches are compressed with zlib before they are sent. Batches larger
+    // than `replication::kMaxCompressedBatchSize` are sent uncompressed.
+    bool compress_batches{false};
+
+    // Lets the changes of a commit become visible before the SYNC replicas
+    // acknowledge it. The commit still returns only once they do, but the
+    // transactions committed in the meantime are then coalesced into the same
+    // batches. A transaction can read data that a failover to a replica loses.
+    bool visible_before_sync_ack{false};
+  } replication;
+
   struct Transaction {
     IsolationLevel isolation_level{IsolationLevel::SNAPSHOT_ISOLATION};
   } transaction;
@@ -0,0 +1,166 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/delta.hpp"
+
+namespace memgraph::storage {
+
+/// Append-only buffer holding the deltas (undo buffer) of a transaction.
+///
+/// Deltas are constructed in place inside chunks whose size grows
+/// geometrically up to `kMaxChunkSize`, so a transaction creating N deltas
+/// does O(log N) allocations for small transactions and one allocation per
+/// `kMaxChunkSize` deltas for large ones, instead of one allocation per delta.
+/// A delta never moves once it is created because the version chains point to
+/// it. All deltas are destroyed and all chunks released together when the
+/// buffer is destroyed, i.e. when the GC collects the undo buffer.
+class DeltaBuffer {
+ private:
+  struct Chunk {
+    Delta *data;
+    size_t size;
+    size_t capacity;
+  };
+
+  template <bool IsConst>
+  class IteratorImpl {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Delta;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const Delta *, Delta *>;
+    using reference = std::conditional_t<IsConst, const Delta &, Delta &>;
+
+    IteratorImpl(const std::vector<Chunk> *chunks, size_t chunk, size_t offset)
+        : chunks_(chunks), chunk_(chunk), offset_(offset) {}
+
+    reference operator*() const { return (*chunks_)[chunk_].data[offset_]; }
+    pointer operator->() const { return &(*chunks_)[chunk_].data[offset_]; }
+
+    IteratorImpl &operator++() {
+      if (++offset_ == (*chunks_)[chunk_].size) {
+        ++chunk_;
+        offset_ = 0;
+      }
+      return *this;
+    }
+
+    IteratorImpl operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const IteratorImpl &other) const { return chunk_ == other.chunk_ && offset_ == other.offset_; }
+    bool operator!=(const IteratorImpl &other) const { return !(*this == other); }
+
+   private:
+    const std::vector<Chunk> *chunks_;
+    size_t chunk_;
+    size_t offset_;
+  };
+
+ public:
+  static constexpr size_t kInitialChunkSize = 16;
+  static constexpr size_t kMaxChunkSize = 4096;
+
+  using Iterator = IteratorImpl<false>;
+  using ConstIterator = IteratorImpl<true>;
+
+  DeltaBuffer() = default;
+
+  DeltaBuffer(DeltaBuffer &&other) noexcept
+      : chunks_(std::exchange(other.chunks_, {})), size_(std::exchange(other.size_, 0)) {}
+
+  DeltaBuffer &operator=(DeltaBuffer &&other) noexcept {
+    if (this == &other) return *this;
+    clear();
+    chunks_ = std::exchange(other.chunks_, {});
+    size_ = std::exchange(other.size_, 0);
+    return *this;
+  }
+
+  DeltaBuffer(const DeltaBuffer &) = delete;
+  DeltaBuffer &operator=(const DeltaBuffer &) = delete;
+
+  ~DeltaBuffer() { clear(); }
+
+  /// Constructs a new delta at the end of the buffer.
+  /// @throw std::bad_alloc
+  template <typename... Args>
+  Delta &emplace_back(Args &&...args) {
+    if (chunks_.empty() || chunks_.back().size == chunks_.back().capacity) {
+      AddChunk();
+    }
+    auto &chunk = chunks_.back();
+    try {
+      new (chunk.data + chunk.size) Delta(std::forward<Args>(args)...);
+    } catch (...) {
+      // Chunks must never be empty, otherwise the iterators would stop on
+      // them.
+      if (chunk.size == 0) {
+        ::operator delete(chunk.data);
+        chunks_.pop_back();
+      }
+      throw;
+    }
+    ++size_;
+    return chunk.data[chunk.size++];
+  }
+
+  Iterator begin() { return Iterator(&chunks_, 0, 0); }
+  Iterator end() { return Iterator(&chunks_, chunks_.size(), 0); }
+  ConstIterator begin() const { return ConstIterator(&chunks_, 0, 0); }
+  ConstIterator end() const { return ConstIterator(&chunks_, chunks_.size(), 0); }
+
+  size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  /// Destroys all deltas and releases the memory of the buffer.
+  void clear() {
+    for (auto &chunk : chunks_) {
+      std::destroy_n(chunk.data, chunk.size);
+      ::operator delete(chunk.data);
+    }
+    chunks_.clear();
+    size_ = 0;
+  }
+
+ private:
+  void AddChunk() {
+    // Reserve first so that the chunk memory can't leak if growing the
+    // directory fails.
+    if (chunks_.size() == chunks_.capacity()) chunks_.reserve(std::max<size_t>(4, 2 * chunks_.size()));
+    auto capacity = std::clamp(size_, kInitialChunkSize, kMaxChunkSize);
+    auto *data = static_cast<Delta *>(::operator new(capacity * sizeof(Delta)));
+    chunks_.push_back(Chunk{data, 0, capacity});
+  }
+
+  std::vector<Chunk> chunks_;
+  size_t size_{0};
+};
+
+static_assert(alignof(Delta) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+              "The DeltaBuffer chunks aren't aligned enough for the Delta!");
+
+}  // namespace memgraph::storage
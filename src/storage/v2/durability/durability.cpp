@@ -27,6 +27,7 @@
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/wal.hpp"
+#include "utils/file.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
 #include "utils/message.hpp"
@@ -61,6 +62,21 @@ void VerifyStorageDirectoryOwnerAndProcessUserOrDie(const std::filesystem::path
             user_process, user_directory, user_directory);
 }
 
+void RemoveSnapshotBatchFiles(const std::filesystem::path &snapshot_directory) {
+  if (!utils::DirExists(snapshot_directory)) return;
+  std::error_code error_code;
+  for (const auto &item : std::filesystem::directory_iterator(snapshot_directory, error_code)) {
+    if (!item.is_regular_file()) continue;
+    const auto name = item.path().filename().string();
+    if (name.find("_edges_batch_") == std::string::npos && name.find("_vertices_batch_") == std::string::npos) continue;
+    spdlog::info("Removing stale snapshot batch file {}.", item.path());
+    utils::DeleteFile(item.path());
+  }
+  if (error_code) {
+    spdlog::warn("Couldn't remove stale snapshot batch files because an error occurred: {}!", error_code.message());
+  }
+}
+
 std::vector<SnapshotDurabilityInfo> GetSnapshotFiles(const std::filesystem::path &snapshot_directory,
                                                      const std::string_view uuid) {
   std::vector<SnapshotDurabilityInfo> snapshot_files;
@@ -133,6 +149,54 @@ void RecoverIndicesAndConstraints(const RecoveredIndicesAndConstraints &indices_
     spdlog::info("A label+property index is recreated from metadata.");
   }
   spdlog::info("Label+property indices are recreated.");
+
+  // Recover composite indices.
+  spdlog::info("Recreating {} composite indices from metadata.",
+               indices_constraints.indices.label_property_composite.size());
+  for (const auto &item : indices_constraints.indices.label_property_composite) {
+    if (!indices->label_property_composite_index.CreateIndex(item.first, item.second, vertices->access()))
+      throw RecoveryFailure("The composite index must be created here!");
+    spdlog::info("A composite index is recreated from metadata.");
+  }
+  spdlog::info("Composite indices are recreated.");
+
+  // Recover hash indices.
+  spdlog::info("Recreating {} hash indices from metadata.", indices_constraints.indices.label_property_hash.size());
+  for (const auto &item : indices_constraints.indices.label_property_hash) {
+    if (!indices->label_property_hash_index.CreateIndex(item.first, item.second, vertices->access()))
+      throw RecoveryFailure("The hash index must be created here!");
+    spdlog::info("A hash index is recreated from metadata.");
+  }
+  spdlog::info("Hash indices are recreated.");
+
+  // Recover property columns.
+  spdlog::info("Recreating property columns of {} labels from metadata.",
+               indices_constraints.indices.property_columns.size());
+  for (const auto &item : indices_constraints.indices.property_columns) {
+    if (!indices->property_columns.CreateColumns(item.first, item.second, vertices->access()))
+      throw RecoveryFailure("The property columns must be created here!");
+    spdlog::info("Property columns are recreated from metadata.");
+  }
+  spdlog::info("Property columns are recreated.");
+
+  // Recover edge type indices.
+  spdlog::info("Recreating {} edge type indices from metadata.", indices_constraints.indices.edge_type.size());
+  for (const auto &item : indices_constraints.indices.edge_type) {
+    if (!indices->edge_type_index.CreateIndex(item, vertices->access()))
+      throw RecoveryFailure("The edge type index must be created here!");
+    spdlog::info("An edge type index is recreated from metadata.");
+  }
+  spdlog::info("Edge type indices are recreated.");
+
+  // Recover edge type+property indices.
+  spdlog::info("Recreating {} edge type+property indices from metadata.",
+               indices_constraints.indices.edge_type_property.size());
+  for (const auto &item : indices_constraints.indices.edge_type_property) {
+    if (!indices->edge_type_property_index.CreateIndex(item.first, item.second, vertices->access()))
+      throw RecoveryFailure("The edge type+property index must be created here!");
+    spdlog::info("An edge type+property index is recreated from metadata.");
+  }
+  spdlog::info("Edge type+property indices are recreated.");
   spdlog::info("Indices are recreated.");
 
   spdlog::info("Recreating constraints from metadata.");
@@ -163,7 +227,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
                                         std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                         utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
                                         std::atomic<uint64_t> *edge_count, NameIdMapper *name_id_mapper,
-                                        Indices *indices, Constraints *constraints, Config::Items items,
+                                        Indices *indices, Constraints *constraints, const Config &config,
                                         uint64_t *wal_seq_num) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
   spdlog::info("Recovering persisted data using snapshot ({}) and WAL directory ({}).", snapshot_directory,
@@ -195,7 +259,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
       }
       spdlog::info("Starting snapshot recovery from {}.", path);
       try {
-        recovered_snapshot = LoadSnapshot(path, vertices, edges, epoch_history, name_id_mapper, edge_count, items);
+        recovered_snapshot = LoadSnapshot(path, vertices, edges, epoch_history, name_id_mapper, edge_count, config);
         spdlog::info("Snapshot recovery successful!");
         break;
       } catch (const RecoveryFailure &e) {
@@ -319,7 +383,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
       }
       try {
         auto info = LoadWal(wal_file.path, &indices_constraints, last_loaded_timestamp, vertices, edges, name_id_mapper,
-                            edge_count, items);
+                            edge_count, config.items, config.durability.recovery_thread_count);
         recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, info.next_vertex_id);
         recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, info.next_edge_id);
         recovery_info.next_timestamp = std::max(recovery_info.next_timestamp, info.next_timestamp);
@@ -35,6 +35,11 @@ namespace memgraph::storage::durability {
 /// killed (`CHECK` failure).
 void VerifyStorageDirectoryOwnerAndProcessUserOrDie(const std::filesystem::path &storage_directory);
 
+/// Removes the intermediate batch files that older versions created next to
+/// the snapshot while it was being written. They are left behind if the
+/// process crashed during snapshot creation.
+void RemoveSnapshotBatchFiles(const std::filesystem::path &snapshot_directory);
+
 // Used to capture the snapshot's data related to durability
 struct SnapshotDurabilityInfo {
   explicit SnapshotDurabilityInfo(std::filesystem::path path, std::string uuid, const uint64_t start_timestamp)
@@ -108,7 +113,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
                                         std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                         utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
                                         std::atomic<uint64_t> *edge_count, NameIdMapper *name_id_mapper,
-                                        Indices *indices, Constraints *constraints, Config::Items items,
+                                        Indices *indices, Constraints *constraints, const Config &config,
                                         uint64_t *wal_seq_num);
 
 }  // namespace memgraph::storage::durability
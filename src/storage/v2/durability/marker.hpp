@@ -56,6 +56,16 @@ enum class Marker : uint8_t {
   DELTA_EXISTENCE_CONSTRAINT_DROP = 0x5e,
   DELTA_UNIQUE_CONSTRAINT_CREATE = 0x5f,
   DELTA_UNIQUE_CONSTRAINT_DROP = 0x60,
+  DELTA_PROPERTY_COLUMNS_CREATE = 0x61,
+  DELTA_PROPERTY_COLUMNS_DROP = 0x62,
+  DELTA_LABEL_PROPERTIES_INDEX_CREATE = 0x63,
+  DELTA_LABEL_PROPERTIES_INDEX_DROP = 0x64,
+  DELTA_EDGE_INDEX_CREATE = 0x65,
+  DELTA_EDGE_INDEX_DROP = 0x66,
+  DELTA_EDGE_PROPERTY_INDEX_CREATE = 0x67,
+  DELTA_EDGE_PROPERTY_INDEX_DROP = 0x68,
+  DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE = 0x69,
+  DELTA_LABEL_PROPERTY_HASH_INDEX_DROP = 0x6a,
 
   VALUE_FALSE = 0x00,
   VALUE_TRUE = 0xff,
@@ -99,6 +109,16 @@ static const Marker kMarkersAll[] = {
     Marker::DELTA_EXISTENCE_CONSTRAINT_DROP,
     Marker::DELTA_UNIQUE_CONSTRAINT_CREATE,
     Marker::DELTA_UNIQUE_CONSTRAINT_DROP,
+    Marker::DELTA_PROPERTY_COLUMNS_CREATE,
+    Marker::DELTA_PROPERTY_COLUMNS_DROP,
+    Marker::DELTA_LABEL_PROPERTIES_INDEX_CREATE,
+    Marker::DELTA_LABEL_PROPERTIES_INDEX_DROP,
+    Marker::DELTA_EDGE_INDEX_CREATE,
+    Marker::DELTA_EDGE_INDEX_DROP,
+    Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE,
+    Marker::DELTA_EDGE_PROPERTY_INDEX_DROP,
+    Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE,
+    Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_DROP,
     Marker::VALUE_FALSE,
     Marker::VALUE_TRUE,
 };
@@ -18,6 +18,7 @@
 
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -36,6 +37,11 @@ struct RecoveredIndicesAndConstraints {
   struct {
     std::vector<LabelId> label;
     std::vector<std::pair<LabelId, PropertyId>> label_property;
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
+    std::vector<std::pair<LabelId, PropertyId>> label_property_hash;
+    std::vector<std::pair<LabelId, std::vector<std::pair<PropertyId, PropertyValue::Type>>>> property_columns;
+    std::vector<EdgeTypeId> edge_type;
+    std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
   } indices;
 
   struct {
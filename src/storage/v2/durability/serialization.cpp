@@ -11,6 +11,8 @@
 
 #include "storage/v2/durability/serialization.hpp"
 
+#include <cstring>
+
 #include "storage/v2/temporal.hpp"
 #include "utils/endian.hpp"
 
@@ -21,115 +23,140 @@ namespace memgraph::storage::durability {
 //////////////////////////
 
 namespace {
-void WriteSize(Encoder *encoder, uint64_t size) {
+// The encoding is shared by all encoders that write the raw bytes through
+// their `Write` function.
+template <typename TEncoder>
+void WriteSize(TEncoder *encoder, uint64_t size) {
   size = utils::HostToLittleEndian(size);
   encoder->Write(reinterpret_cast<const uint8_t *>(&size), sizeof(size));
 }
-}  // namespace
-
-void Encoder::Initialize(const std::filesystem::path &path, const std::string_view &magic, uint64_t version) {
-  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
-  Write(reinterpret_cast<const uint8_t *>(magic.data()), magic.size());
-  auto version_encoded = utils::HostToLittleEndian(version);
-  Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
-}
-
-void Encoder::OpenExisting(const std::filesystem::path &path) {
-  file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
-}
-
-void Encoder::Close() {
-  if (file_.IsOpen()) {
-    file_.Close();
-  }
-}
 
-void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
-
-void Encoder::WriteMarker(Marker marker) {
+template <typename TEncoder>
+void EncodeMarker(TEncoder *encoder, Marker marker) {
   auto value = static_cast<uint8_t>(marker);
-  Write(&value, sizeof(value));
+  encoder->Write(&value, sizeof(value));
 }
 
-void Encoder::WriteBool(bool value) {
-  WriteMarker(Marker::TYPE_BOOL);
+template <typename TEncoder>
+void EncodeBool(TEncoder *encoder, bool value) {
+  EncodeMarker(encoder, Marker::TYPE_BOOL);
   if (value) {
-    WriteMarker(Marker::VALUE_TRUE);
+    EncodeMarker(encoder, Marker::VALUE_TRUE);
   } else {
-    WriteMarker(Marker::VALUE_FALSE);
+    EncodeMarker(encoder, Marker::VALUE_FALSE);
   }
 }
 
-void Encoder::WriteUint(uint64_t value) {
+template <typename TEncoder>
+void EncodeUint(TEncoder *encoder, uint64_t value) {
   value = utils::HostToLittleEndian(value);
-  WriteMarker(Marker::TYPE_INT);
-  Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+  EncodeMarker(encoder, Marker::TYPE_INT);
+  encoder->Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
 }
 
-void Encoder::WriteDouble(double value) {
+template <typename TEncoder>
+void EncodeDouble(TEncoder *encoder, double value) {
   auto value_uint = utils::MemcpyCast<uint64_t>(value);
   value_uint = utils::HostToLittleEndian(value_uint);
-  WriteMarker(Marker::TYPE_DOUBLE);
-  Write(reinterpret_cast<const uint8_t *>(&value_uint), sizeof(value_uint));
+  EncodeMarker(encoder, Marker::TYPE_DOUBLE);
+  encoder->Write(reinterpret_cast<const uint8_t *>(&value_uint), sizeof(value_uint));
 }
 
-void Encoder::WriteString(const std::string_view &value) {
-  WriteMarker(Marker::TYPE_STRING);
-  WriteSize(this, value.size());
-  Write(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+template <typename TEncoder>
+void EncodeString(TEncoder *encoder, const std::string_view &value) {
+  EncodeMarker(encoder, Marker::TYPE_STRING);
+  WriteSize(encoder, value.size());
+  encoder->Write(reinterpret_cast<const uint8_t *>(value.data()), value.size());
 }
 
-void Encoder::WritePropertyValue(const PropertyValue &value) {
-  WriteMarker(Marker::TYPE_PROPERTY_VALUE);
+template <typename TEncoder>
+void EncodePropertyValue(TEncoder *encoder, const PropertyValue &value) {
+  EncodeMarker(encoder, Marker::TYPE_PROPERTY_VALUE);
   switch (value.type()) {
     case PropertyValue::Type::Null: {
-      WriteMarker(Marker::TYPE_NULL);
+      EncodeMarker(encoder, Marker::TYPE_NULL);
       break;
     }
     case PropertyValue::Type::Bool: {
-      WriteBool(value.ValueBool());
+      EncodeBool(encoder, value.ValueBool());
       break;
     }
     case PropertyValue::Type::Int: {
-      WriteUint(utils::MemcpyCast<uint64_t>(value.ValueInt()));
+      EncodeUint(encoder, utils::MemcpyCast<uint64_t>(value.ValueInt()));
       break;
     }
     case PropertyValue::Type::Double: {
-      WriteDouble(value.ValueDouble());
+      EncodeDouble(encoder, value.ValueDouble());
       break;
     }
     case PropertyValue::Type::String: {
-      WriteString(value.ValueString());
+      EncodeString(encoder, value.ValueString());
       break;
     }
     case PropertyValue::Type::List: {
       const auto &list = value.ValueList();
-      WriteMarker(Marker::TYPE_LIST);
-      WriteSize(this, list.size());
+      EncodeMarker(encoder, Marker::TYPE_LIST);
+      WriteSize(encoder, list.size());
       for (const auto &item : list) {
-        WritePropertyValue(item);
+        EncodePropertyValue(encoder, item);
       }
       break;
     }
     case PropertyValue::Type::Map: {
       const auto &map = value.ValueMap();
-      WriteMarker(Marker::TYPE_MAP);
-      WriteSize(this, map.size());
+      EncodeMarker(encoder, Marker::TYPE_MAP);
+      WriteSize(encoder, map.size());
       for (const auto &item : map) {
-        WriteString(item.first);
-        WritePropertyValue(item.second);
+        EncodeString(encoder, item.first);
+        EncodePropertyValue(encoder, item.second);
       }
       break;
     }
     case PropertyValue::Type::TemporalData: {
       const auto temporal_data = value.ValueTemporalData();
-      WriteMarker(Marker::TYPE_TEMPORAL_DATA);
-      WriteUint(static_cast<uint64_t>(temporal_data.type));
-      WriteUint(utils::MemcpyCast<uint64_t>(temporal_data.microseconds));
+      EncodeMarker(encoder, Marker::TYPE_TEMPORAL_DATA);
+      EncodeUint(encoder, static_cast<uint64_t>(temporal_data.type));
+      EncodeUint(encoder, utils::MemcpyCast<uint64_t>(temporal_data.microseconds));
       break;
     }
   }
 }
+}  // namespace
+
+void Encoder::Initialize(const std::filesystem::path &path, const std::string_view &magic, uint64_t version) {
+  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  Write(reinterpret_cast<const uint8_t *>(magic.data()), magic.size());
+  auto version_encoded = utils::HostToLittleEndian(version);
+  Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
+}
+
+void Encoder::Initialize(const std::filesystem::path &path) {
+  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+}
+
+void Encoder::OpenExisting(const std::filesystem::path &path) {
+  file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
+}
+
+void Encoder::Close() {
+  if (file_.IsOpen()) {
+    file_.Close();
+  }
+}
+
+void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
+
+void Encoder::WriteMarker(Marker marker) { EncodeMarker(this, marker); }
+
+void Encoder::WriteBool(bool value) { EncodeBool(this, value); }
+
+void Encoder::WriteUint(uint64_t value) { EncodeUint(this, value); }
+
+void Encoder::WriteDouble(double value) { EncodeDouble(this, value); }
+
+void Encoder::WriteString(const std::string_view &value) { EncodeString(this, value); }
+
+void Encoder::WritePropertyValue(const PropertyValue &value) { EncodePropertyValue(this, value); }
 
 uint64_t Encoder::GetPosition() { return file_.GetPosition(); }
 
@@ -137,6 +164,8 @@ void Encoder::SetPosition(uint64_t position) { file_.SetPosition(utils::OutputFi
 
 void Encoder::Sync() { file_.Sync(); }
 
+int Encoder::FlushAndDuplicate() { return file_.FlushAndDuplicate(); }
+
 void Encoder::Finalize() {
   file_.Sync();
   file_.Close();
@@ -152,6 +181,24 @@ std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return f
 
 size_t Encoder::GetSize() { return file_.GetSize(); }
 
+////////////////////////////////
+// BufferEncoder implementation.
+////////////////////////////////
+
+void BufferEncoder::Write(const uint8_t *data, uint64_t size) { buffer_.insert(buffer_.end(), data, data + size); }
+
+void BufferEncoder::WriteMarker(Marker marker) { EncodeMarker(this, marker); }
+
+void BufferEncoder::WriteBool(bool value) { EncodeBool(this, value); }
+
+void BufferEncoder::WriteUint(uint64_t value) { EncodeUint(this, value); }
+
+void BufferEncoder::WriteDouble(double value) { EncodeDouble(this, value); }
+
+void BufferEncoder::WriteString(const std::string_view &value) { EncodeString(this, value); }
+
+void BufferEncoder::WritePropertyValue(const PropertyValue &value) { EncodePropertyValue(this, value); }
+
 //////////////////////////
 // Decoder implementation.
 //////////////////////////
@@ -176,6 +223,17 @@ std::optional<uint64_t> ReadSize(Decoder *decoder) {
 
 std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic) {
   if (!file_.Open(path)) return std::nullopt;
+  return ReadMagicAndVersion(magic);
+}
+
+std::optional<uint64_t> Decoder::Initialize(const utils::MappedFile &file, const std::string &magic) {
+  if (!file.IsOpen()) return std::nullopt;
+  mapped_file_ = &file;
+  mapped_position_ = 0;
+  return ReadMagicAndVersion(magic);
+}
+
+std::optional<uint64_t> Decoder::ReadMagicAndVersion(const std::string &magic) {
   std::string file_magic(magic.size(), '\0');
   if (!Read(reinterpret_cast<uint8_t *>(file_magic.data()), file_magic.size())) return std::nullopt;
   if (file_magic != magic) return std::nullopt;
@@ -184,9 +242,19 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   return utils::LittleEndianToHost(version_encoded);
 }
 
-bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
+bool Decoder::Read(uint8_t *data, size_t size) {
+  if (!mapped_file_) return file_.Read(data, size);
+  if (!Peek(data, size)) return false;
+  mapped_position_ += size;
+  return true;
+}
 
-bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
+bool Decoder::Peek(uint8_t *data, size_t size) {
+  if (!mapped_file_) return file_.Peek(data, size);
+  if (size > mapped_file_->GetSize() - mapped_position_) return false;
+  memcpy(data, mapped_file_->data() + mapped_position_, size);
+  return true;
+}
 
 std::optional<Marker> Decoder::PeekMarker() {
   uint8_t value;
@@ -236,6 +304,13 @@ std::optional<std::string> Decoder::ReadString() {
   if (!marker || *marker != Marker::TYPE_STRING) return std::nullopt;
   auto size = ReadSize(this);
   if (!size) return std::nullopt;
+  if (mapped_file_) {
+    // The string is constructed directly from the mapped data.
+    if (*size > mapped_file_->GetSize() - mapped_position_) return std::nullopt;
+    std::string value(reinterpret_cast<const char *>(mapped_file_->data() + mapped_position_), *size);
+    mapped_position_ += *size;
+    return value;
+  }
   std::string value(*size, '\0');
   if (!Read(reinterpret_cast<uint8_t *>(value.data()), *size)) return std::nullopt;
   return value;
@@ -350,6 +425,16 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
     case Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+    case Marker::DELTA_LABEL_PROPERTIES_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTIES_INDEX_DROP:
+    case Marker::DELTA_PROPERTY_COLUMNS_CREATE:
+    case Marker::DELTA_PROPERTY_COLUMNS_DROP:
+    case Marker::DELTA_EDGE_INDEX_CREATE:
+    case Marker::DELTA_EDGE_INDEX_DROP:
+    case Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return std::nullopt;
@@ -362,6 +447,12 @@ bool Decoder::SkipString() {
   auto maybe_size = ReadSize(this);
   if (!maybe_size) return false;
 
+  if (mapped_file_) {
+    if (*maybe_size > mapped_file_->GetSize() - mapped_position_) return false;
+    mapped_position_ += *maybe_size;
+    return true;
+  }
+
   const uint64_t kBufferSize = 262144;
   uint8_t buffer[kBufferSize];
   uint64_t size = *maybe_size;
@@ -449,16 +540,39 @@ bool Decoder::SkipPropertyValue() {
     case Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
     case Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+    case Marker::DELTA_LABEL_PROPERTIES_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTIES_INDEX_DROP:
+    case Marker::DELTA_PROPERTY_COLUMNS_CREATE:
+    case Marker::DELTA_PROPERTY_COLUMNS_DROP:
+    case Marker::DELTA_EDGE_INDEX_CREATE:
+    case Marker::DELTA_EDGE_INDEX_DROP:
+    case Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return false;
   }
 }
 
-std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize(); }
+std::optional<uint64_t> Decoder::GetSize() {
+  if (mapped_file_) return mapped_file_->GetSize();
+  return file_.GetSize();
+}
 
-std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
+std::optional<uint64_t> Decoder::GetPosition() {
+  if (mapped_file_) return mapped_position_;
+  return file_.GetPosition();
+}
 
-bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
+bool Decoder::SetPosition(uint64_t position) {
+  if (mapped_file_) {
+    if (position > mapped_file_->GetSize()) return false;
+    mapped_position_ = position;
+    return true;
+  }
+  return !!file_.SetPosition(utils::InputFile::Position::SET, position);
+}
 
 }  // namespace memgraph::storage::durability
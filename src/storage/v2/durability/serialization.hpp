@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <string_view>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/marker.hpp"
@@ -43,6 +44,10 @@ class Encoder final : public BaseEncoder {
  public:
   void Initialize(const std::filesystem::path &path, const std::string_view &magic, uint64_t version);
 
+  // Initializes the encoder without writing the magic and version. Used for
+  // intermediate files whose content is later appended to another file.
+  void Initialize(const std::filesystem::path &path);
+
   void OpenExisting(const std::filesystem::path &path);
 
   void Close();
@@ -62,6 +67,10 @@ class Encoder final : public BaseEncoder {
 
   void Sync();
 
+  // Write the internal buffer to the file and return a duplicate of its file
+  // descriptor, see `utils::OutputFile::FlushAndDuplicate`.
+  int FlushAndDuplicate();
+
   void Finalize();
 
   // Disable flushing of the internal buffer.
@@ -80,6 +89,28 @@ class Encoder final : public BaseEncoder {
   utils::OutputFile file_;
 };
 
+/// Encoder that writes the same encoding as `Encoder` into a memory buffer.
+/// Used to encode data on multiple threads before it's written to a file and
+/// by writers that handle write errors themselves.
+class BufferEncoder final : public BaseEncoder {
+ public:
+  void Write(const uint8_t *data, uint64_t size);
+
+  void WriteMarker(Marker marker) override;
+  void WriteBool(bool value) override;
+  void WriteUint(uint64_t value) override;
+  void WriteDouble(double value) override;
+  void WriteString(const std::string_view &value) override;
+  void WritePropertyValue(const PropertyValue &value) override;
+
+  const std::vector<uint8_t> &GetBuffer() const { return buffer_; }
+
+  void ClearBuffer() { buffer_.clear(); }
+
+ private:
+  std::vector<uint8_t> buffer_;
+};
+
 /// Decoder interface class. Used to implement streams from different sources
 /// (e.g. file and network).
 class BaseDecoder {
@@ -103,8 +134,12 @@ class Decoder final : public BaseDecoder {
  public:
   std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic);
 
+  // Initializes the decoder to read directly from the mapped file instead of
+  // reading the file through a buffer. The mapping must outlive the decoder.
+  std::optional<uint64_t> Initialize(const utils::MappedFile &file, const std::string &magic);
+
   // Main read functions, the only one that are allowed to read from the `file_`
-  // directly.
+  // and `mapped_file_` directly.
   bool Read(uint8_t *data, size_t size);
   bool Peek(uint8_t *data, size_t size);
 
@@ -125,7 +160,11 @@ class Decoder final : public BaseDecoder {
   bool SetPosition(uint64_t position);
 
  private:
+  std::optional<uint64_t> ReadMagicAndVersion(const std::string &magic);
+
   utils::InputFile file_;
+  const utils::MappedFile *mapped_file_{nullptr};
+  uint64_t mapped_position_{0};
 };
 
 }  // namespace memgraph::storage::durability
@@ -11,6 +11,11 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/serialization.hpp"
@@ -22,7 +27,10 @@
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
 #include "utils/message.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/thread.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -65,6 +73,20 @@ namespace memgraph::storage::durability {
 //     * label+property indices
 //         * label
 //         * property
+//     * property columns (from version 16)
+//         * label
+//         * properties and type markers in the order of the columns
+//     * composite indices (from version 17)
+//         * label
+//         * properties in the order of the index
+//     * edge type indices (from version 18)
+//         * edge type
+//     * edge type+property indices (from version 18)
+//         * edge type
+//         * property
+//     * label+property hash indices (from version 19)
+//         * label
+//         * property
 //
 // 7) Constraints
 //     * existence constraints
@@ -86,10 +108,138 @@ namespace memgraph::storage::durability {
 //       applied)
 //     * number of edges
 //     * number of vertices
+//     * edge batches (from version 15)
+//         * number of batches
+//         * offset and number of edges of each batch
+//     * vertex batches (from version 15)
+//         * number of batches
+//         * offset and number of vertices of each batch
+//
+// The edges (4) and vertices (5) are written in batches of at most
+// `items_per_batch` objects. Every batch starts at an object boundary and
+// contains consecutive objects ordered by gid so that it can be decoded
+// independently of the other batches.
 //
 // IMPORTANT: When changing snapshot encoding/decoding bump the snapshot/WAL
 // version in `version.hpp`.
 
+namespace {
+
+// Calls `func` with the index of every batch in `[0, batches_count)`. The
+// batches are distributed to at most `thread_count` threads. The first
+// exception thrown by `func` is rethrown in the calling thread after all of the
+// threads have finished.
+template <typename TFunc>
+void RunBatchesOnThreads(uint64_t thread_count, uint64_t batches_count, const TFunc &func) {
+  if (thread_count <= 1 || batches_count <= 1) {
+    for (uint64_t i = 0; i < batches_count; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  std::atomic<uint64_t> next_batch{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_lock;
+
+  std::vector<std::thread> threads;
+  threads.reserve(std::min(thread_count, batches_count));
+  for (uint64_t i = 0; i < std::min(thread_count, batches_count); ++i) {
+    threads.emplace_back([&] {
+      utils::ThreadSetName("snapshot batch");
+      while (!failed.load(std::memory_order_acquire)) {
+        auto batch_index = next_batch.fetch_add(1, std::memory_order_acq_rel);
+        if (batch_index >= batches_count) break;
+        try {
+          func(batch_index);
+        } catch (...) {
+          std::lock_guard<std::mutex> guard(error_lock);
+          if (!error) error = std::current_exception();
+          failed.store(true, std::memory_order_release);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+// Initializes the decoder to read from the mapped snapshot, or from the
+// snapshot file if it isn't mapped.
+std::optional<uint64_t> InitializeSnapshot(Decoder *snapshot, const std::filesystem::path &path,
+                                           const utils::MappedFile &mapped_snapshot) {
+  if (mapped_snapshot.IsOpen()) return snapshot->Initialize(mapped_snapshot, kSnapshotMagic);
+  return snapshot->Initialize(path, kSnapshotMagic);
+}
+
+// Opens the snapshot and moves the decoder to the given offset.
+void OpenSnapshotAt(Decoder *snapshot, const std::filesystem::path &path, const utils::MappedFile &mapped_snapshot,
+                    uint64_t offset) {
+  auto version = InitializeSnapshot(snapshot, path, mapped_snapshot);
+  if (!version) throw RecoveryFailure("Couldn't read snapshot magic and/or version!");
+  if (!snapshot->SetPosition(offset)) throw RecoveryFailure("Couldn't read data from snapshot!");
+}
+
+// Returns the gid of the first object of every batch of `items_per_batch`
+// objects that are currently in the skip list.
+template <typename TObject>
+std::vector<Gid> SplitIntoBatches(utils::SkipList<TObject> *objects, uint64_t items_per_batch) {
+  std::vector<Gid> batch_starts;
+  uint64_t index = 0;
+  auto acc = objects->access();
+  for (const auto &object : acc) {
+    if (index % items_per_batch == 0) batch_starts.push_back(object.gid);
+    ++index;
+  }
+  return batch_starts;
+}
+
+// Writes the objects of all batches to the snapshot. `write_batch` is called
+// with an encoder, the set of used name IDs and the range of gids
+// `[from, to)` that should be written, and it returns the number of objects
+// that were written. When more than one thread is used, every batch is first
+// encoded into a memory buffer that is written to the snapshot as soon as the
+// batch is done. Batches can therefore be stored out of order, which is fine
+// because the returned batch infos are in gid order and hold the offsets.
+template <typename TWriteBatch>
+std::vector<BatchInfo> WriteBatches(Encoder *snapshot, const std::vector<Gid> &batch_starts, uint64_t thread_count,
+                                    std::unordered_set<uint64_t> *used_ids, const TWriteBatch &write_batch) {
+  auto batch_end = [&batch_starts](uint64_t batch_index) -> std::optional<Gid> {
+    if (batch_index + 1 < batch_starts.size()) return batch_starts[batch_index + 1];
+    return std::nullopt;
+  };
+
+  if (thread_count <= 1 || batch_starts.size() <= 1) {
+    std::vector<BatchInfo> batches;
+    batches.reserve(batch_starts.size());
+    for (uint64_t i = 0; i < batch_starts.size(); ++i) {
+      auto offset = snapshot->GetPosition();
+      auto count = write_batch(snapshot, used_ids, batch_starts[i], batch_end(i));
+      batches.push_back(BatchInfo{offset, count});
+    }
+    return batches;
+  }
+
+  std::vector<BatchInfo> batches(batch_starts.size());
+  std::mutex snapshot_lock;
+  RunBatchesOnThreads(thread_count, batch_starts.size(), [&](uint64_t batch_index) {
+    BufferEncoder encoder;
+    std::unordered_set<uint64_t> batch_used_ids;
+    auto count = write_batch(&encoder, &batch_used_ids, batch_starts[batch_index], batch_end(batch_index));
+    std::lock_guard<std::mutex> guard(snapshot_lock);
+    auto offset = snapshot->GetPosition();
+    snapshot->Write(encoder.GetBuffer().data(), encoder.GetBuffer().size());
+    batches[batch_index] = BatchInfo{offset, count};
+    used_ids->insert(batch_used_ids.begin(), batch_used_ids.end());
+  });
+  return batches;
+}
+
+}  // namespace
+
 // Function used to read information about the snapshot file.
 SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
   // Check magic and version.
@@ -152,6 +302,40 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
     auto maybe_vertices = snapshot.ReadUint();
     if (!maybe_vertices) throw RecoveryFailure("Invalid snapshot data!");
     info.vertices_count = *maybe_vertices;
+
+    if (*version >= kSnapshotBatchesVersion) {
+      auto snapshot_size = snapshot.GetSize();
+      if (!snapshot_size) throw RecoveryFailure("Couldn't read data from snapshot!");
+
+      auto read_batches = [&snapshot, snapshot_size](uint64_t expected_count) {
+        auto batches_size = snapshot.ReadUint();
+        // Every batch info takes at least two encoded integers, so the count
+        // can't exceed what fits into the file.
+        if (!batches_size || *batches_size > *snapshot_size / (2 * (1 + sizeof(uint64_t)))) {
+          throw RecoveryFailure("Invalid snapshot data!");
+        }
+        std::vector<BatchInfo> batches;
+        batches.reserve(*batches_size);
+        uint64_t total_count = 0;
+        for (uint64_t i = 0; i < *batches_size; ++i) {
+          auto offset = snapshot.ReadUint();
+          if (!offset || *offset > *snapshot_size) throw RecoveryFailure("Invalid snapshot data!");
+          auto count = snapshot.ReadUint();
+          if (!count) throw RecoveryFailure("Invalid snapshot data!");
+          batches.push_back(BatchInfo{*offset, *count});
+          total_count += *count;
+        }
+        if (total_count != expected_count) throw RecoveryFailure("Invalid snapshot data!");
+        return batches;
+      };
+
+      info.edge_batches = read_batches(info.edges_count);
+      info.vertex_batches = read_batches(info.vertices_count);
+    } else {
+      // Older snapshots contain all edges and all vertices in a single batch.
+      if (info.offset_edges != 0) info.edge_batches.push_back(BatchInfo{info.offset_edges, info.edges_count});
+      info.vertex_batches.push_back(BatchInfo{info.offset_vertices, info.vertices_count});
+    }
   }
 
   return info;
@@ -160,12 +344,20 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
 RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
                                utils::SkipList<Edge> *edges,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
-                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config::Items items) {
+                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, const Config &config) {
   RecoveryInfo ret;
   RecoveredIndicesAndConstraints indices_constraints;
 
+  // The snapshot is mapped into memory once and all batches are decoded
+  // directly from the mapping, which avoids the read system calls and the
+  // copying through the decoder buffers.
+  utils::MappedFile mapped_snapshot;
+  if (config.durability.snapshot_recovery_mmap && !mapped_snapshot.Open(path)) {
+    spdlog::warn("Couldn't map the snapshot {} into memory, it will be read through buffered reads.", path);
+  }
+
   Decoder snapshot;
-  auto version = snapshot.Initialize(path, kSnapshotMagic);
+  auto version = InitializeSnapshot(&snapshot, path, mapped_snapshot);
   if (!version) throw RecoveryFailure("Couldn't read snapshot magic and/or version!");
   if (!IsVersionSupported(*version)) throw RecoveryFailure(fmt::format("Invalid snapshot version {}", *version));
 
@@ -226,264 +418,299 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   // Reset current edge count.
   edge_count->store(0, std::memory_order_release);
 
+  const auto thread_count = config.durability.recovery_thread_count;
+  const auto properties_on_edges = config.items.properties_on_edges;
+
   {
     // Recover edges.
-    auto edge_acc = edges->access();
-    uint64_t last_edge_gid = 0;
+    std::vector<uint64_t> last_edge_gids(info.edge_batches.size(), 0);
     if (snapshot_has_edges) {
-      spdlog::info("Recovering {} edges.", info.edges_count);
-      if (!snapshot.SetPosition(info.offset_edges)) throw RecoveryFailure("Couldn't read data from snapshot!");
-      for (uint64_t i = 0; i < info.edges_count; ++i) {
-        {
-          const auto marker = snapshot.ReadMarker();
-          if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Invalid snapshot data!");
-        }
-
-        if (items.properties_on_edges) {
-          // Insert edge.
-          auto gid = snapshot.ReadUint();
-          if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-          if (i > 0 && *gid <= last_edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = *gid;
-          spdlog::debug("Recovering edge {} with properties.", *gid);
-          auto [it, inserted] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
-          if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
-
-          // Recover properties.
+      spdlog::info("Recovering {} edges in {} batches.", info.edges_count, info.edge_batches.size());
+      RunBatchesOnThreads(thread_count, info.edge_batches.size(), [&](uint64_t batch_index) {
+        utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+        const auto &batch = info.edge_batches[batch_index];
+        Decoder snapshot;
+        OpenSnapshotAt(&snapshot, path, mapped_snapshot, batch.offset);
+        auto edge_acc = edges->access();
+        uint64_t last_edge_gid = 0;
+        for (uint64_t i = 0; i < batch.count; ++i) {
           {
-            auto props_size = snapshot.ReadUint();
-            if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-            auto &props = it->properties;
-            for (uint64_t j = 0; j < *props_size; ++j) {
-              auto key = snapshot.ReadUint();
-              if (!key) throw RecoveryFailure("Invalid snapshot data!");
-              auto value = snapshot.ReadPropertyValue();
-              if (!value) throw RecoveryFailure("Invalid snapshot data!");
-              SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for edge {}.",
-                           name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-              props.SetProperty(get_property_from_id(*key), *value);
-            }
+            const auto marker = snapshot.ReadMarker();
+            if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Invalid snapshot data!");
           }
-        } else {
-          // Read edge GID.
-          auto gid = snapshot.ReadUint();
-          if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-          if (i > 0 && *gid <= last_edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = *gid;
-
-          spdlog::debug("Ensuring edge {} doesn't have any properties.", *gid);
-          // Read properties.
-          {
-            auto props_size = snapshot.ReadUint();
-            if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-            if (*props_size != 0)
-              throw RecoveryFailure(
-                  "The snapshot has properties on edges, but the storage is "
-                  "configured without properties on edges!");
+
+          if (properties_on_edges) {
+            // Insert edge.
+            auto gid = snapshot.ReadUint();
+            if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+            if (i > 0 && *gid <= last_edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            last_edge_gid = *gid;
+            spdlog::debug("Recovering edge {} with properties.", *gid);
+            auto [it, inserted] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
+            if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
+
+            // Recover properties.
+            {
+              auto props_size = snapshot.ReadUint();
+              if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+              auto &props = it->properties;
+              for (uint64_t j = 0; j < *props_size; ++j) {
+                auto key = snapshot.ReadUint();
+                if (!key) throw RecoveryFailure("Invalid snapshot data!");
+                auto value = snapshot.ReadPropertyValue();
+                if (!value) throw RecoveryFailure("Invalid snapshot data!");
+                SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for edge {}.",
+                             name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
+                props.SetProperty(get_property_from_id(*key), *value);
+              }
+            }
+          } else {
+            // Read edge GID.
+            auto gid = snapshot.ReadUint();
+            if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+            if (i > 0 && *gid <= last_edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            last_edge_gid = *gid;
+
+            spdlog::debug("Ensuring edge {} doesn't have any properties.", *gid);
+            // Read properties.
+            {
+              auto props_size = snapshot.ReadUint();
+              if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+              if (*props_size != 0)
+                throw RecoveryFailure(
+                    "The snapshot has properties on edges, but the storage is "
+                    "configured without properties on edges!");
+            }
           }
         }
-      }
+        last_edge_gids[batch_index] = last_edge_gid;
+      });
       spdlog::info("Edges are recovered.");
     }
 
     // Recover vertices (labels and properties).
-    if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
-    auto vertex_acc = vertices->access();
-    uint64_t last_vertex_gid = 0;
-    spdlog::info("Recovering {} vertices.", info.vertices_count);
-    for (uint64_t i = 0; i < info.vertices_count; ++i) {
-      {
-        auto marker = snapshot.ReadMarker();
-        if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
-      }
+    std::vector<uint64_t> last_vertex_gids(info.vertex_batches.size(), 0);
+    spdlog::info("Recovering {} vertices in {} batches.", info.vertices_count, info.vertex_batches.size());
+    RunBatchesOnThreads(thread_count, info.vertex_batches.size(), [&](uint64_t batch_index) {
+      utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+      const auto &batch = info.vertex_batches[batch_index];
+      Decoder snapshot;
+      OpenSnapshotAt(&snapshot, path, mapped_snapshot, batch.offset);
+      auto vertex_acc = vertices->access();
+      uint64_t last_vertex_gid = 0;
+      for (uint64_t i = 0; i < batch.count; ++i) {
+        {
+          auto marker = snapshot.ReadMarker();
+          if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
+        }
 
-      // Insert vertex.
-      auto gid = snapshot.ReadUint();
-      if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-      if (i > 0 && *gid <= last_vertex_gid) {
-        throw RecoveryFailure("Invalid snapshot data!");
-      }
-      last_vertex_gid = *gid;
-      spdlog::debug("Recovering vertex {}.", *gid);
-      auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
-      if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
-
-      // Recover labels.
-      spdlog::trace("Recovering labels for vertex {}.", *gid);
-      {
-        auto labels_size = snapshot.ReadUint();
-        if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
-        auto &labels = it->labels;
-        labels.reserve(*labels_size);
-        for (uint64_t j = 0; j < *labels_size; ++j) {
-          auto label = snapshot.ReadUint();
-          if (!label) throw RecoveryFailure("Invalid snapshot data!");
-          SPDLOG_TRACE("Recovered label \"{}\" for vertex {}.", name_id_mapper->IdToName(snapshot_id_map.at(*label)),
-                       *gid);
-          labels.emplace_back(get_label_from_id(*label));
+        // Insert vertex.
+        auto gid = snapshot.ReadUint();
+        if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+        if (i > 0 && *gid <= last_vertex_gid) {
+          throw RecoveryFailure("Invalid snapshot data!");
+        }
+        last_vertex_gid = *gid;
+        spdlog::debug("Recovering vertex {}.", *gid);
+        auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
+        if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
+
+        // Recover labels.
+        spdlog::trace("Recovering labels for vertex {}.", *gid);
+        {
+          auto labels_size = snapshot.ReadUint();
+          if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
+          auto &labels = it->labels;
+          labels.reserve(*labels_size);
+          for (uint64_t j = 0; j < *labels_size; ++j) {
+            auto label = snapshot.ReadUint();
+            if (!label) throw RecoveryFailure("Invalid snapshot data!");
+            SPDLOG_TRACE("Recovered label \"{}\" for vertex {}.", name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                         *gid);
+            labels.emplace_back(get_label_from_id(*label));
+          }
         }
-      }
 
-      // Recover properties.
-      spdlog::trace("Recovering properties for vertex {}.", *gid);
-      {
-        auto props_size = snapshot.ReadUint();
-        if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-        auto &props = it->properties;
-        for (uint64_t j = 0; j < *props_size; ++j) {
-          auto key = snapshot.ReadUint();
-          if (!key) throw RecoveryFailure("Invalid snapshot data!");
-          auto value = snapshot.ReadPropertyValue();
-          if (!value) throw RecoveryFailure("Invalid snapshot data!");
-          SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for vertex {}.",
-                       name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-          props.SetProperty(get_property_from_id(*key), *value);
+        // Recover properties.
+        spdlog::trace("Recovering properties for vertex {}.", *gid);
+        {
+          auto props_size = snapshot.ReadUint();
+          if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+          auto &props = it->properties;
+          for (uint64_t j = 0; j < *props_size; ++j) {
+            auto key = snapshot.ReadUint();
+            if (!key) throw RecoveryFailure("Invalid snapshot data!");
+            auto value = snapshot.ReadPropertyValue();
+            if (!value) throw RecoveryFailure("Invalid snapshot data!");
+            SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for vertex {}.",
+                         name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
+            props.SetProperty(get_property_from_id(*key), *value);
+          }
+        }
+
+        // Skip in edges.
+        {
+          auto in_size = snapshot.ReadUint();
+          if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *in_size; ++j) {
+            auto edge_gid = snapshot.ReadUint();
+            if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto from_gid = snapshot.ReadUint();
+            if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto edge_type = snapshot.ReadUint();
+            if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+          }
         }
-      }
 
-      // Skip in edges.
-      {
-        auto in_size = snapshot.ReadUint();
-        if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
-        for (uint64_t j = 0; j < *in_size; ++j) {
+        // Skip out edges.
+        auto out_size = snapshot.ReadUint();
+        if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
+        for (uint64_t j = 0; j < *out_size; ++j) {
           auto edge_gid = snapshot.ReadUint();
           if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          auto from_gid = snapshot.ReadUint();
-          if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
+          auto to_gid = snapshot.ReadUint();
+          if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
           auto edge_type = snapshot.ReadUint();
           if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
         }
       }
-
-      // Skip out edges.
-      auto out_size = snapshot.ReadUint();
-      if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
-      for (uint64_t j = 0; j < *out_size; ++j) {
-        auto edge_gid = snapshot.ReadUint();
-        if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-        auto to_gid = snapshot.ReadUint();
-        if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
-        auto edge_type = snapshot.ReadUint();
-        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
-      }
-    }
+      last_vertex_gids[batch_index] = last_vertex_gid;
+    });
     spdlog::info("Vertices are recovered.");
 
     // Recover vertices (in/out edges).
     spdlog::info("Recovering connectivity.");
-    if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
-    for (auto &vertex : vertex_acc) {
-      {
-        auto marker = snapshot.ReadMarker();
-        if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
-      }
-
-      spdlog::trace("Recovering connectivity for vertex {}.", vertex.gid.AsUint());
-      // Check vertex.
-      auto gid = snapshot.ReadUint();
-      if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-      if (gid != vertex.gid.AsUint()) throw RecoveryFailure("Invalid snapshot data!");
-
-      // Skip labels.
-      {
-        auto labels_size = snapshot.ReadUint();
-        if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
-        for (uint64_t j = 0; j < *labels_size; ++j) {
-          auto label = snapshot.ReadUint();
-          if (!label) throw RecoveryFailure("Invalid snapshot data!");
+    std::vector<uint64_t> last_connectivity_edge_gids(info.vertex_batches.size(), 0);
+    RunBatchesOnThreads(thread_count, info.vertex_batches.size(), [&](uint64_t batch_index) {
+      utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+      const auto &batch = info.vertex_batches[batch_index];
+      Decoder snapshot;
+      OpenSnapshotAt(&snapshot, path, mapped_snapshot, batch.offset);
+      auto vertex_acc = vertices->access();
+      auto edge_acc = edges->access();
+      uint64_t last_edge_gid = 0;
+      for (uint64_t i = 0; i < batch.count; ++i) {
+        {
+          auto marker = snapshot.ReadMarker();
+          if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
         }
-      }
 
-      // Skip properties.
-      {
-        auto props_size = snapshot.ReadUint();
-        if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-        for (uint64_t j = 0; j < *props_size; ++j) {
-          auto key = snapshot.ReadUint();
-          if (!key) throw RecoveryFailure("Invalid snapshot data!");
-          auto value = snapshot.SkipPropertyValue();
-          if (!value) throw RecoveryFailure("Invalid snapshot data!");
-        }
-      }
+        // Find vertex.
+        auto gid = snapshot.ReadUint();
+        if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+        auto vertex_it = vertex_acc.find(Gid::FromUint(*gid));
+        if (vertex_it == vertex_acc.end()) throw RecoveryFailure("Invalid snapshot data!");
+        auto &vertex = *vertex_it;
+        spdlog::trace("Recovering connectivity for vertex {}.", vertex.gid.AsUint());
 
-      // Recover in edges.
-      {
-        spdlog::trace("Recovering inbound edges for vertex {}.", vertex.gid.AsUint());
-        auto in_size = snapshot.ReadUint();
-        if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
-        vertex.in_edges.reserve(*in_size);
-        for (uint64_t j = 0; j < *in_size; ++j) {
-          auto edge_gid = snapshot.ReadUint();
-          if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = std::max(last_edge_gid, *edge_gid);
+        // Skip labels.
+        {
+          auto labels_size = snapshot.ReadUint();
+          if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *labels_size; ++j) {
+            auto label = snapshot.ReadUint();
+            if (!label) throw RecoveryFailure("Invalid snapshot data!");
+          }
+        }
 
-          auto from_gid = snapshot.ReadUint();
-          if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
-          auto edge_type = snapshot.ReadUint();
-          if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        // Skip properties.
+        {
+          auto props_size = snapshot.ReadUint();
+          if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *props_size; ++j) {
+            auto key = snapshot.ReadUint();
+            if (!key) throw RecoveryFailure("Invalid snapshot data!");
+            auto value = snapshot.SkipPropertyValue();
+            if (!value) throw RecoveryFailure("Invalid snapshot data!");
+          }
+        }
 
-          auto from_vertex = vertex_acc.find(Gid::FromUint(*from_gid));
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid from vertex!");
-
-          EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-          if (items.properties_on_edges) {
-            if (snapshot_has_edges) {
-              auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
-              if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
-              edge_ref = EdgeRef(&*edge);
-            } else {
-              auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
-              edge_ref = EdgeRef(&*edge);
+        // Recover in edges.
+        {
+          spdlog::trace("Recovering inbound edges for vertex {}.", vertex.gid.AsUint());
+          auto in_size = snapshot.ReadUint();
+          if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *in_size; ++j) {
+            auto edge_gid = snapshot.ReadUint();
+            if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            last_edge_gid = std::max(last_edge_gid, *edge_gid);
+
+            auto from_gid = snapshot.ReadUint();
+            if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto edge_type = snapshot.ReadUint();
+            if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+
+            auto from_vertex = vertex_acc.find(Gid::FromUint(*from_gid));
+            if (from_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid from vertex!");
+
+            EdgeRef edge_ref(Gid::FromUint(*edge_gid));
+            if (properties_on_edges) {
+              if (snapshot_has_edges) {
+                auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
+                if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
+                edge_ref = EdgeRef(&*edge);
+              } else {
+                // The same edge is also inserted while recovering the out
+                // edges of the other vertex (possibly on another thread), so
+                // we use whichever object ends up in the skip list.
+                auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
+                edge_ref = EdgeRef(&*edge);
+              }
             }
+            SPDLOG_TRACE("Recovered inbound edge {} with label \"{}\" from vertex {}.", *edge_gid,
+                         name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
+            vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
           }
-          SPDLOG_TRACE("Recovered inbound edge {} with label \"{}\" from vertex {}.", *edge_gid,
-                       name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
-          vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
         }
-      }
-
-      // Recover out edges.
-      {
-        spdlog::trace("Recovering outbound edges for vertex {}.", vertex.gid.AsUint());
-        auto out_size = snapshot.ReadUint();
-        if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
-        vertex.out_edges.reserve(*out_size);
-        for (uint64_t j = 0; j < *out_size; ++j) {
-          auto edge_gid = snapshot.ReadUint();
-          if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = std::max(last_edge_gid, *edge_gid);
-
-          auto to_gid = snapshot.ReadUint();
-          if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
-          auto edge_type = snapshot.ReadUint();
-          if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
 
-          auto to_vertex = vertex_acc.find(Gid::FromUint(*to_gid));
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid to vertex!");
-
-          EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-          if (items.properties_on_edges) {
-            if (snapshot_has_edges) {
-              auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
-              if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
-              edge_ref = EdgeRef(&*edge);
-            } else {
-              auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
-              edge_ref = EdgeRef(&*edge);
+        // Recover out edges.
+        {
+          spdlog::trace("Recovering outbound edges for vertex {}.", vertex.gid.AsUint());
+          auto out_size = snapshot.ReadUint();
+          if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *out_size; ++j) {
+            auto edge_gid = snapshot.ReadUint();
+            if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            last_edge_gid = std::max(last_edge_gid, *edge_gid);
+
+            auto to_gid = snapshot.ReadUint();
+            if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto edge_type = snapshot.ReadUint();
+            if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+
+            auto to_vertex = vertex_acc.find(Gid::FromUint(*to_gid));
+            if (to_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid to vertex!");
+
+            EdgeRef edge_ref(Gid::FromUint(*edge_gid));
+            if (properties_on_edges) {
+              if (snapshot_has_edges) {
+                auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
+                if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
+                edge_ref = EdgeRef(&*edge);
+              } else {
+                auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
+                edge_ref = EdgeRef(&*edge);
+              }
             }
+            SPDLOG_TRACE("Recovered outbound edge {} with label \"{}\" to vertex {}.", *edge_gid,
+                         name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), to_vertex->gid.AsUint());
+            vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
           }
-          SPDLOG_TRACE("Recovered outbound edge {} with label \"{}\" to vertex {}.", *edge_gid,
-                       name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), to_vertex->gid.AsUint());
-          vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
+          // Increment edge count. We only increment the count here because the
+          // information is duplicated in in_edges.
+          edge_count->fetch_add(*out_size, std::memory_order_acq_rel);
         }
-        // Increment edge count. We only increment the count here because the
-        // information is duplicated in in_edges.
-        edge_count->fetch_add(*out_size, std::memory_order_acq_rel);
       }
-    }
+      last_connectivity_edge_gids[batch_index] = last_edge_gid;
+    });
     spdlog::info("Connectivity is recovered.");
 
     // Set initial values for edge/vertex ID generators.
+    uint64_t last_edge_gid = 0;
+    for (auto gid : last_edge_gids) last_edge_gid = std::max(last_edge_gid, gid);
+    for (auto gid : last_connectivity_edge_gids) last_edge_gid = std::max(last_edge_gid, gid);
+    uint64_t last_vertex_gid = 0;
+    for (auto gid : last_vertex_gids) last_vertex_gid = std::max(last_vertex_gid, gid);
     ret.next_edge_id = last_edge_gid + 1;
     ret.next_vertex_id = last_vertex_gid + 1;
   }
@@ -530,6 +757,113 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       }
       spdlog::info("Metadata of label+property indices are recovered.");
     }
+
+    // Recover property columns.
+    if (*version >= kPropertyColumnsVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of property columns of {} labels.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto properties_count = snapshot.ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid snapshot data!");
+        std::vector<std::pair<PropertyId, PropertyValue::Type>> schema;
+        for (uint64_t j = 0; j < *properties_count; ++j) {
+          auto property = snapshot.ReadUint();
+          if (!property) throw RecoveryFailure("Invalid snapshot data!");
+          auto marker = snapshot.ReadMarker();
+          if (!marker) throw RecoveryFailure("Invalid snapshot data!");
+          auto type = MarkerToPropertyColumnType(*marker);
+          if (!type) throw RecoveryFailure("Invalid snapshot data!");
+          schema.emplace_back(get_property_from_id(*property), *type);
+        }
+        AddRecoveredIndexConstraint(&indices_constraints.indices.property_columns,
+                                    {get_label_from_id(*label), std::move(schema)},
+                                    "The property columns already exist!");
+        SPDLOG_TRACE("Recovered metadata of property columns for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)));
+      }
+      spdlog::info("Metadata of property columns are recovered.");
+    }
+
+    // Recover composite indices.
+    if (*version >= kCompositeIndicesVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} composite indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto properties_count = snapshot.ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid snapshot data!");
+        std::vector<PropertyId> properties;
+        for (uint64_t j = 0; j < *properties_count; ++j) {
+          auto property = snapshot.ReadUint();
+          if (!property) throw RecoveryFailure("Invalid snapshot data!");
+          properties.push_back(get_property_from_id(*property));
+        }
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_property_composite,
+                                    {get_label_from_id(*label), std::move(properties)},
+                                    "The composite index already exists!");
+        SPDLOG_TRACE("Recovered metadata of composite index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)));
+      }
+      spdlog::info("Metadata of composite indices are recovered.");
+    }
+
+    // Recover edge indices.
+    if (*version >= kEdgeIndicesVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} edge type indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.edge_type, get_edge_type_from_id(*edge_type),
+                                    "The edge index already exists!");
+        SPDLOG_TRACE("Recovered metadata of edge index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)));
+      }
+      spdlog::info("Metadata of edge type indices are recovered.");
+
+      size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} edge type+property indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.edge_type_property,
+                                    {get_edge_type_from_id(*edge_type), get_property_from_id(*property)},
+                                    "The edge property index already exists!");
+        SPDLOG_TRACE("Recovered metadata of edge property index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of edge type+property indices are recovered.");
+    }
+
+    // Recover hash indices.
+    if (*version >= kHashIndicesVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} hash indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_property_hash,
+                                    {get_label_from_id(*label), get_property_from_id(*property)},
+                                    "The hash index already exists!");
+        SPDLOG_TRACE("Recovered metadata of hash index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of hash indices are recovered.");
+    }
     spdlog::info("Metadata of indices are recovered.");
   }
 
@@ -626,11 +960,16 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
 }
 
 void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snapshot_directory,
-                    const std::filesystem::path &wal_directory, uint64_t snapshot_retention_count,
-                    utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper,
-                    Indices *indices, Constraints *constraints, Config::Items items, const std::string &uuid,
+                    const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices,
+                    utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, Indices *indices,
+                    Constraints *constraints, const Config &config, const std::string &uuid,
                     const std::string_view epoch_id, const std::deque<std::pair<std::string, uint64_t>> &epoch_history,
                     utils::FileRetainer *file_retainer) {
+  const auto items = config.items;
+  const auto snapshot_retention_count = config.durability.snapshot_retention_count;
+  const auto items_per_batch = std::max(config.durability.items_per_batch, static_cast<uint64_t>(1));
+  const auto thread_count = config.durability.snapshot_thread_count;
+
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(snapshot_directory);
 
@@ -665,130 +1004,158 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
   uint64_t edges_count = 0;
   uint64_t vertices_count = 0;
 
+  // Object batches.
+  std::vector<BatchInfo> edge_batches;
+  std::vector<BatchInfo> vertex_batches;
+
   // Mapper data.
   std::unordered_set<uint64_t> used_ids;
-  auto write_mapping = [&snapshot, &used_ids](auto mapping) {
-    used_ids.insert(mapping.AsUint());
-    snapshot.WriteUint(mapping.AsUint());
+  auto write_mapping = [](BaseEncoder *encoder, std::unordered_set<uint64_t> *used_ids, auto mapping) {
+    used_ids->insert(mapping.AsUint());
+    encoder->WriteUint(mapping.AsUint());
   };
 
   // Store all edges.
   if (items.properties_on_edges) {
     offset_edges = snapshot.GetPosition();
-    auto acc = edges->access();
-    for (auto &edge : acc) {
-      // The edge visibility check must be done here manually because we don't
-      // allow direct access to the edges through the public API.
-      bool is_visible = true;
-      Delta *delta = nullptr;
-      {
-        std::lock_guard<utils::SpinLock> guard(edge.lock);
-        is_visible = !edge.deleted;
-        delta = edge.delta;
-      }
-      ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
-        switch (delta.action) {
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            break;
-          case Delta::Action::RECREATE_OBJECT: {
-            is_visible = true;
-            break;
+    auto write_edges = [&](BaseEncoder *encoder, std::unordered_set<uint64_t> *used_ids, Gid from,
+                           std::optional<Gid> to) -> uint64_t {
+      uint64_t count = 0;
+      auto acc = edges->access();
+      for (auto it = acc.find_equal_or_greater(from); it != acc.end(); ++it) {
+        auto &edge = *it;
+        if (to && edge.gid >= *to) break;
+        // The edge visibility check must be done here manually because we don't
+        // allow direct access to the edges through the public API.
+        bool is_visible = true;
+        Delta *delta = nullptr;
+        {
+          std::lock_guard<utils::SpinLock> guard(edge.lock);
+          is_visible = !edge.deleted;
+          delta = edge.delta;
+        }
+        ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
+          switch (delta.action) {
+            case Delta::Action::ADD_LABEL:
+            case Delta::Action::REMOVE_LABEL:
+            case Delta::Action::SET_PROPERTY:
+            case Delta::Action::ADD_IN_EDGE:
+            case Delta::Action::ADD_OUT_EDGE:
+            case Delta::Action::REMOVE_IN_EDGE:
+            case Delta::Action::REMOVE_OUT_EDGE:
+              break;
+            case Delta::Action::RECREATE_OBJECT: {
+              is_visible = true;
+              break;
+            }
+            case Delta::Action::DELETE_OBJECT: {
+              is_visible = false;
+              break;
+            }
           }
-          case Delta::Action::DELETE_OBJECT: {
-            is_visible = false;
-            break;
+        });
+        if (!is_visible) continue;
+        EdgeRef edge_ref(&edge);
+        // Here we create an edge accessor that we will use to get the
+        // properties of the edge. The accessor is created with an invalid
+        // type and invalid from/to pointers because we don't know them here,
+        // but that isn't an issue because we won't use that part of the API
+        // here.
+        auto ea = EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints,
+                               items};
+
+        // Get edge data.
+        auto maybe_props = ea.Properties(View::OLD);
+        MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+
+        // Store the edge.
+        {
+          encoder->WriteMarker(Marker::SECTION_EDGE);
+          encoder->WriteUint(edge.gid.AsUint());
+          const auto &props = maybe_props.GetValue();
+          encoder->WriteUint(props.size());
+          for (const auto &item : props) {
+            write_mapping(encoder, used_ids, item.first);
+            encoder->WritePropertyValue(item.second);
           }
         }
-      });
-      if (!is_visible) continue;
-      EdgeRef edge_ref(&edge);
-      // Here we create an edge accessor that we will use to get the
-      // properties of the edge. The accessor is created with an invalid
-      // type and invalid from/to pointers because we don't know them here,
-      // but that isn't an issue because we won't use that part of the API
-      // here.
-      auto ea =
-          EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints, items};
-
-      // Get edge data.
-      auto maybe_props = ea.Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-
-      // Store the edge.
-      {
-        snapshot.WriteMarker(Marker::SECTION_EDGE);
-        snapshot.WriteUint(edge.gid.AsUint());
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-      }
 
-      ++edges_count;
+        ++count;
+      }
+      return count;
+    };
+    edge_batches = WriteBatches(&snapshot, SplitIntoBatches(edges, items_per_batch), thread_count, &used_ids,
+                                write_edges);
+    for (const auto &batch : edge_batches) {
+      edges_count += batch.count;
     }
   }
 
   // Store all vertices.
   {
     offset_vertices = snapshot.GetPosition();
-    auto acc = vertices->access();
-    for (auto &vertex : acc) {
-      // The visibility check is implemented for vertices so we use it here.
-      auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, items, View::OLD);
-      if (!va) continue;
-
-      // Get vertex data.
-      // TODO (mferencevic): All of these functions could be written into a
-      // single function so that we traverse the undo deltas only once.
-      auto maybe_labels = va->Labels(View::OLD);
-      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
-      auto maybe_props = va->Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-      auto maybe_in_edges = va->InEdges(View::OLD);
-      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
-      auto maybe_out_edges = va->OutEdges(View::OLD);
-      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
-
-      // Store the vertex.
-      {
-        snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        snapshot.WriteUint(vertex.gid.AsUint());
-        const auto &labels = maybe_labels.GetValue();
-        snapshot.WriteUint(labels.size());
-        for (const auto &item : labels) {
-          write_mapping(item);
-        }
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-        const auto &in_edges = maybe_in_edges.GetValue();
-        snapshot.WriteUint(in_edges.size());
-        for (const auto &item : in_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
-        }
-        const auto &out_edges = maybe_out_edges.GetValue();
-        snapshot.WriteUint(out_edges.size());
-        for (const auto &item : out_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
+    auto write_vertices = [&](BaseEncoder *encoder, std::unordered_set<uint64_t> *used_ids, Gid from,
+                              std::optional<Gid> to) -> uint64_t {
+      uint64_t count = 0;
+      auto acc = vertices->access();
+      for (auto it = acc.find_equal_or_greater(from); it != acc.end(); ++it) {
+        auto &vertex = *it;
+        if (to && vertex.gid >= *to) break;
+        // The visibility check is implemented for vertices so we use it here.
+        auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, items, View::OLD);
+        if (!va) continue;
+
+        // Get vertex data.
+        // TODO (mferencevic): All of these functions could be written into a
+        // single function so that we traverse the undo deltas only once.
+        auto maybe_labels = va->Labels(View::OLD);
+        MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+        auto maybe_props = va->Properties(View::OLD);
+        MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+        auto maybe_in_edges = va->InEdges(View::OLD);
+        MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+        auto maybe_out_edges = va->OutEdges(View::OLD);
+        MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+        // Store the vertex.
+        {
+          encoder->WriteMarker(Marker::SECTION_VERTEX);
+          encoder->WriteUint(vertex.gid.AsUint());
+          const auto &labels = maybe_labels.GetValue();
+          encoder->WriteUint(labels.size());
+          for (const auto &item : labels) {
+            write_mapping(encoder, used_ids, item);
+          }
+          const auto &props = maybe_props.GetValue();
+          encoder->WriteUint(props.size());
+          for (const auto &item : props) {
+            write_mapping(encoder, used_ids, item.first);
+            encoder->WritePropertyValue(item.second);
+          }
+          const auto &in_edges = maybe_in_edges.GetValue();
+          encoder->WriteUint(in_edges.size());
+          for (const auto &item : in_edges) {
+            encoder->WriteUint(item.Gid().AsUint());
+            encoder->WriteUint(item.FromVertex().Gid().AsUint());
+            write_mapping(encoder, used_ids, item.EdgeType());
+          }
+          const auto &out_edges = maybe_out_edges.GetValue();
+          encoder->WriteUint(out_edges.size());
+          for (const auto &item : out_edges) {
+            encoder->WriteUint(item.Gid().AsUint());
+            encoder->WriteUint(item.ToVertex().Gid().AsUint());
+            write_mapping(encoder, used_ids, item.EdgeType());
+          }
         }
-      }
 
-      ++vertices_count;
+        ++count;
+      }
+      return count;
+    };
+    vertex_batches = WriteBatches(&snapshot, SplitIntoBatches(vertices, items_per_batch), thread_count, &used_ids,
+                                  write_vertices);
+    for (const auto &batch : vertex_batches) {
+      vertices_count += batch.count;
     }
   }
 
@@ -802,7 +1169,7 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
       auto label = indices->label_index.ListIndices();
       snapshot.WriteUint(label.size());
       for (const auto &item : label) {
-        write_mapping(item);
+        write_mapping(&snapshot, &used_ids, item);
       }
     }
 
@@ -811,8 +1178,60 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
       auto label_property = indices->label_property_index.ListIndices();
       snapshot.WriteUint(label_property.size());
       for (const auto &item : label_property) {
-        write_mapping(item.first);
-        write_mapping(item.second);
+        write_mapping(&snapshot, &used_ids, item.first);
+        write_mapping(&snapshot, &used_ids, item.second);
+      }
+    }
+
+    // Write property columns.
+    {
+      auto columns = indices->property_columns.ListColumns();
+      snapshot.WriteUint(columns.size());
+      for (const auto &[label, schema] : columns) {
+        write_mapping(&snapshot, &used_ids, label);
+        snapshot.WriteUint(schema.size());
+        for (const auto &[property, type] : schema) {
+          write_mapping(&snapshot, &used_ids, property);
+          snapshot.WriteMarker(PropertyColumnTypeToMarker(type));
+        }
+      }
+    }
+
+    // Write composite indices.
+    {
+      auto composite = indices->label_property_composite_index.ListIndices();
+      snapshot.WriteUint(composite.size());
+      for (const auto &item : composite) {
+        write_mapping(&snapshot, &used_ids, item.first);
+        snapshot.WriteUint(item.second.size());
+        for (const auto &property : item.second) {
+          write_mapping(&snapshot, &used_ids, property);
+        }
+      }
+    }
+
+    // Write edge indices.
+    {
+      auto edge_type = indices->edge_type_index.ListIndices();
+      snapshot.WriteUint(edge_type.size());
+      for (const auto &item : edge_type) {
+        write_mapping(&snapshot, &used_ids, item);
+      }
+      auto edge_type_property = indices->edge_type_property_index.ListIndices();
+      snapshot.WriteUint(edge_type_property.size());
+      for (const auto &item : edge_type_property) {
+        write_mapping(&snapshot, &used_ids, item.first);
+        write_mapping(&snapshot, &used_ids, item.second);
+      }
+    }
+
+    // Write hash indices.
+    {
+      auto hash = indices->label_property_hash_index.ListIndices();
+      snapshot.WriteUint(hash.size());
+      for (const auto &item : hash) {
+        write_mapping(&snapshot, &used_ids, item.first);
+        write_mapping(&snapshot, &used_ids, item.second);
       }
     }
   }
@@ -827,8 +1246,8 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
       auto existence = ListExistenceConstraints(*constraints);
       snapshot.WriteUint(existence.size());
       for (const auto &item : existence) {
-        write_mapping(item.first);
-        write_mapping(item.second);
+        write_mapping(&snapshot, &used_ids, item.first);
+        write_mapping(&snapshot, &used_ids, item.second);
       }
     }
 
@@ -837,10 +1256,10 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
       auto unique = constraints->unique_constraints.ListConstraints();
       snapshot.WriteUint(unique.size());
       for (const auto &item : unique) {
-        write_mapping(item.first);
+        write_mapping(&snapshot, &used_ids, item.first);
         snapshot.WriteUint(item.second.size());
         for (const auto &property : item.second) {
-          write_mapping(property);
+          write_mapping(&snapshot, &used_ids, property);
         }
       }
     }
@@ -877,6 +1296,15 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(transaction->start_timestamp);
     snapshot.WriteUint(edges_count);
     snapshot.WriteUint(vertices_count);
+    auto write_batches = [&snapshot](const std::vector<BatchInfo> &batches) {
+      snapshot.WriteUint(batches.size());
+      for (const auto &batch : batches) {
+        snapshot.WriteUint(batch.offset);
+        snapshot.WriteUint(batch.count);
+      }
+    };
+    write_batches(edge_batches);
+    write_batches(vertex_batches);
   }
 
   // Write true offsets.
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/constraints.hpp"
@@ -28,6 +29,13 @@
 
 namespace memgraph::storage::durability {
 
+/// Structure used to hold the location of a batch of edges or vertices in the
+/// snapshot. Each batch can be decoded independently of the other batches.
+struct BatchInfo {
+  uint64_t offset;
+  uint64_t count;
+};
+
 /// Structure used to hold information about a snapshot.
 struct SnapshotInfo {
   uint64_t offset_edges;
@@ -43,6 +51,9 @@ struct SnapshotInfo {
   uint64_t start_timestamp;
   uint64_t edges_count;
   uint64_t vertices_count;
+
+  std::vector<BatchInfo> edge_batches;
+  std::vector<BatchInfo> vertex_batches;
 };
 
 /// Structure used to hold information about the snapshot that has been
@@ -62,13 +73,13 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path);
 RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
                                utils::SkipList<Edge> *edges,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
-                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config::Items items);
+                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, const Config &config);
 
 /// Function used to create a snapshot using the given transaction.
 void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snapshot_directory,
-                    const std::filesystem::path &wal_directory, uint64_t snapshot_retention_count,
-                    utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper,
-                    Indices *indices, Constraints *constraints, Config::Items items, const std::string &uuid,
+                    const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices,
+                    utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, Indices *indices,
+                    Constraints *constraints, const Config &config, const std::string &uuid,
                     std::string_view epoch_id, const std::deque<std::pair<std::string, uint64_t>> &epoch_history,
                     utils::FileRetainer *file_retainer);
 
@@ -20,10 +20,15 @@ namespace memgraph::storage::durability {
 // The current version of snapshot and WAL encoding / decoding.
 // IMPORTANT: Please bump this version for every snapshot and/or WAL format
 // change!!!
-const uint64_t kVersion{14};
+const uint64_t kVersion{19};
 
 const uint64_t kOldestSupportedVersion{14};
 const uint64_t kUniqueConstraintVersion{13};
+const uint64_t kSnapshotBatchesVersion{15};
+const uint64_t kPropertyColumnsVersion{16};
+const uint64_t kCompositeIndicesVersion{17};
+const uint64_t kEdgeIndicesVersion{18};
+const uint64_t kHashIndicesVersion{19};
 
 // Magic values written to the start of a snapshot/WAL file to identify it.
 const std::string kSnapshotMagic{"MGsn"};
@@ -11,6 +11,12 @@
 
 #include "storage/v2/durability/wal.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/durability/paths.hpp"
@@ -19,6 +25,7 @@
 #include "storage/v2/vertex.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
+#include "utils/thread.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -63,12 +70,28 @@ namespace memgraph::storage::durability {
 //         * label index create, label index drop
 //              * label name
 //         * label property index create, label property index drop,
-//           existence constraint create, existence constraint drop
+//           existence constraint create, existence constraint drop, label
+//           property hash index create, label property hash index drop (the
+//           latter two from version 19)
 //              * label name
 //              * property name
 //         * unique constraint create, unique constraint drop
 //              * label name
 //              * property names
+//         * property columns create (from version 16)
+//              * label name
+//              * property names and type markers in the order of the columns
+//         * property columns drop (from version 16)
+//              * label name
+//         * composite index create, composite index drop (from version 17)
+//              * label name
+//              * property names in the order of the index
+//         * edge index create, edge index drop (from version 18)
+//              * edge type name
+//         * edge property index create, edge property index drop (from
+//           version 18)
+//              * edge type name
+//              * property name
 //
 // IMPORTANT: When changing WAL encoding/decoding bump the snapshot/WAL version
 // in `version.hpp`.
@@ -93,6 +116,26 @@ Marker OperationToMarker(StorageGlobalOperation operation) {
       return Marker::DELTA_UNIQUE_CONSTRAINT_CREATE;
     case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
       return Marker::DELTA_UNIQUE_CONSTRAINT_DROP;
+    case StorageGlobalOperation::LABEL_PROPERTIES_INDEX_CREATE:
+      return Marker::DELTA_LABEL_PROPERTIES_INDEX_CREATE;
+    case StorageGlobalOperation::LABEL_PROPERTIES_INDEX_DROP:
+      return Marker::DELTA_LABEL_PROPERTIES_INDEX_DROP;
+    case StorageGlobalOperation::PROPERTY_COLUMNS_CREATE:
+      return Marker::DELTA_PROPERTY_COLUMNS_CREATE;
+    case StorageGlobalOperation::PROPERTY_COLUMNS_DROP:
+      return Marker::DELTA_PROPERTY_COLUMNS_DROP;
+    case StorageGlobalOperation::EDGE_INDEX_CREATE:
+      return Marker::DELTA_EDGE_INDEX_CREATE;
+    case StorageGlobalOperation::EDGE_INDEX_DROP:
+      return Marker::DELTA_EDGE_INDEX_DROP;
+    case StorageGlobalOperation::EDGE_PROPERTY_INDEX_CREATE:
+      return Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE;
+    case StorageGlobalOperation::EDGE_PROPERTY_INDEX_DROP:
+      return Marker::DELTA_EDGE_PROPERTY_INDEX_DROP;
+    case StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_CREATE:
+      return Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE;
+    case StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_DROP:
+      return Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_DROP;
   }
 }
 
@@ -161,6 +204,26 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
       return WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE;
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
       return WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP;
+    case Marker::DELTA_LABEL_PROPERTIES_INDEX_CREATE:
+      return WalDeltaData::Type::LABEL_PROPERTIES_INDEX_CREATE;
+    case Marker::DELTA_LABEL_PROPERTIES_INDEX_DROP:
+      return WalDeltaData::Type::LABEL_PROPERTIES_INDEX_DROP;
+    case Marker::DELTA_PROPERTY_COLUMNS_CREATE:
+      return WalDeltaData::Type::PROPERTY_COLUMNS_CREATE;
+    case Marker::DELTA_PROPERTY_COLUMNS_DROP:
+      return WalDeltaData::Type::PROPERTY_COLUMNS_DROP;
+    case Marker::DELTA_EDGE_INDEX_CREATE:
+      return WalDeltaData::Type::EDGE_INDEX_CREATE;
+    case Marker::DELTA_EDGE_INDEX_DROP:
+      return WalDeltaData::Type::EDGE_INDEX_DROP;
+    case Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE:
+      return WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE;
+    case Marker::DELTA_EDGE_PROPERTY_INDEX_DROP:
+      return WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP;
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE:
+      return WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE;
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_DROP:
+      return WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_DROP;
 
     case Marker::TYPE_NULL:
     case Marker::TYPE_BOOL:
@@ -262,7 +325,8 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
     case WalDeltaData::Type::TRANSACTION_END:
       break;
     case WalDeltaData::Type::LABEL_INDEX_CREATE:
-    case WalDeltaData::Type::LABEL_INDEX_DROP: {
+    case WalDeltaData::Type::LABEL_INDEX_DROP:
+    case WalDeltaData::Type::PROPERTY_COLUMNS_DROP: {
       if constexpr (read_data) {
         auto label = decoder->ReadString();
         if (!label) throw RecoveryFailure("Invalid WAL data!");
@@ -275,7 +339,9 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
-    case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
+    case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_DROP: {
       if constexpr (read_data) {
         auto label = decoder->ReadString();
         if (!label) throw RecoveryFailure("Invalid WAL data!");
@@ -309,6 +375,80 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
           if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
         }
       }
+      break;
+    }
+    case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_property_list.label = std::move(*label);
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          auto property = decoder->ReadString();
+          if (!property) throw RecoveryFailure("Invalid WAL data!");
+          delta.operation_label_property_list.properties.emplace_back(std::move(*property));
+        }
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        }
+      }
+      break;
+    }
+    case WalDeltaData::Type::PROPERTY_COLUMNS_CREATE: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_property_columns.label = std::move(*label);
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      auto properties_count = decoder->ReadUint();
+      if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+      for (uint64_t i = 0; i < *properties_count; ++i) {
+        if constexpr (read_data) {
+          auto property = decoder->ReadString();
+          if (!property) throw RecoveryFailure("Invalid WAL data!");
+          auto marker = decoder->ReadMarker();
+          if (!marker) throw RecoveryFailure("Invalid WAL data!");
+          auto type = MarkerToPropertyColumnType(*marker);
+          if (!type) throw RecoveryFailure("Invalid WAL data!");
+          delta.operation_label_property_columns.properties.emplace_back(std::move(*property), *type);
+        } else {
+          if (!decoder->SkipString() || !decoder->ReadMarker()) throw RecoveryFailure("Invalid WAL data!");
+        }
+      }
+      break;
+    }
+    case WalDeltaData::Type::EDGE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto edge_type = decoder->ReadString();
+        if (!edge_type) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type.edge_type = std::move(*edge_type);
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
+    }
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto edge_type = decoder->ReadString();
+        if (!edge_type) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.edge_type = std::move(*edge_type);
+        auto property = decoder->ReadString();
+        if (!property) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.property = std::move(*property);
+      } else {
+        if (!decoder->SkipString() || !decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
     }
   }
 
@@ -444,18 +584,35 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
 
     case WalDeltaData::Type::LABEL_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_INDEX_DROP:
+    case WalDeltaData::Type::PROPERTY_COLUMNS_DROP:
       return a.operation_label.label == b.operation_label.label;
 
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_DROP:
       return a.operation_label_property.label == b.operation_label_property.label &&
              a.operation_label_property.property == b.operation_label_property.property;
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
       return a.operation_label_properties.label == b.operation_label_properties.label &&
              a.operation_label_properties.properties == b.operation_label_properties.properties;
+    case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_DROP:
+      return a.operation_label_property_list.label == b.operation_label_property_list.label &&
+             a.operation_label_property_list.properties == b.operation_label_property_list.properties;
+    case WalDeltaData::Type::PROPERTY_COLUMNS_CREATE:
+      return a.operation_label_property_columns.label == b.operation_label_property_columns.label &&
+             a.operation_label_property_columns.properties == b.operation_label_property_columns.properties;
+    case WalDeltaData::Type::EDGE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_INDEX_DROP:
+      return a.operation_edge_type.edge_type == b.operation_edge_type.edge_type;
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP:
+      return a.operation_edge_type_property.edge_type == b.operation_edge_type_property.edge_type &&
+             a.operation_edge_type_property.property == b.operation_edge_type_property.property;
   }
 }
 bool operator!=(const WalDeltaData &a, const WalDeltaData &b) { return !(a == b); }
@@ -583,12 +740,13 @@ void EncodeTransactionEnd(BaseEncoder *encoder, uint64_t timestamp) {
 }
 
 void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
-                     LabelId label, const std::set<PropertyId> &properties, uint64_t timestamp) {
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp) {
   encoder->WriteMarker(Marker::SECTION_DELTA);
   encoder->WriteUint(timestamp);
   switch (operation) {
     case StorageGlobalOperation::LABEL_INDEX_CREATE:
-    case StorageGlobalOperation::LABEL_INDEX_DROP: {
+    case StorageGlobalOperation::LABEL_INDEX_DROP:
+    case StorageGlobalOperation::PROPERTY_COLUMNS_DROP: {
       MG_ASSERT(properties.empty(), "Invalid function call!");
       encoder->WriteMarker(OperationToMarker(operation));
       encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
@@ -597,7 +755,9 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
     case StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE:
     case StorageGlobalOperation::LABEL_PROPERTY_INDEX_DROP:
     case StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE:
-    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP: {
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_DROP: {
       MG_ASSERT(properties.size() == 1, "Invalid function call!");
       encoder->WriteMarker(OperationToMarker(operation));
       encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
@@ -605,7 +765,9 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
       break;
     }
     case StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
-    case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP: {
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTIES_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTIES_INDEX_DROP: {
       MG_ASSERT(!properties.empty(), "Invalid function call!");
       encoder->WriteMarker(OperationToMarker(operation));
       encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
@@ -615,13 +777,319 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
       }
       break;
     }
+    case StorageGlobalOperation::PROPERTY_COLUMNS_CREATE:
+    case StorageGlobalOperation::EDGE_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_INDEX_DROP:
+    case StorageGlobalOperation::EDGE_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_PROPERTY_INDEX_DROP:
+      LOG_FATAL("Invalid function call!");
+  }
+}
+
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     LabelId label, const std::vector<std::pair<PropertyId, PropertyValue::Type>> &schema,
+                     uint64_t timestamp) {
+  MG_ASSERT(operation == StorageGlobalOperation::PROPERTY_COLUMNS_CREATE && !schema.empty(),
+            "Invalid function call!");
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteUint(timestamp);
+  encoder->WriteMarker(OperationToMarker(operation));
+  encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
+  encoder->WriteUint(schema.size());
+  for (const auto &[property, type] : schema) {
+    encoder->WriteString(name_id_mapper->IdToName(property.AsUint()));
+    encoder->WriteMarker(PropertyColumnTypeToMarker(type));
+  }
+}
+
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     EdgeTypeId edge_type, const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteUint(timestamp);
+  switch (operation) {
+    case StorageGlobalOperation::EDGE_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_INDEX_DROP: {
+      MG_ASSERT(properties.empty(), "Invalid function call!");
+      encoder->WriteMarker(OperationToMarker(operation));
+      encoder->WriteString(name_id_mapper->IdToName(edge_type.AsUint()));
+      break;
+    }
+    case StorageGlobalOperation::EDGE_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_PROPERTY_INDEX_DROP: {
+      MG_ASSERT(properties.size() == 1, "Invalid function call!");
+      encoder->WriteMarker(OperationToMarker(operation));
+      encoder->WriteString(name_id_mapper->IdToName(edge_type.AsUint()));
+      encoder->WriteString(name_id_mapper->IdToName(properties.front().AsUint()));
+      break;
+    }
+    case StorageGlobalOperation::LABEL_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_INDEX_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_INDEX_DROP:
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE:
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTIES_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTIES_INDEX_DROP:
+    case StorageGlobalOperation::PROPERTY_COLUMNS_CREATE:
+    case StorageGlobalOperation::PROPERTY_COLUMNS_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_DROP:
+      LOG_FATAL("Invalid function call!");
+  }
+}
+
+Marker PropertyColumnTypeToMarker(PropertyValue::Type type) {
+  switch (type) {
+    case PropertyValue::Type::Bool:
+      return Marker::TYPE_BOOL;
+    case PropertyValue::Type::Int:
+      return Marker::TYPE_INT;
+    case PropertyValue::Type::Double:
+      return Marker::TYPE_DOUBLE;
+    case PropertyValue::Type::Null:
+    case PropertyValue::Type::String:
+    case PropertyValue::Type::List:
+    case PropertyValue::Type::Map:
+    case PropertyValue::Type::TemporalData:
+      LOG_FATAL("Invalid property column type!");
+  }
+}
+
+std::optional<PropertyValue::Type> MarkerToPropertyColumnType(Marker marker) {
+  switch (marker) {
+    case Marker::TYPE_BOOL:
+      return PropertyValue::Type::Bool;
+    case Marker::TYPE_INT:
+      return PropertyValue::Type::Int;
+    case Marker::TYPE_DOUBLE:
+      return PropertyValue::Type::Double;
+    default:
+      return std::nullopt;
   }
 }
 
+namespace {
+
+// Change of a single vertex or edge that is recovered from a WAL delta.
+struct RecoveredChange {
+  enum class Type {
+    VERTEX_DELETE,
+    VERTEX_ADD_LABEL,
+    VERTEX_REMOVE_LABEL,
+    VERTEX_SET_PROPERTY,
+    VERTEX_ADD_OUT_EDGE,
+    VERTEX_ADD_IN_EDGE,
+    VERTEX_REMOVE_OUT_EDGE,
+    VERTEX_REMOVE_IN_EDGE,
+    EDGE_DELETE,
+    EDGE_SET_PROPERTY,
+  };
+
+  Type type;
+  Vertex *vertex{nullptr};
+  Edge *edge{nullptr};
+  LabelId label;
+  PropertyId property;
+  PropertyValue value;
+  // The other vertex and the edge of the added or removed edge link.
+  std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{EdgeTypeId::FromUint(0), nullptr, EdgeRef(Gid::FromUint(0))};
+};
+
+void ApplyRecoveredChange(RecoveredChange *change, utils::SkipList<Vertex>::Accessor *vertex_acc,
+                          utils::SkipList<Edge>::Accessor *edge_acc) {
+  auto *vertex = change->vertex;
+  switch (change->type) {
+    case RecoveredChange::Type::VERTEX_DELETE: {
+      if (!vertex->in_edges.empty() || !vertex->out_edges.empty())
+        throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
+      if (!vertex_acc->remove(vertex->gid)) throw RecoveryFailure("The vertex must be removed here!");
+      break;
+    }
+    case RecoveredChange::Type::VERTEX_ADD_LABEL: {
+      if (std::find(vertex->labels.begin(), vertex->labels.end(), change->label) != vertex->labels.end())
+        throw RecoveryFailure("The vertex already has the label!");
+      vertex->labels.push_back(change->label);
+      break;
+    }
+    case RecoveredChange::Type::VERTEX_REMOVE_LABEL: {
+      auto it = std::find(vertex->labels.begin(), vertex->labels.end(), change->label);
+      if (it == vertex->labels.end()) throw RecoveryFailure("The vertex doesn't have the label!");
+      std::swap(*it, vertex->labels.back());
+      vertex->labels.pop_back();
+      break;
+    }
+    case RecoveredChange::Type::VERTEX_SET_PROPERTY:
+      vertex->properties.SetProperty(change->property, change->value);
+      break;
+    case RecoveredChange::Type::VERTEX_ADD_OUT_EDGE:
+      if (vertex->out_edges.contains(change->link)) throw RecoveryFailure("The from vertex already has this edge!");
+      vertex->out_edges.push_back(change->link);
+      break;
+    case RecoveredChange::Type::VERTEX_ADD_IN_EDGE:
+      if (vertex->in_edges.contains(change->link)) throw RecoveryFailure("The to vertex already has this edge!");
+      vertex->in_edges.push_back(change->link);
+      break;
+    case RecoveredChange::Type::VERTEX_REMOVE_OUT_EDGE:
+      if (!vertex->out_edges.erase(change->link)) throw RecoveryFailure("The from vertex doesn't have this edge!");
+      break;
+    case RecoveredChange::Type::VERTEX_REMOVE_IN_EDGE:
+      if (!vertex->in_edges.erase(change->link)) throw RecoveryFailure("The to vertex doesn't have this edge!");
+      break;
+    case RecoveredChange::Type::EDGE_DELETE:
+      if (!edge_acc->remove(change->edge->gid)) throw RecoveryFailure("The edge must be removed here!");
+      break;
+    case RecoveredChange::Type::EDGE_SET_PROPERTY:
+      change->edge->properties.SetProperty(change->property, change->value);
+      break;
+  }
+}
+
+// Applies the changes recovered from the WAL deltas while the following deltas
+// are being decoded. Every vertex and edge is owned by one of the `thread_count`
+// threads (chosen by its gid) which applies all of its changes in the order in
+// which they were added, so the changes of different objects are applied in
+// parallel. Creating and deleting an edge changes both of its vertices, so the
+// decoding thread splits such deltas into a change of each vertex. With a
+// single thread, the changes are applied immediately by the calling thread.
+class RecoveredChangeApplier {
+ public:
+  RecoveredChangeApplier(uint64_t thread_count, utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges)
+      : vertices_(vertices), edges_(edges), workers_(thread_count > 1 ? thread_count : 0) {
+    if (workers_.empty()) {
+      vertex_acc_.emplace(vertices_->access());
+      edge_acc_.emplace(edges_->access());
+      return;
+    }
+    for (auto &worker : workers_) {
+      worker.thread = std::thread([this, &worker] { Run(&worker); });
+    }
+  }
+
+  RecoveredChangeApplier(const RecoveredChangeApplier &) = delete;
+  RecoveredChangeApplier(RecoveredChangeApplier &&) = delete;
+  RecoveredChangeApplier &operator=(const RecoveredChangeApplier &) = delete;
+  RecoveredChangeApplier &operator=(RecoveredChangeApplier &&) = delete;
+
+  ~RecoveredChangeApplier() {
+    // The changes that weren't applied yet are discarded if the recovery
+    // failed before `Finish` was done. The threads are always joined, also
+    // when `Finish` itself threw.
+    if (!finished_) failed_.store(true, std::memory_order_release);
+    Stop();
+  }
+
+  /// @throw RecoveryFailure
+  void Apply(Gid owner, RecoveredChange change) {
+    if (workers_.empty()) {
+      ApplyRecoveredChange(&change, &*vertex_acc_, &*edge_acc_);
+      return;
+    }
+    auto &worker = workers_[owner.AsUint() % workers_.size()];
+    worker.pending.push_back(std::move(change));
+    if (worker.pending.size() >= kChangesPerBatch) Flush(&worker);
+  }
+
+  /// Waits until all of the changes are applied.
+  /// @throw RecoveryFailure
+  void Finish() {
+    for (auto &worker : workers_) {
+      if (!worker.pending.empty()) Flush(&worker);
+    }
+    Stop();
+    finished_ = true;
+    if (error_) std::rethrow_exception(error_);
+  }
+
+ private:
+  static constexpr size_t kChangesPerBatch = 4096;
+  static constexpr size_t kMaxQueuedBatches = 16;
+
+  struct Worker {
+    std::vector<RecoveredChange> pending;
+    std::mutex lock;
+    std::condition_variable cv;
+    std::deque<std::vector<RecoveredChange>> batches;
+    bool done{false};
+    std::thread thread;
+  };
+
+  void Flush(Worker *worker) {
+    if (failed_.load(std::memory_order_acquire)) {
+      std::lock_guard guard(error_lock_);
+      std::rethrow_exception(error_);
+    }
+    {
+      std::unique_lock guard(worker->lock);
+      // The decoding doesn't get too far ahead of the slowest thread.
+      worker->cv.wait(guard, [&] { return worker->batches.size() < kMaxQueuedBatches; });
+      worker->batches.push_back(std::move(worker->pending));
+    }
+    worker->cv.notify_all();
+    worker->pending.clear();
+    worker->pending.reserve(kChangesPerBatch);
+  }
+
+  void Stop() {
+    for (auto &worker : workers_) {
+      {
+        std::lock_guard guard(worker.lock);
+        worker.done = true;
+      }
+      worker.cv.notify_all();
+    }
+    for (auto &worker : workers_) {
+      if (worker.thread.joinable()) worker.thread.join();
+    }
+  }
+
+  void Run(Worker *worker) {
+    utils::ThreadSetName("WAL recovery");
+    auto vertex_acc = vertices_->access();
+    auto edge_acc = edges_->access();
+    while (true) {
+      std::vector<RecoveredChange> batch;
+      {
+        std::unique_lock guard(worker->lock);
+        worker->cv.wait(guard, [&] { return !worker->batches.empty() || worker->done; });
+        if (worker->batches.empty()) return;
+        batch = std::move(worker->batches.front());
+        worker->batches.pop_front();
+      }
+      worker->cv.notify_all();
+      // The batches keep being taken after a failure so that the decoding
+      // thread isn't blocked.
+      if (failed_.load(std::memory_order_acquire)) continue;
+      try {
+        for (auto &change : batch) {
+          ApplyRecoveredChange(&change, &vertex_acc, &edge_acc);
+        }
+      } catch (...) {
+        std::lock_guard guard(error_lock_);
+        if (!error_) error_ = std::current_exception();
+        failed_.store(true, std::memory_order_release);
+      }
+    }
+  }
+
+  utils::SkipList<Vertex> *vertices_;
+  utils::SkipList<Edge> *edges_;
+  std::optional<utils::SkipList<Vertex>::Accessor> vertex_acc_;
+  std::optional<utils::SkipList<Edge>::Accessor> edge_acc_;
+  std::vector<Worker> workers_;
+  bool finished_{false};
+  std::atomic<bool> failed_{false};
+  std::mutex error_lock_;
+  std::exception_ptr error_;
+};
+
+}  // namespace
+
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      const std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                     Config::Items items) {
+                     Config::Items items, const uint64_t thread_count) {
   spdlog::info("Trying to load WAL file {}.", path);
   RecoveryInfo ret;
 
@@ -640,11 +1108,18 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
     return ret;
   }
 
-  // Recover deltas.
+  // Recover deltas. The vertices and edges are created and looked up here,
+  // while the rest of their changes are applied by the `applier`.
   wal.SetPosition(info.offset_deltas);
   uint64_t deltas_applied = 0;
   auto edge_acc = edges->access();
   auto vertex_acc = vertices->access();
+  RecoveredChangeApplier applier(thread_count, vertices, edges);
+  auto find_vertex = [&](Gid gid, const char *error) {
+    auto vertex = vertex_acc.find(gid);
+    if (vertex == vertex_acc.end()) throw RecoveryFailure(error);
+    return &*vertex;
+  };
   spdlog::info("WAL file contains {} deltas.", info.num_deltas);
   for (uint64_t i = 0; i < info.num_deltas; ++i) {
     // Read WAL delta header to find out the delta timestamp.
@@ -663,51 +1138,38 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           break;
         }
         case WalDeltaData::Type::VERTEX_DELETE: {
-          auto vertex = vertex_acc.find(delta.vertex_create_delete.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-          if (!vertex->in_edges.empty() || !vertex->out_edges.empty())
-            throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
-
-          if (!vertex_acc.remove(delta.vertex_create_delete.gid))
-            throw RecoveryFailure("The vertex must be removed here!");
-
+          const auto gid = delta.vertex_create_delete.gid;
+          applier.Apply(gid, {.type = RecoveredChange::Type::VERTEX_DELETE,
+                              .vertex = find_vertex(gid, "The vertex doesn't exist!")});
           break;
         }
         case WalDeltaData::Type::VERTEX_ADD_LABEL:
         case WalDeltaData::Type::VERTEX_REMOVE_LABEL: {
-          auto vertex = vertex_acc.find(delta.vertex_add_remove_label.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-
+          const auto gid = delta.vertex_add_remove_label.gid;
+          auto *vertex = find_vertex(gid, "The vertex doesn't exist!");
           auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.vertex_add_remove_label.label));
-          auto it = std::find(vertex->labels.begin(), vertex->labels.end(), label_id);
-
-          if (delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL) {
-            if (it != vertex->labels.end()) throw RecoveryFailure("The vertex already has the label!");
-            vertex->labels.push_back(label_id);
-          } else {
-            if (it == vertex->labels.end()) throw RecoveryFailure("The vertex doesn't have the label!");
-            std::swap(*it, vertex->labels.back());
-            vertex->labels.pop_back();
-          }
-
+          applier.Apply(gid, {.type = delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL
+                                          ? RecoveredChange::Type::VERTEX_ADD_LABEL
+                                          : RecoveredChange::Type::VERTEX_REMOVE_LABEL,
+                              .vertex = vertex,
+                              .label = label_id});
           break;
         }
         case WalDeltaData::Type::VERTEX_SET_PROPERTY: {
-          auto vertex = vertex_acc.find(delta.vertex_edge_set_property.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-
+          const auto gid = delta.vertex_edge_set_property.gid;
+          auto *vertex = find_vertex(gid, "The vertex doesn't exist!");
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
-
-          vertex->properties.SetProperty(property_id, property_value);
-
+          applier.Apply(gid, {.type = RecoveredChange::Type::VERTEX_SET_PROPERTY,
+                              .vertex = vertex,
+                              .property = property_id,
+                              .value = std::move(delta.vertex_edge_set_property.value)});
           break;
         }
         case WalDeltaData::Type::EDGE_CREATE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
+          const auto from_gid = delta.edge_create_delete.from_vertex;
+          const auto to_gid = delta.edge_create_delete.to_vertex;
+          auto *from_vertex = find_vertex(from_gid, "The from vertex doesn't exist!");
+          auto *to_vertex = find_vertex(to_gid, "The to vertex doesn't exist!");
 
           auto edge_gid = delta.edge_create_delete.gid;
           auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
@@ -717,18 +1179,12 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
             edge_ref = EdgeRef(&*edge);
           }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
-            from_vertex->out_edges.push_back(link);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
-            to_vertex->in_edges.push_back(link);
-          }
+          applier.Apply(from_gid, {.type = RecoveredChange::Type::VERTEX_ADD_OUT_EDGE,
+                                   .vertex = from_vertex,
+                                   .link = {edge_type_id, to_vertex, edge_ref}});
+          applier.Apply(to_gid, {.type = RecoveredChange::Type::VERTEX_ADD_IN_EDGE,
+                                 .vertex = to_vertex,
+                                 .link = {edge_type_id, from_vertex, edge_ref}});
 
           ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
 
@@ -738,10 +1194,10 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           break;
         }
         case WalDeltaData::Type::EDGE_DELETE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
+          const auto from_gid = delta.edge_create_delete.from_vertex;
+          const auto to_gid = delta.edge_create_delete.to_vertex;
+          auto *from_vertex = find_vertex(from_gid, "The from vertex doesn't exist!");
+          auto *to_vertex = find_vertex(to_gid, "The to vertex doesn't exist!");
 
           auto edge_gid = delta.edge_create_delete.gid;
           auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
@@ -751,22 +1207,14 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
             edge_ref = EdgeRef(&*edge);
           }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
-            std::swap(*it, from_vertex->out_edges.back());
-            from_vertex->out_edges.pop_back();
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
-            std::swap(*it, to_vertex->in_edges.back());
-            to_vertex->in_edges.pop_back();
-          }
+          applier.Apply(from_gid, {.type = RecoveredChange::Type::VERTEX_REMOVE_OUT_EDGE,
+                                   .vertex = from_vertex,
+                                   .link = {edge_type_id, to_vertex, edge_ref}});
+          applier.Apply(to_gid, {.type = RecoveredChange::Type::VERTEX_REMOVE_IN_EDGE,
+                                 .vertex = to_vertex,
+                                 .link = {edge_type_id, from_vertex, edge_ref}});
           if (items.properties_on_edges) {
-            if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
+            applier.Apply(edge_gid, {.type = RecoveredChange::Type::EDGE_DELETE, .edge = edge_ref.ptr});
           }
 
           // Decrement edge count.
@@ -779,11 +1227,14 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             throw RecoveryFailure(
                 "The WAL has properties on edges, but the storage is "
                 "configured without properties on edges!");
-          auto edge = edge_acc.find(delta.vertex_edge_set_property.gid);
+          const auto edge_gid = delta.vertex_edge_set_property.gid;
+          auto edge = edge_acc.find(edge_gid);
           if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
-          edge->properties.SetProperty(property_id, property_value);
+          applier.Apply(edge_gid, {.type = RecoveredChange::Type::EDGE_SET_PROPERTY,
+                                   .edge = &*edge,
+                                   .property = property_id,
+                                   .value = std::move(delta.vertex_edge_set_property.value)});
           break;
         }
         case WalDeltaData::Type::TRANSACTION_END:
@@ -847,6 +1298,92 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                                          "The unique constraint doesn't exist!");
           break;
         }
+        case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_CREATE: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+          std::vector<PropertyId> property_ids;
+          for (const auto &prop : delta.operation_label_property_list.properties) {
+            property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+          }
+          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite, {label_id, property_ids},
+                                      "The composite index already exists!");
+          break;
+        }
+        case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_DROP: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+          std::vector<PropertyId> property_ids;
+          for (const auto &prop : delta.operation_label_property_list.properties) {
+            property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+          }
+          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                         {label_id, property_ids}, "The composite index doesn't exist!");
+          break;
+        }
+        case WalDeltaData::Type::PROPERTY_COLUMNS_CREATE: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_columns.label));
+          std::vector<std::pair<PropertyId, PropertyValue::Type>> schema;
+          for (const auto &[prop, type] : delta.operation_label_property_columns.properties) {
+            schema.emplace_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)), type);
+          }
+          auto &columns = indices_constraints->indices.property_columns;
+          if (std::any_of(columns.begin(), columns.end(), [&](const auto &item) { return item.first == label_id; })) {
+            throw RecoveryFailure("The property columns already exist!");
+          }
+          columns.emplace_back(label_id, std::move(schema));
+          break;
+        }
+        case WalDeltaData::Type::PROPERTY_COLUMNS_DROP: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+          auto &columns = indices_constraints->indices.property_columns;
+          auto it =
+              std::find_if(columns.begin(), columns.end(), [&](const auto &item) { return item.first == label_id; });
+          if (it == columns.end()) throw RecoveryFailure("The property columns don't exist!");
+          columns.erase(it);
+          break;
+        }
+        case WalDeltaData::Type::EDGE_INDEX_CREATE: {
+          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+          AddRecoveredIndexConstraint(&indices_constraints->indices.edge_type, edge_type_id,
+                                      "The edge index already exists!");
+          break;
+        }
+        case WalDeltaData::Type::EDGE_INDEX_DROP: {
+          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+          RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_type, edge_type_id,
+                                         "The edge index doesn't exist!");
+          break;
+        }
+        case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE: {
+          auto edge_type_id =
+              EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+          auto property_id =
+              PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+          AddRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property, {edge_type_id, property_id},
+                                      "The edge property index already exists!");
+          break;
+        }
+        case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
+          auto edge_type_id =
+              EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+          auto property_id =
+              PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+          RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property,
+                                         {edge_type_id, property_id}, "The edge property index doesn't exist!");
+          break;
+        }
+        case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property_hash, {label_id, property_id},
+                                      "The hash index already exists!");
+          break;
+        }
+        case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_DROP: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property_hash, {label_id, property_id},
+                                         "The hash index doesn't exist!");
+          break;
+        }
       }
       ret.next_timestamp = std::max(ret.next_timestamp, timestamp + 1);
       ++deltas_applied;
@@ -855,6 +1392,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
       SkipWalDeltaData(&wal);
     }
   }
+  applier.Finish();
 
   spdlog::info("Applied {} deltas from WAL. Skipped {} deltas, because they were too old.", deltas_applied,
                info.num_deltas - deltas_applied);
@@ -961,14 +1499,29 @@ void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   UpdateStats(timestamp);
 }
 
-void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
-                              uint64_t timestamp) {
+void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label,
+                              const std::vector<PropertyId> &properties, uint64_t timestamp) {
   EncodeOperation(&wal_, name_id_mapper_, operation, label, properties, timestamp);
   UpdateStats(timestamp);
 }
 
+void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label,
+                              const std::vector<std::pair<PropertyId, PropertyValue::Type>> &schema,
+                              uint64_t timestamp) {
+  EncodeOperation(&wal_, name_id_mapper_, operation, label, schema, timestamp);
+  UpdateStats(timestamp);
+}
+
+void WalFile::AppendOperation(StorageGlobalOperation operation, EdgeTypeId edge_type,
+                              const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  EncodeOperation(&wal_, name_id_mapper_, operation, edge_type, properties, timestamp);
+  UpdateStats(timestamp);
+}
+
 void WalFile::Sync() { wal_.Sync(); }
 
+int WalFile::FlushAndDuplicate() { return wal_.FlushAndDuplicate(); }
+
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
@@ -987,4 +1540,55 @@ void WalFile::TryFlushing() { wal_.TryFlushing(); }
 
 std::pair<const uint8_t *, size_t> WalFile::CurrentFileBuffer() const { return wal_.CurrentFileBuffer(); }
 
+WalGroupCommit::WalGroupCommit(std::function<void()> sync) : sync_(std::move(sync)), thread_([this] { Run(); }) {}
+
+WalGroupCommit::~WalGroupCommit() {
+  {
+    std::lock_guard guard(mutex_);
+    stop_ = true;
+  }
+  sync_requested_.notify_one();
+  thread_.join();
+}
+
+uint64_t WalGroupCommit::Register() {
+  uint64_t lsn = 0;
+  {
+    std::lock_guard guard(mutex_);
+    lsn = ++registered_lsn_;
+  }
+  sync_requested_.notify_one();
+  return lsn;
+}
+
+void WalGroupCommit::WaitDurable(uint64_t lsn) {
+  std::unique_lock guard(mutex_);
+  durable_.wait(guard, [&] { return durable_lsn_ >= lsn; });
+}
+
+void WalGroupCommit::MarkAllDurable() {
+  {
+    std::lock_guard guard(mutex_);
+    durable_lsn_ = registered_lsn_;
+  }
+  durable_.notify_all();
+}
+
+void WalGroupCommit::Run() {
+  utils::ThreadSetName("WAL writer");
+  std::unique_lock guard(mutex_);
+  while (true) {
+    sync_requested_.wait(guard, [this] { return stop_ || registered_lsn_ > durable_lsn_; });
+    // Pending commits are synced even when stopping.
+    if (registered_lsn_ == durable_lsn_) break;
+    // Everything registered up to now was appended before the sync starts.
+    const auto target_lsn = registered_lsn_;
+    guard.unlock();
+    sync_();
+    guard.lock();
+    durable_lsn_ = std::max(durable_lsn_, target_lsn);
+    durable_.notify_all();
+  }
+}
+
 }  // namespace memgraph::storage::durability
@@ -11,10 +11,15 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/delta.hpp"
@@ -63,6 +68,16 @@ struct WalDeltaData {
     EXISTENCE_CONSTRAINT_DROP,
     UNIQUE_CONSTRAINT_CREATE,
     UNIQUE_CONSTRAINT_DROP,
+    LABEL_PROPERTIES_INDEX_CREATE,
+    LABEL_PROPERTIES_INDEX_DROP,
+    PROPERTY_COLUMNS_CREATE,
+    PROPERTY_COLUMNS_DROP,
+    EDGE_INDEX_CREATE,
+    EDGE_INDEX_DROP,
+    EDGE_PROPERTY_INDEX_CREATE,
+    EDGE_PROPERTY_INDEX_DROP,
+    LABEL_PROPERTY_HASH_INDEX_CREATE,
+    LABEL_PROPERTY_HASH_INDEX_DROP,
   };
 
   Type type{Type::TRANSACTION_END};
@@ -102,6 +117,25 @@ struct WalDeltaData {
     std::string label;
     std::set<std::string> properties;
   } operation_label_properties;
+
+  struct {
+    std::string label;
+    std::vector<std::string> properties;
+  } operation_label_property_list;
+
+  struct {
+    std::string label;
+    std::vector<std::pair<std::string, PropertyValue::Type>> properties;
+  } operation_label_property_columns;
+
+  struct {
+    std::string edge_type;
+  } operation_edge_type;
+
+  struct {
+    std::string edge_type;
+    std::string property;
+  } operation_edge_type_property;
 };
 
 bool operator==(const WalDeltaData &a, const WalDeltaData &b);
@@ -117,6 +151,16 @@ enum class StorageGlobalOperation {
   EXISTENCE_CONSTRAINT_DROP,
   UNIQUE_CONSTRAINT_CREATE,
   UNIQUE_CONSTRAINT_DROP,
+  LABEL_PROPERTIES_INDEX_CREATE,
+  LABEL_PROPERTIES_INDEX_DROP,
+  PROPERTY_COLUMNS_CREATE,
+  PROPERTY_COLUMNS_DROP,
+  EDGE_INDEX_CREATE,
+  EDGE_INDEX_DROP,
+  EDGE_PROPERTY_INDEX_CREATE,
+  EDGE_PROPERTY_INDEX_DROP,
+  LABEL_PROPERTY_HASH_INDEX_CREATE,
+  LABEL_PROPERTY_HASH_INDEX_DROP,
 };
 
 constexpr bool IsWalDeltaDataTypeTransactionEnd(const WalDeltaData::Type type) {
@@ -148,6 +192,16 @@ constexpr bool IsWalDeltaDataTypeTransactionEnd(const WalDeltaData::Type type) {
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTIES_INDEX_DROP:
+    case WalDeltaData::Type::PROPERTY_COLUMNS_CREATE:
+    case WalDeltaData::Type::PROPERTY_COLUMNS_DROP:
+    case WalDeltaData::Type::EDGE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_INDEX_DROP:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_DROP:
       return true;
   }
 }
@@ -184,16 +238,35 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta
 /// Function used to encode the transaction end.
 void EncodeTransactionEnd(BaseEncoder *encoder, uint64_t timestamp);
 
-/// Function used to encode non-transactional operation.
+/// Function used to encode non-transactional operation. The order of the
+/// properties is kept only for composite indices.
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp);
+
+/// Function used to encode the creation of property columns, which also
+/// stores the type of every column.
 void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
-                     LabelId label, const std::set<PropertyId> &properties, uint64_t timestamp);
+                     LabelId label, const std::vector<std::pair<PropertyId, PropertyValue::Type>> &schema,
+                     uint64_t timestamp);
 
-/// Function used to load the WAL data into the storage.
+/// Function used to encode the creation or removal of an edge index. The
+/// properties are empty for an edge type index and hold a single property for
+/// an edge type+property index.
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     EdgeTypeId edge_type, const std::vector<PropertyId> &properties, uint64_t timestamp);
+
+/// Functions used to encode and decode the type of a property column.
+Marker PropertyColumnTypeToMarker(PropertyValue::Type type);
+std::optional<PropertyValue::Type> MarkerToPropertyColumnType(Marker marker);
+
+/// Function used to load the WAL data into the storage. The deltas are
+/// decoded by the calling thread and applied to the vertices and edges by
+/// `thread_count` threads.
 /// @throw RecoveryFailure
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                     Config::Items items);
+                     Config::Items items, uint64_t thread_count = 1);
 
 /// WalFile class used to append deltas and operations to the WAL file.
 class WalFile {
@@ -215,11 +288,19 @@ class WalFile {
 
   void AppendTransactionEnd(uint64_t timestamp);
 
-  void AppendOperation(StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
+  void AppendOperation(StorageGlobalOperation operation, LabelId label, const std::vector<PropertyId> &properties,
                        uint64_t timestamp);
+  void AppendOperation(StorageGlobalOperation operation, LabelId label,
+                       const std::vector<std::pair<PropertyId, PropertyValue::Type>> &schema, uint64_t timestamp);
+  void AppendOperation(StorageGlobalOperation operation, EdgeTypeId edge_type,
+                       const std::vector<PropertyId> &properties, uint64_t timestamp);
 
   void Sync();
 
+  // Write the internal buffer to the file and return a duplicate of its file
+  // descriptor which can be synced without holding the engine lock.
+  int FlushAndDuplicate();
+
   uint64_t GetSize();
 
   uint64_t SequenceNumber() const;
@@ -260,4 +341,51 @@ class WalFile {
   utils::FileRetainer *file_retainer_;
 };
 
+/// Group commit of WAL writes.
+///
+/// Committing transactions append their deltas to the WAL and register
+/// themselves, getting a log sequence number (LSN) in return. A single writer
+/// thread repeatedly makes everything registered so far durable with one sync
+/// and then releases all committers waiting for an LSN up to that point. While
+/// a sync is in progress new commits keep accumulating, so a single sync
+/// covers as many transactions as were committed during the previous one.
+class WalGroupCommit {
+ public:
+  /// `sync` is called from the writer thread and has to make all WAL data
+  /// appended before the call durable.
+  explicit WalGroupCommit(std::function<void()> sync);
+
+  WalGroupCommit(const WalGroupCommit &) = delete;
+  WalGroupCommit(WalGroupCommit &&) = delete;
+  WalGroupCommit &operator=(const WalGroupCommit &) = delete;
+  WalGroupCommit &operator=(WalGroupCommit &&) = delete;
+
+  /// Syncs the pending commits and stops the writer thread.
+  ~WalGroupCommit();
+
+  /// Registers a commit whose data was just appended to the WAL. Commits must
+  /// be registered in the order in which they were appended.
+  /// @return LSN which should be passed to `WaitDurable`
+  uint64_t Register();
+
+  /// Blocks until all commits up to (and including) `lsn` are durable.
+  void WaitDurable(uint64_t lsn);
+
+  /// Marks all registered commits as durable. Used when the WAL file was
+  /// synced by other means, e.g. when it was finalized.
+  void MarkAllDurable();
+
+ private:
+  void Run();
+
+  std::function<void()> sync_;
+  std::mutex mutex_;
+  std::condition_variable sync_requested_;
+  std::condition_variable durable_;
+  uint64_t registered_lsn_{0};
+  uint64_t durable_lsn_{0};
+  bool stop_{false};
+  std::thread thread_;
+};
+
 }  // namespace memgraph::storage::durability
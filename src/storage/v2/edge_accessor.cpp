@@ -13,6 +13,7 @@
 
 #include <memory>
 
+#include "storage/v2/indices.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/vertex_accessor.hpp"
@@ -81,6 +82,8 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
   CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property, current_value);
   edge_.ptr->properties.SetProperty(property, value);
 
+  UpdateOnEdgeSetProperty(indices_, property, value, from_vertex_, to_vertex_, edge_.ptr, edge_type_, *transaction_);
+
   return std::move(current_value);
 }
 
@@ -0,0 +1,563 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/edge_indices.hpp"
+
+#include <mutex>
+
+#include "storage/v2/mvcc.hpp"
+#include "utils/memory_tracker.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+/// Traverses deltas visible from transaction with start timestamp greater than
+/// the provided timestamp, and calls the provided callback function for each
+/// delta. If the callback ever returns true, traversal is stopped and the
+/// function returns true. Otherwise, the function returns false.
+template <typename TCallback>
+bool AnyVersionSatisfiesPredicate(uint64_t timestamp, const Delta *delta, const TCallback &predicate) {
+  while (delta != nullptr) {
+    auto ts = delta->timestamp->load(std::memory_order_acquire);
+    // This is a committed change that we see so we shouldn't undo it.
+    if (ts < timestamp) {
+      break;
+    }
+    if (predicate(*delta)) {
+      return true;
+    }
+    delta = delta->next.load(std::memory_order_acquire);
+  }
+  return false;
+}
+
+bool IsSameEdge(const Delta &delta, EdgeTypeId edge_type, Vertex *to_vertex, EdgeRef edge) {
+  return delta.vertex_edge.edge_type == edge_type && delta.vertex_edge.vertex == to_vertex &&
+         delta.vertex_edge.edge == edge;
+}
+
+/// Helper function for edge type index garbage collection when edges don't
+/// have properties. Returns true if there's a reachable version of the `from`
+/// vertex that has the edge among its outgoing edges.
+bool AnyVersionHasOutEdge(const Vertex &from_vertex, EdgeTypeId edge_type, Vertex *to_vertex, EdgeRef edge,
+                          uint64_t timestamp) {
+  bool deleted;
+  bool has_edge;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SpinLock> guard(from_vertex.lock);
+    deleted = from_vertex.deleted;
+    has_edge = from_vertex.out_edges.contains({edge_type, to_vertex, edge});
+    delta = from_vertex.delta;
+  }
+  if (!deleted && has_edge) {
+    return true;
+  }
+  return AnyVersionSatisfiesPredicate(timestamp, delta, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_OUT_EDGE:
+        if (IsSameEdge(delta, edge_type, to_vertex, edge)) has_edge = true;
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        if (IsSameEdge(delta, edge_type, to_vertex, edge)) has_edge = false;
+        break;
+      case Delta::Action::RECREATE_OBJECT:
+        deleted = false;
+        break;
+      case Delta::Action::DELETE_OBJECT:
+        deleted = true;
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+        break;
+    }
+    return !deleted && has_edge;
+  });
+}
+
+/// Helper function for edge index garbage collection when edges have
+/// properties. Returns true if there's a reachable version of the edge that
+/// isn't deleted and, if `key` is set, has the given property value.
+bool AnyVersionHasEdge(const Edge &edge, std::optional<PropertyId> key, const PropertyValue &value,
+                       uint64_t timestamp) {
+  bool deleted;
+  bool current_value_equal_to_value = true;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SpinLock> guard(edge.lock);
+    deleted = edge.deleted;
+    if (key) current_value_equal_to_value = edge.properties.IsPropertyEqual(*key, value);
+    delta = edge.delta;
+  }
+  if (!deleted && current_value_equal_to_value) {
+    return true;
+  }
+  return AnyVersionSatisfiesPredicate(timestamp, delta, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::SET_PROPERTY:
+        if (key && delta.property.key == *key) {
+          current_value_equal_to_value = delta.property.value == value;
+        }
+        break;
+      case Delta::Action::RECREATE_OBJECT:
+        deleted = false;
+        break;
+      case Delta::Action::DELETE_OBJECT:
+        deleted = true;
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+    return !deleted && current_value_equal_to_value;
+  });
+}
+
+// Helper function for iterating through the edge type index when edges don't
+// have properties. Returns true if this transaction can see the edge among
+// the outgoing edges of the `from` vertex. Finding the edge costs linear time
+// in the number of edges of the same type of the vertex.
+bool CurrentVersionHasOutEdge(const Vertex &from_vertex, EdgeTypeId edge_type, Vertex *to_vertex, EdgeRef edge,
+                              Transaction *transaction, View view) {
+  bool deleted;
+  bool has_edge;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SpinLock> guard(from_vertex.lock);
+    deleted = from_vertex.deleted;
+    has_edge = from_vertex.out_edges.contains({edge_type, to_vertex, edge});
+    delta = from_vertex.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_OUT_EDGE:
+        if (IsSameEdge(delta, edge_type, to_vertex, edge)) has_edge = true;
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        if (IsSameEdge(delta, edge_type, to_vertex, edge)) has_edge = false;
+        break;
+      case Delta::Action::DELETE_OBJECT:
+        deleted = true;
+        break;
+      case Delta::Action::RECREATE_OBJECT:
+        deleted = false;
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+        break;
+    }
+  });
+  return !deleted && has_edge;
+}
+
+// Helper function for iterating through the edge indices when edges have
+// properties. Returns true if this transaction can see the edge and, if `key`
+// is set, the visible version has the given property value.
+bool CurrentVersionHasEdge(const Edge &edge, std::optional<PropertyId> key, const PropertyValue &value,
+                           Transaction *transaction, View view) {
+  bool deleted;
+  bool exists = true;
+  bool current_value_equal_to_value = true;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SpinLock> guard(edge.lock);
+    deleted = edge.deleted;
+    if (key) current_value_equal_to_value = edge.properties.IsPropertyEqual(*key, value);
+    delta = edge.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::SET_PROPERTY:
+        if (key && delta.property.key == *key) {
+          current_value_equal_to_value = delta.property.value == value;
+        }
+        break;
+      case Delta::Action::DELETE_OBJECT:
+        exists = false;
+        break;
+      case Delta::Action::RECREATE_OBJECT:
+        deleted = false;
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+  });
+  return exists && !deleted && current_value_equal_to_value;
+}
+
+}  // namespace
+
+void EdgeTypeIndex::UpdateOnEdgeCreation(Vertex *from_vertex, Vertex *to_vertex, EdgeRef edge, EdgeTypeId edge_type,
+                                         const Transaction &tx) {
+  auto it = index_.find(edge_type);
+  if (it == index_.end()) return;
+  auto gid = config_.properties_on_edges ? edge.ptr->gid : edge.gid;
+  auto acc = it->second.access();
+  acc.insert(Entry{from_vertex, to_vertex, edge, gid, tx.start_timestamp});
+}
+
+bool EdgeTypeIndex::CreateIndex(EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(edge_type), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  try {
+    auto acc = it->second.access();
+    for (Vertex &from_vertex : vertices) {
+      if (from_vertex.deleted) {
+        continue;
+      }
+      const auto *edges = from_vertex.out_edges.edges(edge_type);
+      if (!edges) {
+        continue;
+      }
+      for (const auto &[to_vertex, edge] : *edges) {
+        auto gid = config_.properties_on_edges ? edge.ptr->gid : edge.gid;
+        acc.insert(Entry{&from_vertex, to_vertex, edge, gid, 0});
+      }
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+std::vector<EdgeTypeId> EdgeTypeIndex::ListIndices() const {
+  std::vector<EdgeTypeId> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void EdgeTypeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[edge_type, index] : index_) {
+    auto index_acc = index.access();
+    for (auto it = index_acc.begin(); it != index_acc.end();) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp >= oldest_active_start_timestamp) {
+        it = next_it;
+        continue;
+      }
+
+      bool has_edge = false;
+      if (config_.properties_on_edges) {
+        has_edge = AnyVersionHasEdge(*it->edge.ptr, std::nullopt, PropertyValue(), oldest_active_start_timestamp);
+      } else {
+        has_edge = AnyVersionHasOutEdge(*it->from_vertex, edge_type, it->to_vertex, it->edge,
+                                        oldest_active_start_timestamp);
+      }
+      if ((next_it != index_acc.end() && it->gid == next_it->gid) || !has_edge) {
+        index_acc.remove(*it);
+      }
+
+      it = next_it;
+    }
+  }
+}
+
+EdgeTypeIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_edge_accessor_(EdgeRef(nullptr), self_->edge_type_, nullptr, nullptr, nullptr, nullptr, nullptr,
+                             self_->config_) {
+  AdvanceUntilValid();
+}
+
+EdgeTypeIndex::Iterable::Iterator &EdgeTypeIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void EdgeTypeIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (current_edge_ == index_iterator_->gid) {
+      continue;
+    }
+    bool visible = false;
+    if (self_->config_.properties_on_edges) {
+      visible = CurrentVersionHasEdge(*index_iterator_->edge.ptr, std::nullopt, PropertyValue(), self_->transaction_,
+                                      self_->view_);
+    } else {
+      visible = CurrentVersionHasOutEdge(*index_iterator_->from_vertex, self_->edge_type_, index_iterator_->to_vertex,
+                                         index_iterator_->edge, self_->transaction_, self_->view_);
+    }
+    if (visible) {
+      current_edge_ = index_iterator_->gid;
+      current_edge_accessor_ = EdgeAccessor(index_iterator_->edge, self_->edge_type_, index_iterator_->from_vertex,
+                                            index_iterator_->to_vertex, self_->transaction_, self_->indices_,
+                                            self_->constraints_, self_->config_);
+      break;
+    }
+  }
+}
+
+EdgeTypeIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, View view,
+                                  Transaction *transaction, Indices *indices, Constraints *constraints,
+                                  Config::Items config)
+    : index_accessor_(std::move(index_accessor)),
+      edge_type_(edge_type),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {}
+
+void EdgeTypeIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+bool EdgeTypePropertyIndex::Entry::operator<(const Entry &rhs) {
+  if (value < rhs.value) {
+    return true;
+  }
+  if (rhs.value < value) {
+    return false;
+  }
+  return std::make_tuple(edge, timestamp) < std::make_tuple(rhs.edge, rhs.timestamp);
+}
+
+bool EdgeTypePropertyIndex::Entry::operator==(const Entry &rhs) {
+  return value == rhs.value && edge == rhs.edge && timestamp == rhs.timestamp;
+}
+
+bool EdgeTypePropertyIndex::Entry::operator<(const PropertyValue &rhs) { return value < rhs; }
+
+bool EdgeTypePropertyIndex::Entry::operator==(const PropertyValue &rhs) { return value == rhs; }
+
+void EdgeTypePropertyIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *from_vertex,
+                                                Vertex *to_vertex, Edge *edge, EdgeTypeId edge_type,
+                                                const Transaction &tx) {
+  if (value.IsNull()) {
+    return;
+  }
+  auto it = index_.find({edge_type, property});
+  if (it == index_.end()) return;
+  auto acc = it->second.access();
+  acc.insert(Entry{value, from_vertex, to_vertex, edge, tx.start_timestamp});
+}
+
+bool EdgeTypePropertyIndex::CreateIndex(EdgeTypeId edge_type, PropertyId property,
+                                        utils::SkipList<Vertex>::Accessor vertices) {
+  if (!config_.properties_on_edges) {
+    return false;
+  }
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(edge_type, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  try {
+    auto acc = it->second.access();
+    for (Vertex &from_vertex : vertices) {
+      if (from_vertex.deleted) {
+        continue;
+      }
+      const auto *edges = from_vertex.out_edges.edges(edge_type);
+      if (!edges) {
+        continue;
+      }
+      for (const auto &[to_vertex, edge] : *edges) {
+        auto value = edge.ptr->properties.GetProperty(property);
+        if (value.IsNull()) {
+          continue;
+        }
+        acc.insert(Entry{std::move(value), &from_vertex, to_vertex, edge.ptr, 0});
+      }
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+std::vector<std::pair<EdgeTypeId, PropertyId>> EdgeTypePropertyIndex::ListIndices() const {
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void EdgeTypePropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[edge_type_property, index] : index_) {
+    auto index_acc = index.access();
+    for (auto it = index_acc.begin(); it != index_acc.end();) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp >= oldest_active_start_timestamp) {
+        it = next_it;
+        continue;
+      }
+
+      if ((next_it != index_acc.end() && it->edge == next_it->edge && it->value == next_it->value) ||
+          !AnyVersionHasEdge(*it->edge, edge_type_property.second, it->value, oldest_active_start_timestamp)) {
+        index_acc.remove(*it);
+      }
+      it = next_it;
+    }
+  }
+}
+
+EdgeTypePropertyIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_edge_accessor_(EdgeRef(nullptr), self_->edge_type_, nullptr, nullptr, nullptr, nullptr, nullptr,
+                             self_->config_),
+      current_edge_(nullptr) {
+  AdvanceUntilValid();
+}
+
+EdgeTypePropertyIndex::Iterable::Iterator &EdgeTypePropertyIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void EdgeTypePropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->edge == current_edge_) {
+      continue;
+    }
+
+    const auto &value = index_iterator_->value;
+    if (self_->upper_bound_ && PropertyValue::AreComparableTypes(value.type(), self_->upper_bound_->value().type()) &&
+        (self_->upper_bound_->value() < value ||
+         (!self_->upper_bound_->IsInclusive() && value == self_->upper_bound_->value()))) {
+      // All following entries have greater values.
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+    if (self_->lower_bound_ && !PropertyValue::AreComparableTypes(value.type(), self_->lower_bound_->value().type())) {
+      // The iteration started at the lower bound and values are ordered by
+      // type first, so all following entries have incomparable types.
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+    if (!self_->IsInBounds(value)) {
+      continue;
+    }
+
+    if (CurrentVersionHasEdge(*index_iterator_->edge, self_->property_, value, self_->transaction_, self_->view_)) {
+      current_edge_ = index_iterator_->edge;
+      current_edge_accessor_ = EdgeAccessor(EdgeRef(current_edge_), self_->edge_type_, index_iterator_->from_vertex,
+                                            index_iterator_->to_vertex, self_->transaction_, self_->indices_,
+                                            self_->constraints_, self_->config_);
+      break;
+    }
+  }
+}
+
+EdgeTypePropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type,
+                                          PropertyId property,
+                                          const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                          const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                          Transaction *transaction, Indices *indices, Constraints *constraints,
+                                          Config::Items config)
+    : index_accessor_(std::move(index_accessor)),
+      edge_type_(edge_type),
+      property_(property),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  // Remove any bounds that are set to `Null` because that isn't a valid value.
+  if (lower_bound_ && lower_bound_->value().IsNull()) {
+    lower_bound_ = std::nullopt;
+  }
+  if (upper_bound_ && upper_bound_->value().IsNull()) {
+    upper_bound_ = std::nullopt;
+  }
+
+  // Check whether the bounds are of comparable types if both are supplied.
+  if (lower_bound_ && upper_bound_ &&
+      !PropertyValue::AreComparableTypes(lower_bound_->value().type(), upper_bound_->value().type())) {
+    bounds_valid_ = false;
+  }
+}
+
+bool EdgeTypePropertyIndex::Iterable::IsInBounds(const PropertyValue &value) const {
+  if (lower_bound_) {
+    if (!PropertyValue::AreComparableTypes(value.type(), lower_bound_->value().type())) return false;
+    if (value < lower_bound_->value()) return false;
+    if (!lower_bound_->IsInclusive() && value == lower_bound_->value()) return false;
+  }
+  if (upper_bound_) {
+    if (!PropertyValue::AreComparableTypes(value.type(), upper_bound_->value().type())) return false;
+    if (upper_bound_->value() < value) return false;
+    if (!upper_bound_->IsInclusive() && value == upper_bound_->value()) return false;
+  }
+  return true;
+}
+
+EdgeTypePropertyIndex::Iterable::Iterator EdgeTypePropertyIndex::Iterable::begin() {
+  if (!bounds_valid_) return Iterator(this, index_accessor_.end());
+  if (lower_bound_) return Iterator(this, index_accessor_.find_equal_or_greater(lower_bound_->value()));
+  return Iterator(this, index_accessor_.begin());
+}
+
+EdgeTypePropertyIndex::Iterable::Iterator EdgeTypePropertyIndex::Iterable::end() {
+  return Iterator(this, index_accessor_.end());
+}
+
+int64_t EdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                                    const PropertyValue &value) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  if (value.IsNull()) return acc.size();
+  return acc.estimate_count(value, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void EdgeTypePropertyIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,264 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/edge.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/bound.hpp"
+#include "utils/logging.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+struct Indices;
+struct Constraints;
+
+/// Index of all edges with a given edge type.
+///
+/// Without the index, finding edges of a type requires scanning all vertices
+/// and their adjacency lists. Entries are ordered by the edge gid and, like
+/// in the vertex indices, an entry only means that some version of the edge
+/// might belong to the index, so visibility is checked while iterating.
+class EdgeTypeIndex {
+ private:
+  struct Entry {
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    EdgeRef edge;
+    Gid gid;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) {
+      return std::make_tuple(gid, timestamp) < std::make_tuple(rhs.gid, rhs.timestamp);
+    }
+    bool operator==(const Entry &rhs) { return gid == rhs.gid && timestamp == rhs.timestamp; }
+  };
+
+ public:
+  EdgeTypeIndex(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnEdgeCreation(Vertex *from_vertex, Vertex *to_vertex, EdgeRef edge, EdgeTypeId edge_type,
+                            const Transaction &tx);
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices);
+
+  /// Returns false if there was no index to drop
+  bool DropIndex(EdgeTypeId edge_type) { return index_.erase(edge_type) > 0; }
+
+  bool IndexExists(EdgeTypeId edge_type) const { return index_.find(edge_type) != index_.end(); }
+
+  std::vector<EdgeTypeId> ListIndices() const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, View view,
+             Transaction *transaction, Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      EdgeAccessor operator*() const { return current_edge_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      EdgeAccessor current_edge_accessor_;
+      std::optional<Gid> current_edge_;
+    };
+
+    Iterator begin() { return Iterator(this, index_accessor_.begin()); }
+    Iterator end() { return Iterator(this, index_accessor_.end()); }
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    EdgeTypeId edge_type_;
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  /// Returns an iterable with edges visible from the given transaction.
+  Iterable Edges(EdgeTypeId edge_type, View view, Transaction *transaction) {
+    auto it = index_.find(edge_type);
+    MG_ASSERT(it != index_.end(), "Index for edge type {} doesn't exist", edge_type.AsUint());
+    return Iterable(it->second.access(), edge_type, view, transaction, indices_, constraints_, config_);
+  }
+
+  int64_t ApproximateEdgeCount(EdgeTypeId edge_type) const {
+    auto it = index_.find(edge_type);
+    MG_ASSERT(it != index_.end(), "Index for edge type {} doesn't exist", edge_type.AsUint());
+    return it->second.size();
+  }
+
+  void Clear() { index_.clear(); }
+
+  void RunGC();
+
+ private:
+  std::map<EdgeTypeId, utils::SkipList<Entry>> index_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
+/// Index of edges with a given edge type by the value of a given property.
+///
+/// Edges only have properties when `properties_on_edges` is enabled, so the
+/// index can't be created otherwise. Edges without the property aren't
+/// indexed.
+class EdgeTypePropertyIndex {
+ private:
+  struct Entry {
+    PropertyValue value;
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    Edge *edge;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs);
+    bool operator==(const Entry &rhs);
+
+    bool operator<(const PropertyValue &rhs);
+    bool operator==(const PropertyValue &rhs);
+  };
+
+ public:
+  EdgeTypePropertyIndex(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// Must be called while holding the edge lock.
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *from_vertex, Vertex *to_vertex,
+                           Edge *edge, EdgeTypeId edge_type, const Transaction &tx);
+
+  /// @return false if the index already exists or edges don't have properties
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  bool DropIndex(EdgeTypeId edge_type, PropertyId property) { return index_.erase({edge_type, property}) > 0; }
+
+  bool IndexExists(EdgeTypeId edge_type, PropertyId property) const {
+    return index_.find({edge_type, property}) != index_.end();
+  }
+
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ListIndices() const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, PropertyId property,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+             Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      EdgeAccessor operator*() const { return current_edge_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      EdgeAccessor current_edge_accessor_;
+      Edge *current_edge_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    bool IsInBounds(const PropertyValue &value) const;
+
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    EdgeTypeId edge_type_;
+    PropertyId property_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  /// Iterates over edges whose value of the property lies within the bounds.
+  /// `Null` bounds are ignored and only values comparable to the bounds are
+  /// returned.
+  Iterable Edges(EdgeTypeId edge_type, PropertyId property,
+                 const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                 const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction) {
+    auto it = index_.find({edge_type, property});
+    MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+              property.AsUint());
+    return Iterable(it->second.access(), edge_type, property, lower_bound, upper_bound, view, transaction, indices_,
+                    constraints_, config_);
+  }
+
+  int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const {
+    auto it = index_.find({edge_type, property});
+    MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+              property.AsUint());
+    return it->second.size();
+  }
+
+  /// Estimates the number of edges whose property is equal to `value`.
+  int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value) const;
+
+  void Clear() { index_.clear(); }
+
+  void RunGC();
+
+ private:
+  std::map<std::pair<EdgeTypeId, PropertyId>, utils::SkipList<Entry>> index_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
+}  // namespace memgraph::storage
@@ -0,0 +1,83 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/graph_statistics.hpp"
+
+#include <algorithm>
+
+namespace memgraph::storage {
+
+double PropertyStatistics::EqualSelectivity() const {
+  if (distinct_values == 0) return 0.0;
+  return 1.0 / static_cast<double>(distinct_values);
+}
+
+double PropertyStatistics::RangeSelectivity(const std::optional<utils::Bound<PropertyValue>> &lower,
+                                            const std::optional<utils::Bound<PropertyValue>> &upper) const {
+  if (histogram.empty()) return 0.0;
+
+  auto in_bounds = [&](const PropertyValue &value) {
+    if (lower) {
+      if (!PropertyValue::AreComparableTypes(value.type(), lower->value().type())) return false;
+      if (value < lower->value() || (lower->IsExclusive() && value == lower->value())) return false;
+    }
+    if (upper) {
+      if (!PropertyValue::AreComparableTypes(value.type(), upper->value().type())) return false;
+      if (upper->value() < value || (upper->IsExclusive() && value == upper->value())) return false;
+    }
+    return true;
+  };
+
+  // Every bucket whose upper bound lies within the range is counted as fully
+  // within the range. A range that falls between two bounds is counted as half
+  // of a bucket.
+  auto buckets = std::count_if(histogram.begin(), histogram.end(), in_bounds);
+  return std::max(static_cast<double>(buckets), 0.5) / static_cast<double>(histogram.size());
+}
+
+PropertyStatistics GraphStatistics::MakePropertyStatistics(std::vector<PropertyValue> sample, uint64_t count) {
+  PropertyStatistics statistics;
+  statistics.count = count;
+  if (sample.empty()) return statistics;
+
+  std::sort(sample.begin(), sample.end());
+  // Number of distinct values in the sample and the number of values that
+  // appear in the sample exactly once.
+  uint64_t distinct = 0;
+  uint64_t singletons = 0;
+  for (size_t i = 0; i < sample.size();) {
+    auto j = i + 1;
+    while (j < sample.size() && sample[i] == sample[j]) ++j;
+    ++distinct;
+    if (j - i == 1) ++singletons;
+    i = j;
+  }
+  if (sample.size() >= count) {
+    statistics.distinct_values = distinct;
+  } else {
+    // Haas-Stokes estimator of the number of distinct values: values that
+    // appear only once in the sample are likely to be rare in the whole
+    // population, so they are scaled up more than the others.
+    const auto n = static_cast<double>(sample.size());
+    const auto estimate = n * static_cast<double>(distinct) /
+                          (n - static_cast<double>(singletons) + static_cast<double>(singletons) * n / count);
+    statistics.distinct_values = std::clamp<uint64_t>(static_cast<uint64_t>(estimate), distinct, count);
+  }
+
+  auto buckets = std::min<uint64_t>(kHistogramBuckets, sample.size());
+  statistics.histogram.reserve(buckets);
+  for (uint64_t i = 1; i <= buckets; ++i) {
+    statistics.histogram.push_back(sample[i * sample.size() / buckets - 1]);
+  }
+  return statistics;
+}
+
+}  // namespace memgraph::storage
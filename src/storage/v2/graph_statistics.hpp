@@ -0,0 +1,80 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/bound.hpp"
+
+namespace memgraph::storage {
+
+/// Statistics of the values of a single property of the vertices with a given
+/// label.
+struct PropertyStatistics {
+  /// Number of vertices with the label that have the property.
+  uint64_t count{0};
+  /// Number of distinct values of the property.
+  uint64_t distinct_values{0};
+  /// Upper bounds of the buckets of an equi-depth histogram over the values of
+  /// the property, in ascending order. All buckets hold approximately the same
+  /// number of values.
+  std::vector<PropertyValue> histogram;
+
+  /// Estimated fraction of the vertices with the property that have the given
+  /// value, assuming that the values are uniformly distributed.
+  double EqualSelectivity() const;
+
+  /// Estimated fraction of the vertices with the property whose value lies
+  /// within the bounds. The bounds follow the same rules as the bounds of
+  /// `LabelPropertyIndex::Vertices`.
+  double RangeSelectivity(const std::optional<utils::Bound<PropertyValue>> &lower,
+                          const std::optional<utils::Bound<PropertyValue>> &upper) const;
+};
+
+/// Statistics of the edges of a single edge type.
+struct EdgeTypeStatistics {
+  uint64_t count{0};
+  /// Number of distinct vertices with at least one outgoing edge of the type.
+  uint64_t from_vertices{0};
+  /// Number of distinct vertices with at least one incoming edge of the type.
+  uint64_t to_vertices{0};
+};
+
+/// Statistics of the graph collected by `Storage::AnalyzeGraph`. The
+/// statistics describe the graph at the time it was analyzed and aren't
+/// updated as the graph changes.
+struct GraphStatistics {
+  static constexpr uint64_t kHistogramBuckets = 64;
+  /// Maximum number of values of a single property that are sampled when the
+  /// graph is analyzed.
+  static constexpr uint64_t kPropertySampleSize = 10000;
+
+  uint64_t vertex_count{0};
+  uint64_t edge_count{0};
+  std::map<LabelId, uint64_t> label_counts;
+  std::map<std::pair<LabelId, PropertyId>, PropertyStatistics> label_properties;
+  std::map<EdgeTypeId, EdgeTypeStatistics> edge_types;
+
+  /// Computes the statistics of a single property from a uniform sample of
+  /// its values. `count` is the number of all values the sample was taken
+  /// from. The number of distinct values is estimated from the sample when it
+  /// doesn't contain all values.
+  static PropertyStatistics MakePropertyStatistics(std::vector<PropertyValue> sample, uint64_t count);
+};
+
+}  // namespace memgraph::storage
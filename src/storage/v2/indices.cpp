@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include "indices.hpp"
+#include <algorithm>
 #include <limits>
 
 #include "storage/v2/mvcc.hpp"
@@ -261,6 +262,161 @@ bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label, Propert
   return !deleted && has_label && current_value_equal_to_value;
 }
 
+/// Reads the values of the given properties of the vertex. Returns an empty
+/// vector if any of the properties isn't set. Must be called while holding
+/// the vertex lock.
+std::vector<PropertyValue> GetPropertyValues(const Vertex &vertex, const std::vector<PropertyId> &properties) {
+  std::vector<PropertyValue> values;
+  values.reserve(properties.size());
+  for (auto property : properties) {
+    auto value = vertex.properties.GetProperty(property);
+    if (value.IsNull()) return {};
+    values.push_back(std::move(value));
+  }
+  return values;
+}
+
+/// Tracks whether the values of a list of properties are equal to the given
+/// values while the deltas of a vertex are being applied.
+class PropertiesEqualityTracker {
+ public:
+  PropertiesEqualityTracker(const std::vector<PropertyId> &keys, const std::vector<PropertyValue> &values)
+      : keys_(&keys), values_(&values), equal_(keys.size(), false) {}
+
+  /// Must be called while holding the vertex lock.
+  void Init(const Vertex &vertex) {
+    for (size_t i = 0; i < keys_->size(); ++i) {
+      equal_[i] = vertex.properties.IsPropertyEqual((*keys_)[i], (*values_)[i]);
+    }
+  }
+
+  void Update(PropertyId key, const PropertyValue &value) {
+    auto it = std::find(keys_->begin(), keys_->end(), key);
+    if (it == keys_->end()) return;
+    auto i = it - keys_->begin();
+    equal_[i] = value == (*values_)[i];
+  }
+
+  bool AllEqual() const { return std::all_of(equal_.begin(), equal_.end(), [](bool equal) { return equal; }); }
+
+ private:
+  const std::vector<PropertyId> *keys_;
+  const std::vector<PropertyValue> *values_;
+  std::vector<bool> equal_;
+};
+
+/// Helper function for composite index garbage collection. Returns true if
+/// there's a reachable version of the vertex that has the given label and
+/// property values.
+bool AnyVersionHasLabelProperties(const Vertex &vertex, LabelId label, const std::vector<PropertyId> &keys,
+                                  const std::vector<PropertyValue> &values, uint64_t timestamp) {
+  bool has_label;
+  bool deleted;
+  PropertiesEqualityTracker tracker(keys, values);
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SpinLock> guard(vertex.lock);
+    has_label = utils::Contains(vertex.labels, label);
+    tracker.Init(vertex);
+    deleted = vertex.deleted;
+    delta = vertex.delta;
+  }
+
+  if (!deleted && has_label && tracker.AllEqual()) {
+    return true;
+  }
+
+  return AnyVersionSatisfiesPredicate(timestamp, delta, [&has_label, &tracker, &deleted, label](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+        if (delta.label == label) {
+          MG_ASSERT(!has_label, "Invalid database state!");
+          has_label = true;
+        }
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta.label == label) {
+          MG_ASSERT(has_label, "Invalid database state!");
+          has_label = false;
+        }
+        break;
+      case Delta::Action::SET_PROPERTY:
+        tracker.Update(delta.property.key, delta.property.value);
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        MG_ASSERT(deleted, "Invalid database state!");
+        deleted = false;
+        break;
+      }
+      case Delta::Action::DELETE_OBJECT: {
+        MG_ASSERT(!deleted, "Invalid database state!");
+        deleted = true;
+        break;
+      }
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+    return !deleted && has_label && tracker.AllEqual();
+  });
+}
+
+// Helper function for iterating through composite index. Returns true if this
+// transaction can see the given vertex, and the visible version has the given
+// label and property values.
+bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, const std::vector<PropertyId> &keys,
+                                      const std::vector<PropertyValue> &values, Transaction *transaction, View view) {
+  bool deleted;
+  bool has_label;
+  PropertiesEqualityTracker tracker(keys, values);
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SpinLock> guard(vertex.lock);
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    tracker.Init(vertex);
+    delta = vertex.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view, [&deleted, &has_label, &tracker, label](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::SET_PROPERTY: {
+        tracker.Update(delta.property.key, delta.property.value);
+        break;
+      }
+      case Delta::Action::DELETE_OBJECT: {
+        MG_ASSERT(!deleted, "Invalid database state!");
+        deleted = true;
+        break;
+      }
+      case Delta::Action::RECREATE_OBJECT: {
+        MG_ASSERT(deleted, "Invalid database state!");
+        deleted = false;
+        break;
+      }
+      case Delta::Action::ADD_LABEL:
+        if (delta.label == label) {
+          MG_ASSERT(!has_label, "Invalid database state!");
+          has_label = true;
+        }
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta.label == label) {
+          MG_ASSERT(has_label, "Invalid database state!");
+          has_label = false;
+        }
+        break;
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+  });
+  return !deleted && has_label && tracker.AllEqual();
+}
+
 }  // namespace
 
 void LabelIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
@@ -293,6 +449,22 @@ bool LabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor ve
   return true;
 }
 
+void LabelIndex::AddBulkLoadedVertices(const std::vector<Vertex *> &vertices) {
+  for (auto &[label, storage] : index_) {
+    std::vector<Entry> entries;
+    for (auto *vertex : vertices) {
+      if (utils::Contains(vertex->labels, label)) {
+        entries.push_back(Entry{vertex, 0});
+      }
+    }
+    std::sort(entries.begin(), entries.end(), [](auto &lhs, auto &rhs) { return lhs < rhs; });
+    auto acc = storage.access();
+    for (auto &entry : entries) {
+      acc.insert(entry);
+    }
+  }
+}
+
 std::vector<LabelId> LabelIndex::ListIndices() const {
   std::vector<LabelId> ret;
   ret.reserve(index_.size());
@@ -444,6 +616,27 @@ bool LabelPropertyIndex::CreateIndex(LabelId label, PropertyId property, utils::
   return true;
 }
 
+void LabelPropertyIndex::AddBulkLoadedVertices(const std::vector<Vertex *> &vertices) {
+  for (auto &[label_prop, storage] : index_) {
+    std::vector<Entry> entries;
+    for (auto *vertex : vertices) {
+      if (!utils::Contains(vertex->labels, label_prop.first)) {
+        continue;
+      }
+      auto value = vertex->properties.GetProperty(label_prop.second);
+      if (value.IsNull()) {
+        continue;
+      }
+      entries.push_back(Entry{std::move(value), vertex, 0});
+    }
+    std::sort(entries.begin(), entries.end(), [](auto &lhs, auto &rhs) { return lhs < rhs; });
+    auto acc = storage.access();
+    for (auto &entry : entries) {
+      acc.insert(std::move(entry));
+    }
+  }
+}
+
 std::vector<std::pair<LabelId, PropertyId>> LabelPropertyIndex::ListIndices() const {
   std::vector<std::pair<LabelId, PropertyId>> ret;
   ret.reserve(index_.size());
@@ -694,19 +887,551 @@ void LabelPropertyIndex::RunGC() {
   }
 }
 
+bool LabelPropertyCompositeIndex::Entry::operator<(const Entry &rhs) {
+  if (values < rhs.values) {
+    return true;
+  }
+  if (rhs.values < values) {
+    return false;
+  }
+  return std::make_tuple(vertex, timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+}
+
+bool LabelPropertyCompositeIndex::Entry::operator==(const Entry &rhs) {
+  return values == rhs.values && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool LabelPropertyCompositeIndex::Entry::operator<(const std::vector<PropertyValue> &rhs) {
+  DMG_ASSERT(rhs.size() <= values.size(), "Invalid composite index lookup!");
+  return std::lexicographical_compare(values.begin(), values.begin() + rhs.size(), rhs.begin(), rhs.end());
+}
+
+bool LabelPropertyCompositeIndex::Entry::operator==(const std::vector<PropertyValue> &rhs) {
+  DMG_ASSERT(rhs.size() <= values.size(), "Invalid composite index lookup!");
+  return std::equal(rhs.begin(), rhs.end(), values.begin());
+}
+
+void LabelPropertyCompositeIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
+  for (auto &[label_props, storage] : index_) {
+    if (label_props.first != label) {
+      continue;
+    }
+    auto values = GetPropertyValues(*vertex, label_props.second);
+    if (!values.empty()) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(values), vertex, tx.start_timestamp});
+    }
+  }
+}
+
+void LabelPropertyCompositeIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                                      const Transaction &tx) {
+  if (value.IsNull()) {
+    return;
+  }
+  for (auto &[label_props, storage] : index_) {
+    if (!utils::Contains(label_props.second, property) || !utils::Contains(vertex->labels, label_props.first)) {
+      continue;
+    }
+    auto values = GetPropertyValues(*vertex, label_props.second);
+    if (!values.empty()) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(values), vertex, tx.start_timestamp});
+    }
+  }
+}
+
+bool LabelPropertyCompositeIndex::CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                                              utils::SkipList<Vertex>::Accessor vertices) {
+  if (properties.size() < 2) return false;
+  for (auto it = properties.begin(); it != properties.end(); ++it) {
+    if (std::find(properties.begin(), it, *it) != it) return false;
+  }
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, properties), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  try {
+    auto acc = it->second.access();
+    for (Vertex &vertex : vertices) {
+      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
+        continue;
+      }
+      auto values = GetPropertyValues(vertex, properties);
+      if (values.empty()) {
+        continue;
+      }
+      acc.insert(Entry{std::move(values), &vertex, 0});
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+std::vector<std::pair<LabelId, std::vector<PropertyId>>> LabelPropertyCompositeIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void LabelPropertyCompositeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[label_props, index] : index_) {
+    auto index_acc = index.access();
+    for (auto it = index_acc.begin(); it != index_acc.end();) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp >= oldest_active_start_timestamp) {
+        it = next_it;
+        continue;
+      }
+
+      if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->values == next_it->values) ||
+          !AnyVersionHasLabelProperties(*it->vertex, label_props.first, label_props.second, it->values,
+                                        oldest_active_start_timestamp)) {
+        index_acc.remove(*it);
+      }
+      it = next_it;
+    }
+  }
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                          utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator &LabelPropertyCompositeIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void LabelPropertyCompositeIndex::Iterable::Iterator::AdvanceUntilValid() {
+  const auto prefix_size = self_->prefix_.size();
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    // Entries are sorted by the prefix first, so we are done as soon as the
+    // prefix doesn't match.
+    if (!(*index_iterator_ == self_->prefix_)) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
+    if (prefix_size < index_iterator_->values.size()) {
+      const auto &value = index_iterator_->values[prefix_size];
+      if (self_->upper_bound_ && PropertyValue::AreComparableTypes(value.type(), self_->upper_bound_->value().type()) &&
+          (self_->upper_bound_->value() < value ||
+           (!self_->upper_bound_->IsInclusive() && value == self_->upper_bound_->value()))) {
+        // All following entries with the same prefix have greater values.
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (!self_->IsInBounds(value)) {
+        continue;
+      }
+    }
+
+    if (CurrentVersionHasLabelProperties(*index_iterator_->vertex, self_->label_, *self_->properties_,
+                                         index_iterator_->values, self_->transaction_, self_->view_)) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ =
+          VertexAccessor(current_vertex_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_);
+      break;
+    }
+  }
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label,
+                                                const std::vector<PropertyId> *properties,
+                                                std::vector<PropertyValue> prefix,
+                                                const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                View view, Transaction *transaction, Indices *indices,
+                                                Constraints *constraints, Config::Items config)
+    : index_accessor_(std::move(index_accessor)),
+      label_(label),
+      properties_(properties),
+      prefix_(std::move(prefix)),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  // Indexed vertices have all of the properties set, so a `Null` in the
+  // prefix can't match anything.
+  if (std::any_of(prefix_.begin(), prefix_.end(), [](const auto &value) { return value.IsNull(); })) {
+    bounds_valid_ = false;
+    return;
+  }
+
+  // Remove any bounds that are set to `Null` because that isn't a valid value.
+  if (lower_bound_ && lower_bound_->value().IsNull()) {
+    lower_bound_ = std::nullopt;
+  }
+  if (upper_bound_ && upper_bound_->value().IsNull()) {
+    upper_bound_ = std::nullopt;
+  }
+
+  // Check whether the bounds are of comparable types if both are supplied.
+  if (lower_bound_ && upper_bound_ &&
+      !PropertyValue::AreComparableTypes(lower_bound_->value().type(), upper_bound_->value().type())) {
+    bounds_valid_ = false;
+  }
+}
+
+bool LabelPropertyCompositeIndex::Iterable::IsInBounds(const PropertyValue &value) const {
+  if (lower_bound_) {
+    if (!PropertyValue::AreComparableTypes(value.type(), lower_bound_->value().type())) return false;
+    if (value < lower_bound_->value()) return false;
+    if (!lower_bound_->IsInclusive() && value == lower_bound_->value()) return false;
+  }
+  if (upper_bound_) {
+    if (!PropertyValue::AreComparableTypes(value.type(), upper_bound_->value().type())) return false;
+    if (upper_bound_->value() < value) return false;
+    if (!upper_bound_->IsInclusive() && value == upper_bound_->value()) return false;
+  }
+  return true;
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator LabelPropertyCompositeIndex::Iterable::begin() {
+  if (!bounds_valid_) return Iterator(this, index_accessor_.end());
+  if (lower_bound_) {
+    auto key = prefix_;
+    key.push_back(lower_bound_->value());
+    return Iterator(this, index_accessor_.find_equal_or_greater(key));
+  }
+  return Iterator(this, index_accessor_.find_equal_or_greater(prefix_));
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator LabelPropertyCompositeIndex::Iterable::end() {
+  return Iterator(this, index_accessor_.end());
+}
+
+int64_t LabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                                            const std::vector<PropertyValue> &prefix) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  auto acc = it->second.access();
+  if (prefix.empty()) return acc.size();
+  return acc.estimate_count(prefix, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void LabelPropertyCompositeIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+void LabelPropertyHashIndex::Table::Insert(const PropertyValue &value, Vertex *vertex, uint64_t timestamp) {
+  auto &stripe = GetStripe(value);
+  std::lock_guard<utils::SpinLock> guard(stripe.lock);
+  auto [it, emplaced] = stripe.entries.try_emplace(value);
+  if (emplaced) {
+    values.fetch_add(1, std::memory_order_acq_rel);
+  }
+  it->second.push_back(Entry{vertex, timestamp});
+  size.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void LabelPropertyHashIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
+  for (auto &[label_prop, table] : index_) {
+    if (label_prop.first != label) {
+      continue;
+    }
+    auto prop_value = vertex->properties.GetProperty(label_prop.second);
+    if (!prop_value.IsNull()) {
+      table.Insert(prop_value, vertex, tx.start_timestamp);
+    }
+  }
+}
+
+void LabelPropertyHashIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                                 const Transaction &tx) {
+  if (value.IsNull()) {
+    return;
+  }
+  for (auto &[label_prop, table] : index_) {
+    if (label_prop.second != property) {
+      continue;
+    }
+    if (utils::Contains(vertex->labels, label_prop.first)) {
+      table.Insert(value, vertex, tx.start_timestamp);
+    }
+  }
+}
+
+bool LabelPropertyHashIndex::CreateIndex(LabelId label, PropertyId property,
+                                         utils::SkipList<Vertex>::Accessor vertices) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  try {
+    for (Vertex &vertex : vertices) {
+      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
+        continue;
+      }
+      auto value = vertex.properties.GetProperty(property);
+      if (value.IsNull()) {
+        continue;
+      }
+      it->second.Insert(value, &vertex, 0);
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+std::vector<std::pair<LabelId, PropertyId>> LabelPropertyHashIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void LabelPropertyHashIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[label_property, table] : index_) {
+    for (auto &stripe : table.stripes) {
+      // Checking whether an entry is obsolete locks the vertex, which mustn't
+      // be done while holding the stripe lock because updates of the index
+      // lock the vertex first. The values and entry vectors stay at the same
+      // address in between because they are removed only here.
+      std::vector<std::pair<const PropertyValue *, Vertex *>> candidates;
+      {
+        std::lock_guard<utils::SpinLock> guard(stripe.lock);
+        for (auto it = stripe.entries.begin(); it != stripe.entries.end();) {
+          auto &entries = it->second;
+          std::sort(entries.begin(), entries.end(), [](const Entry &lhs, const Entry &rhs) {
+            return std::make_tuple(lhs.vertex, lhs.timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+          });
+          size_t kept = 0;
+          for (size_t i = 0; i < entries.size(); ++i) {
+            const auto entry = entries[i];
+            if (entry.timestamp < oldest_active_start_timestamp) {
+              // An old entry is redundant if there is a newer one for the same
+              // vertex.
+              if (i + 1 < entries.size() && entries[i + 1].vertex == entry.vertex) {
+                continue;
+              }
+              candidates.emplace_back(&it->first, entry.vertex);
+            }
+            entries[kept++] = entry;
+          }
+          table.size.fetch_sub(entries.size() - kept, std::memory_order_acq_rel);
+          entries.resize(kept);
+          if (entries.empty()) {
+            it = stripe.entries.erase(it);
+            table.values.fetch_sub(1, std::memory_order_acq_rel);
+          } else {
+            ++it;
+          }
+        }
+      }
+
+      // Candidates are grouped by value and sorted by vertex within a group.
+      std::vector<std::pair<const PropertyValue *, Vertex *>> obsolete;
+      for (const auto &[value, vertex] : candidates) {
+        if (!AnyVersionHasLabelProperty(*vertex, label_property.first, label_property.second, *value,
+                                        oldest_active_start_timestamp)) {
+          obsolete.emplace_back(value, vertex);
+        }
+      }
+      if (obsolete.empty()) continue;
+
+      std::lock_guard<utils::SpinLock> guard(stripe.lock);
+      for (auto group_begin = obsolete.begin(); group_begin != obsolete.end();) {
+        const auto *value = group_begin->first;
+        auto group_end = std::find_if(group_begin, obsolete.end(),
+                                      [value](const auto &item) { return item.first != value; });
+        auto it = stripe.entries.find(*value);
+        MG_ASSERT(it != stripe.entries.end(), "Invalid hash index state!");
+        auto &entries = it->second;
+        // Entries added in the meantime have newer timestamps and are kept.
+        auto removed = std::erase_if(entries, [&](const Entry &entry) {
+          return entry.timestamp < oldest_active_start_timestamp &&
+                 std::binary_search(group_begin, group_end, std::make_pair(value, entry.vertex));
+        });
+        table.size.fetch_sub(removed, std::memory_order_acq_rel);
+        if (entries.empty()) {
+          stripe.entries.erase(it);
+          table.values.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        group_begin = group_end;
+      }
+    }
+  }
+}
+
+LabelPropertyHashIndex::Iterable LabelPropertyHashIndex::Vertices(LabelId label, PropertyId property,
+                                                                  const PropertyValue &value, View view,
+                                                                  Transaction *transaction) {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Hash index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  std::vector<Vertex *> vertices;
+  if (!value.IsNull()) {
+    const auto &stripe = it->second.GetStripe(value);
+    std::lock_guard<utils::SpinLock> guard(stripe.lock);
+    if (auto entries = stripe.entries.find(value); entries != stripe.entries.end()) {
+      vertices.reserve(entries->second.size());
+      for (const auto &entry : entries->second) {
+        vertices.push_back(entry.vertex);
+      }
+    }
+  }
+  // The visibility checks are done outside of the lock, so each vertex has to
+  // be checked only once.
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+  return Iterable(std::move(vertices), label, property, value, view, transaction, indices_, constraints_, config_);
+}
+
+LabelPropertyHashIndex::Iterable::Iterable(std::vector<Vertex *> vertices, LabelId label, PropertyId property,
+                                           const PropertyValue &value, View view, Transaction *transaction,
+                                           Indices *indices, Constraints *constraints, Config::Items config)
+    : vertices_(std::move(vertices)),
+      label_(label),
+      property_(property),
+      value_(value),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {}
+
+LabelPropertyHashIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                     std::vector<Vertex *>::const_iterator vertex_iterator)
+    : self_(self),
+      vertex_iterator_(vertex_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_) {
+  AdvanceUntilValid();
+}
+
+LabelPropertyHashIndex::Iterable::Iterator &LabelPropertyHashIndex::Iterable::Iterator::operator++() {
+  ++vertex_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void LabelPropertyHashIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; vertex_iterator_ != self_->vertices_.cend(); ++vertex_iterator_) {
+    if (CurrentVersionHasLabelProperty(**vertex_iterator_, self_->label_, self_->property_, self_->value_,
+                                       self_->transaction_, self_->view_)) {
+      current_vertex_accessor_ =
+          VertexAccessor(*vertex_iterator_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_);
+      break;
+    }
+  }
+}
+
+int64_t LabelPropertyHashIndex::ApproximateVertexCount(LabelId label, PropertyId property,
+                                                       const PropertyValue &value) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Hash index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  const auto &table = it->second;
+  if (value.IsNull()) {
+    // As in `LabelPropertyIndex`, `Null` is used to estimate the average
+    // number of vertices with the same value.
+    const auto values = table.values.load(std::memory_order_acquire);
+    if (values == 0) return 0;
+    const auto size = table.size.load(std::memory_order_acquire);
+    return static_cast<int64_t>((size + values - 1) / values);
+  }
+  const auto &stripe = table.GetStripe(value);
+  std::lock_guard<utils::SpinLock> guard(stripe.lock);
+  auto entries = stripe.entries.find(value);
+  if (entries == stripe.entries.end()) return 0;
+  return static_cast<int64_t>(entries->second.size());
+}
+
 void RemoveObsoleteEntries(Indices *indices, uint64_t oldest_active_start_timestamp) {
-  indices->label_index.RemoveObsoleteEntries(oldest_active_start_timestamp);
-  indices->label_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp);
+  for (const auto &task : RemoveObsoleteEntriesTasks(indices, oldest_active_start_timestamp)) {
+    task();
+  }
+}
+
+std::vector<std::function<void()>> RemoveObsoleteEntriesTasks(Indices *indices,
+                                                              uint64_t oldest_active_start_timestamp) {
+  // Every index is a separate structure, so they can be cleaned up in
+  // parallel.
+  return {
+      [=] { indices->label_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->label_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->label_property_composite_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->label_property_hash_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->property_columns.RemoveObsoleteEntries(); },
+      [=] { indices->edge_type_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->edge_type_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+  };
+}
+
+void AddBulkLoadedVertices(Indices *indices, const std::vector<Vertex *> &vertices) {
+  indices->label_index.AddBulkLoadedVertices(vertices);
+  indices->label_property_index.AddBulkLoadedVertices(vertices);
+  // The remaining indices are updated one vertex at a time, as if the labels
+  // were added by a transaction that is older than all others.
+  Transaction tx(kTransactionInitialId, kTimestampInitialId, IsolationLevel::SNAPSHOT_ISOLATION);
+  for (auto *vertex : vertices) {
+    for (auto label : vertex->labels) {
+      indices->label_property_composite_index.UpdateOnAddLabel(label, vertex, tx);
+      indices->label_property_hash_index.UpdateOnAddLabel(label, vertex, tx);
+      indices->property_columns.UpdateOnAddLabel(label, vertex);
+    }
+  }
 }
 
 void UpdateOnAddLabel(Indices *indices, LabelId label, Vertex *vertex, const Transaction &tx) {
   indices->label_index.UpdateOnAddLabel(label, vertex, tx);
   indices->label_property_index.UpdateOnAddLabel(label, vertex, tx);
+  indices->label_property_composite_index.UpdateOnAddLabel(label, vertex, tx);
+  indices->label_property_hash_index.UpdateOnAddLabel(label, vertex, tx);
+  indices->property_columns.UpdateOnAddLabel(label, vertex);
 }
 
 void UpdateOnSetProperty(Indices *indices, PropertyId property, const PropertyValue &value, Vertex *vertex,
                          const Transaction &tx) {
   indices->label_property_index.UpdateOnSetProperty(property, value, vertex, tx);
+  indices->label_property_composite_index.UpdateOnSetProperty(property, value, vertex, tx);
+  indices->label_property_hash_index.UpdateOnSetProperty(property, value, vertex, tx);
+  indices->property_columns.UpdateOnSetProperty(property, value, vertex);
+}
+
+void UpdateOnEdgeCreation(Indices *indices, Vertex *from_vertex, Vertex *to_vertex, EdgeRef edge, EdgeTypeId edge_type,
+                          const Transaction &tx) {
+  indices->edge_type_index.UpdateOnEdgeCreation(from_vertex, to_vertex, edge, edge_type, tx);
+}
+
+void UpdateOnEdgeSetProperty(Indices *indices, PropertyId property, const PropertyValue &value, Vertex *from_vertex,
+                             Vertex *to_vertex, Edge *edge, EdgeTypeId edge_type, const Transaction &tx) {
+  indices->edge_type_property_index.UpdateOnSetProperty(property, value, from_vertex, to_vertex, edge, edge_type, tx);
 }
 
 }  // namespace memgraph::storage
@@ -11,17 +11,26 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
 #include <optional>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "storage/v2/config.hpp"
+#include "storage/v2/edge_indices.hpp"
+#include "storage/v2/property_columns.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/bound.hpp"
 #include "utils/logging.hpp"
 #include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
 
 namespace memgraph::storage {
 
@@ -60,6 +69,11 @@ class LabelIndex {
   /// @throw std::bad_alloc
   bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices);
 
+  /// Adds vertices created by a bulk load. The entries of each index are
+  /// sorted before they are inserted into the skip list.
+  /// @throw std::bad_alloc
+  void AddBulkLoadedVertices(const std::vector<Vertex *> &vertices);
+
   /// Returns false if there was no index to drop
   bool DropIndex(LabelId label) { return index_.erase(label) > 0; }
 
@@ -158,6 +172,11 @@ class LabelPropertyIndex {
   /// @throw std::bad_alloc
   bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
 
+  /// Adds vertices created by a bulk load. The entries of each index are
+  /// sorted before they are inserted into the skip list.
+  /// @throw std::bad_alloc
+  void AddBulkLoadedVertices(const std::vector<Vertex *> &vertices);
+
   bool DropIndex(LabelId label, PropertyId property) { return index_.erase({label, property}) > 0; }
 
   bool IndexExists(LabelId label, PropertyId property) const { return index_.find({label, property}) != index_.end(); }
@@ -248,9 +267,280 @@ class LabelPropertyIndex {
   Config::Items config_;
 };
 
+/// Index over an ordered list of properties of vertices with a given label.
+///
+/// Entries are ordered lexicographically by the values of the properties, so
+/// the index can be used to look up vertices by equal values of a prefix of
+/// the properties, optionally followed by a range on the next property. Only
+/// vertices that have all of the properties set are indexed.
+class LabelPropertyCompositeIndex {
+ private:
+  struct Entry {
+    std::vector<PropertyValue> values;
+    Vertex *vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs);
+    bool operator==(const Entry &rhs);
+
+    // These compare only the first `rhs.size()` values, which is what prefix
+    // lookups need.
+    bool operator<(const std::vector<PropertyValue> &rhs);
+    bool operator==(const std::vector<PropertyValue> &rhs);
+  };
+
+ public:
+  LabelPropertyCompositeIndex(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx);
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex, const Transaction &tx);
+
+  /// @return false if the index already exists or has less than two
+  /// properties or a repeated property
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                   utils::SkipList<Vertex>::Accessor vertices);
+
+  bool DropIndex(LabelId label, const std::vector<PropertyId> &properties) {
+    return index_.erase({label, properties}) > 0;
+  }
+
+  bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+    return index_.find({label, properties}) != index_.end();
+  }
+
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListIndices() const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, const std::vector<PropertyId> *properties,
+             std::vector<PropertyValue> prefix, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+             Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      VertexAccessor operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    bool IsInBounds(const PropertyValue &value) const;
+
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    // Points to the key of the index, which outlives the iterable because the
+    // index can't be dropped while a transaction is active.
+    const std::vector<PropertyId> *properties_;
+    std::vector<PropertyValue> prefix_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  /// Iterates over vertices whose values of the first `prefix.size()`
+  /// properties are equal to `prefix` and whose value of the following
+  /// property lies within the bounds. The bounds can only be set if `prefix`
+  /// is shorter than the list of properties. A `Null` value in the prefix
+  /// doesn't match any vertex.
+  Iterable Vertices(LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                    Transaction *transaction) {
+    auto it = index_.find({label, properties});
+    MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+    MG_ASSERT(prefix.size() < it->first.second.size() || (!lower_bound && !upper_bound),
+              "Bounds can only be set on a property that follows the prefix");
+    return Iterable(it->second.access(), label, &it->first.second, std::move(prefix), lower_bound, upper_bound, view,
+                    transaction, indices_, constraints_, config_);
+  }
+
+  int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const {
+    auto it = index_.find({label, properties});
+    MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+    return it->second.size();
+  }
+
+  /// Estimates the number of vertices whose values of the first
+  /// `prefix.size()` properties are equal to `prefix`.
+  int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                 const std::vector<PropertyValue> &prefix) const;
+
+  void Clear() { index_.clear(); }
+
+  void RunGC();
+
+ private:
+  std::map<std::pair<LabelId, std::vector<PropertyId>>, utils::SkipList<Entry>> index_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
+/// Hash index of vertices with a given label by the value of a given
+/// property.
+///
+/// The index only supports looking up vertices with a property equal to a
+/// given value, but unlike `LabelPropertyIndex` a lookup hashes the value once
+/// instead of comparing values on every level of a skip list. The table is
+/// split into stripes which are locked independently, so concurrent updates
+/// rarely contend. As in the other indices, an entry only means that some
+/// version of the vertex had the value, so visibility is checked on lookup and
+/// obsolete entries are removed during garbage collection.
+class LabelPropertyHashIndex {
+ private:
+  struct Entry {
+    Vertex *vertex;
+    uint64_t timestamp;
+  };
+
+  struct Stripe {
+    mutable utils::SpinLock lock;
+    std::unordered_map<PropertyValue, std::vector<Entry>> entries;
+  };
+
+  struct Table {
+    static constexpr size_t kStripeCount = 256;
+
+    Stripe &GetStripe(const PropertyValue &value) {
+      return stripes[std::hash<PropertyValue>{}(value) % kStripeCount];
+    }
+    const Stripe &GetStripe(const PropertyValue &value) const {
+      return stripes[std::hash<PropertyValue>{}(value) % kStripeCount];
+    }
+
+    /// @throw std::bad_alloc
+    void Insert(const PropertyValue &value, Vertex *vertex, uint64_t timestamp);
+
+    std::array<Stripe, kStripeCount> stripes;
+    // Number of entries and distinct values, used for the estimates.
+    std::atomic<uint64_t> size{0};
+    std::atomic<uint64_t> values{0};
+  };
+
+ public:
+  LabelPropertyHashIndex(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx);
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex, const Transaction &tx);
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  bool DropIndex(LabelId label, PropertyId property) { return index_.erase({label, property}) > 0; }
+
+  bool IndexExists(LabelId label, PropertyId property) const { return index_.find({label, property}) != index_.end(); }
+
+  std::vector<std::pair<LabelId, PropertyId>> ListIndices() const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(std::vector<Vertex *> vertices, LabelId label, PropertyId property, const PropertyValue &value,
+             View view, Transaction *transaction, Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, std::vector<Vertex *>::const_iterator vertex_iterator);
+
+      VertexAccessor operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return vertex_iterator_ == other.vertex_iterator_; }
+      bool operator!=(const Iterator &other) const { return vertex_iterator_ != other.vertex_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      std::vector<Vertex *>::const_iterator vertex_iterator_;
+      VertexAccessor current_vertex_accessor_;
+    };
+
+    Iterator begin() { return Iterator(this, vertices_.cbegin()); }
+    Iterator end() { return Iterator(this, vertices_.cend()); }
+
+   private:
+    // Candidates copied out of the table, sorted and without duplicates.
+    std::vector<Vertex *> vertices_;
+    LabelId label_;
+    PropertyId property_;
+    PropertyValue value_;
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  /// Returns an iterable over the vertices whose property is equal to `value`.
+  /// A `Null` value doesn't match any vertex.
+  Iterable Vertices(LabelId label, PropertyId property, const PropertyValue &value, View view,
+                    Transaction *transaction);
+
+  int64_t ApproximateVertexCount(LabelId label, PropertyId property) const {
+    auto it = index_.find({label, property});
+    MG_ASSERT(it != index_.end(), "Hash index for label {} and property {} doesn't exist", label.AsUint(),
+              property.AsUint());
+    return it->second.size.load(std::memory_order_acquire);
+  }
+
+  /// Estimates the number of vertices whose property is equal to `value`. A
+  /// `Null` value estimates the average number of vertices per value.
+  int64_t ApproximateVertexCount(LabelId label, PropertyId property, const PropertyValue &value) const;
+
+  void Clear() { index_.clear(); }
+
+ private:
+  std::map<std::pair<LabelId, PropertyId>, Table> index_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
 struct Indices {
   Indices(Constraints *constraints, Config::Items config)
-      : label_index(this, constraints, config), label_property_index(this, constraints, config) {}
+      : label_index(this, constraints, config),
+        label_property_index(this, constraints, config),
+        label_property_composite_index(this, constraints, config),
+        label_property_hash_index(this, constraints, config),
+        property_columns(this, constraints, config),
+        edge_type_index(this, constraints, config),
+        edge_type_property_index(this, constraints, config) {}
 
   // Disable copy and move because members hold pointer to `this`.
   Indices(const Indices &) = delete;
@@ -261,12 +551,27 @@ struct Indices {
 
   LabelIndex label_index;
   LabelPropertyIndex label_property_index;
+  LabelPropertyCompositeIndex label_property_composite_index;
+  LabelPropertyHashIndex label_property_hash_index;
+  PropertyColumns property_columns;
+  EdgeTypeIndex edge_type_index;
+  EdgeTypePropertyIndex edge_type_property_index;
 };
 
 /// This function should be called from garbage collection to clean-up the
 /// index.
 void RemoveObsoleteEntries(Indices *indices, uint64_t oldest_active_start_timestamp);
 
+/// Returns the clean-ups done by `RemoveObsoleteEntries` split into tasks that
+/// can run concurrently with each other.
+std::vector<std::function<void()>> RemoveObsoleteEntriesTasks(Indices *indices, uint64_t oldest_active_start_timestamp);
+
+/// Adds vertices created by a bulk load (see `Storage::BulkLoadAccessor`) to
+/// all indices. Like the entries added when an index is created, the entries
+/// are visible to all transactions.
+/// @throw std::bad_alloc
+void AddBulkLoadedVertices(Indices *indices, const std::vector<Vertex *> &vertices);
+
 // Indices are updated whenever an update occurs, instead of only on commit or
 // advance command. This is necessary because we want indices to support `NEW`
 // view for use in Merge.
@@ -279,4 +584,14 @@ void UpdateOnAddLabel(Indices *indices, LabelId label, Vertex *vertex, const Tra
 /// @throw std::bad_alloc
 void UpdateOnSetProperty(Indices *indices, PropertyId property, const PropertyValue &value, Vertex *vertex,
                          const Transaction &tx);
+
+/// This function should be called whenever an edge is created.
+/// @throw std::bad_alloc
+void UpdateOnEdgeCreation(Indices *indices, Vertex *from_vertex, Vertex *to_vertex, EdgeRef edge, EdgeTypeId edge_type,
+                          const Transaction &tx);
+
+/// This function should be called whenever a property is modified on an edge.
+/// @throw std::bad_alloc
+void UpdateOnEdgeSetProperty(Indices *indices, PropertyId property, const PropertyValue &value, Vertex *from_vertex,
+                             Vertex *to_vertex, Edge *edge, EdgeTypeId edge_type, const Transaction &tx);
 }  // namespace memgraph::storage
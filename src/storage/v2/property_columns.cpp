@@ -0,0 +1,437 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/property_columns.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+#include "storage/v2/mvcc.hpp"
+#include "utils/algorithm.hpp"
+#include "utils/memory_tracker.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+bool IsColumnType(PropertyValue::Type type) {
+  switch (type) {
+    case PropertyValue::Type::Bool:
+    case PropertyValue::Type::Int:
+    case PropertyValue::Type::Double:
+      return true;
+    case PropertyValue::Type::Null:
+    case PropertyValue::Type::String:
+    case PropertyValue::Type::List:
+    case PropertyValue::Type::Map:
+    case PropertyValue::Type::TemporalData:
+      return false;
+  }
+}
+
+uint64_t EncodeCell(const PropertyValue &value) {
+  switch (value.type()) {
+    case PropertyValue::Type::Bool:
+      return value.ValueBool() ? 1 : 0;
+    case PropertyValue::Type::Int:
+      return std::bit_cast<uint64_t>(value.ValueInt());
+    case PropertyValue::Type::Double:
+      return std::bit_cast<uint64_t>(value.ValueDouble());
+    case PropertyValue::Type::Null:
+    case PropertyValue::Type::String:
+    case PropertyValue::Type::List:
+    case PropertyValue::Type::Map:
+    case PropertyValue::Type::TemporalData:
+      LOG_FATAL("Invalid property value type for a property column!");
+  }
+}
+
+PropertyValue DecodeCell(uint64_t cell, PropertyValue::Type type) {
+  switch (type) {
+    case PropertyValue::Type::Bool:
+      return PropertyValue(cell != 0);
+    case PropertyValue::Type::Int:
+      return PropertyValue(std::bit_cast<int64_t>(cell));
+    case PropertyValue::Type::Double:
+      return PropertyValue(std::bit_cast<double>(cell));
+    case PropertyValue::Type::Null:
+    case PropertyValue::Type::String:
+    case PropertyValue::Type::List:
+    case PropertyValue::Type::Map:
+    case PropertyValue::Type::TemporalData:
+      LOG_FATAL("Invalid property value type for a property column!");
+  }
+}
+
+}  // namespace
+
+PropertyColumns::Row PropertyColumns::LabelColumns::AllocateRow(Vertex *vertex) {
+  std::lock_guard<utils::SpinLock> guard(lock);
+  Row row;
+  if (!free_rows.empty()) {
+    row = free_rows.back();
+    free_rows.pop_back();
+  } else {
+    if (chunks.empty() || chunks.back()->used.load(std::memory_order_acquire) == kChunkSize) {
+      chunks.push_back(std::make_unique<Chunk>(schema.size()));
+    }
+    row = Row{chunks.back().get(), chunks.back()->used.load(std::memory_order_acquire)};
+    // The vertex has to be visible in the row before the row is counted as
+    // used, otherwise a concurrent scan could skip it.
+    row.chunk->vertices[row.offset].store(vertex, std::memory_order_release);
+    row.chunk->used.fetch_add(1, std::memory_order_acq_rel);
+    return row;
+  }
+  row.chunk->vertices[row.offset].store(vertex, std::memory_order_release);
+  return row;
+}
+
+void PropertyColumns::LabelColumns::FreeRow(const Row &row) {
+  std::lock_guard<utils::SpinLock> guard(lock);
+  row.chunk->vertices[row.offset].store(nullptr, std::memory_order_release);
+  free_rows.push_back(row);
+}
+
+std::vector<PropertyColumns::Chunk *> PropertyColumns::LabelColumns::ChunksSnapshot() {
+  std::lock_guard<utils::SpinLock> guard(lock);
+  std::vector<Chunk *> ret;
+  ret.reserve(chunks.size());
+  for (const auto &chunk : chunks) {
+    ret.push_back(chunk.get());
+  }
+  return ret;
+}
+
+void PropertyColumns::WriteCell(Chunk *chunk, uint64_t column, uint64_t offset, PropertyValue::Type type,
+                                const PropertyValue &value) {
+  const auto index = column * kChunkSize + offset;
+  if (value.IsNull()) {
+    chunk->states[index] = CellState::NONE;
+  } else if (value.type() == type) {
+    chunk->values[index] = EncodeCell(value);
+    chunk->states[index] = CellState::VALUE;
+  } else {
+    chunk->states[index] = CellState::OTHER;
+  }
+}
+
+void PropertyColumns::FillRow(const LabelColumns &columns, const Row &row, const Vertex &vertex) {
+  for (uint64_t column = 0; column < columns.schema.size(); ++column) {
+    const auto &[property, type] = columns.schema[column];
+    WriteCell(row.chunk, column, row.offset, type, vertex.properties.GetProperty(property));
+  }
+}
+
+void PropertyColumns::UpdateOnAddLabel(LabelId label, Vertex *vertex) {
+  auto it = columns_.find(label);
+  if (it == columns_.end()) return;
+  auto &columns = it->second;
+  auto acc = columns.rows.access();
+  auto row_it = acc.find(vertex);
+  if (row_it != acc.end()) {
+    // The label was removed and added again so the vertex still owns a row.
+    FillRow(columns, row_it->row, *vertex);
+    return;
+  }
+  auto row = columns.AllocateRow(vertex);
+  FillRow(columns, row, *vertex);
+  acc.insert(RowEntry{vertex, row});
+}
+
+void PropertyColumns::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex) {
+  for (auto &[label, columns] : columns_) {
+    auto schema_it = std::find_if(columns.schema.begin(), columns.schema.end(),
+                                  [property](const auto &item) { return item.first == property; });
+    if (schema_it == columns.schema.end() || !utils::Contains(vertex->labels, label)) {
+      continue;
+    }
+    auto acc = columns.rows.access();
+    auto row_it = acc.find(vertex);
+    MG_ASSERT(row_it != acc.end(), "Vertex with a columnar label doesn't own a row!");
+    WriteCell(row_it->row.chunk, schema_it - columns.schema.begin(), row_it->row.offset, schema_it->second, value);
+  }
+}
+
+void PropertyColumns::UpdateOnAbort(Vertex *vertex) {
+  for (auto &[label, columns] : columns_) {
+    auto acc = columns.rows.access();
+    auto row_it = acc.find(vertex);
+    if (row_it == acc.end()) continue;
+    FillRow(columns, row_it->row, *vertex);
+  }
+}
+
+bool PropertyColumns::CreateColumns(LabelId label, const Schema &schema, utils::SkipList<Vertex>::Accessor vertices) {
+  if (schema.empty()) return false;
+  for (auto it = schema.begin(); it != schema.end(); ++it) {
+    if (!IsColumnType(it->second)) return false;
+    if (std::any_of(schema.begin(), it, [&it](const auto &item) { return item.first == it->first; })) return false;
+  }
+
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] = columns_.emplace(std::piecewise_construct, std::forward_as_tuple(label),
+                                         std::forward_as_tuple(schema));
+  if (!emplaced) {
+    // Columns already exist.
+    return false;
+  }
+  try {
+    auto &columns = it->second;
+    auto acc = columns.rows.access();
+    for (Vertex &vertex : vertices) {
+      std::lock_guard<utils::SpinLock> guard(vertex.lock);
+      // Vertices that don't have the label in their latest version don't get a
+      // row, even if an older version that is still visible to some
+      // transaction has the label. Scans read these versions through
+      // `PropertyStore` and the delta chain of the vertices that do have a row.
+      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
+        continue;
+      }
+      auto row = columns.AllocateRow(&vertex);
+      FillRow(columns, row, vertex);
+      acc.insert(RowEntry{&vertex, row});
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    columns_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+bool PropertyColumns::ColumnExists(LabelId label, PropertyId property) const {
+  auto it = columns_.find(label);
+  if (it == columns_.end()) return false;
+  return std::any_of(it->second.schema.begin(), it->second.schema.end(),
+                     [property](const auto &item) { return item.first == property; });
+}
+
+std::vector<std::pair<LabelId, PropertyColumns::Schema>> PropertyColumns::ListColumns() const {
+  std::vector<std::pair<LabelId, Schema>> ret;
+  ret.reserve(columns_.size());
+  for (const auto &[label, columns] : columns_) {
+    ret.emplace_back(label, columns.schema);
+  }
+  return ret;
+}
+
+int64_t PropertyColumns::ApproximateVertexCount(LabelId label) const {
+  auto it = columns_.find(label);
+  MG_ASSERT(it != columns_.end(), "Property columns for label {} don't exist", label.AsUint());
+  return it->second.rows.size();
+}
+
+void PropertyColumns::RemoveObsoleteEntries() {
+  for (auto &[label, columns] : columns_) {
+    auto acc = columns.rows.access();
+    for (auto it = acc.begin(); it != acc.end();) {
+      auto next_it = it;
+      ++next_it;
+
+      {
+        std::lock_guard<utils::SpinLock> guard(it->vertex->lock);
+        // A vertex without deltas that is deleted or doesn't have the label
+        // anymore can't be seen through the columns by any transaction. The
+        // vertex itself is freed only after all transactions that are currently
+        // active finish, so the scans that still hold a pointer to it can safely
+        // inspect it. The row is released while holding the vertex lock so
+        // that adding the label back can't race with it.
+        if (it->vertex->delta == nullptr &&
+            (it->vertex->deleted || !utils::Contains(it->vertex->labels, label))) {
+          columns.FreeRow(it->row);
+          acc.remove(*it);
+        }
+      }
+      it = next_it;
+    }
+  }
+}
+
+void PropertyColumns::RunGC() {
+  for (auto &[label, columns] : columns_) {
+    columns.rows.run_gc();
+  }
+}
+
+PropertyColumns::Iterable PropertyColumns::Vertices(LabelId label, PropertyId property,
+                                                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                    const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                    View view, Transaction *transaction) {
+  auto it = columns_.find(label);
+  MG_ASSERT(it != columns_.end(), "Property columns for label {} don't exist", label.AsUint());
+  const auto &schema = it->second.schema;
+  auto schema_it =
+      std::find_if(schema.begin(), schema.end(), [property](const auto &item) { return item.first == property; });
+  MG_ASSERT(schema_it != schema.end(), "Property column for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  return Iterable(&it->second, label, property, schema_it - schema.begin(), lower_bound, upper_bound, view,
+                  transaction, indices_, constraints_, config_);
+}
+
+PropertyColumns::Iterable::Iterable(LabelColumns *columns, LabelId label, PropertyId property, uint64_t column,
+                                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                    Transaction *transaction, Indices *indices, Constraints *constraints,
+                                    Config::Items config)
+    : chunks_(columns->ChunksSnapshot()),
+      label_(label),
+      property_(property),
+      column_(column),
+      type_(columns->schema[column].second),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  // Remove any bounds that are set to `Null` because that isn't a valid value.
+  if (lower_bound_ && lower_bound_->value().IsNull()) {
+    lower_bound_ = std::nullopt;
+  }
+  if (upper_bound_ && upper_bound_->value().IsNull()) {
+    upper_bound_ = std::nullopt;
+  }
+
+  // Check whether the bounds are of comparable types if both are supplied.
+  if (lower_bound_ && upper_bound_ &&
+      !PropertyValue::AreComparableTypes(lower_bound_->value().type(), upper_bound_->value().type())) {
+    bounds_valid_ = false;
+  }
+}
+
+PropertyValue PropertyColumns::Iterable::VisibleValue(Vertex *vertex, const Chunk &chunk, uint64_t offset) const {
+  bool deleted;
+  bool has_label;
+  PropertyValue value;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SpinLock> guard(vertex->lock);
+    deleted = vertex->deleted;
+    has_label = utils::Contains(vertex->labels, label_);
+    delta = vertex->delta;
+    // The row could have been released and handed out to another vertex since
+    // the scan read the vertex pointer, in which case its cells can't be used.
+    if (delta == nullptr && chunk.vertices[offset].load(std::memory_order_acquire) == vertex) {
+      // There are no changes that the transaction could have to undo so the
+      // column holds exactly the value that is visible. This is the common
+      // case once the garbage collector catches up.
+      if (deleted || !has_label) return PropertyValue();
+      const auto index = column_ * kChunkSize + offset;
+      switch (chunk.states[index]) {
+        case CellState::NONE:
+          return PropertyValue();
+        case CellState::VALUE:
+          return DecodeCell(chunk.values[index], type_);
+        case CellState::OTHER:
+          return vertex->properties.GetProperty(property_);
+      }
+    }
+    value = vertex->properties.GetProperty(property_);
+  }
+  ApplyDeltasForRead(transaction_, delta, view_, [&deleted, &has_label, &value, this](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::SET_PROPERTY: {
+        if (delta.property.key == property_) {
+          value = delta.property.value;
+        }
+        break;
+      }
+      case Delta::Action::DELETE_OBJECT: {
+        MG_ASSERT(!deleted, "Invalid database state!");
+        deleted = true;
+        break;
+      }
+      case Delta::Action::RECREATE_OBJECT: {
+        MG_ASSERT(deleted, "Invalid database state!");
+        deleted = false;
+        break;
+      }
+      case Delta::Action::ADD_LABEL:
+        if (delta.label == label_) {
+          MG_ASSERT(!has_label, "Invalid database state!");
+          has_label = true;
+        }
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta.label == label_) {
+          MG_ASSERT(has_label, "Invalid database state!");
+          has_label = false;
+        }
+        break;
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+  });
+  if (deleted || !has_label) return PropertyValue();
+  return value;
+}
+
+bool PropertyColumns::Iterable::IsInBounds(const PropertyValue &value) const {
+  if (value.IsNull()) return false;
+  if (lower_bound_) {
+    if (!PropertyValue::AreComparableTypes(value.type(), lower_bound_->value().type())) return false;
+    if (value < lower_bound_->value()) return false;
+    if (!lower_bound_->IsInclusive() && value == lower_bound_->value()) return false;
+  }
+  if (upper_bound_) {
+    if (!PropertyValue::AreComparableTypes(value.type(), upper_bound_->value().type())) return false;
+    if (upper_bound_->value() < value) return false;
+    if (!upper_bound_->IsInclusive() && value == upper_bound_->value()) return false;
+  }
+  return true;
+}
+
+PropertyColumns::Iterable::Iterator::Iterator(Iterable *self, uint64_t chunk_index, uint64_t offset)
+    : self_(self),
+      chunk_index_(chunk_index),
+      offset_(offset),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_) {
+  AdvanceUntilValid();
+}
+
+PropertyColumns::Iterable::Iterator &PropertyColumns::Iterable::Iterator::operator++() {
+  ++offset_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void PropertyColumns::Iterable::Iterator::AdvanceUntilValid() {
+  for (; chunk_index_ < self_->chunks_.size(); ++chunk_index_, offset_ = 0) {
+    const auto &chunk = *self_->chunks_[chunk_index_];
+    const auto used = chunk.used.load(std::memory_order_acquire);
+    for (; offset_ < used; ++offset_) {
+      auto *vertex = chunk.vertices[offset_].load(std::memory_order_acquire);
+      if (vertex == nullptr) continue;
+      if (self_->IsInBounds(self_->VisibleValue(vertex, chunk, offset_))) {
+        current_vertex_accessor_ =
+            VertexAccessor{vertex, self_->transaction_, self_->indices_, self_->constraints_, self_->config_};
+        return;
+      }
+    }
+  }
+  offset_ = 0;
+}
+
+PropertyColumns::Iterable::Iterator PropertyColumns::Iterable::begin() {
+  // If the bounds are set and don't have comparable types we don't yield any
+  // items.
+  if (!bounds_valid_) return end();
+  return Iterator(this, 0, 0);
+}
+
+PropertyColumns::Iterable::Iterator PropertyColumns::Iterable::end() { return Iterator(this, chunks_.size(), 0); }
+
+}  // namespace memgraph::storage
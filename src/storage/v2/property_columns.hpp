@@ -0,0 +1,237 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/bound.hpp"
+#include "utils/logging.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::storage {
+
+struct Indices;
+struct Constraints;
+
+/// Column-oriented copy of selected properties of all vertices with a given
+/// label.
+///
+/// `PropertyStore` keeps each vertex's properties in a single encoded buffer,
+/// so reading one property has to decode the buffer up to that property. For
+/// labels with a stable schema the user can register a set of fixed-width
+/// properties (bool, int and double). Their values are then additionally kept
+/// in typed arrays, one per property, split into chunks of `kChunkSize` rows.
+/// Every vertex with the label owns one row. A scan over a column reads the
+/// values at fixed offsets and only falls back to `PropertyStore` and the delta
+/// chain when the vertex has uncommitted or not yet garbage collected changes.
+///
+/// The columns are kept up to date in the same places where the indices are
+/// updated. The cells of a row are only ever read and written while holding
+/// the lock of the row's vertex. `PropertyStore` stays the source of truth, so
+/// a value whose type doesn't match the schema is marked as such in the column
+/// and read from the `PropertyStore` instead.
+class PropertyColumns {
+ public:
+  using Schema = std::vector<std::pair<PropertyId, PropertyValue::Type>>;
+
+  static constexpr uint64_t kChunkSize = 4096;
+
+ private:
+  enum class CellState : uint8_t {
+    // The vertex doesn't have the property.
+    NONE,
+    // The value is stored in the column.
+    VALUE,
+    // The value has a type different from the schema type and has to be read
+    // from the `PropertyStore`.
+    OTHER,
+  };
+
+  struct Chunk {
+    explicit Chunk(uint64_t columns_count)
+        : values(std::make_unique<uint64_t[]>(columns_count * kChunkSize)),
+          states(std::make_unique<CellState[]>(columns_count * kChunkSize)) {}
+
+    std::array<std::atomic<Vertex *>, kChunkSize> vertices{};
+    // Cells are laid out column by column, i.e. the cell of column `c` and row
+    // offset `o` is at `c * kChunkSize + o`.
+    std::unique_ptr<uint64_t[]> values;
+    std::unique_ptr<CellState[]> states;
+    // Number of rows of the chunk that were ever handed out.
+    std::atomic<uint64_t> used{0};
+  };
+
+  struct Row {
+    Chunk *chunk;
+    uint64_t offset;
+  };
+
+  struct RowEntry {
+    Vertex *vertex;
+    Row row;
+
+    bool operator<(const RowEntry &rhs) { return vertex < rhs.vertex; }
+    bool operator==(const RowEntry &rhs) { return vertex == rhs.vertex; }
+    bool operator<(const Vertex *rhs) { return vertex < rhs; }
+    bool operator==(const Vertex *rhs) { return vertex == rhs; }
+  };
+
+  struct LabelColumns {
+    explicit LabelColumns(Schema schema) : schema(std::move(schema)) {}
+
+    /// @throw std::bad_alloc
+    Row AllocateRow(Vertex *vertex);
+
+    void FreeRow(const Row &row);
+
+    std::vector<Chunk *> ChunksSnapshot();
+
+    Schema schema;
+    utils::SkipList<RowEntry> rows;
+
+    // Protects `chunks` and `free_rows`.
+    utils::SpinLock lock;
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<Row> free_rows;
+  };
+
+ public:
+  PropertyColumns(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// Allocates a row for the vertex if the label has columns and fills it from
+  /// the vertex's `PropertyStore`. Must be called while holding the vertex lock.
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId label, Vertex *vertex);
+
+  /// Must be called while holding the vertex lock.
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex);
+
+  /// Refreshes all rows of the vertex from its `PropertyStore`. Used after the
+  /// vertex was modified without going through the hooks above (e.g. when
+  /// undoing deltas of an aborted transaction). Must be called while holding
+  /// the vertex lock.
+  void UpdateOnAbort(Vertex *vertex);
+
+  /// Registers columns for the given label and fills them with the properties
+  /// of the existing vertices. Only `Bool`, `Int` and `Double` properties can
+  /// be stored in columns.
+  /// @return false if the label already has columns or the schema is invalid
+  /// @throw std::bad_alloc
+  bool CreateColumns(LabelId label, const Schema &schema, utils::SkipList<Vertex>::Accessor vertices);
+
+  bool DropColumns(LabelId label) { return columns_.erase(label) > 0; }
+
+  bool ColumnExists(LabelId label, PropertyId property) const;
+
+  std::vector<std::pair<LabelId, Schema>> ListColumns() const;
+
+  /// Returns the number of rows of the label, which is an over-estimate of
+  /// the number of vertices with the label and any of the column properties.
+  int64_t ApproximateVertexCount(LabelId label) const;
+
+  /// Releases the rows of vertices that were deleted and whose deltas were
+  /// already unlinked by the garbage collector.
+  void RemoveObsoleteEntries();
+
+  class Iterable {
+   public:
+    Iterable(LabelColumns *columns, LabelId label, PropertyId property, uint64_t column,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+             Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, uint64_t chunk_index, uint64_t offset);
+
+      VertexAccessor operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const {
+        return chunk_index_ == other.chunk_index_ && offset_ == other.offset_;
+      }
+      bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      uint64_t chunk_index_;
+      uint64_t offset_;
+      VertexAccessor current_vertex_accessor_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    /// Returns the value of the column for the given row as seen by the
+    /// transaction, or `Null` if the vertex isn't visible or doesn't have the
+    /// label.
+    PropertyValue VisibleValue(Vertex *vertex, const Chunk &chunk, uint64_t offset) const;
+
+    bool IsInBounds(const PropertyValue &value) const;
+
+    std::vector<Chunk *> chunks_;
+    LabelId label_;
+    PropertyId property_;
+    uint64_t column_;
+    PropertyValue::Type type_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  /// Iterates over vertices with the given label whose value of the given
+  /// property is not `Null` and lies within the bounds. The bounds follow the
+  /// same rules as the bounds of `LabelPropertyIndex::Vertices`.
+  Iterable Vertices(LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                    Transaction *transaction);
+
+  void Clear() { columns_.clear(); }
+
+  void RunGC();
+
+ private:
+  static void WriteCell(Chunk *chunk, uint64_t column, uint64_t offset, PropertyValue::Type type,
+                        const PropertyValue &value);
+
+  static void FillRow(const LabelColumns &columns, const Row &row, const Vertex &vertex);
+
+  std::map<LabelId, LabelColumns> columns_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
+}  // namespace memgraph::storage
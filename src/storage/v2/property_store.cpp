@@ -1144,6 +1144,48 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
   return !existed;
 }
 
+bool PropertyStore::InitProperties(const std::map<PropertyId, PropertyValue> &properties) {
+  uint64_t size = 0;
+  uint8_t *data = nullptr;
+  std::tie(size, data) = GetSizeData(buffer_);
+  if (size != 0) return false;
+
+  // The properties are stored sorted by their ids, which is the order of the
+  // map, so they can be encoded one after another.
+  Writer size_writer;
+  for (const auto &[property, value] : properties) {
+    if (value.IsNull()) continue;
+    EncodeProperty(&size_writer, property, value);
+  }
+  auto properties_size = size_writer.Written();
+  if (properties_size == 0) return true;
+
+  if (properties_size <= sizeof(buffer_) - 1) {
+    // Use the local buffer.
+    buffer_[0] = kUseLocalBuffer;
+    size = sizeof(buffer_) - 1;
+    data = &buffer_[1];
+  } else {
+    // Allocate a new external buffer.
+    size = ToPowerOf8(properties_size);
+    data = new uint8_t[size];
+    SetSizeData(buffer_, size, data);
+  }
+
+  Writer writer(data, size);
+  for (const auto &[property, value] : properties) {
+    if (value.IsNull()) continue;
+    MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+  }
+  auto metadata = writer.WriteMetadata();
+  if (metadata) {
+    // If there is any space left in the buffer we add a tombstone to indicate
+    // that there are no more properties to be decoded.
+    metadata->Set({Type::EMPTY});
+  }
+  return true;
+}
+
 bool PropertyStore::ClearProperties() {
   bool in_local_buffer = false;
   uint64_t size;
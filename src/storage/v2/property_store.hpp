@@ -59,6 +59,14 @@ class PropertyStore {
   /// @throw std::bad_alloc
   bool SetProperty(PropertyId property, const PropertyValue &value);
 
+  /// Sets all of the given properties at once and returns `true`, which is
+  /// faster than setting them one by one because the data is encoded into a
+  /// single buffer. `Null` values are skipped. `false` is returned and nothing
+  /// is set if the store already has properties. The time complexity of this
+  /// function is O(n).
+  /// @throw std::bad_alloc
+  bool InitProperties(const std::map<PropertyId, PropertyValue> &properties);
+
   /// Remove all properties and return `true` if any removal took place.
   /// `false` is returned if there were no properties to remove. The time
   /// complexity of this function is O(1).
@@ -19,6 +19,7 @@
 #include "storage/v2/temporal.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/exceptions.hpp"
+#include "utils/fnv.hpp"
 
 namespace memgraph::storage {
 
@@ -488,3 +489,44 @@ inline void PropertyValue::DestroyValue() noexcept {
 }
 
 }  // namespace memgraph::storage
+
+namespace std {
+
+/// The hash is consistent with `operator==`, so integers and doubles which
+/// compare equal have the same hash.
+template <>
+struct hash<memgraph::storage::PropertyValue> {
+  size_t operator()(const memgraph::storage::PropertyValue &value) const noexcept {
+    using Type = memgraph::storage::PropertyValue::Type;
+    switch (value.type()) {
+      case Type::Null:
+        return 31;
+      case Type::Bool:
+        return std::hash<bool>{}(value.ValueBool());
+      case Type::Int:
+        return std::hash<double>{}(static_cast<double>(value.ValueInt()));
+      case Type::Double:
+        return std::hash<double>{}(value.ValueDouble());
+      case Type::String:
+        return std::hash<std::string_view>{}(value.ValueString());
+      case Type::List:
+        return memgraph::utils::FnvCollection<std::vector<memgraph::storage::PropertyValue>,
+                                              memgraph::storage::PropertyValue>{}(value.ValueList());
+      case Type::Map: {
+        size_t hash = 6543457;
+        for (const auto &[key, item] : value.ValueMap()) {
+          hash ^= std::hash<std::string_view>{}(key);
+          hash ^= (*this)(item);
+        }
+        return hash;
+      }
+      case Type::TemporalData: {
+        const auto &temporal_data = value.ValueTemporalData();
+        return memgraph::utils::HashCombine<int64_t, int64_t>{}(static_cast<int64_t>(temporal_data.type),
+                                                                temporal_data.microseconds);
+      }
+    }
+  }
+};
+
+}  // namespace std
@@ -10,10 +10,16 @@
 // licenses/APL.txt.
 
 #pragma once
+#include <cstdint>
 #include <optional>
 #include <string>
 
 namespace memgraph::storage::replication {
+// Compressed batches are only sent up to this uncompressed size, larger ones
+// are sent uncompressed. The replicas reject compressed batches that claim to
+// be larger, so that they don't allocate arbitrary amounts of memory.
+inline constexpr uint64_t kMaxCompressedBatchSize = 128UL * 1024 * 1024;
+
 struct ReplicationClientConfig {
   std::optional<double> timeout;
 
@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <type_traits>
 
+#include <zlib.h>
+
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/replication/config.hpp"
 #include "storage/v2/replication/enums.hpp"
@@ -27,13 +29,35 @@ namespace memgraph::storage {
 namespace {
 template <typename>
 [[maybe_unused]] inline constexpr bool always_false_v = false;
+
+// Returns the data compressed with zlib or nothing if the compression doesn't
+// make the data smaller.
+std::optional<std::vector<uint8_t>> Compress(const std::vector<uint8_t> &data) {
+  auto compressed_size = compressBound(data.size());
+  std::vector<uint8_t> compressed(compressed_size);
+  if (compress2(compressed.data(), &compressed_size, data.data(), data.size(), Z_BEST_SPEED) != Z_OK ||
+      compressed_size >= data.size()) {
+    return std::nullopt;
+  }
+  compressed.resize(compressed_size);
+  return std::move(compressed);
+}
 }  // namespace
 
 ////// ReplicationClient //////
 Storage::ReplicationClient::ReplicationClient(std::string name, Storage *storage, const io::network::Endpoint &endpoint,
                                               const replication::ReplicationMode mode,
                                               const replication::ReplicationClientConfig &config)
-    : name_(std::move(name)), storage_(storage), mode_(mode) {
+    : name_(std::move(name)),
+      storage_(storage),
+      transaction_builder_([this](const uint8_t *data, size_t size, bool have_more) {
+        // Only the encoded data is kept, the batch is split into segments
+        // again when it's sent.
+        const auto *begin = data + sizeof(slk::SegmentSize);
+        const auto *end = data + size - (have_more ? 0 : sizeof(slk::SegmentSize));
+        transaction_data_.insert(transaction_data_.end(), begin, end);
+      }),
+      mode_(mode) {
   if (config.ssl) {
     rpc_context_.emplace(config.ssl->key_file, config.ssl->cert_file);
   } else {
@@ -45,7 +69,6 @@ Storage::ReplicationClient::ReplicationClient(std::string name, Storage *storage
 
   if (config.timeout && replica_state_ != replication::ReplicaState::INVALID) {
     timeout_.emplace(*config.timeout);
-    timeout_dispatcher_.emplace();
   }
 }
 
@@ -140,130 +163,199 @@ replication::WalFilesRes Storage::ReplicationClient::TransferWalFiles(
 }
 
 void Storage::ReplicationClient::StartTransactionReplication(const uint64_t current_wal_seq_num) {
+  std::unique_lock batches_guard(batches_lock_);
+  if (mode_ == replication::ReplicationMode::SYNC) {
+    // Commits wait for a SYNC replica to make room for the transaction
+    // instead of skipping it.
+    batches_cv_.wait(batches_guard, [this] { return CanQueueTransaction(); });
+  }
   std::unique_lock guard(client_lock_);
   const auto status = replica_state_.load();
   switch (status) {
     case replication::ReplicaState::RECOVERY:
       spdlog::debug("Replica {} is behind MAIN instance", name_);
       return;
-    case replication::ReplicaState::REPLICATING:
-      spdlog::debug("Replica {} missed a transaction", name_);
-      // We missed a transaction because we're still replicating
-      // the previous transaction so we need to go to RECOVERY
-      // state to catch up with the missing transaction
-      // We cannot queue the recovery process here because
-      // an error can happen while we're replicating the previous
-      // transaction after which the client should go to
-      // INVALID state before starting the recovery process
-      replica_state_.store(replication::ReplicaState::RECOVERY);
-      return;
     case replication::ReplicaState::INVALID:
       HandleRpcFailure();
       return;
     case replication::ReplicaState::READY:
+    case replication::ReplicaState::REPLICATING:
       MG_ASSERT(!replica_stream_);
-      try {
-        replica_stream_.emplace(ReplicaStream{this, storage_->last_commit_timestamp_.load(), current_wal_seq_num});
-        replica_state_.store(replication::ReplicaState::REPLICATING);
-      } catch (const rpc::RpcFailedException &) {
-        replica_state_.store(replication::ReplicaState::INVALID);
-        HandleRpcFailure();
+      if (!CanQueueTransaction()) {
+        spdlog::debug("Replica {} missed a transaction", name_);
+        // We missed a transaction because the replica didn't receive the
+        // previous batches yet so we need to go to RECOVERY state to catch
+        // up with the missing transaction. The recovery is started by the
+        // sending thread after the batch that it's currently sending because
+        // an error can happen while sending it after which the client should
+        // go to INVALID state before starting the recovery process.
+        replica_state_.store(replication::ReplicaState::RECOVERY);
+        return;
       }
+      replica_stream_.emplace(ReplicaStream{this, storage_->last_commit_timestamp_.load(), current_wal_seq_num});
+      replica_state_.store(replication::ReplicaState::REPLICATING);
       return;
   }
 }
 
 void Storage::ReplicationClient::IfStreamingTransaction(const std::function<void(ReplicaStream &handler)> &callback) {
-  // We can only check the state because it guarantees to be only
-  // valid during a single transaction replication (if the assumption
-  // that this and other transaction replication functions can only be
-  // called from a one thread stands)
-  if (replica_state_ != replication::ReplicaState::REPLICATING) {
+  // The stream exists only between the StartTransactionReplication and
+  // FinalizeTransactionReplication calls of the transaction (if the
+  // assumption that the transaction replication functions can only be
+  // called from a one thread stands).
+  if (!replica_stream_) {
     return;
   }
+  callback(*replica_stream_);
+}
 
-  try {
-    callback(*replica_stream_);
-  } catch (const rpc::RpcFailedException &) {
-    {
-      std::unique_lock client_guard{client_lock_};
-      replica_state_.store(replication::ReplicaState::INVALID);
+std::optional<replication::TransactionAck> Storage::ReplicationClient::FinalizeTransactionReplication() {
+  if (!replica_stream_) {
+    return std::nullopt;
+  }
+  replica_stream_->Finalize();
+  const auto previous_commit_timestamp = replica_stream_->previous_commit_timestamp_;
+  const auto seq_num = replica_stream_->seq_num_;
+  replica_stream_.reset();
+
+  std::unique_lock batches_guard(batches_lock_);
+  const auto now = std::chrono::steady_clock::now();
+  if (mode_ == replication::ReplicationMode::SYNC && timeout_) {
+    // TODO (antonio2368): Document and/or polish SEMI-SYNC to ASYNC fallback.
+    auto oldest_deadline = sending_deadline_;
+    if (!oldest_deadline && !pending_batches_.empty()) oldest_deadline = pending_batches_.front().deadline;
+    if (oldest_deadline && *oldest_deadline < now) {
+      spdlog::warn("Replica {} didn't apply a transaction in time, it will be replicated to asynchronously", name_);
+      mode_ = replication::ReplicationMode::ASYNC;
+    }
+  }
+
+  // A WAL file can't be changed in the middle of a batch because the replica
+  // receives the sequence number of the WAL file once per batch.
+  const auto batch_size = storage_->config_.replication.batch_size_kibibytes * 1024;
+  if (pending_batches_.empty() || pending_batches_.back().seq_num != seq_num ||
+      pending_batches_.back().data.size() >= batch_size) {
+    auto &batch = pending_batches_.emplace_back();
+    batch.epoch_id = storage_->epoch_id_;
+    batch.previous_commit_timestamp = previous_commit_timestamp;
+    batch.seq_num = seq_num;
+  }
+  auto &batch = pending_batches_.back();
+  batch.data.insert(batch.data.end(), transaction_data_.begin(), transaction_data_.end());
+  ++batch.transaction_count;
+  transaction_data_.clear();
+
+  std::optional<replication::TransactionAck> ack;
+  if (mode_ == replication::ReplicationMode::SYNC) {
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+    if (timeout_) {
+      deadline.emplace(now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::duration<double>(*timeout_)));
+      if (!batch.deadline) batch.deadline = deadline;
     }
-    HandleRpcFailure();
+    ack.emplace(batch.applied_future, deadline);
+  }
+
+  if (!sending_) {
+    sending_ = true;
+    thread_pool_.AddTask([this] { this->SendPendingBatches(); });
   }
+  return ack;
 }
 
-void Storage::ReplicationClient::FinalizeTransactionReplication() {
-  // We can only check the state because it guarantees to be only
-  // valid during a single transaction replication (if the assumption
-  // that this and other transaction replication functions can only be
-  // called from a one thread stands)
-  if (replica_state_ != replication::ReplicaState::REPLICATING) {
-    return;
+bool Storage::ReplicationClient::CanQueueTransaction() const {
+  if (!sending_ || pending_batches_.size() < storage_->config_.replication.max_pending_batches) return true;
+  // The transaction can still be added to the last batch.
+  return !pending_batches_.empty() &&
+         pending_batches_.back().data.size() < storage_->config_.replication.batch_size_kibibytes * 1024;
+}
+
+void Storage::ReplicationClient::DropPendingBatches() {
+  for (auto &batch : pending_batches_) {
+    batch.applied.set_value();
   }
+  pending_batches_.clear();
+  sending_deadline_.reset();
+  sending_ = false;
+  batches_cv_.notify_all();
+}
 
-  if (mode_ == replication::ReplicationMode::ASYNC) {
-    thread_pool_.AddTask([this] { this->FinalizeTransactionReplicationInternal(); });
-  } else if (timeout_) {
-    MG_ASSERT(mode_ == replication::ReplicationMode::SYNC, "Only SYNC replica can have a timeout.");
-    MG_ASSERT(timeout_dispatcher_, "Timeout thread is missing");
-    timeout_dispatcher_->WaitForTaskToFinish();
-
-    timeout_dispatcher_->active = true;
-    thread_pool_.AddTask([&, this] {
-      this->FinalizeTransactionReplicationInternal();
-      std::unique_lock main_guard(timeout_dispatcher_->main_lock);
-      // TimerThread can finish waiting for timeout
-      timeout_dispatcher_->active = false;
-      // Notify the main thread
-      timeout_dispatcher_->main_cv.notify_one();
-    });
-
-    timeout_dispatcher_->StartTimeoutTask(*timeout_);
-
-    // Wait until one of the threads notifies us that they finished executing
-    // Both threads should first set the active flag to false
+void Storage::ReplicationClient::SendPendingBatches() {
+  // The replica has the commits of all batches before the first pending one
+  // if it missed a transaction while they were being sent.
+  uint64_t replica_commit{kTimestampInitialId};
+  while (true) {
+    std::optional<TransactionBatch> batch;
     {
-      std::unique_lock main_guard(timeout_dispatcher_->main_lock);
-      timeout_dispatcher_->main_cv.wait(main_guard, [&] { return !timeout_dispatcher_->active.load(); });
+      std::unique_lock batches_guard(batches_lock_);
+      std::unique_lock client_guard(client_lock_);
+      if (replica_state_ == replication::ReplicaState::RECOVERY) {
+        if (!pending_batches_.empty()) replica_commit = pending_batches_.front().previous_commit_timestamp;
+        DropPendingBatches();
+        client_guard.unlock();
+        batches_guard.unlock();
+        RecoverReplica(replica_commit);
+        return;
+      }
+      if (pending_batches_.empty()) {
+        DropPendingBatches();
+        replica_state_.store(replication::ReplicaState::READY);
+        return;
+      }
+      batch.emplace(std::move(pending_batches_.front()));
+      pending_batches_.pop_front();
+      sending_deadline_ = batch->deadline;
+      batches_cv_.notify_all();
     }
 
-    // TODO (antonio2368): Document and/or polish SEMI-SYNC to ASYNC fallback.
-    if (replica_state_ == replication::ReplicaState::REPLICATING) {
-      mode_ = replication::ReplicationMode::ASYNC;
-      timeout_.reset();
-      // This can only happen if we timeouted so we are sure that
-      // Timeout task finished
-      // We need to delete timeout dispatcher AFTER the replication
-      // finished because it tries to acquire the timeout lock
-      // and acces the `active` variable`
-      thread_pool_.AddTask([this] { timeout_dispatcher_.reset(); });
+    try {
+      const auto response = SendBatch(*batch);
+      batch->applied.set_value();
+      replica_commit = response.current_commit_timestamp;
+      if (!response.success) {
+        {
+          std::unique_lock batches_guard(batches_lock_);
+          std::unique_lock client_guard(client_lock_);
+          replica_state_.store(replication::ReplicaState::RECOVERY);
+          DropPendingBatches();
+        }
+        RecoverReplica(replica_commit);
+        return;
+      }
+    } catch (const rpc::RpcFailedException &) {
+      batch->applied.set_value();
+      {
+        std::unique_lock batches_guard(batches_lock_);
+        std::unique_lock client_guard(client_lock_);
+        replica_state_.store(replication::ReplicaState::INVALID);
+        DropPendingBatches();
+      }
+      HandleRpcFailure();
+      return;
     }
-  } else {
-    FinalizeTransactionReplicationInternal();
   }
 }
 
-void Storage::ReplicationClient::FinalizeTransactionReplicationInternal() {
-  MG_ASSERT(replica_stream_, "Missing stream for transaction deltas");
-  try {
-    auto response = replica_stream_->Finalize();
-    replica_stream_.reset();
-    std::unique_lock client_guard(client_lock_);
-    if (!response.success || replica_state_ == replication::ReplicaState::RECOVERY) {
-      replica_state_.store(replication::ReplicaState::RECOVERY);
-      thread_pool_.AddTask([&, this] { this->RecoverReplica(response.current_commit_timestamp); });
-    } else {
-      replica_state_.store(replication::ReplicaState::READY);
-    }
-  } catch (const rpc::RpcFailedException &) {
-    replica_stream_.reset();
-    {
-      std::unique_lock client_guard(client_lock_);
-      replica_state_.store(replication::ReplicaState::INVALID);
-    }
-    HandleRpcFailure();
+replication::AppendDeltasRes Storage::ReplicationClient::SendBatch(const TransactionBatch &batch) {
+  // A batch that grew over the protocol limit because of a large transaction
+  // is sent uncompressed, the replica doesn't accept such compressed batches.
+  std::optional<std::vector<uint8_t>> compressed;
+  if (storage_->config_.replication.compress_batches && batch.data.size() <= replication::kMaxCompressedBatchSize) {
+    compressed = Compress(batch.data);
+  }
+
+  auto stream{rpc_client_->Stream<replication::AppendDeltasRpc>(batch.previous_commit_timestamp, batch.seq_num,
+                                                                batch.transaction_count, compressed.has_value())};
+  replication::Encoder encoder(stream.GetBuilder());
+  encoder.WriteString(batch.epoch_id);
+  if (compressed) {
+    encoder.WriteUint(batch.data.size());
+    encoder.WriteUint(compressed->size());
+    encoder.WriteBuffer(compressed->data(), compressed->size());
+  } else {
+    encoder.WriteBuffer(batch.data.data(), batch.data.size());
   }
+  return stream.AwaitResponse();
 }
 
 void Storage::ReplicationClient::RecoverReplica(uint64_t replica_commit) {
@@ -503,66 +595,56 @@ std::vector<Storage::ReplicationClient::RecoveryStep> Storage::ReplicationClient
   return recovery_steps;
 }
 
-////// TimeoutDispatcher //////
-void Storage::ReplicationClient::TimeoutDispatcher::WaitForTaskToFinish() {
-  // Wait for the previous timeout task to finish
-  std::unique_lock main_guard(main_lock);
-  main_cv.wait(main_guard, [&] { return finished; });
-}
-
-void Storage::ReplicationClient::TimeoutDispatcher::StartTimeoutTask(const double timeout) {
-  timeout_pool.AddTask([timeout, this] {
-    finished = false;
-    using std::chrono::steady_clock;
-    const auto timeout_duration =
-        std::chrono::duration_cast<steady_clock::duration>(std::chrono::duration<double>(timeout));
-    const auto end_time = steady_clock::now() + timeout_duration;
-    while (active && (steady_clock::now() < end_time)) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    std::unique_lock main_guard(main_lock);
-    finished = true;
-    active = false;
-    main_cv.notify_one();
-  });
-}
 ////// ReplicaStream //////
 Storage::ReplicationClient::ReplicaStream::ReplicaStream(ReplicationClient *self,
                                                          const uint64_t previous_commit_timestamp,
                                                          const uint64_t current_seq_num)
-    : self_(self),
-      stream_(self_->rpc_client_->Stream<replication::AppendDeltasRpc>(previous_commit_timestamp, current_seq_num)) {
-  replication::Encoder encoder{stream_.GetBuilder()};
-  encoder.WriteString(self_->storage_->epoch_id_);
+    : self_(self), previous_commit_timestamp_(previous_commit_timestamp), seq_num_(current_seq_num) {
+  MG_ASSERT(self_->transaction_data_.empty(), "Another transaction is being encoded");
 }
 
 void Storage::ReplicationClient::ReplicaStream::AppendDelta(const Delta &delta, const Vertex &vertex,
                                                             uint64_t final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(&self_->transaction_builder_);
   EncodeDelta(&encoder, &self_->storage_->name_id_mapper_, self_->storage_->config_.items, delta, vertex,
               final_commit_timestamp);
 }
 
 void Storage::ReplicationClient::ReplicaStream::AppendDelta(const Delta &delta, const Edge &edge,
                                                             uint64_t final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(&self_->transaction_builder_);
   EncodeDelta(&encoder, &self_->storage_->name_id_mapper_, delta, edge, final_commit_timestamp);
 }
 
 void Storage::ReplicationClient::ReplicaStream::AppendTransactionEnd(uint64_t final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(&self_->transaction_builder_);
   EncodeTransactionEnd(&encoder, final_commit_timestamp);
 }
 
 void Storage::ReplicationClient::ReplicaStream::AppendOperation(durability::StorageGlobalOperation operation,
-                                                                LabelId label, const std::set<PropertyId> &properties,
+                                                                LabelId label,
+                                                                const std::vector<PropertyId> &properties,
                                                                 uint64_t timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(&self_->transaction_builder_);
   EncodeOperation(&encoder, &self_->storage_->name_id_mapper_, operation, label, properties, timestamp);
 }
 
-replication::AppendDeltasRes Storage::ReplicationClient::ReplicaStream::Finalize() { return stream_.AwaitResponse(); }
+void Storage::ReplicationClient::ReplicaStream::AppendOperation(durability::StorageGlobalOperation operation,
+                                                                LabelId label, const PropertyColumns::Schema &schema,
+                                                                uint64_t timestamp) {
+  replication::Encoder encoder(&self_->transaction_builder_);
+  EncodeOperation(&encoder, &self_->storage_->name_id_mapper_, operation, label, schema, timestamp);
+}
+
+void Storage::ReplicationClient::ReplicaStream::AppendOperation(durability::StorageGlobalOperation operation,
+                                                                EdgeTypeId edge_type,
+                                                                const std::vector<PropertyId> &properties,
+                                                                uint64_t timestamp) {
+  replication::Encoder encoder(&self_->transaction_builder_);
+  EncodeOperation(&encoder, &self_->storage_->name_id_mapper_, operation, edge_type, properties, timestamp);
+}
+
+void Storage::ReplicationClient::ReplicaStream::Finalize() { self_->transaction_builder_.Finalize(); }
 
 ////// CurrentWalHandler //////
 Storage::ReplicationClient::CurrentWalHandler::CurrentWalHandler(ReplicationClient *self)
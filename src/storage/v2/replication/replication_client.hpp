@@ -13,6 +13,10 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
 #include <thread>
 #include <variant>
 
@@ -28,6 +32,7 @@
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/rpc.hpp"
 #include "storage/v2/replication/serialization.hpp"
+#include "storage/v2/replication/transaction_ack.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/file.hpp"
 #include "utils/file_locker.hpp"
@@ -42,32 +47,35 @@ class Storage::ReplicationClient {
   ReplicationClient(std::string name, Storage *storage, const io::network::Endpoint &endpoint,
                     replication::ReplicationMode mode, const replication::ReplicationClientConfig &config = {});
 
-  // Handler used for transfering the current transaction.
+  // Handler used for encoding the current transaction. The encoded
+  // transaction is queued for sending once it's finalized.
   class ReplicaStream {
    private:
     friend class ReplicationClient;
     explicit ReplicaStream(ReplicationClient *self, uint64_t previous_commit_timestamp, uint64_t current_seq_num);
 
    public:
-    /// @throw rpc::RpcFailedException
     void AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t final_commit_timestamp);
 
-    /// @throw rpc::RpcFailedException
     void AppendDelta(const Delta &delta, const Edge &edge, uint64_t final_commit_timestamp);
 
-    /// @throw rpc::RpcFailedException
     void AppendTransactionEnd(uint64_t final_commit_timestamp);
 
-    /// @throw rpc::RpcFailedException
     void AppendOperation(durability::StorageGlobalOperation operation, LabelId label,
-                         const std::set<PropertyId> &properties, uint64_t timestamp);
+                         const std::vector<PropertyId> &properties, uint64_t timestamp);
+    void AppendOperation(durability::StorageGlobalOperation operation, LabelId label,
+                         const PropertyColumns::Schema &schema, uint64_t timestamp);
+    void AppendOperation(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                         const std::vector<PropertyId> &properties, uint64_t timestamp);
 
    private:
-    /// @throw rpc::RpcFailedException
-    replication::AppendDeltasRes Finalize();
+    // Finishes the encoding, the encoded transaction is left in the
+    // `transaction_data_` of the client.
+    void Finalize();
 
     ReplicationClient *self_;
-    rpc::Client::StreamHandler<replication::AppendDeltasRpc> stream_;
+    uint64_t previous_commit_timestamp_;
+    uint64_t seq_num_;
   };
 
   // Handler for transfering the current WAL file whose data is
@@ -103,7 +111,11 @@ class Storage::ReplicationClient {
   // StartTransactionReplication, stream is created.
   void IfStreamingTransaction(const std::function<void(ReplicaStream &handler)> &callback);
 
-  void FinalizeTransactionReplication();
+  // Queues the current transaction for sending. Transactions are sent in
+  // batches from the background thread, so for SYNC replicas this returns an
+  // acknowledgement that the committing transaction should wait for after it
+  // releases the engine lock.
+  std::optional<replication::TransactionAck> FinalizeTransactionReplication();
 
   // Transfer the snapshot file.
   // @param path Path of the snapshot file.
@@ -118,14 +130,44 @@ class Storage::ReplicationClient {
 
   auto State() const { return replica_state_.load(); }
 
-  auto Mode() const { return mode_; }
+  auto Mode() const { return mode_.load(); }
 
-  auto Timeout() const { return timeout_; }
+  // A SYNC replica which falls back to ASYNC because it didn't apply a
+  // transaction in time doesn't have a timeout anymore.
+  std::optional<double> Timeout() const {
+    return mode_ == replication::ReplicationMode::SYNC ? timeout_ : std::nullopt;
+  }
 
   const auto &Endpoint() const { return rpc_client_->Endpoint(); }
 
  private:
-  void FinalizeTransactionReplicationInternal();
+  // Consecutive transactions sent to the replica in a single AppendDeltasRpc.
+  struct TransactionBatch {
+    std::string epoch_id;
+    uint64_t previous_commit_timestamp{0};
+    uint64_t seq_num{0};
+    uint64_t transaction_count{0};
+    std::vector<uint8_t> data;
+    // Deadline of the first transaction of a SYNC replica with a timeout.
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+    std::promise<void> applied;
+    std::shared_future<void> applied_future{applied.get_future()};
+  };
+
+  // Whether there is room in the pending batches for another transaction.
+  // Must be called while holding `batches_lock_`.
+  bool CanQueueTransaction() const;
+
+  // Acknowledges and removes all pending batches and stops the sending.
+  // Must be called while holding `batches_lock_`.
+  void DropPendingBatches();
+
+  // Sends the pending batches one after another until there are none left.
+  // Runs on the `thread_pool_`.
+  void SendPendingBatches();
+
+  /// @throw rpc::RpcFailedException
+  replication::AppendDeltasRes SendBatch(const TransactionBatch &batch);
 
   void RecoverReplica(uint64_t replica_commit);
 
@@ -155,32 +197,23 @@ class Storage::ReplicationClient {
   std::optional<communication::ClientContext> rpc_context_;
   std::optional<rpc::Client> rpc_client_;
 
+  // The current transaction is encoded into `transaction_data_` through
+  // this builder. Both are reused so that the large segment buffer of the
+  // builder isn't allocated for each transaction.
+  std::vector<uint8_t> transaction_data_;
+  slk::Builder transaction_builder_;
   std::optional<ReplicaStream> replica_stream_;
-  replication::ReplicationMode mode_{replication::ReplicationMode::SYNC};
-
-  // Dispatcher class for timeout tasks
-  struct TimeoutDispatcher {
-    explicit TimeoutDispatcher(){};
-
-    void WaitForTaskToFinish();
-
-    void StartTimeoutTask(double timeout);
-
-    // If the Timeout task should continue waiting
-    std::atomic<bool> active{false};
-
-    std::mutex main_lock;
-    std::condition_variable main_cv;
-
-   private:
-    // if the Timeout task finished executing
-    bool finished{true};
-
-    utils::ThreadPool timeout_pool{1};
-  };
+  std::atomic<replication::ReplicationMode> mode_{replication::ReplicationMode::SYNC};
 
   std::optional<double> timeout_;
-  std::optional<TimeoutDispatcher> timeout_dispatcher_;
+
+  std::mutex batches_lock_;
+  std::condition_variable batches_cv_;
+  std::deque<TransactionBatch> pending_batches_;
+  // Deadline of the batch that is currently being sent.
+  std::optional<std::chrono::steady_clock::time_point> sending_deadline_;
+  // Whether the `thread_pool_` is sending batches.
+  bool sending_{false};
 
   utils::SpinLock client_lock_;
   // This thread pool is used for background tasks so we don't
@@ -12,6 +12,9 @@
 #include "storage/v2/replication/replication_server.hpp"
 #include <atomic>
 #include <filesystem>
+#include <memory>
+
+#include <zlib.h>
 
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/durability/paths.hpp"
@@ -37,6 +40,37 @@ std::pair<uint64_t, durability::WalDeltaData> ReadDelta(durability::BaseDecoder
     throw utils::BasicException("Invalid data!");
   }
 };
+
+// Reads a batch of transactions compressed with zlib and returns it as an SLK
+// stream so that it can be read with the `replication::Decoder`. The sizes
+// are checked against `replication::kMaxCompressedBatchSize` before anything
+// is allocated.
+std::vector<uint8_t> ReadCompressedBatch(replication::Decoder *decoder) {
+  const auto uncompressed_size = decoder->ReadUint();
+  const auto compressed_size = decoder->ReadUint();
+  if (!uncompressed_size || !compressed_size) throw utils::BasicException("Missing data!");
+  if (*uncompressed_size > replication::kMaxCompressedBatchSize || *compressed_size > compressBound(*uncompressed_size)) {
+    throw utils::BasicException("Compressed batch is too large!");
+  }
+
+  std::vector<uint8_t> compressed(*compressed_size);
+  decoder->ReadBuffer(compressed.data(), compressed.size());
+  std::vector<uint8_t> batch(*uncompressed_size);
+  uLongf batch_size = batch.size();
+  if (uncompress(batch.data(), &batch_size, compressed.data(), compressed.size()) != Z_OK ||
+      batch_size != batch.size()) {
+    throw utils::BasicException("Invalid data!");
+  }
+
+  // The builder is too large to be kept on the stack.
+  std::vector<uint8_t> stream;
+  auto builder = std::make_unique<slk::Builder>([&stream](const uint8_t *data, size_t size, bool /*have_more*/) {
+    stream.insert(stream.end(), data, data + size);
+  });
+  builder->Save(batch.data(), batch.size());
+  builder->Finalize();
+  return stream;
+}
 }  // namespace
 
 Storage::ReplicationServer::ReplicationServer(Storage *storage, io::network::Endpoint endpoint,
@@ -113,21 +147,37 @@ void Storage::ReplicationServer::AppendDeltasHandler(slk::Reader *req_reader, sl
     storage_->wal_seq_num_ = req.seq_num;
   }
 
+  // The transactions of a compressed batch are decoded from the decompressed
+  // stream.
+  std::vector<uint8_t> batch;
+  std::optional<slk::Reader> batch_reader;
+  if (req.compressed) {
+    batch = ReadCompressedBatch(&decoder);
+    batch_reader.emplace(batch.data(), batch.size());
+  }
+  replication::Decoder batch_decoder(batch_reader ? &*batch_reader : req_reader);
+
   if (req.previous_commit_timestamp != storage_->last_commit_timestamp_.load()) {
     // Empty the stream
-    bool transaction_complete = false;
-    while (!transaction_complete) {
-      SPDLOG_INFO("Skipping delta");
-      const auto [timestamp, delta] = ReadDelta(&decoder);
-      transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.type);
+    for (uint64_t i = 0; i < req.transaction_count; ++i) {
+      bool transaction_complete = false;
+      while (!transaction_complete) {
+        SPDLOG_INFO("Skipping delta");
+        const auto [timestamp, delta] = ReadDelta(&batch_decoder);
+        transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.type);
+      }
     }
+    if (batch_reader) batch_reader->Finalize();
 
     replication::AppendDeltasRes res{false, storage_->last_commit_timestamp_.load()};
     slk::Save(res, res_builder);
     return;
   }
 
-  ReadAndApplyDelta(&decoder);
+  for (uint64_t i = 0; i < req.transaction_count; ++i) {
+    ReadAndApplyDelta(&batch_decoder);
+  }
+  if (batch_reader) batch_reader->Finalize();
 
   replication::AppendDeltasRes res{true, storage_->last_commit_timestamp_.load()};
   slk::Save(res, res_builder);
@@ -154,11 +204,16 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
   storage_->indices_.label_index = LabelIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
   storage_->indices_.label_property_index =
       LabelPropertyIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
+  storage_->indices_.label_property_composite_index.Clear();
+  storage_->indices_.label_property_hash_index.Clear();
+  storage_->indices_.property_columns.Clear();
+  storage_->indices_.edge_type_index.Clear();
+  storage_->indices_.edge_type_property_index.Clear();
   try {
     spdlog::debug("Loading snapshot");
     auto recovered_snapshot = durability::LoadSnapshot(*maybe_snapshot_path, &storage_->vertices_, &storage_->edges_,
                                                        &storage_->epoch_history_, &storage_->name_id_mapper_,
-                                                       &storage_->edge_count_, storage_->config_.items);
+                                                       &storage_->edge_count_, storage_->config_);
     spdlog::debug("Snapshot loaded successfully");
     // If this step is present it should always be the first step of
     // the recovery so we use the UUID we read from snasphost
@@ -167,7 +222,7 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
     const auto &recovery_info = recovered_snapshot.recovery_info;
     storage_->vertex_id_ = recovery_info.next_vertex_id;
     storage_->edge_id_ = recovery_info.next_edge_id;
-    storage_->timestamp_ = std::max(storage_->timestamp_, recovery_info.next_timestamp);
+    storage_->AdvanceTimestamp(recovery_info.next_timestamp);
 
     durability::RecoverIndicesAndConstraints(recovered_snapshot.indices_constraints, &storage_->indices_,
                                              &storage_->constraints_, &storage_->vertices_);
@@ -550,12 +605,112 @@ uint64_t Storage::ReplicationServer::ReadAndApplyDelta(durability::BaseDecoder *
         if (ret != UniqueConstraints::DeletionStatus::SUCCESS) throw utils::BasicException("Invalid transaction!");
         break;
       }
+      case durability::WalDeltaData::Type::LABEL_PROPERTIES_INDEX_CREATE: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_property_list.properties);
+        spdlog::trace("       Create composite index on :{} ({})", delta.operation_label_property_list.label, ss.str());
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          properties.push_back(storage_->NameToProperty(prop));
+        }
+        if (!storage_->CreateCompositeIndex(storage_->NameToLabel(delta.operation_label_property_list.label),
+                                            properties, timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::LABEL_PROPERTIES_INDEX_DROP: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_property_list.properties);
+        spdlog::trace("       Drop composite index on :{} ({})", delta.operation_label_property_list.label, ss.str());
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          properties.push_back(storage_->NameToProperty(prop));
+        }
+        if (!storage_->DropCompositeIndex(storage_->NameToLabel(delta.operation_label_property_list.label), properties,
+                                          timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::PROPERTY_COLUMNS_CREATE: {
+        spdlog::trace("       Create property columns on :{}", delta.operation_label_property_columns.label);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        PropertyColumns::Schema schema;
+        for (const auto &[prop, type] : delta.operation_label_property_columns.properties) {
+          schema.emplace_back(storage_->NameToProperty(prop), type);
+        }
+        if (!storage_->CreatePropertyColumns(storage_->NameToLabel(delta.operation_label_property_columns.label),
+                                             schema, timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::PROPERTY_COLUMNS_DROP: {
+        spdlog::trace("       Drop property columns on :{}", delta.operation_label.label);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->DropPropertyColumns(storage_->NameToLabel(delta.operation_label.label), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE: {
+        spdlog::trace("       Create hash index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->CreateHashIndex(storage_->NameToLabel(delta.operation_label_property.label),
+                                       storage_->NameToProperty(delta.operation_label_property.property), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_DROP: {
+        spdlog::trace("       Drop hash index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->DropHashIndex(storage_->NameToLabel(delta.operation_label_property.label),
+                                     storage_->NameToProperty(delta.operation_label_property.property), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_INDEX_CREATE: {
+        spdlog::trace("       Create edge index on :{}", delta.operation_edge_type.edge_type);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->CreateEdgeIndex(storage_->NameToEdgeType(delta.operation_edge_type.edge_type), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_INDEX_DROP: {
+        spdlog::trace("       Drop edge index on :{}", delta.operation_edge_type.edge_type);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->DropEdgeIndex(storage_->NameToEdgeType(delta.operation_edge_type.edge_type), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE: {
+        spdlog::trace("       Create edge index on :{}({})", delta.operation_edge_type_property.edge_type,
+                      delta.operation_edge_type_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->CreateEdgeIndex(storage_->NameToEdgeType(delta.operation_edge_type_property.edge_type),
+                                       storage_->NameToProperty(delta.operation_edge_type_property.property),
+                                       timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
+        spdlog::trace("       Drop edge index on :{}({})", delta.operation_edge_type_property.edge_type,
+                      delta.operation_edge_type_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->DropEdgeIndex(storage_->NameToEdgeType(delta.operation_edge_type_property.edge_type),
+                                     storage_->NameToProperty(delta.operation_edge_type_property.property),
+                                     timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
     }
   }
 
   if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid data!");
 
   storage_->last_commit_timestamp_ = max_commit_timestamp;
+  storage_->NotifyCommitTimestampWaiters();
 
   return applied_deltas;
 }
@@ -67,6 +67,9 @@ class Decoder final : public durability::BaseDecoder {
 
   bool SkipPropertyValue() override;
 
+  /// Read raw data written with `Encoder::WriteBuffer`.
+  void ReadBuffer(uint8_t *buffer, size_t buffer_size);
+
   /// Read the file and save it inside the specified directory.
   /// @param directory Directory which will contain the read file.
   /// @param suffix Suffix to be added to the received file's filename.
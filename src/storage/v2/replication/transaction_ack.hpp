@@ -0,0 +1,44 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <optional>
+#include <utility>
+
+namespace memgraph::storage::replication {
+
+/// Acknowledgement of a transaction that was queued for a SYNC replica. It
+/// becomes ready when the batch containing the transaction is applied on the
+/// replica or when its replication fails.
+class TransactionAck {
+ public:
+  TransactionAck(std::shared_future<void> applied, std::optional<std::chrono::steady_clock::time_point> deadline)
+      : applied_(std::move(applied)), deadline_(deadline) {}
+
+  /// Blocks until the acknowledgement is ready or until the deadline of the
+  /// replica passes.
+  void Wait() const {
+    if (deadline_) {
+      applied_.wait_until(*deadline_);
+    } else {
+      applied_.wait();
+    }
+  }
+
+ private:
+  std::shared_future<void> applied_;
+  std::optional<std::chrono::steady_clock::time_point> deadline_;
+};
+
+}  // namespace memgraph::storage::replication
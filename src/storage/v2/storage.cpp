@@ -12,8 +12,16 @@
 #include "storage/v2/storage.hpp"
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <random>
+#include <set>
+#include <thread>
 #include <variant>
 
 #include <gflags/gflags.h>
@@ -30,6 +38,7 @@
 #include "storage/v2/replication/config.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex_accessor.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/file.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
@@ -44,6 +53,13 @@
 #include "storage/v2/replication/replication_server.hpp"
 #include "storage/v2/replication/rpc.hpp"
 
+namespace EventCounter {
+extern const Event GcUnlinkedTransactions;
+extern const Event GcUnlinkBudgetExceeded;
+extern const Event GcRemovedVertices;
+extern const Event GcRemovedEdges;
+}  // namespace EventCounter
+
 namespace memgraph::storage {
 
 using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
@@ -53,9 +69,11 @@ namespace {
 }  // namespace
 
 auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipList<Vertex>::Iterator end,
-                            std::optional<VertexAccessor> *vertex, Transaction *tx, View view, Indices *indices,
-                            Constraints *constraints, Config::Items config) {
+                            const std::optional<Gid> &upper_gid, std::optional<VertexAccessor> *vertex,
+                            Transaction *tx, View view, Indices *indices, Constraints *constraints,
+                            Config::Items config) {
   while (it != end) {
+    if (upper_gid && it->gid >= *upper_gid) return end;
     *vertex = VertexAccessor::Create(&*it, tx, indices, constraints, config, view);
     if (!*vertex) {
       ++it;
@@ -68,15 +86,17 @@ auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipLis
 
 AllVerticesIterable::Iterator::Iterator(AllVerticesIterable *self, utils::SkipList<Vertex>::Iterator it)
     : self_(self),
-      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), &self->vertex_, self->transaction_, self->view_,
-                                 self->indices_, self_->constraints_, self->config_)) {}
+      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), self->upper_gid_, &self->vertex_,
+                                 self->transaction_, self->view_, self->indices_, self_->constraints_,
+                                 self->config_)) {}
 
 VertexAccessor AllVerticesIterable::Iterator::operator*() const { return *self_->vertex_; }
 
 AllVerticesIterable::Iterator &AllVerticesIterable::Iterator::operator++() {
   ++it_;
-  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), &self_->vertex_, self_->transaction_, self_->view_,
-                               self_->indices_, self_->constraints_, self_->config_);
+  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), self_->upper_gid_, &self_->vertex_,
+                               self_->transaction_, self_->view_, self_->indices_, self_->constraints_,
+                               self_->config_);
   return *this;
 }
 
@@ -92,6 +112,19 @@ VerticesIterable::VerticesIterable(LabelPropertyIndex::Iterable vertices) : type
   new (&vertices_by_label_property_) LabelPropertyIndex::Iterable(std::move(vertices));
 }
 
+VerticesIterable::VerticesIterable(LabelPropertyCompositeIndex::Iterable vertices)
+    : type_(Type::BY_LABEL_PROPERTY_COMPOSITE) {
+  new (&vertices_by_label_property_composite_) LabelPropertyCompositeIndex::Iterable(std::move(vertices));
+}
+
+VerticesIterable::VerticesIterable(LabelPropertyHashIndex::Iterable vertices) : type_(Type::BY_LABEL_PROPERTY_HASH) {
+  new (&vertices_by_label_property_hash_) LabelPropertyHashIndex::Iterable(std::move(vertices));
+}
+
+VerticesIterable::VerticesIterable(PropertyColumns::Iterable vertices) : type_(Type::BY_LABEL_PROPERTY_COLUMN) {
+  new (&vertices_by_property_column_) PropertyColumns::Iterable(std::move(vertices));
+}
+
 VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
@@ -103,6 +136,17 @@ VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(ot
     case Type::BY_LABEL_PROPERTY:
       new (&vertices_by_label_property_) LabelPropertyIndex::Iterable(std::move(other.vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&vertices_by_label_property_composite_)
+          LabelPropertyCompositeIndex::Iterable(std::move(other.vertices_by_label_property_composite_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      new (&vertices_by_label_property_hash_)
+          LabelPropertyHashIndex::Iterable(std::move(other.vertices_by_label_property_hash_));
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      new (&vertices_by_property_column_) PropertyColumns::Iterable(std::move(other.vertices_by_property_column_));
+      break;
   }
 }
 
@@ -117,6 +161,15 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
     case Type::BY_LABEL_PROPERTY:
       vertices_by_label_property_.LabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      vertices_by_label_property_composite_.LabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      vertices_by_label_property_hash_.LabelPropertyHashIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      vertices_by_property_column_.PropertyColumns::Iterable::~Iterable();
+      break;
   }
   type_ = other.type_;
   switch (other.type_) {
@@ -129,6 +182,17 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
     case Type::BY_LABEL_PROPERTY:
       new (&vertices_by_label_property_) LabelPropertyIndex::Iterable(std::move(other.vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&vertices_by_label_property_composite_)
+          LabelPropertyCompositeIndex::Iterable(std::move(other.vertices_by_label_property_composite_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      new (&vertices_by_label_property_hash_)
+          LabelPropertyHashIndex::Iterable(std::move(other.vertices_by_label_property_hash_));
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      new (&vertices_by_property_column_) PropertyColumns::Iterable(std::move(other.vertices_by_property_column_));
+      break;
   }
   return *this;
 }
@@ -144,6 +208,15 @@ VerticesIterable::~VerticesIterable() {
     case Type::BY_LABEL_PROPERTY:
       vertices_by_label_property_.LabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      vertices_by_label_property_composite_.LabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      vertices_by_label_property_hash_.LabelPropertyHashIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      vertices_by_property_column_.PropertyColumns::Iterable::~Iterable();
+      break;
   }
 }
 
@@ -155,6 +228,12 @@ VerticesIterable::Iterator VerticesIterable::begin() {
       return Iterator(vertices_by_label_.begin());
     case Type::BY_LABEL_PROPERTY:
       return Iterator(vertices_by_label_property_.begin());
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return Iterator(vertices_by_label_property_composite_.begin());
+    case Type::BY_LABEL_PROPERTY_HASH:
+      return Iterator(vertices_by_label_property_hash_.begin());
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      return Iterator(vertices_by_property_column_.begin());
   }
 }
 
@@ -166,6 +245,12 @@ VerticesIterable::Iterator VerticesIterable::end() {
       return Iterator(vertices_by_label_.end());
     case Type::BY_LABEL_PROPERTY:
       return Iterator(vertices_by_label_property_.end());
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return Iterator(vertices_by_label_property_composite_.end());
+    case Type::BY_LABEL_PROPERTY_HASH:
+      return Iterator(vertices_by_label_property_hash_.end());
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      return Iterator(vertices_by_property_column_.end());
   }
 }
 
@@ -181,6 +266,20 @@ VerticesIterable::Iterator::Iterator(LabelPropertyIndex::Iterable::Iterator it)
   new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(std::move(it));
 }
 
+VerticesIterable::Iterator::Iterator(LabelPropertyCompositeIndex::Iterable::Iterator it)
+    : type_(Type::BY_LABEL_PROPERTY_COMPOSITE) {
+  new (&by_label_property_composite_it_) LabelPropertyCompositeIndex::Iterable::Iterator(std::move(it));
+}
+
+VerticesIterable::Iterator::Iterator(LabelPropertyHashIndex::Iterable::Iterator it)
+    : type_(Type::BY_LABEL_PROPERTY_HASH) {
+  new (&by_label_property_hash_it_) LabelPropertyHashIndex::Iterable::Iterator(std::move(it));
+}
+
+VerticesIterable::Iterator::Iterator(PropertyColumns::Iterable::Iterator it) : type_(Type::BY_LABEL_PROPERTY_COLUMN) {
+  new (&by_property_column_it_) PropertyColumns::Iterable::Iterator(std::move(it));
+}
+
 VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
@@ -192,6 +291,17 @@ VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) :
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(other.by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(other.by_label_property_composite_it_);
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      new (&by_label_property_hash_it_)
+          LabelPropertyHashIndex::Iterable::Iterator(other.by_label_property_hash_it_);
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      new (&by_property_column_it_) PropertyColumns::Iterable::Iterator(other.by_property_column_it_);
+      break;
   }
 }
 
@@ -208,6 +318,17 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(const Vertices
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(other.by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(other.by_label_property_composite_it_);
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      new (&by_label_property_hash_it_)
+          LabelPropertyHashIndex::Iterable::Iterator(other.by_label_property_hash_it_);
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      new (&by_property_column_it_) PropertyColumns::Iterable::Iterator(other.by_property_column_it_);
+      break;
   }
   return *this;
 }
@@ -223,6 +344,17 @@ VerticesIterable::Iterator::Iterator(VerticesIterable::Iterator &&other) noexcep
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(std::move(other.by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(std::move(other.by_label_property_composite_it_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      new (&by_label_property_hash_it_)
+          LabelPropertyHashIndex::Iterable::Iterator(std::move(other.by_label_property_hash_it_));
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      new (&by_property_column_it_) PropertyColumns::Iterable::Iterator(std::move(other.by_property_column_it_));
+      break;
   }
 }
 
@@ -239,6 +371,17 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(VerticesIterab
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(std::move(other.by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(std::move(other.by_label_property_composite_it_));
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      new (&by_label_property_hash_it_)
+          LabelPropertyHashIndex::Iterable::Iterator(std::move(other.by_label_property_hash_it_));
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      new (&by_property_column_it_) PropertyColumns::Iterable::Iterator(std::move(other.by_property_column_it_));
+      break;
   }
   return *this;
 }
@@ -256,6 +399,15 @@ void VerticesIterable::Iterator::Destroy() noexcept {
     case Type::BY_LABEL_PROPERTY:
       by_label_property_it_.LabelPropertyIndex::Iterable::Iterator::~Iterator();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      by_label_property_composite_it_.LabelPropertyCompositeIndex::Iterable::Iterator::~Iterator();
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      by_label_property_hash_it_.LabelPropertyHashIndex::Iterable::Iterator::~Iterator();
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      by_property_column_it_.PropertyColumns::Iterable::Iterator::~Iterator();
+      break;
   }
 }
 
@@ -267,6 +419,12 @@ VertexAccessor VerticesIterable::Iterator::operator*() const {
       return *by_label_it_;
     case Type::BY_LABEL_PROPERTY:
       return *by_label_property_it_;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return *by_label_property_composite_it_;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      return *by_label_property_hash_it_;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      return *by_property_column_it_;
   }
 }
 
@@ -281,6 +439,15 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator++() {
     case Type::BY_LABEL_PROPERTY:
       ++by_label_property_it_;
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      ++by_label_property_composite_it_;
+      break;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      ++by_label_property_hash_it_;
+      break;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      ++by_property_column_it_;
+      break;
   }
   return *this;
 }
@@ -293,6 +460,186 @@ bool VerticesIterable::Iterator::operator==(const Iterator &other) const {
       return by_label_it_ == other.by_label_it_;
     case Type::BY_LABEL_PROPERTY:
       return by_label_property_it_ == other.by_label_property_it_;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return by_label_property_composite_it_ == other.by_label_property_composite_it_;
+    case Type::BY_LABEL_PROPERTY_HASH:
+      return by_label_property_hash_it_ == other.by_label_property_hash_it_;
+    case Type::BY_LABEL_PROPERTY_COLUMN:
+      return by_property_column_it_ == other.by_property_column_it_;
+  }
+}
+
+EdgesIterable::EdgesIterable(EdgeTypeIndex::Iterable edges) : type_(Type::BY_EDGE_TYPE) {
+  new (&edges_by_edge_type_) EdgeTypeIndex::Iterable(std::move(edges));
+}
+
+EdgesIterable::EdgesIterable(EdgeTypePropertyIndex::Iterable edges) : type_(Type::BY_EDGE_TYPE_PROPERTY) {
+  new (&edges_by_edge_type_property_) EdgeTypePropertyIndex::Iterable(std::move(edges));
+}
+
+EdgesIterable::EdgesIterable(EdgesIterable &&other) noexcept : type_(other.type_) {
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&edges_by_edge_type_) EdgeTypeIndex::Iterable(std::move(other.edges_by_edge_type_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&edges_by_edge_type_property_)
+          EdgeTypePropertyIndex::Iterable(std::move(other.edges_by_edge_type_property_));
+      break;
+  }
+}
+
+EdgesIterable &EdgesIterable::operator=(EdgesIterable &&other) noexcept {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      edges_by_edge_type_.EdgeTypeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      edges_by_edge_type_property_.EdgeTypePropertyIndex::Iterable::~Iterable();
+      break;
+  }
+  type_ = other.type_;
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&edges_by_edge_type_) EdgeTypeIndex::Iterable(std::move(other.edges_by_edge_type_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&edges_by_edge_type_property_)
+          EdgeTypePropertyIndex::Iterable(std::move(other.edges_by_edge_type_property_));
+      break;
+  }
+  return *this;
+}
+
+EdgesIterable::~EdgesIterable() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      edges_by_edge_type_.EdgeTypeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      edges_by_edge_type_property_.EdgeTypePropertyIndex::Iterable::~Iterable();
+      break;
+  }
+}
+
+EdgesIterable::Iterator EdgesIterable::begin() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return Iterator(edges_by_edge_type_.begin());
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return Iterator(edges_by_edge_type_property_.begin());
+  }
+}
+
+EdgesIterable::Iterator EdgesIterable::end() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return Iterator(edges_by_edge_type_.end());
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return Iterator(edges_by_edge_type_property_.end());
+  }
+}
+
+EdgesIterable::Iterator::Iterator(EdgeTypeIndex::Iterable::Iterator it) : type_(Type::BY_EDGE_TYPE) {
+  new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(std::move(it));
+}
+
+EdgesIterable::Iterator::Iterator(EdgeTypePropertyIndex::Iterable::Iterator it) : type_(Type::BY_EDGE_TYPE_PROPERTY) {
+  new (&by_edge_type_property_it_) EdgeTypePropertyIndex::Iterable::Iterator(std::move(it));
+}
+
+EdgesIterable::Iterator::Iterator(const EdgesIterable::Iterator &other) : type_(other.type_) {
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(other.by_edge_type_it_);
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_) EdgeTypePropertyIndex::Iterable::Iterator(other.by_edge_type_property_it_);
+      break;
+  }
+}
+
+EdgesIterable::Iterator &EdgesIterable::Iterator::operator=(const EdgesIterable::Iterator &other) {
+  Destroy();
+  type_ = other.type_;
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(other.by_edge_type_it_);
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_) EdgeTypePropertyIndex::Iterable::Iterator(other.by_edge_type_property_it_);
+      break;
+  }
+  return *this;
+}
+
+EdgesIterable::Iterator::Iterator(EdgesIterable::Iterator &&other) noexcept : type_(other.type_) {
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(std::move(other.by_edge_type_it_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_)
+          EdgeTypePropertyIndex::Iterable::Iterator(std::move(other.by_edge_type_property_it_));
+      break;
+  }
+}
+
+EdgesIterable::Iterator &EdgesIterable::Iterator::operator=(EdgesIterable::Iterator &&other) noexcept {
+  Destroy();
+  type_ = other.type_;
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(std::move(other.by_edge_type_it_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_)
+          EdgeTypePropertyIndex::Iterable::Iterator(std::move(other.by_edge_type_property_it_));
+      break;
+  }
+  return *this;
+}
+
+EdgesIterable::Iterator::~Iterator() { Destroy(); }
+
+void EdgesIterable::Iterator::Destroy() noexcept {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      by_edge_type_it_.EdgeTypeIndex::Iterable::Iterator::~Iterator();
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      by_edge_type_property_it_.EdgeTypePropertyIndex::Iterable::Iterator::~Iterator();
+      break;
+  }
+}
+
+EdgeAccessor EdgesIterable::Iterator::operator*() const {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return *by_edge_type_it_;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return *by_edge_type_property_it_;
+  }
+}
+
+EdgesIterable::Iterator &EdgesIterable::Iterator::operator++() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      ++by_edge_type_it_;
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      ++by_edge_type_property_it_;
+      break;
+  }
+  return *this;
+}
+
+bool EdgesIterable::Iterator::operator==(const Iterator &other) const {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return by_edge_type_it_ == other.by_edge_type_it_;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return by_edge_type_property_it_ == other.by_edge_type_property_it_;
   }
 }
 
@@ -330,15 +677,17 @@ Storage::Storage(Config config)
               "storage directory, please stop it first before starting this "
               "process!",
               config_.durability.storage_directory);
+
+    durability::RemoveSnapshotBatchFiles(snapshot_directory_);
   }
   if (config_.durability.recover_on_startup) {
     auto info = durability::RecoverData(snapshot_directory_, wal_directory_, &uuid_, &epoch_id_, &epoch_history_,
                                         &vertices_, &edges_, &edge_count_, &name_id_mapper_, &indices_, &constraints_,
-                                        config_.items, &wal_seq_num_);
+                                        config_, &wal_seq_num_);
     if (info) {
       vertex_id_ = info->next_vertex_id;
       edge_id_ = info->next_edge_id;
-      timestamp_ = std::max(timestamp_, info->next_timestamp);
+      AdvanceTimestamp(info->next_timestamp);
       if (info->last_commit_timestamp) {
         last_commit_timestamp_ = *info->last_commit_timestamp;
       }
@@ -384,9 +733,16 @@ Storage::Storage(Config config)
       }
     });
   }
+  if (config_.gc.thread_count > 1) {
+    gc_pool_.emplace(config_.gc.thread_count - 1);
+  }
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->CollectGarbage<false>(); });
   }
+  if (config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL &&
+      config_.durability.wal_group_commit && config_.durability.wal_group_commit_visible_before_durable) {
+    wal_group_commit_.emplace([this] { SyncWalFile(); });
+  }
 
   if (timestamp_ == kTimestampInitialId) {
     commit_log_.emplace();
@@ -404,6 +760,7 @@ Storage::~Storage() {
     replication_server_.reset();
     replication_clients_.WithLock([&](auto &clients) { clients.clear(); });
   }
+  wal_group_commit_.reset();
   if (wal_file_) {
     wal_file_->FinalizeWal();
     wal_file_ = std::nullopt;
@@ -532,8 +889,8 @@ Result<std::optional<std::pair<VertexAccessor, std::vector<EdgeAccessor>>>> Stor
 
     if (vertex_ptr->deleted) return std::optional<ReturnType>{};
 
-    in_edges = vertex_ptr->in_edges;
-    out_edges = vertex_ptr->out_edges;
+    in_edges.assign(vertex_ptr->in_edges.begin(), vertex_ptr->in_edges.end());
+    out_edges.assign(vertex_ptr->out_edges.begin(), vertex_ptr->out_edges.end());
   }
 
   std::vector<EdgeAccessor> deleted_edges;
@@ -636,6 +993,8 @@ Result<EdgeAccessor> Storage::Accessor::CreateEdge(VertexAccessor *from, VertexA
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
   to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
 
+  UpdateOnEdgeCreation(&storage_->indices_, from_vertex, to_vertex, edge, edge_type, transaction_);
+
   // Increment edge count.
   storage_->edge_count_.fetch_add(1, std::memory_order_acq_rel);
 
@@ -704,6 +1063,8 @@ Result<EdgeAccessor> Storage::Accessor::CreateEdge(VertexAccessor *from, VertexA
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
   to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
 
+  UpdateOnEdgeCreation(&storage_->indices_, from_vertex, to_vertex, edge, edge_type, transaction_);
+
   // Increment edge count.
   storage_->edge_count_.fetch_add(1, std::memory_order_acq_rel);
 
@@ -755,15 +1116,11 @@ Result<std::optional<EdgeAccessor>> Storage::Accessor::DeleteEdge(EdgeAccessor *
 
   auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto erased = edges->erase(link);
     if (config_.properties_on_edges) {
-      MG_ASSERT(it != edges->end(), "Invalid database state!");
-    } else if (it == edges->end()) {
-      return false;
+      MG_ASSERT(erased, "Invalid database state!");
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
-    return true;
+    return erased;
   };
 
   auto op1 = delete_edge_from_storage(to_vertex, &from_vertex->out_edges);
@@ -848,9 +1205,27 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
     // Save these so we can mark them used in the commit log.
     uint64_t start_timestamp = transaction_.start_timestamp;
 
+    // LSN of the transaction in the WAL group commit, if its changes become
+    // visible before the WAL is durable and it has to wait for that.
+    std::optional<uint64_t> wal_lsn;
+
+    // Acknowledgements of the SYNC replicas the transaction was sent to.
+    std::vector<replication::TransactionAck> replica_acks;
+
     {
       std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
+      // Transactions starting after the commit timestamp is taken have to wait
+      // until the changes are visible, see `WaitForCommitBefore`.
+      storage_->committing_timestamp_.store(kCommitTimestampPending, std::memory_order_release);
       commit_timestamp_.emplace(storage_->CommitTimestamp(desired_commit_timestamp));
+      storage_->committing_timestamp_.store(*commit_timestamp_, std::memory_order_release);
+      // Clear it on every path that leaves the critical section without
+      // making the changes visible (constraint violation or an exception).
+      utils::OnScopeExit committing_timestamp_cleaner{[&] {
+        if (engine_guard.owns_lock()) {
+          storage_->committing_timestamp_.store(kNoCommitInProgress, std::memory_order_release);
+        }
+      }};
 
       // Before committing and validating vertices against unique constraints,
       // we have to update unique constraints with the vertices that are going
@@ -893,7 +1268,14 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
         // Replica can log only the write transaction received from Main
         // so the Wal files are consistent
         if (storage_->replication_role_ == ReplicationRole::MAIN || desired_commit_timestamp.has_value()) {
-          storage_->AppendToWal(transaction_, *commit_timestamp_);
+          replica_acks = storage_->AppendToWal(transaction_, *commit_timestamp_);
+          if (storage_->wal_group_commit_) wal_lsn = storage_->wal_group_commit_->Register();
+          // The SYNC replicas have to apply the transaction before it becomes
+          // visible, unless that was explicitly relaxed.
+          if (!storage_->config_.replication.visible_before_sync_ack) {
+            for (const auto &ack : replica_acks) ack.Wait();
+            replica_acks.clear();
+          }
         }
 
         // Take committed_transactions lock while holding the engine lock to
@@ -910,12 +1292,16 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
             // Update the last commit timestamp
             storage_->last_commit_timestamp_.store(*commit_timestamp_);
           }
+          storage_->committing_timestamp_.store(kNoCommitInProgress, std::memory_order_release);
           // Release engine lock because we don't have to hold it anymore
           // and emplace back could take a long time.
           engine_guard.unlock();
         });
 
         storage_->commit_log_->MarkFinished(start_timestamp);
+        if (storage_->replication_role_ == ReplicationRole::MAIN || desired_commit_timestamp.has_value()) {
+          storage_->NotifyCommitTimestampWaiters();
+        }
       }
     }
 
@@ -923,6 +1309,14 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
       Abort();
       return *unique_constraint_violation;
     }
+
+    // The engine lock is released by now, so the transactions committing in
+    // the meantime join the same WAL sync.
+    if (wal_lsn) storage_->wal_group_commit_->WaitDurable(*wal_lsn);
+    // With `visible_before_sync_ack`, the replicas also receive the
+    // transaction in batches together with the transactions committing in the
+    // meantime.
+    for (const auto &ack : replica_acks) ack.Wait();
   }
   is_transaction_active_ = false;
 
@@ -968,16 +1362,14 @@ void Storage::Accessor::Abort() {
             case Delta::Action::ADD_IN_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
-              MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
+              MG_ASSERT(!vertex->in_edges.contains(link), "Invalid database state!");
               vertex->in_edges.push_back(link);
               break;
             }
             case Delta::Action::ADD_OUT_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
-              MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
+              MG_ASSERT(!vertex->out_edges.contains(link), "Invalid database state!");
               vertex->out_edges.push_back(link);
               // Increment edge count. We only increment the count here because
               // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
@@ -989,19 +1381,15 @@ void Storage::Accessor::Abort() {
             case Delta::Action::REMOVE_IN_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
-              MG_ASSERT(it != vertex->in_edges.end(), "Invalid database state!");
-              std::swap(*it, *vertex->in_edges.rbegin());
-              vertex->in_edges.pop_back();
+              auto erased = vertex->in_edges.erase(link);
+              MG_ASSERT(erased, "Invalid database state!");
               break;
             }
             case Delta::Action::REMOVE_OUT_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
-              MG_ASSERT(it != vertex->out_edges.end(), "Invalid database state!");
-              std::swap(*it, *vertex->out_edges.rbegin());
-              vertex->out_edges.pop_back();
+              auto erased = vertex->out_edges.erase(link);
+              MG_ASSERT(erased, "Invalid database state!");
               // Decrement edge count. We only decrement the count here because
               // the information in `REMOVE_IN_EDGE` and `Edge/DELETE_OBJECT` is
               // redundant. Also, `Edge/DELETE_OBJECT` isn't available when edge
@@ -1025,6 +1413,9 @@ void Storage::Accessor::Abort() {
         if (current != nullptr) {
           current->prev.Set(vertex);
         }
+        // Undoing the deltas bypasses the index hooks so the property columns
+        // have to be brought back in sync with the `PropertyStore`.
+        storage_->indices_.property_columns.UpdateOnAbort(vertex);
 
         break;
       }
@@ -1104,6 +1495,165 @@ void Storage::Accessor::FinalizeTransaction() {
   }
 }
 
+Storage::BulkLoadAccessor::BulkLoadAccessor(Storage *storage)
+    : storage_(storage),
+      storage_guard_(storage_->main_lock_),
+      vertices_(storage_->vertices_.access()),
+      edges_(storage_->edges_.access()),
+      first_vertex_gid_(storage_->vertex_id_.load(std::memory_order_acquire)),
+      first_edge_gid_(storage_->edge_id_.load(std::memory_order_acquire)) {}
+
+Storage::BulkLoadAccessor::BulkLoadAccessor(BulkLoadAccessor &&other) noexcept
+    : storage_(other.storage_),
+      storage_guard_(std::move(other.storage_guard_)),
+      vertices_(std::move(other.vertices_)),
+      edges_(std::move(other.edges_)),
+      first_vertex_gid_(other.first_vertex_gid_),
+      first_edge_gid_(other.first_edge_gid_),
+      is_finished_(other.is_finished_) {
+  // Don't allow the other accessor to finish the load in destructor.
+  other.is_finished_ = true;
+}
+
+Storage::BulkLoadAccessor::~BulkLoadAccessor() {
+  if (!is_finished_) {
+    Finish();
+  }
+}
+
+Gid Storage::BulkLoadAccessor::CreateVertex(const std::vector<LabelId> &labels,
+                                            const std::map<PropertyId, PropertyValue> &properties) {
+  auto gid = ReserveVertexGids(1);
+  CreateVertex(gid, labels, properties);
+  return gid;
+}
+
+Gid Storage::BulkLoadAccessor::ReserveVertexGids(uint64_t count) {
+  return storage::Gid::FromUint(storage_->vertex_id_.fetch_add(count, std::memory_order_acq_rel));
+}
+
+void Storage::BulkLoadAccessor::CreateVertex(Gid gid, const std::vector<LabelId> &labels,
+                                             const std::map<PropertyId, PropertyValue> &properties) {
+  OOMExceptionEnabler oom_exception;
+  MG_ASSERT(!is_finished_, "The bulk load is already finished!");
+  MG_ASSERT(gid.AsUint() >= first_vertex_gid_ && gid.AsUint() < storage_->vertex_id_.load(std::memory_order_acquire),
+            "The vertex gid wasn't reserved by the bulk load!");
+  auto [it, inserted] = vertices_.insert(Vertex{gid, nullptr});
+  MG_ASSERT(inserted, "The vertex must be inserted here!");
+  MG_ASSERT(it != vertices_.end(), "Invalid Vertex accessor!");
+  it->labels = labels;
+  it->properties.InitProperties(properties);
+}
+
+Result<Gid> Storage::BulkLoadAccessor::CreateEdge(Gid from, Gid to, EdgeTypeId edge_type,
+                                                  const std::map<PropertyId, PropertyValue> &properties) {
+  OOMExceptionEnabler oom_exception;
+  MG_ASSERT(!is_finished_, "The bulk load is already finished!");
+  const auto properties_on_edges = storage_->config_.items.properties_on_edges;
+  if (!properties_on_edges && !properties.empty()) return Error::PROPERTIES_DISABLED;
+
+  auto from_it = vertices_.find(from);
+  if (from_it == vertices_.end() || from_it->deleted) return Error::NONEXISTENT_OBJECT;
+  auto to_it = vertices_.find(to);
+  if (to_it == vertices_.end() || to_it->deleted) return Error::NONEXISTENT_OBJECT;
+  auto *from_vertex = &*from_it;
+  auto *to_vertex = &*to_it;
+
+  auto gid = storage::Gid::FromUint(storage_->edge_id_.fetch_add(1, std::memory_order_acq_rel));
+  EdgeRef edge(gid);
+  if (properties_on_edges) {
+    auto [it, inserted] = edges_.insert(Edge(gid, nullptr));
+    MG_ASSERT(inserted, "The edge must be inserted here!");
+    MG_ASSERT(it != edges_.end(), "Invalid Edge accessor!");
+    it->properties.InitProperties(properties);
+    edge = EdgeRef(&*it);
+  }
+
+  {
+    // Other threads may be adding edges to the same vertices. Obtain the
+    // locks by `gid` order to avoid lock cycles.
+    std::unique_lock<utils::SpinLock> guard_from(from_vertex->lock, std::defer_lock);
+    std::unique_lock<utils::SpinLock> guard_to(to_vertex->lock, std::defer_lock);
+    if (from_vertex->gid < to_vertex->gid) {
+      guard_from.lock();
+      guard_to.lock();
+    } else if (from_vertex->gid > to_vertex->gid) {
+      guard_to.lock();
+      guard_from.lock();
+    } else {
+      // The vertices are the same vertex, only lock one.
+      guard_from.lock();
+    }
+    from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+    to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  }
+
+  // Increment edge count.
+  storage_->edge_count_.fetch_add(1, std::memory_order_acq_rel);
+
+  return gid;
+}
+
+void Storage::BulkLoadAccessor::Finish() {
+  MG_ASSERT(!is_finished_, "The bulk load is already finished!");
+  is_finished_ = true;
+
+  // The indices are updated in bulk at the end instead of on every change.
+  auto *indices = &storage_->indices_;
+  std::vector<Vertex *> loaded_vertices;
+  for (auto it = vertices_.find_equal_or_greater(Gid::FromUint(first_vertex_gid_)); it != vertices_.end(); ++it) {
+    loaded_vertices.push_back(&*it);
+  }
+  AddBulkLoadedVertices(indices, loaded_vertices);
+  loaded_vertices = {};
+
+  // Edges created by the load can also connect vertices that existed before,
+  // so they are found by scanning all adjacency lists, but only when there is
+  // an edge index to update.
+  if (!indices->edge_type_index.ListIndices().empty() || !indices->edge_type_property_index.ListIndices().empty()) {
+    const auto properties_on_edges = storage_->config_.items.properties_on_edges;
+    Transaction transaction(kTransactionInitialId, kTimestampInitialId, IsolationLevel::SNAPSHOT_ISOLATION);
+    for (auto &from_vertex : vertices_) {
+      for (const auto &[edge_type, to_vertex, edge] : from_vertex.out_edges) {
+        auto edge_gid = properties_on_edges ? edge.ptr->gid : edge.gid;
+        if (edge_gid.AsUint() < first_edge_gid_) continue;
+        UpdateOnEdgeCreation(indices, &from_vertex, to_vertex, edge, edge_type, transaction);
+        if (!properties_on_edges) continue;
+        for (const auto &[property, value] : edge.ptr->properties.Properties()) {
+          UpdateOnEdgeSetProperty(indices, property, value, &from_vertex, to_vertex, edge.ptr, edge_type,
+                                  transaction);
+        }
+      }
+    }
+  }
+  storage_guard_.unlock();
+
+  // Nothing that was loaded is in the WAL, so the data is durable only once a
+  // snapshot is created.
+  if (storage_->config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
+    if (storage_->CreateSnapshot().HasError()) {
+      spdlog::warn("The snapshot after the bulk load couldn't be created because the instance isn't MAIN anymore!");
+    }
+  }
+}
+
+utils::BasicResult<Storage::BulkLoadError, Storage::BulkLoadAccessor> Storage::BulkLoad() {
+  if (replication_role_.load() != ReplicationRole::MAIN) {
+    return BulkLoadError::DISABLED_FOR_REPLICA;
+  }
+  if (replication_clients_.WithLock([](const auto &clients) { return !clients.empty(); })) {
+    return BulkLoadError::REPLICAS_REGISTERED;
+  }
+  BulkLoadAccessor accessor{this};
+  // Constraints are only changed while holding the unique storage lock, so
+  // they can't be created until the load is finished.
+  if (!ListExistenceConstraints(constraints_).empty() || !constraints_.unique_constraints.ListConstraints().empty()) {
+    accessor.is_finished_ = true;
+    return BulkLoadError::CONSTRAINTS_EXIST;
+  }
+  return std::move(accessor);
+}
+
 const std::string &Storage::LabelToName(LabelId label) const { return name_id_mapper_.IdToName(label.AsUint()); }
 
 const std::string &Storage::PropertyToName(PropertyId property) const {
@@ -1131,6 +1681,7 @@ bool Storage::CreateIndex(LabelId label, const std::optional<uint64_t> desired_c
   AppendToWal(durability::StorageGlobalOperation::LABEL_INDEX_CREATE, label, {}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return true;
 }
 
@@ -1141,6 +1692,7 @@ bool Storage::CreateIndex(LabelId label, PropertyId property, const std::optiona
   AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE, label, {property}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return true;
 }
 
@@ -1151,6 +1703,7 @@ bool Storage::DropIndex(LabelId label, const std::optional<uint64_t> desired_com
   AppendToWal(durability::StorageGlobalOperation::LABEL_INDEX_DROP, label, {}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return true;
 }
 
@@ -1163,12 +1716,216 @@ bool Storage::DropIndex(LabelId label, PropertyId property, const std::optional<
   AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTY_INDEX_DROP, label, {property}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::CreateCompositeIndex(LabelId label, const std::vector<PropertyId> &properties,
+                                   const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_composite_index.CreateIndex(label, properties, vertices_.access())) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTIES_INDEX_CREATE, label, properties, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::DropCompositeIndex(LabelId label, const std::vector<PropertyId> &properties,
+                                 const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_composite_index.DropIndex(label, properties)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTIES_INDEX_DROP, label, properties, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::CreateHashIndex(LabelId label, PropertyId property,
+                              const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_hash_index.CreateIndex(label, property, vertices_.access())) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_CREATE, label, {property},
+              commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::DropHashIndex(LabelId label, PropertyId property,
+                            const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_hash_index.DropIndex(label, property)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_DROP, label, {property},
+              commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::CreateEdgeIndex(EdgeTypeId edge_type, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_index.CreateIndex(edge_type, vertices_.access())) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_INDEX_CREATE, edge_type, {}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::CreateEdgeIndex(EdgeTypeId edge_type, PropertyId property,
+                              const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_property_index.CreateIndex(edge_type, property, vertices_.access())) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_CREATE, edge_type, {property}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::DropEdgeIndex(EdgeTypeId edge_type, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_index.DropIndex(edge_type)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_INDEX_DROP, edge_type, {}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::DropEdgeIndex(EdgeTypeId edge_type, PropertyId property,
+                            const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_property_index.DropIndex(edge_type, property)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_DROP, edge_type, {property}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return true;
 }
 
 IndicesInfo Storage::ListAllIndices() const {
   std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
-  return {indices_.label_index.ListIndices(), indices_.label_property_index.ListIndices()};
+  return {indices_.label_index.ListIndices(),
+          indices_.label_property_index.ListIndices(),
+          indices_.label_property_composite_index.ListIndices(),
+          indices_.label_property_hash_index.ListIndices(),
+          indices_.edge_type_index.ListIndices(),
+          indices_.edge_type_property_index.ListIndices(),
+          indices_.property_columns.ListColumns()};
+}
+
+bool Storage::CreatePropertyColumns(LabelId label, const PropertyColumns::Schema &schema,
+                                    const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.property_columns.CreateColumns(label, schema, vertices_.access())) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendOperationToWal([&](auto &appender) {
+    appender.AppendOperation(durability::StorageGlobalOperation::PROPERTY_COLUMNS_CREATE, label, schema,
+                             commit_timestamp);
+  });
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+bool Storage::DropPropertyColumns(LabelId label, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.property_columns.DropColumns(label)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::PROPERTY_COLUMNS_DROP, label, {}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
+  return true;
+}
+
+std::shared_ptr<const GraphStatistics> Storage::AnalyzeGraph() {
+  auto statistics = std::make_shared<GraphStatistics>();
+  // Only a uniform sample of the values of every property is kept in memory,
+  // see `GraphStatistics::kPropertySampleSize`.
+  struct PropertySample {
+    uint64_t count{0};
+    std::vector<PropertyValue> values;
+  };
+  std::map<std::pair<LabelId, PropertyId>, PropertySample> property_samples;
+  std::mt19937_64 random_generator;
+  std::set<EdgeTypeId> edge_types;
+  {
+    auto acc = Access();
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      auto maybe_labels = vertex.Labels(View::OLD);
+      auto maybe_properties = vertex.Properties(View::OLD);
+      auto maybe_out_edges = vertex.OutEdges(View::OLD);
+      auto maybe_in_edges = vertex.InEdges(View::OLD);
+      if (maybe_labels.HasError() || maybe_properties.HasError() || maybe_out_edges.HasError() ||
+          maybe_in_edges.HasError()) {
+        continue;
+      }
+
+      ++statistics->vertex_count;
+      for (const auto &label : *maybe_labels) {
+        ++statistics->label_counts[label];
+        for (const auto &[property, value] : *maybe_properties) {
+          auto &sample = property_samples[{label, property}];
+          ++sample.count;
+          if (sample.values.size() < GraphStatistics::kPropertySampleSize) {
+            sample.values.push_back(value);
+            continue;
+          }
+          // Reservoir sampling, every value ends up in the sample with the
+          // same probability.
+          auto index = std::uniform_int_distribution<uint64_t>(0, sample.count - 1)(random_generator);
+          if (index < sample.values.size()) sample.values[index] = value;
+        }
+      }
+
+      // Every edge is counted once, when visiting its source vertex.
+      edge_types.clear();
+      for (const auto &edge : *maybe_out_edges) {
+        ++statistics->edge_count;
+        ++statistics->edge_types[edge.EdgeType()].count;
+        edge_types.insert(edge.EdgeType());
+      }
+      for (const auto &edge_type : edge_types) {
+        ++statistics->edge_types[edge_type].from_vertices;
+      }
+      edge_types.clear();
+      for (const auto &edge : *maybe_in_edges) {
+        edge_types.insert(edge.EdgeType());
+      }
+      for (const auto &edge_type : edge_types) {
+        ++statistics->edge_types[edge_type].to_vertices;
+      }
+    }
+    acc.Abort();
+  }
+
+  for (auto &[key, sample] : property_samples) {
+    statistics->label_properties.emplace(
+        key, GraphStatistics::MakePropertyStatistics(std::move(sample.values), sample.count));
+  }
+
+  std::shared_ptr<const GraphStatistics> result = std::move(statistics);
+  graph_statistics_.WithLock([&](auto &graph_statistics) { graph_statistics = result; });
+  return result;
+}
+
+void Storage::ClearGraphStatistics() {
+  graph_statistics_.WithLock([](auto &graph_statistics) { graph_statistics.reset(); });
 }
 
 utils::BasicResult<ConstraintViolation, bool> Storage::CreateExistenceConstraint(
@@ -1180,6 +1937,7 @@ utils::BasicResult<ConstraintViolation, bool> Storage::CreateExistenceConstraint
   AppendToWal(durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE, label, {property}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return true;
 }
 
@@ -1191,6 +1949,7 @@ bool Storage::DropExistenceConstraint(LabelId label, PropertyId property,
   AppendToWal(durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP, label, {property}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return true;
 }
 
@@ -1202,9 +1961,11 @@ utils::BasicResult<ConstraintViolation, UniqueConstraints::CreationStatus> Stora
     return ret;
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE, label, properties, commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE, label,
+              {properties.begin(), properties.end()}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return UniqueConstraints::CreationStatus::SUCCESS;
 }
 
@@ -1216,9 +1977,11 @@ UniqueConstraints::DeletionStatus Storage::DropUniqueConstraint(
     return ret;
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP, label, properties, commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP, label, {properties.begin(), properties.end()},
+              commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
+  NotifyCommitTimestampWaiters();
   return UniqueConstraints::DeletionStatus::SUCCESS;
 }
 
@@ -1238,17 +2001,39 @@ StorageInfo Storage::GetInfo() const {
           utils::GetDirDiskUsage(config_.durability.storage_directory)};
 }
 
+std::vector<Gid> Storage::Accessor::VerticesPartitionPoints(uint64_t max_partitions) {
+  auto acc = storage_->vertices_.access();
+  auto points = acc.partition_points(max_partitions);
+  std::vector<Gid> gids;
+  gids.reserve(points.size());
+  for (const auto &point : points) {
+    gids.push_back(point->gid);
+  }
+  return gids;
+}
+
 VerticesIterable Storage::Accessor::Vertices(LabelId label, View view) {
   return VerticesIterable(storage_->indices_.label_index.Vertices(label, view, &transaction_));
 }
 
 VerticesIterable Storage::Accessor::Vertices(LabelId label, PropertyId property, View view) {
+  if (!storage_->indices_.label_property_index.IndexExists(label, property)) {
+    return VerticesByPropertyColumn(label, property, std::nullopt, std::nullopt, view);
+  }
   return VerticesIterable(storage_->indices_.label_property_index.Vertices(label, property, std::nullopt, std::nullopt,
                                                                            view, &transaction_));
 }
 
 VerticesIterable Storage::Accessor::Vertices(LabelId label, PropertyId property, const PropertyValue &value,
                                              View view) {
+  if (storage_->indices_.label_property_hash_index.IndexExists(label, property)) {
+    return VerticesIterable(
+        storage_->indices_.label_property_hash_index.Vertices(label, property, value, view, &transaction_));
+  }
+  if (!storage_->indices_.label_property_index.IndexExists(label, property)) {
+    return VerticesByPropertyColumn(label, property, utils::MakeBoundInclusive(value), utils::MakeBoundInclusive(value),
+                                    view);
+  }
   return VerticesIterable(storage_->indices_.label_property_index.Vertices(
       label, property, utils::MakeBoundInclusive(value), utils::MakeBoundInclusive(value), view, &transaction_));
 }
@@ -1256,34 +2041,174 @@ VerticesIterable Storage::Accessor::Vertices(LabelId label, PropertyId property,
 VerticesIterable Storage::Accessor::Vertices(LabelId label, PropertyId property,
                                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  if (!storage_->indices_.label_property_index.IndexExists(label, property)) {
+    return VerticesByPropertyColumn(label, property, lower_bound, upper_bound, view);
+  }
   return VerticesIterable(
       storage_->indices_.label_property_index.Vertices(label, property, lower_bound, upper_bound, view, &transaction_));
 }
 
+VerticesIterable Storage::Accessor::Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                                             const std::vector<PropertyValue> &prefix,
+                                             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  return VerticesIterable(storage_->indices_.label_property_composite_index.Vertices(
+      label, properties, prefix, lower_bound, upper_bound, view, &transaction_));
+}
+
+EdgesIterable Storage::Accessor::Edges(EdgeTypeId edge_type, View view) {
+  return EdgesIterable(storage_->indices_.edge_type_index.Edges(edge_type, view, &transaction_));
+}
+
+EdgesIterable Storage::Accessor::Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value,
+                                       View view) {
+  return EdgesIterable(storage_->indices_.edge_type_property_index.Edges(
+      edge_type, property, utils::MakeBoundInclusive(value), utils::MakeBoundInclusive(value), view, &transaction_));
+}
+
+EdgesIterable Storage::Accessor::Edges(EdgeTypeId edge_type, PropertyId property,
+                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  return EdgesIterable(storage_->indices_.edge_type_property_index.Edges(edge_type, property, lower_bound,
+                                                                         upper_bound, view, &transaction_));
+}
+
+VerticesIterable Storage::Accessor::VerticesByPropertyColumn(
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  return VerticesIterable(
+      storage_->indices_.property_columns.Vertices(label, property, lower_bound, upper_bound, view, &transaction_));
+}
+
 Transaction Storage::CreateTransaction(IsolationLevel isolation_level) {
-  // We acquire the transaction engine lock here because we access (and
-  // modify) the transaction engine variables (`transaction_id` and
-  // `timestamp`) below.
-  uint64_t transaction_id;
+  auto transaction_id = transaction_id_.fetch_add(1, std::memory_order_acq_rel);
   uint64_t start_timestamp;
-  {
-    std::lock_guard<utils::SpinLock> guard(engine_lock_);
-    transaction_id = transaction_id_++;
-    // Replica should have only read queries and the write queries
-    // can come from main instance with any past timestamp.
-    // To preserve snapshot isolation we set the start timestamp
-    // of any query on replica to the last commited transaction
-    // which is timestamp_ as only commit of transaction with writes
-    // can change the value of it.
-    if (replication_role_ == ReplicationRole::REPLICA) {
-      start_timestamp = timestamp_;
-    } else {
-      start_timestamp = timestamp_++;
-    }
+  // Replica should have only read queries and the write queries
+  // can come from main instance with any past timestamp.
+  // To preserve snapshot isolation we set the start timestamp
+  // of any query on replica to the last commited transaction
+  // which is timestamp_ as only commit of transaction with writes
+  // can change the value of it.
+  if (replication_role_ == ReplicationRole::REPLICA) {
+    start_timestamp = timestamp_.load(std::memory_order_acquire);
+  } else {
+    start_timestamp = timestamp_.fetch_add(1, std::memory_order_acq_rel);
   }
+  WaitForCommitBefore(start_timestamp);
   return {transaction_id, start_timestamp, isolation_level};
 }
 
+void Storage::UnlinkDeltas(Transaction *transaction, std::list<Gid> *deleted_vertices, std::list<Gid> *deleted_edges) {
+  auto commit_timestamp = transaction->commit_timestamp->load(std::memory_order_acquire);
+
+  // When unlinking a delta which is the first delta in its version chain,
+  // special care has to be taken to avoid the following race condition:
+  //
+  // [Vertex] --> [Delta A]
+  //
+  //    GC thread: Delta A is the first in its chain, it must be unlinked from
+  //               vertex and marked for deletion
+  //    TX thread: Update vertex and add Delta B with Delta A as next
+  //
+  // [Vertex] --> [Delta B] <--> [Delta A]
+  //
+  //    GC thread: Unlink delta from Vertex
+  //
+  // [Vertex] --> (nullptr)
+  //
+  // When processing a delta that is the first one in its chain, we
+  // obtain the corresponding vertex or edge lock, and then verify that this
+  // delta still is the first in its chain.
+  // When processing a delta that is in the middle of the chain we only
+  // process the final delta of the given transaction in that chain. We
+  // determine the owner of the chain (either a vertex or an edge), obtain the
+  // corresponding lock, and then verify that this delta is still in the same
+  // position as it was before taking the lock.
+  //
+  // Even though the delta chain is lock-free (both `next` and `prev`) the
+  // chain should not be modified without taking the lock from the object that
+  // owns the chain (either a vertex or an edge). Modifying the chain without
+  // taking the lock will cause subtle race conditions that will leave the
+  // chain in a broken state.
+  // The chain can be only read without taking any locks.
+
+  for (Delta &delta : transaction->deltas) {
+    while (true) {
+      auto prev = delta.prev.Get();
+      switch (prev.type) {
+        case PreviousPtr::Type::VERTEX: {
+          Vertex *vertex = prev.vertex;
+          std::lock_guard<utils::SpinLock> vertex_guard(vertex->lock);
+          if (vertex->delta != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
+          }
+          vertex->delta = nullptr;
+          if (vertex->deleted) {
+            deleted_vertices->push_back(vertex->gid);
+          }
+          break;
+        }
+        case PreviousPtr::Type::EDGE: {
+          Edge *edge = prev.edge;
+          std::lock_guard<utils::SpinLock> edge_guard(edge->lock);
+          if (edge->delta != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
+          }
+          edge->delta = nullptr;
+          if (edge->deleted) {
+            deleted_edges->push_back(edge->gid);
+          }
+          break;
+        }
+        case PreviousPtr::Type::DELTA: {
+          if (prev.delta->timestamp->load(std::memory_order_acquire) == commit_timestamp) {
+            // The delta that is newer than this one is also a delta from this
+            // transaction. We skip the current delta and will remove it as a
+            // part of the suffix later.
+            break;
+          }
+          std::unique_lock<utils::SpinLock> guard;
+          {
+            // We need to find the parent object in order to be able to use
+            // its lock.
+            auto parent = prev;
+            while (parent.type == PreviousPtr::Type::DELTA) {
+              parent = parent.delta->prev.Get();
+            }
+            switch (parent.type) {
+              case PreviousPtr::Type::VERTEX:
+                guard = std::unique_lock<utils::SpinLock>(parent.vertex->lock);
+                break;
+              case PreviousPtr::Type::EDGE:
+                guard = std::unique_lock<utils::SpinLock>(parent.edge->lock);
+                break;
+              case PreviousPtr::Type::DELTA:
+              case PreviousPtr::Type::NULLPTR:
+                LOG_FATAL("Invalid database state!");
+            }
+          }
+          if (delta.prev.Get() != prev) {
+            // Something changed, we could now be the first delta in the
+            // chain.
+            continue;
+          }
+          Delta *prev_delta = prev.delta;
+          prev_delta->next.store(nullptr, std::memory_order_release);
+          break;
+        }
+        case PreviousPtr::Type::NULLPTR: {
+          LOG_FATAL("Invalid pointer!");
+        }
+      }
+      break;
+    }
+  }
+}
+
 template <bool force>
 void Storage::CollectGarbage() {
   if constexpr (force) {
@@ -1324,7 +2249,7 @@ void Storage::CollectGarbage() {
   // We don't move undo buffers of unlinked transactions to garbage_undo_buffers
   // list immediately, because we would have to repeatedly take
   // garbage_undo_buffers lock.
-  std::list<std::pair<uint64_t, std::list<Delta>>> unlinked_undo_buffers;
+  std::list<std::pair<uint64_t, DeltaBuffer>> unlinked_undo_buffers;
 
   // We will only free vertices deleted up until now in this GC cycle, and we
   // will do it after cleaning-up the indices. That way we are sure that all
@@ -1340,145 +2265,78 @@ void Storage::CollectGarbage() {
   // eliminates high CPU usage when the GC doesn't have to clean up anything.
   bool run_index_cleanup = !committed_transactions_->empty() || !garbage_undo_buffers_->empty();
 
-  while (true) {
-    // We don't want to hold the lock on commited transactions for too long,
-    // because that prevents other transactions from committing.
-    Transaction *transaction;
-    {
-      auto committed_transactions_ptr = committed_transactions_.Lock();
-      if (committed_transactions_ptr->empty()) {
-        break;
-      }
-      transaction = &committed_transactions_ptr->front();
-    }
-
-    auto commit_timestamp = transaction->commit_timestamp->load(std::memory_order_acquire);
-    if (commit_timestamp >= oldest_active_start_timestamp) {
-      break;
+  // Phase 1: unlink the undo buffers of the transactions that can't be seen
+  // by any active transaction anymore. We only take the committed
+  // transactions lock to collect the transactions and to pop them, because
+  // holding it prevents other transactions from committing. The undo buffers
+  // of different transactions are unlinked independently of each other
+  // because every change of a version chain is done under the lock of its
+  // owner.
+  std::vector<Transaction *> transactions;
+  committed_transactions_.WithLock([&](auto &committed_transactions) {
+    for (auto &transaction : committed_transactions) {
+      if (transaction.commit_timestamp->load(std::memory_order_acquire) >= oldest_active_start_timestamp) break;
+      transactions.push_back(&transaction);
     }
+  });
 
-    // When unlinking a delta which is the first delta in its version chain,
-    // special care has to be taken to avoid the following race condition:
-    //
-    // [Vertex] --> [Delta A]
-    //
-    //    GC thread: Delta A is the first in its chain, it must be unlinked from
-    //               vertex and marked for deletion
-    //    TX thread: Update vertex and add Delta B with Delta A as next
-    //
-    // [Vertex] --> [Delta B] <--> [Delta A]
-    //
-    //    GC thread: Unlink delta from Vertex
-    //
-    // [Vertex] --> (nullptr)
-    //
-    // When processing a delta that is the first one in its chain, we
-    // obtain the corresponding vertex or edge lock, and then verify that this
-    // delta still is the first in its chain.
-    // When processing a delta that is in the middle of the chain we only
-    // process the final delta of the given transaction in that chain. We
-    // determine the owner of the chain (either a vertex or an edge), obtain the
-    // corresponding lock, and then verify that this delta is still in the same
-    // position as it was before taking the lock.
-    //
-    // Even though the delta chain is lock-free (both `next` and `prev`) the
-    // chain should not be modified without taking the lock from the object that
-    // owns the chain (either a vertex or an edge). Modifying the chain without
-    // taking the lock will cause subtle race conditions that will leave the
-    // chain in a broken state.
-    // The chain can be only read without taking any locks.
-
-    for (Delta &delta : transaction->deltas) {
+  const auto unlink_start = std::chrono::steady_clock::now();
+  const auto unlink_time_budget = config_.gc.unlink_time_budget;
+  const auto thread_count = std::max<uint64_t>(1, std::min<uint64_t>(config_.gc.thread_count, transactions.size()));
+  std::atomic<uint64_t> next_transaction{0};
+  std::atomic<bool> budget_exceeded{false};
+  std::vector<std::list<Gid>> deleted_vertices(thread_count);
+  std::vector<std::list<Gid>> deleted_edges(thread_count);
+  std::vector<std::function<void()>> unlink_tasks;
+  unlink_tasks.reserve(thread_count);
+  for (uint64_t i = 0; i < thread_count; ++i) {
+    unlink_tasks.emplace_back([&, i] {
       while (true) {
-        auto prev = delta.prev.Get();
-        switch (prev.type) {
-          case PreviousPtr::Type::VERTEX: {
-            Vertex *vertex = prev.vertex;
-            std::lock_guard<utils::SpinLock> vertex_guard(vertex->lock);
-            if (vertex->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            vertex->delta = nullptr;
-            if (vertex->deleted) {
-              current_deleted_vertices.push_back(vertex->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::EDGE: {
-            Edge *edge = prev.edge;
-            std::lock_guard<utils::SpinLock> edge_guard(edge->lock);
-            if (edge->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            edge->delta = nullptr;
-            if (edge->deleted) {
-              current_deleted_edges.push_back(edge->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::DELTA: {
-            if (prev.delta->timestamp->load(std::memory_order_acquire) == commit_timestamp) {
-              // The delta that is newer than this one is also a delta from this
-              // transaction. We skip the current delta and will remove it as a
-              // part of the suffix later.
-              break;
-            }
-            std::unique_lock<utils::SpinLock> guard;
-            {
-              // We need to find the parent object in order to be able to use
-              // its lock.
-              auto parent = prev;
-              while (parent.type == PreviousPtr::Type::DELTA) {
-                parent = parent.delta->prev.Get();
-              }
-              switch (parent.type) {
-                case PreviousPtr::Type::VERTEX:
-                  guard = std::unique_lock<utils::SpinLock>(parent.vertex->lock);
-                  break;
-                case PreviousPtr::Type::EDGE:
-                  guard = std::unique_lock<utils::SpinLock>(parent.edge->lock);
-                  break;
-                case PreviousPtr::Type::DELTA:
-                case PreviousPtr::Type::NULLPTR:
-                  LOG_FATAL("Invalid database state!");
-              }
-            }
-            if (delta.prev.Get() != prev) {
-              // Something changed, we could now be the first delta in the
-              // chain.
-              continue;
-            }
-            Delta *prev_delta = prev.delta;
-            prev_delta->next.store(nullptr, std::memory_order_release);
-            break;
-          }
-          case PreviousPtr::Type::NULLPTR: {
-            LOG_FATAL("Invalid pointer!");
-          }
+        // The transactions that were claimed are always a prefix of
+        // `transactions` so that the unlinked ones can be popped from the
+        // front of `committed_transactions_`.
+        if (!force && unlink_time_budget.count() > 0 &&
+            std::chrono::steady_clock::now() - unlink_start >= unlink_time_budget) {
+          budget_exceeded.store(true, std::memory_order_release);
+          break;
         }
-        break;
+        auto index = next_transaction.fetch_add(1, std::memory_order_acq_rel);
+        if (index >= transactions.size()) break;
+        UnlinkDeltas(transactions[index], &deleted_vertices[i], &deleted_edges[i]);
       }
-    }
-
-    committed_transactions_.WithLock([&](auto &committed_transactions) {
-      unlinked_undo_buffers.emplace_back(0, std::move(transaction->deltas));
-      committed_transactions.pop_front();
     });
   }
-
-  // After unlinking deltas from vertices, we refresh the indices. That way
-  // we're sure that none of the vertices from `current_deleted_vertices`
-  // appears in an index, and we can safely remove the from the main storage
-  // after the last currently active transaction is finished.
+  RunGcTasks(unlink_tasks);
+  const auto unlinked_count = std::min<uint64_t>(next_transaction.load(std::memory_order_acquire), transactions.size());
+  for (uint64_t i = 0; i < thread_count; ++i) {
+    current_deleted_vertices.splice(current_deleted_vertices.end(), deleted_vertices[i]);
+    current_deleted_edges.splice(current_deleted_edges.end(), deleted_edges[i]);
+  }
+  committed_transactions_.WithLock([&](auto &committed_transactions) {
+    for (uint64_t i = 0; i < unlinked_count; ++i) {
+      unlinked_undo_buffers.emplace_back(0, std::move(committed_transactions.front().deltas));
+      committed_transactions.pop_front();
+    }
+  });
+  EventCounter::IncrementCounter(EventCounter::GcUnlinkedTransactions, unlinked_count);
+  if (budget_exceeded.load(std::memory_order_acquire)) {
+    EventCounter::IncrementCounter(EventCounter::GcUnlinkBudgetExceeded);
+    spdlog::trace("GC unlinked {} of {} transactions before running out of time.", unlinked_count,
+                  transactions.size());
+  }
+
+  // Phase 2: after unlinking deltas from vertices, we refresh the indices.
+  // That way we're sure that none of the vertices from
+  // `current_deleted_vertices` appears in an index, and we can safely remove
+  // them from the main storage after the last currently active transaction is
+  // finished.
   if (run_index_cleanup) {
     // This operation is very expensive as it traverses through all of the items
     // in every index every time.
-    RemoveObsoleteEntries(&indices_, oldest_active_start_timestamp);
-    constraints_.unique_constraints.RemoveObsoleteEntries(oldest_active_start_timestamp);
+    auto cleanup_tasks = RemoveObsoleteEntriesTasks(&indices_, oldest_active_start_timestamp);
+    cleanup_tasks.emplace_back(
+        [&] { constraints_.unique_constraints.RemoveObsoleteEntries(oldest_active_start_timestamp); });
+    RunGcTasks(cleanup_tasks);
   }
 
   {
@@ -1501,6 +2359,9 @@ void Storage::CollectGarbage() {
     for (auto vertex : current_deleted_vertices) {
       garbage_vertices_.emplace_back(mark_timestamp, vertex);
     }
+    for (auto edge : current_deleted_edges) {
+      garbage_edges_.emplace_back(mark_timestamp, edge);
+    }
   }
 
   garbage_undo_buffers_.WithLock([&](auto &undo_buffers) {
@@ -1515,6 +2376,8 @@ void Storage::CollectGarbage() {
     }
   });
 
+  // Phase 3: remove the deleted vertices and edges from the main storage.
+  uint64_t removed_vertices = 0;
   {
     auto vertex_acc = vertices_.access();
     if constexpr (force) {
@@ -1523,20 +2386,75 @@ void Storage::CollectGarbage() {
       while (!garbage_vertices_.empty()) {
         MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
         garbage_vertices_.pop_front();
+        ++removed_vertices;
       }
     } else {
       while (!garbage_vertices_.empty() && garbage_vertices_.front().first < oldest_active_start_timestamp) {
         MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
         garbage_vertices_.pop_front();
+        ++removed_vertices;
       }
     }
   }
+  uint64_t removed_edges = 0;
   {
+    // Edges are removed with the same delay as vertices because transactions
+    // that are still active could have found them through the edge indices.
     auto edge_acc = edges_.access();
-    for (auto edge : current_deleted_edges) {
-      MG_ASSERT(edge_acc.remove(edge), "Invalid database state!");
+    while (!garbage_edges_.empty() && (force || garbage_edges_.front().first < oldest_active_start_timestamp)) {
+      MG_ASSERT(edge_acc.remove(garbage_edges_.front().second), "Invalid database state!");
+      garbage_edges_.pop_front();
+      ++removed_edges;
+    }
+  }
+  EventCounter::IncrementCounter(EventCounter::GcRemovedVertices, removed_vertices);
+  EventCounter::IncrementCounter(EventCounter::GcRemovedEdges, removed_edges);
+}
+
+void Storage::RunGcTasks(const std::vector<std::function<void()>> &tasks) {
+  if (!gc_pool_ || tasks.size() <= 1) {
+    for (const auto &task : tasks) {
+      task();
     }
+    return;
   }
+
+  std::atomic<uint64_t> next_task{0};
+  std::exception_ptr error;
+  std::mutex error_lock;
+  auto run_tasks = [&] {
+    while (true) {
+      auto index = next_task.fetch_add(1, std::memory_order_acq_rel);
+      if (index >= tasks.size()) break;
+      try {
+        tasks[index]();
+      } catch (...) {
+        std::lock_guard<std::mutex> guard(error_lock);
+        if (!error) error = std::current_exception();
+      }
+    }
+  };
+
+  // The GC thread takes tasks as well, so the pool only needs to help with
+  // the rest of them.
+  const auto helpers_count = std::min<uint64_t>(config_.gc.thread_count - 1, tasks.size() - 1);
+  uint64_t finished_helpers = 0;
+  std::mutex finished_lock;
+  std::condition_variable finished_cv;
+  for (uint64_t i = 0; i < helpers_count; ++i) {
+    gc_pool_->AddTask([&] {
+      run_tasks();
+      std::lock_guard<std::mutex> guard(finished_lock);
+      ++finished_helpers;
+      finished_cv.notify_one();
+    });
+  }
+  run_tasks();
+  {
+    std::unique_lock<std::mutex> guard(finished_lock);
+    finished_cv.wait(guard, [&] { return finished_helpers == helpers_count; });
+  }
+  if (error) std::rethrow_exception(error);
 }
 
 // tell the linker he can find the CollectGarbage definitions here
@@ -1554,15 +2472,23 @@ bool Storage::InitializeWalFile() {
 }
 
 void Storage::FinalizeWalFile() {
-  ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
-    wal_file_->Sync();
-    wal_unsynced_transactions_ = 0;
+  // With group commit the syncs are done by the WAL writer thread. If the
+  // commits have to be durable without it, the WAL is synced here, before
+  // the changes become visible.
+  if (!wal_group_commit_) {
+    ++wal_unsynced_transactions_;
+    if (config_.durability.wal_group_commit ||
+        wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+      wal_file_->Sync();
+      wal_unsynced_transactions_ = 0;
+    }
   }
   if (wal_file_->GetSize() / 1024 >= config_.durability.wal_file_size_kibibytes) {
+    // Finalizing the WAL file syncs it.
     wal_file_->FinalizeWal();
     wal_file_ = std::nullopt;
     wal_unsynced_transactions_ = 0;
+    if (wal_group_commit_) wal_group_commit_->MarkAllDurable();
   } else {
     // Try writing the internal buffer if possible, if not
     // the data should be written as soon as it's possible
@@ -1572,8 +2498,24 @@ void Storage::FinalizeWalFile() {
   }
 }
 
-void Storage::AppendToWal(const Transaction &transaction, uint64_t final_commit_timestamp) {
-  if (!InitializeWalFile()) return;
+void Storage::SyncWalFile() {
+  int fd = -1;
+  std::filesystem::path path;
+  {
+    // Only the write to the file is done under the engine lock, the committing
+    // transactions can keep appending to the WAL while the data is synced.
+    std::lock_guard<utils::SpinLock> guard(engine_lock_);
+    // All appended data was already synced when the last file was finalized.
+    if (!wal_file_) return;
+    fd = wal_file_->FlushAndDuplicate();
+    path = wal_file_->Path();
+  }
+  utils::SyncDataAndClose(fd, path);
+}
+
+std::vector<replication::TransactionAck> Storage::AppendToWal(const Transaction &transaction,
+                                                              uint64_t final_commit_timestamp) {
+  if (!InitializeWalFile()) return {};
   // Traverse deltas and append them to the WAL file.
   // A single transaction will always be contained in a single WAL file.
   auto current_commit_timestamp = transaction.commit_timestamp->load(std::memory_order_acquire);
@@ -1742,31 +2684,53 @@ void Storage::AppendToWal(const Transaction &transaction, uint64_t final_commit_
 
   FinalizeWalFile();
 
+  std::vector<replication::TransactionAck> replica_acks;
   replication_clients_.WithLock([&](auto &clients) {
     for (auto &client : clients) {
       client->IfStreamingTransaction([&](auto &stream) { stream.AppendTransactionEnd(final_commit_timestamp); });
-      client->FinalizeTransactionReplication();
+      if (auto ack = client->FinalizeTransactionReplication()) replica_acks.push_back(std::move(*ack));
     }
   });
+  return replica_acks;
 }
 
-void Storage::AppendToWal(durability::StorageGlobalOperation operation, LabelId label,
-                          const std::set<PropertyId> &properties, uint64_t final_commit_timestamp) {
-  if (!InitializeWalFile()) return;
-  wal_file_->AppendOperation(operation, label, properties, final_commit_timestamp);
+template <typename TAppend>
+void Storage::AppendOperationToWal(const TAppend &append) {
+  std::vector<replication::TransactionAck> replica_acks;
   {
+    // `main_lock_` is held exclusively, so no transaction is committing, but
+    // the WAL writer thread still accesses the WAL file under the engine lock.
+    std::lock_guard<utils::SpinLock> engine_guard(engine_lock_);
+    if (!InitializeWalFile()) return;
+    append(*wal_file_);
     if (replication_role_.load() == ReplicationRole::MAIN) {
       replication_clients_.WithLock([&](auto &clients) {
         for (auto &client : clients) {
           client->StartTransactionReplication(wal_file_->SequenceNumber());
-          client->IfStreamingTransaction(
-              [&](auto &stream) { stream.AppendOperation(operation, label, properties, final_commit_timestamp); });
-          client->FinalizeTransactionReplication();
+          client->IfStreamingTransaction([&](auto &stream) { append(stream); });
+          if (auto ack = client->FinalizeTransactionReplication()) replica_acks.push_back(std::move(*ack));
         }
       });
     }
+    FinalizeWalFile();
+    // There are no concurrent commits whose sync could be shared, so the WAL
+    // is synced right away instead of waiting for the WAL writer thread while
+    // holding `main_lock_`. A finalized WAL file is already synced.
+    if (wal_group_commit_ && wal_file_) wal_file_->Sync();
   }
-  FinalizeWalFile();
+  for (const auto &ack : replica_acks) ack.Wait();
+}
+
+void Storage::AppendToWal(durability::StorageGlobalOperation operation, LabelId label,
+                          const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp) {
+  AppendOperationToWal(
+      [&](auto &appender) { appender.AppendOperation(operation, label, properties, final_commit_timestamp); });
+}
+
+void Storage::AppendToWal(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                          const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp) {
+  AppendOperationToWal(
+      [&](auto &appender) { appender.AppendOperation(operation, edge_type, properties, final_commit_timestamp); });
 }
 
 utils::BasicResult<Storage::CreateSnapshotError> Storage::CreateSnapshot() {
@@ -1783,10 +2747,8 @@ utils::BasicResult<Storage::CreateSnapshotError> Storage::CreateSnapshot() {
   auto transaction = CreateTransaction(IsolationLevel::SNAPSHOT_ISOLATION);
 
   // Create snapshot.
-  durability::CreateSnapshot(&transaction, snapshot_directory_, wal_directory_,
-                             config_.durability.snapshot_retention_count, &vertices_, &edges_, &name_id_mapper_,
-                             &indices_, &constraints_, config_.items, uuid_, epoch_id_, epoch_history_,
-                             &file_retainer_);
+  durability::CreateSnapshot(&transaction, snapshot_directory_, wal_directory_, &vertices_, &edges_, &name_id_mapper_,
+                             &indices_, &constraints_, config_, uuid_, epoch_id_, epoch_history_, &file_retainer_);
 
   // Finalize snapshot transaction.
   commit_log_->MarkFinished(transaction.start_timestamp);
@@ -1820,17 +2782,47 @@ void Storage::FreeMemory() {
   edges_.run_gc();
   indices_.label_index.RunGC();
   indices_.label_property_index.RunGC();
+  indices_.label_property_composite_index.RunGC();
+  indices_.property_columns.RunGC();
+  indices_.edge_type_index.RunGC();
+  indices_.edge_type_property_index.RunGC();
 }
 
 uint64_t Storage::CommitTimestamp(const std::optional<uint64_t> desired_commit_timestamp) {
   if (!desired_commit_timestamp) {
-    return timestamp_++;
+    return timestamp_.fetch_add(1, std::memory_order_acq_rel);
   } else {
-    timestamp_ = std::max(timestamp_, *desired_commit_timestamp + 1);
+    AdvanceTimestamp(*desired_commit_timestamp + 1);
     return *desired_commit_timestamp;
   }
 }
 
+void Storage::AdvanceTimestamp(const uint64_t next_timestamp) {
+  // The value is always written, even when it doesn't change, so that the
+  // transactions starting afterwards synchronize with the commit that called
+  // this, see `WaitForCommitBefore`.
+  auto timestamp = timestamp_.load(std::memory_order_acquire);
+  while (!timestamp_.compare_exchange_weak(timestamp, std::max(timestamp, next_timestamp),
+                                           std::memory_order_acq_rel)) {
+  }
+}
+
+void Storage::WaitForCommitBefore(const uint64_t start_timestamp) const {
+  // The committing transaction publishes `committing_timestamp_` before it
+  // takes its commit timestamp from `timestamp_`, so a transaction whose start
+  // timestamp is newer always finds it here. The wait is as long as the
+  // commit holds `engine_lock_`, which starting transactions previously
+  // waited for as well.
+  while (true) {
+    auto committing_timestamp = committing_timestamp_.load(std::memory_order_acquire);
+    if (committing_timestamp == kNoCommitInProgress ||
+        (committing_timestamp != kCommitTimestampPending && committing_timestamp >= start_timestamp)) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+
 bool Storage::SetReplicaRole(io::network::Endpoint endpoint, const replication::ReplicationServerConfig &config) {
   // We don't want to restart the server if we're already a REPLICA
   if (replication_role_ == ReplicationRole::REPLICA) {
@@ -1927,6 +2919,22 @@ std::optional<replication::ReplicaState> Storage::GetReplicaState(const std::str
 
 ReplicationRole Storage::GetReplicationRole() const { return replication_role_; }
 
+uint64_t Storage::LastCommitTimestamp() const { return last_commit_timestamp_.load(); }
+
+bool Storage::WaitForCommitTimestamp(uint64_t commit_timestamp, std::chrono::milliseconds timeout) {
+  if (last_commit_timestamp_.load() >= commit_timestamp) return true;
+  std::unique_lock guard(last_commit_timestamp_mutex_);
+  return last_commit_timestamp_cv_.wait_for(guard, timeout,
+                                            [&] { return last_commit_timestamp_.load() >= commit_timestamp; });
+}
+
+void Storage::NotifyCommitTimestampWaiters() {
+  // Taking the mutex after the timestamp is updated makes sure that a waiter
+  // either sees the new timestamp or is already waiting for the notification.
+  { std::lock_guard guard(last_commit_timestamp_mutex_); }
+  last_commit_timestamp_cv_.notify_all();
+}
+
 std::vector<Storage::ReplicaInfo> Storage::ReplicasInfo() {
   return replication_clients_.WithLock([](auto &clients) {
     std::vector<Storage::ReplicaInfo> replica_info;
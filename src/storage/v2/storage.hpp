@@ -12,7 +12,13 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <variant>
@@ -25,6 +31,7 @@
 #include "storage/v2/durability/wal.hpp"
 #include "storage/v2/edge.hpp"
 #include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/graph_statistics.hpp"
 #include "storage/v2/indices.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/mvcc.hpp"
@@ -39,6 +46,7 @@
 #include "utils/scheduler.hpp"
 #include "utils/skip_list.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/uuid.hpp"
 
 /// REPLICATION ///
@@ -47,6 +55,7 @@
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/rpc.hpp"
 #include "storage/v2/replication/serialization.hpp"
+#include "storage/v2/replication/transaction_ack.hpp"
 
 namespace memgraph::storage {
 
@@ -66,6 +75,9 @@ class AllVerticesIterable final {
   Indices *indices_;
   Constraints *constraints_;
   Config::Items config_;
+  // Optional range `[lower_gid_, upper_gid_)` of the scanned vertices.
+  std::optional<Gid> lower_gid_;
+  std::optional<Gid> upper_gid_;
   std::optional<VertexAccessor> vertex_;
 
  public:
@@ -86,15 +98,21 @@ class AllVerticesIterable final {
   };
 
   AllVerticesIterable(utils::SkipList<Vertex>::Accessor vertices_accessor, Transaction *transaction, View view,
-                      Indices *indices, Constraints *constraints, Config::Items config)
+                      Indices *indices, Constraints *constraints, Config::Items config,
+                      std::optional<Gid> lower_gid = std::nullopt, std::optional<Gid> upper_gid = std::nullopt)
       : vertices_accessor_(std::move(vertices_accessor)),
         transaction_(transaction),
         view_(view),
         indices_(indices),
         constraints_(constraints),
-        config_(config) {}
+        config_(config),
+        lower_gid_(lower_gid),
+        upper_gid_(upper_gid) {}
 
-  Iterator begin() { return Iterator(this, vertices_accessor_.begin()); }
+  Iterator begin() {
+    if (lower_gid_) return Iterator(this, vertices_accessor_.find_equal_or_greater(*lower_gid_));
+    return Iterator(this, vertices_accessor_.begin());
+  }
   Iterator end() { return Iterator(this, vertices_accessor_.end()); }
 };
 
@@ -103,19 +121,32 @@ class AllVerticesIterable final {
 /// This class should be the primary type used by the client code to iterate
 /// over vertices inside a Storage instance.
 class VerticesIterable final {
-  enum class Type { ALL, BY_LABEL, BY_LABEL_PROPERTY };
+  enum class Type {
+    ALL,
+    BY_LABEL,
+    BY_LABEL_PROPERTY,
+    BY_LABEL_PROPERTY_COMPOSITE,
+    BY_LABEL_PROPERTY_HASH,
+    BY_LABEL_PROPERTY_COLUMN
+  };
 
   Type type_;
   union {
     AllVerticesIterable all_vertices_;
     LabelIndex::Iterable vertices_by_label_;
     LabelPropertyIndex::Iterable vertices_by_label_property_;
+    LabelPropertyCompositeIndex::Iterable vertices_by_label_property_composite_;
+    LabelPropertyHashIndex::Iterable vertices_by_label_property_hash_;
+    PropertyColumns::Iterable vertices_by_property_column_;
   };
 
  public:
   explicit VerticesIterable(AllVerticesIterable);
   explicit VerticesIterable(LabelIndex::Iterable);
   explicit VerticesIterable(LabelPropertyIndex::Iterable);
+  explicit VerticesIterable(LabelPropertyCompositeIndex::Iterable);
+  explicit VerticesIterable(LabelPropertyHashIndex::Iterable);
+  explicit VerticesIterable(PropertyColumns::Iterable);
 
   VerticesIterable(const VerticesIterable &) = delete;
   VerticesIterable &operator=(const VerticesIterable &) = delete;
@@ -131,6 +162,9 @@ class VerticesIterable final {
       AllVerticesIterable::Iterator all_it_;
       LabelIndex::Iterable::Iterator by_label_it_;
       LabelPropertyIndex::Iterable::Iterator by_label_property_it_;
+      LabelPropertyCompositeIndex::Iterable::Iterator by_label_property_composite_it_;
+      LabelPropertyHashIndex::Iterable::Iterator by_label_property_hash_it_;
+      PropertyColumns::Iterable::Iterator by_property_column_it_;
     };
 
     void Destroy() noexcept;
@@ -139,6 +173,9 @@ class VerticesIterable final {
     explicit Iterator(AllVerticesIterable::Iterator);
     explicit Iterator(LabelIndex::Iterable::Iterator);
     explicit Iterator(LabelPropertyIndex::Iterable::Iterator);
+    explicit Iterator(LabelPropertyCompositeIndex::Iterable::Iterator);
+    explicit Iterator(LabelPropertyHashIndex::Iterable::Iterator);
+    explicit Iterator(PropertyColumns::Iterable::Iterator);
 
     Iterator(const Iterator &);
     Iterator &operator=(const Iterator &);
@@ -160,10 +197,70 @@ class VerticesIterable final {
   Iterator end();
 };
 
+/// Generic access to the edges found through the edge indices.
+class EdgesIterable final {
+  enum class Type { BY_EDGE_TYPE, BY_EDGE_TYPE_PROPERTY };
+
+  Type type_;
+  union {
+    EdgeTypeIndex::Iterable edges_by_edge_type_;
+    EdgeTypePropertyIndex::Iterable edges_by_edge_type_property_;
+  };
+
+ public:
+  explicit EdgesIterable(EdgeTypeIndex::Iterable);
+  explicit EdgesIterable(EdgeTypePropertyIndex::Iterable);
+
+  EdgesIterable(const EdgesIterable &) = delete;
+  EdgesIterable &operator=(const EdgesIterable &) = delete;
+
+  EdgesIterable(EdgesIterable &&) noexcept;
+  EdgesIterable &operator=(EdgesIterable &&) noexcept;
+
+  ~EdgesIterable();
+
+  class Iterator final {
+    Type type_;
+    union {
+      EdgeTypeIndex::Iterable::Iterator by_edge_type_it_;
+      EdgeTypePropertyIndex::Iterable::Iterator by_edge_type_property_it_;
+    };
+
+    void Destroy() noexcept;
+
+   public:
+    explicit Iterator(EdgeTypeIndex::Iterable::Iterator);
+    explicit Iterator(EdgeTypePropertyIndex::Iterable::Iterator);
+
+    Iterator(const Iterator &);
+    Iterator &operator=(const Iterator &);
+
+    Iterator(Iterator &&) noexcept;
+    Iterator &operator=(Iterator &&) noexcept;
+
+    ~Iterator();
+
+    EdgeAccessor operator*() const;
+
+    Iterator &operator++();
+
+    bool operator==(const Iterator &other) const;
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+  };
+
+  Iterator begin();
+  Iterator end();
+};
+
 /// Structure used to return information about existing indices in the storage.
 struct IndicesInfo {
   std::vector<LabelId> label;
   std::vector<std::pair<LabelId, PropertyId>> label_property;
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
+  std::vector<std::pair<LabelId, PropertyId>> label_property_hash;
+  std::vector<EdgeTypeId> edge_type;
+  std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
+  std::vector<std::pair<LabelId, PropertyColumns::Schema>> property_columns;
 };
 
 /// Structure used to return information about existing constraints in the
@@ -222,14 +319,49 @@ class Storage final {
 
     VerticesIterable Vertices(LabelId label, View view);
 
+    /// Uses the label-property index if it exists and the property column of
+    /// the label otherwise.
     VerticesIterable Vertices(LabelId label, PropertyId property, View view);
 
+    /// Uses the hash index on `label` and `property` if it exists, then the
+    /// label-property index and the property column of the label otherwise.
     VerticesIterable Vertices(LabelId label, PropertyId property, const PropertyValue &value, View view);
 
+    /// Uses the label-property index if it exists and the property column of
+    /// the label otherwise.
     VerticesIterable Vertices(LabelId label, PropertyId property,
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
 
+    /// Iterates over vertices from the composite index on `label` and
+    /// `properties` whose values of the first `prefix.size()` properties are
+    /// equal to `prefix` and whose value of the following property lies within
+    /// the bounds.
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              const std::vector<PropertyValue> &prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
+
+    /// Returns up to `max_partitions - 1` vertex gids that split the vertices
+    /// into ranges of approximately equal size. The ranges can be scanned
+    /// independently (e.g. from multiple threads) using `VerticesInRange`.
+    std::vector<Gid> VerticesPartitionPoints(uint64_t max_partitions);
+
+    /// Iterates over the vertices whose gid lies within `[lower, upper)`. A
+    /// missing bound means the range is unbounded on that side.
+    VerticesIterable VerticesInRange(std::optional<Gid> lower, std::optional<Gid> upper, View view) {
+      return VerticesIterable(AllVerticesIterable(storage_->vertices_.access(), &transaction_, view,
+                                                  &storage_->indices_, &storage_->constraints_,
+                                                  storage_->config_.items, lower, upper));
+    }
+
+    /// Scans the property column of the given label instead of an index. The
+    /// column must exist, see `Storage::CreatePropertyColumns`.
+    VerticesIterable VerticesByPropertyColumn(LabelId label, PropertyId property,
+                                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                              const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                              View view);
+
     /// Return approximate number of all vertices in the database.
     /// Note that this is always an over-estimate and never an under-estimate.
     int64_t ApproximateVertexCount() const { return storage_->vertices_.size(); }
@@ -243,13 +375,25 @@ class Storage final {
     /// Return approximate number of vertices with the given label and property.
     /// Note that this is always an over-estimate and never an under-estimate.
     int64_t ApproximateVertexCount(LabelId label, PropertyId property) const {
-      return storage_->indices_.label_property_index.ApproximateVertexCount(label, property);
+      if (storage_->indices_.label_property_index.IndexExists(label, property)) {
+        return storage_->indices_.label_property_index.ApproximateVertexCount(label, property);
+      }
+      if (storage_->indices_.label_property_hash_index.IndexExists(label, property)) {
+        return storage_->indices_.label_property_hash_index.ApproximateVertexCount(label, property);
+      }
+      return storage_->indices_.property_columns.ApproximateVertexCount(label);
     }
 
     /// Return approximate number of vertices with the given label and the given
     /// value for the given property. Note that this is always an over-estimate
     /// and never an under-estimate.
     int64_t ApproximateVertexCount(LabelId label, PropertyId property, const PropertyValue &value) const {
+      if (storage_->indices_.label_property_hash_index.IndexExists(label, property)) {
+        return storage_->indices_.label_property_hash_index.ApproximateVertexCount(label, property, value);
+      }
+      if (!storage_->indices_.label_property_index.IndexExists(label, property)) {
+        return storage_->indices_.property_columns.ApproximateVertexCount(label);
+      }
       return storage_->indices_.label_property_index.ApproximateVertexCount(label, property, value);
     }
 
@@ -259,9 +403,53 @@ class Storage final {
     int64_t ApproximateVertexCount(LabelId label, PropertyId property,
                                    const std::optional<utils::Bound<PropertyValue>> &lower,
                                    const std::optional<utils::Bound<PropertyValue>> &upper) const {
+      if (!storage_->indices_.label_property_index.IndexExists(label, property)) {
+        return storage_->indices_.property_columns.ApproximateVertexCount(label);
+      }
       return storage_->indices_.label_property_index.ApproximateVertexCount(label, property, lower, upper);
     }
 
+    /// Return approximate number of vertices in the composite index on `label`
+    /// and `properties` whose values of the first `prefix.size()` properties
+    /// are equal to `prefix`.
+    int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                   const std::vector<PropertyValue> &prefix) const {
+      return storage_->indices_.label_property_composite_index.ApproximateVertexCount(label, properties, prefix);
+    }
+
+    /// Iterates over the edges of the given type. The edge type index must
+    /// exist.
+    EdgesIterable Edges(EdgeTypeId edge_type, View view);
+
+    /// Iterates over the edges of the given type whose value of the given
+    /// property is equal to `value`. The edge type-property index must exist.
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view);
+
+    /// Iterates over the edges of the given type whose value of the given
+    /// property lies within the bounds. The edge type-property index must
+    /// exist.
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property,
+                        const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                        const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
+
+    /// Return approximate number of edges with the given type.
+    /// Note that this is always an over-estimate and never an under-estimate.
+    int64_t ApproximateEdgeCount(EdgeTypeId edge_type) const {
+      return storage_->indices_.edge_type_index.ApproximateEdgeCount(edge_type);
+    }
+
+    /// Return approximate number of edges with the given type and property.
+    /// Note that this is always an over-estimate and never an under-estimate.
+    int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const {
+      return storage_->indices_.edge_type_property_index.ApproximateEdgeCount(edge_type, property);
+    }
+
+    /// Return approximate number of edges with the given type and the given
+    /// value for the given property.
+    int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value) const {
+      return storage_->indices_.edge_type_property_index.ApproximateEdgeCount(edge_type, property, value);
+    }
+
     /// @return Accessor to the deleted vertex if a deletion took place, std::nullopt otherwise
     /// @throw std::bad_alloc
     Result<std::optional<VertexAccessor>> DeleteVertex(VertexAccessor *vertex);
@@ -297,8 +485,33 @@ class Storage final {
       return storage_->indices_.label_property_index.IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+      return storage_->indices_.label_property_composite_index.IndexExists(label, properties);
+    }
+
+    bool LabelPropertyHashIndexExists(LabelId label, PropertyId property) const {
+      return storage_->indices_.label_property_hash_index.IndexExists(label, property);
+    }
+
+    bool EdgeTypeIndexExists(EdgeTypeId edge_type) const {
+      return storage_->indices_.edge_type_index.IndexExists(edge_type);
+    }
+
+    bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const {
+      return storage_->indices_.edge_type_property_index.IndexExists(edge_type, property);
+    }
+
+    bool PropertyColumnExists(LabelId label, PropertyId property) const {
+      return storage_->indices_.property_columns.ColumnExists(label, property);
+    }
+
     IndicesInfo ListAllIndices() const {
-      return {storage_->indices_.label_index.ListIndices(), storage_->indices_.label_property_index.ListIndices()};
+      return {storage_->indices_.label_index.ListIndices(), storage_->indices_.label_property_index.ListIndices(),
+              storage_->indices_.label_property_composite_index.ListIndices(),
+              storage_->indices_.label_property_hash_index.ListIndices(),
+              storage_->indices_.edge_type_index.ListIndices(),
+              storage_->indices_.edge_type_property_index.ListIndices(),
+              storage_->indices_.property_columns.ListColumns()};
     }
 
     ConstraintsInfo ListAllConstraints() const {
@@ -306,6 +519,10 @@ class Storage final {
               storage_->constraints_.unique_constraints.ListConstraints()};
     }
 
+    /// Returns the statistics collected by the last `Storage::AnalyzeGraph`
+    /// or nullptr if the graph wasn't analyzed.
+    std::shared_ptr<const GraphStatistics> GetGraphStatistics() const { return storage_->GetGraphStatistics(); }
+
     void AdvanceCommand();
 
     /// Commit returns `ConstraintViolation` if the changes made by this
@@ -338,6 +555,77 @@ class Storage final {
     return Accessor{this, override_isolation_level.value_or(isolation_level_)};
   }
 
+  /// Loads a large amount of data into the storage outside of transactions.
+  ///
+  /// Vertices and edges are created without undo deltas and aren't written to
+  /// the WAL or replicated, so they are visible to all transactions as soon as
+  /// they are created. The accessor holds the unique storage lock while it is
+  /// alive, so no transaction can run at the same time and the thread that
+  /// creates it must not hold another accessor. `Finish` adds the loaded data
+  /// to the indices in bulk and then creates a snapshot if durability is
+  /// enabled. The loaded data isn't durable until that snapshot exists.
+  /// Vertices and edges can be created from multiple threads concurrently.
+  class BulkLoadAccessor final {
+   private:
+    friend class Storage;
+
+    explicit BulkLoadAccessor(Storage *storage);
+
+   public:
+    BulkLoadAccessor(const BulkLoadAccessor &) = delete;
+    BulkLoadAccessor &operator=(const BulkLoadAccessor &) = delete;
+    BulkLoadAccessor &operator=(BulkLoadAccessor &&other) = delete;
+
+    BulkLoadAccessor(BulkLoadAccessor &&other) noexcept;
+
+    /// Calls `Finish` if it wasn't called yet.
+    ~BulkLoadAccessor();
+
+    /// @throw std::bad_alloc
+    Gid CreateVertex(const std::vector<LabelId> &labels, const std::map<PropertyId, PropertyValue> &properties);
+
+    /// Reserves `count` consecutive vertex gids and returns the first one.
+    /// The reserved gids can be passed to `CreateVertex`, which allows the
+    /// gids to be assigned in a deterministic order while the vertices are
+    /// created concurrently.
+    Gid ReserveVertexGids(uint64_t count);
+
+    /// Creates a vertex with a gid that was reserved by `ReserveVertexGids`.
+    /// @throw std::bad_alloc
+    void CreateVertex(Gid gid, const std::vector<LabelId> &labels,
+                      const std::map<PropertyId, PropertyValue> &properties);
+
+    /// Returns `NONEXISTENT_OBJECT` if one of the vertices doesn't exist and
+    /// `PROPERTIES_DISABLED` if properties are given but edges don't have
+    /// properties.
+    /// @throw std::bad_alloc
+    Result<Gid> CreateEdge(Gid from, Gid to, EdgeTypeId edge_type,
+                           const std::map<PropertyId, PropertyValue> &properties);
+
+    /// Adds the loaded vertices and edges to the indices, releases the storage
+    /// lock and creates the snapshot. The accessor can't be used afterwards.
+    /// @throw std::bad_alloc
+    void Finish();
+
+   private:
+    Storage *storage_;
+    std::unique_lock<utils::RWLock> storage_guard_;
+    utils::SkipList<Vertex>::Accessor vertices_;
+    utils::SkipList<Edge>::Accessor edges_;
+    // Gids are handed out in increasing order, so all vertices and edges with
+    // gids starting from these were created by the bulk load.
+    uint64_t first_vertex_gid_;
+    uint64_t first_edge_gid_;
+    bool is_finished_{false};
+  };
+
+  enum class BulkLoadError : uint8_t { DISABLED_FOR_REPLICA, REPLICAS_REGISTERED, CONSTRAINTS_EXIST };
+
+  /// Starts a bulk load, see `BulkLoadAccessor`. Bulk loads are refused on
+  /// replicas, while replicas are registered (they would miss the data) and
+  /// while constraints exist (the data wouldn't be checked against them).
+  utils::BasicResult<BulkLoadError, BulkLoadAccessor> BulkLoad();
+
   const std::string &LabelToName(LabelId label) const;
   const std::string &PropertyToName(PropertyId property) const;
   const std::string &EdgeTypeToName(EdgeTypeId edge_type) const;
@@ -361,8 +649,69 @@ class Storage final {
 
   bool DropIndex(LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp = {});
 
+  /// Creates an index over an ordered list of at least two distinct
+  /// properties.
+  ///
+  /// @throw std::bad_alloc
+  bool CreateCompositeIndex(LabelId label, const std::vector<PropertyId> &properties,
+                            std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropCompositeIndex(LabelId label, const std::vector<PropertyId> &properties,
+                          std::optional<uint64_t> desired_commit_timestamp = {});
+
+  /// Creates a hash index on the given label and property, which is used
+  /// instead of the label-property index for lookups of a single value.
+  ///
+  /// @throw std::bad_alloc
+  bool CreateHashIndex(LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropHashIndex(LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp = {});
+
+  /// Creates an index of the edges with the given type.
+  ///
+  /// @throw std::bad_alloc
+  bool CreateEdgeIndex(EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp = {});
+
+  /// Creates an index of the edges with the given type by the value of the
+  /// given property. Returns false if the index already exists or edges don't
+  /// have properties.
+  ///
+  /// @throw std::bad_alloc
+  bool CreateEdgeIndex(EdgeTypeId edge_type, PropertyId property,
+                       std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropEdgeIndex(EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropEdgeIndex(EdgeTypeId edge_type, PropertyId property,
+                     std::optional<uint64_t> desired_commit_timestamp = {});
+
   IndicesInfo ListAllIndices() const;
 
+  /// Stores the given properties of all vertices with the label in typed
+  /// columns in addition to their `PropertyStore`. Returns false if the label
+  /// already has columns or the schema is invalid. Scans over a label and
+  /// property without a label-property index read the column instead.
+  ///
+  /// @throw std::bad_alloc
+  bool CreatePropertyColumns(LabelId label, const PropertyColumns::Schema &schema,
+                             std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropPropertyColumns(LabelId label, std::optional<uint64_t> desired_commit_timestamp = {});
+
+  /// Scans the whole graph and collects the statistics used by the query
+  /// planner. The statistics replace the ones collected previously. They are
+  /// kept only in memory and aren't persisted or replicated.
+  ///
+  /// @throw std::bad_alloc
+  std::shared_ptr<const GraphStatistics> AnalyzeGraph();
+
+  /// Removes the statistics collected by `AnalyzeGraph`.
+  void ClearGraphStatistics();
+
+  std::shared_ptr<const GraphStatistics> GetGraphStatistics() const {
+    return graph_statistics_.WithLock([](const auto &statistics) { return statistics; });
+  }
+
   /// Creates an existence constraint. Returns true if the constraint was
   /// successfuly added, false if it already exists and a `ConstraintViolation`
   /// if there is an existing vertex violating the constraint.
@@ -425,6 +774,16 @@ class Storage final {
 
   ReplicationRole GetReplicationRole() const;
 
+  /// Returns the commit timestamp of the last transaction that was committed
+  /// on this instance or, on a REPLICA, received from the MAIN.
+  uint64_t LastCommitTimestamp() const;
+
+  /// Blocks until the last commit timestamp reaches `commit_timestamp` or the
+  /// timeout expires. Returns whether the timestamp was reached. On a REPLICA
+  /// this waits until all transactions committed on the MAIN up to that
+  /// timestamp are applied and visible to new transactions.
+  bool WaitForCommitTimestamp(uint64_t commit_timestamp, std::chrono::milliseconds timeout);
+
   struct ReplicaInfo {
     std::string name;
     replication::ReplicationMode mode;
@@ -460,15 +819,50 @@ class Storage final {
   template <bool force>
   void CollectGarbage();
 
+  // Unlinks the deltas of a committed transaction from the version chains and
+  // collects the vertices and edges that were deleted by it.
+  void UnlinkDeltas(Transaction *transaction, std::list<Gid> *deleted_vertices, std::list<Gid> *deleted_edges);
+
+  // Runs the independent GC tasks on the GC thread and `gc_pool_` and waits
+  // for all of them to finish. The first exception thrown by a task is
+  // rethrown.
+  void RunGcTasks(const std::vector<std::function<void()>> &tasks);
+
   bool InitializeWalFile();
   void FinalizeWalFile();
-
-  void AppendToWal(const Transaction &transaction, uint64_t final_commit_timestamp);
-  void AppendToWal(durability::StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
-                   uint64_t final_commit_timestamp);
+  // Syncs the data appended to the current WAL file, used by the WAL group
+  // commit.
+  void SyncWalFile();
+
+  /// @return acknowledgements that the transaction should wait for after it
+  ///         releases the engine lock
+  std::vector<replication::TransactionAck> AppendToWal(const Transaction &transaction,
+                                                       uint64_t final_commit_timestamp);
+  void AppendToWal(durability::StorageGlobalOperation operation, LabelId label,
+                   const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp);
+  void AppendToWal(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                   const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp);
+
+  // Appends a non-transactional operation to the WAL file and replicates it.
+  // `append` is called with the WAL file and with the stream of every replica,
+  // which have the same set of `AppendOperation` overloads.
+  template <typename TAppend>
+  void AppendOperationToWal(const TAppend &append);
 
   uint64_t CommitTimestamp(std::optional<uint64_t> desired_commit_timestamp = {});
 
+  // Wakes up the `WaitForCommitTimestamp` callers. Must be called after
+  // `last_commit_timestamp_` is updated.
+  void NotifyCommitTimestampWaiters();
+
+  // Makes sure that the next timestamp handed out is at least
+  // `next_timestamp`.
+  void AdvanceTimestamp(uint64_t next_timestamp);
+
+  // Waits until the transaction that is being committed is visible if its
+  // commit timestamp is older than `start_timestamp`.
+  void WaitForCommitBefore(uint64_t start_timestamp) const;
+
   // Main storage lock.
   //
   // Accessors take a shared lock when starting, so it is possible to block
@@ -492,10 +886,24 @@ class Storage final {
   Constraints constraints_;
   Indices indices_;
 
+  mutable utils::Synchronized<std::shared_ptr<const GraphStatistics>, utils::SpinLock> graph_statistics_;
+
   // Transaction engine
+  //
+  // Transaction ids and timestamps are handed out by atomic counters, so
+  // starting a transaction doesn't take `engine_lock_`. Commits still take it
+  // to keep the committed transactions (and the WAL) sorted by the commit
+  // timestamp.
   utils::SpinLock engine_lock_;
-  uint64_t timestamp_{kTimestampInitialId};
-  uint64_t transaction_id_{kTransactionInitialId};
+  std::atomic<uint64_t> timestamp_{kTimestampInitialId};
+  std::atomic<uint64_t> transaction_id_{kTransactionInitialId};
+  // Commit timestamp of the transaction that is being committed while its
+  // changes aren't visible yet. A transaction that starts after the commit
+  // timestamp was taken must wait until the changes become visible, otherwise
+  // it could see them appear in the middle of its execution.
+  static constexpr uint64_t kNoCommitInProgress = std::numeric_limits<uint64_t>::max();
+  static constexpr uint64_t kCommitTimestampPending = kNoCommitInProgress - 1;
+  std::atomic<uint64_t> committing_timestamp_{kNoCommitInProgress};
   // TODO: This isn't really a commit log, it doesn't even care if a
   // transaction commited or aborted. We could probably combine this with
   // `timestamp_` in a sensible unit, something like TransactionClock or
@@ -508,9 +916,12 @@ class Storage final {
   Config config_;
   utils::Scheduler gc_runner_;
   std::mutex gc_lock_;
+  // Helper threads of the GC, created only when `config_.gc.thread_count` is
+  // larger than 1.
+  std::optional<utils::ThreadPool> gc_pool_;
 
   // Undo buffers that were unlinked and now are waiting to be freed.
-  utils::Synchronized<std::list<std::pair<uint64_t, std::list<Delta>>>, utils::SpinLock> garbage_undo_buffers_;
+  utils::Synchronized<std::list<std::pair<uint64_t, DeltaBuffer>>, utils::SpinLock> garbage_undo_buffers_;
 
   // Vertices that are logically deleted but still have to be removed from
   // indices before removing them from the main storage.
@@ -524,6 +935,10 @@ class Storage final {
   // storage.
   utils::Synchronized<std::list<Gid>, utils::SpinLock> deleted_edges_;
 
+  // Edges that are logically deleted and removed from indices and now wait to
+  // be removed from the main storage.
+  std::list<std::pair<uint64_t, Gid>> garbage_edges_;
+
   // Durability
   std::filesystem::path snapshot_directory_;
   std::filesystem::path wal_directory_;
@@ -560,6 +975,9 @@ class Storage final {
 
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Only used when `wal_group_commit` and
+  // `wal_group_commit_visible_before_durable` are enabled.
+  std::optional<durability::WalGroupCommit> wal_group_commit_;
 
   utils::FileRetainer file_retainer_;
 
@@ -568,6 +986,11 @@ class Storage final {
 
   // Last commited timestamp
   std::atomic<uint64_t> last_commit_timestamp_{kTimestampInitialId};
+  // Used to wake up the `WaitForCommitTimestamp` callers when a transaction
+  // or an operation is committed, or when a REPLICA applies the transactions
+  // received from the MAIN.
+  std::mutex last_commit_timestamp_mutex_;
+  std::condition_variable last_commit_timestamp_cv_;
 
   class ReplicationServer;
   std::unique_ptr<ReplicationServer> replication_server_{nullptr};
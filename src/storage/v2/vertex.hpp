@@ -12,9 +12,9 @@
 #pragma once
 
 #include <limits>
-#include <tuple>
 #include <vector>
 
+#include "storage/v2/adjacency_list.hpp"
 #include "storage/v2/delta.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
@@ -34,8 +34,8 @@ struct Vertex {
   std::vector<LabelId> labels;
   PropertyStore properties;
 
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
+  AdjacencyList in_edges;
+  AdjacencyList out_edges;
 
   mutable utils::SpinLock lock;
   bool deleted;
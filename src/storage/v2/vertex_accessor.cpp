@@ -11,7 +11,10 @@
 
 #include "storage/v2/vertex_accessor.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <tuple>
+#include <vector>
 
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/id_types.hpp"
@@ -57,6 +60,35 @@ std::pair<bool, bool> IsVisible(Vertex *vertex, Transaction *transaction, View v
 
   return {exists, deleted};
 }
+
+// Copies the edges of the given types (all edges if `edge_types` is empty)
+// that lead to `destination` (any vertex if it is `nullptr`). Only the groups
+// of the requested edge types are visited, so the cost doesn't depend on the
+// number of edges of other types.
+void CollectEdges(const AdjacencyList &edges, const std::vector<EdgeTypeId> &edge_types, const Vertex *destination,
+                  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> *result) {
+  if (edge_types.empty()) {
+    if (!destination) {
+      result->assign(edges.begin(), edges.end());
+      return;
+    }
+    for (const auto &item : edges) {
+      if (std::get<Vertex *>(item) != destination) continue;
+      result->push_back(item);
+    }
+    return;
+  }
+  for (auto it = edge_types.begin(); it != edge_types.end(); ++it) {
+    // Skip duplicate edge types so that the edges aren't returned twice.
+    if (std::find(edge_types.begin(), it, *it) != it) continue;
+    const auto *typed_edges = edges.edges(*it);
+    if (!typed_edges) continue;
+    for (const auto &[vertex, edge] : *typed_edges) {
+      if (destination && vertex != destination) continue;
+      result->emplace_back(*it, vertex, edge);
+    }
+  }
+}
 }  // namespace
 }  // namespace detail
 
@@ -349,17 +381,7 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::InEdges(View view, const std::
   {
     std::lock_guard<utils::SpinLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    if (edge_types.empty() && !destination) {
-      in_edges = vertex_->in_edges;
-    } else {
-      for (const auto &item : vertex_->in_edges) {
-        const auto &[edge_type, from_vertex, edge] = item;
-        if (destination && from_vertex != destination->vertex_) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        in_edges.push_back(item);
-      }
-    }
+    detail::CollectEdges(vertex_->in_edges, edge_types, destination ? destination->vertex_ : nullptr, &in_edges);
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(
@@ -429,17 +451,7 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::OutEdges(View view, const std:
   {
     std::lock_guard<utils::SpinLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    if (edge_types.empty() && !destination) {
-      out_edges = vertex_->out_edges;
-    } else {
-      for (const auto &item : vertex_->out_edges) {
-        const auto &[edge_type, to_vertex, edge] = item;
-        if (destination && to_vertex != destination->vertex_) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        out_edges.push_back(item);
-      }
-    }
+    detail::CollectEdges(vertex_->out_edges, edge_types, destination ? destination->vertex_ : nullptr, &out_edges);
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(
@@ -186,10 +186,19 @@ bool AsyncTimer::IsExpired() const noexcept {
   return false;
 }
 
+AsyncTimer AsyncTimer::Share() const {
+  AsyncTimer timer;
+  timer.expiration_flag_ = expiration_flag_;
+  return timer;
+}
+
 void AsyncTimer::ReleaseResources() {
   if (expiration_flag_ != nullptr) {
-    timer_delete(timer_id_);
-    EraseFlag(flag_id_);
+    // Shared timers only observe the flag and don't own the timer.
+    if (flag_id_ != kInvalidFlagId) {
+      timer_delete(timer_id_);
+      EraseFlag(flag_id_);
+    }
     flag_id_ = kInvalidFlagId;
     expiration_flag_ = std::shared_ptr<std::atomic<bool>>{};
   }
@@ -35,6 +35,11 @@ class AsyncTimer {
   // Returns false if the object isn't associated with any timer.
   bool IsExpired() const noexcept;
 
+  // Returns a timer which expires together with this one, but doesn't own the
+  // underlying timer, e.g. to check the timeout of a query on other threads.
+  // The shared timer never expires if this one is destroyed before expiring.
+  AsyncTimer Share() const;
+
  private:
   void ReleaseResources();
 
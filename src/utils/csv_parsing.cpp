@@ -11,8 +11,13 @@
 
 #include "utils/csv_parsing.hpp"
 
+#include <algorithm>
 #include <string_view>
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 #include "utils/file.hpp"
 #include "utils/string.hpp"
 
@@ -20,6 +25,74 @@ namespace memgraph::csv {
 
 using ParseError = Reader::ParseError;
 
+namespace {
+#if defined(__x86_64__)
+bool HasAvx2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+
+// Skips the 32-byte blocks that don't contain any of the characters and
+// returns the position of the first match or of the remaining tail.
+__attribute__((target("avx2"))) size_t SkipBlocksAvx2(std::string_view data, size_t pos, const char *characters,
+                                                      size_t size) {
+  __m256i needles[CharacterFinder::kMaxCharacters];
+  for (size_t i = 0; i < size; ++i) {
+    needles[i] = _mm256_set1_epi8(characters[i]);
+  }
+  for (; pos + 32 <= data.size(); pos += 32) {
+    const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data.data() + pos));
+    auto matches = _mm256_cmpeq_epi8(block, needles[0]);
+    for (size_t i = 1; i < size; ++i) {
+      matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, needles[i]));
+    }
+    const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+    if (mask != 0) return pos + __builtin_ctz(mask);
+  }
+  return pos;
+}
+#endif
+}  // namespace
+
+CharacterFinder::CharacterFinder(std::string_view characters) {
+  for (const auto c : characters) {
+    if (lookup_[static_cast<unsigned char>(c)]) continue;
+    if (size_ == kMaxCharacters) {
+      throw CsvReadException("CSV: Can't search for more than {} different characters at once", kMaxCharacters);
+    }
+    lookup_[static_cast<unsigned char>(c)] = true;
+    characters_[size_++] = c;
+  }
+}
+
+size_t CharacterFinder::Find(std::string_view data, size_t pos) const {
+#if defined(__x86_64__)
+  if (size_ != 0 && HasAvx2()) {
+    pos = SkipBlocksAvx2(data, pos, characters_.data(), size_);
+  }
+#endif
+  return FindScalar(data, pos);
+}
+
+size_t CharacterFinder::FindScalar(std::string_view data, size_t pos) const {
+  for (; pos < data.size(); ++pos) {
+    if (lookup_[static_cast<unsigned char>(data[pos])]) return pos;
+  }
+  return std::string_view::npos;
+}
+
+void Reader::InitializeFinder() {
+  // Inside of a quoted field only line breaks, null bytes and the quote are
+  // special.
+  std::string characters{'\n', '\r', '\0'};
+  if (!read_config_.quote->empty()) characters += read_config_.quote->front();
+  quoted_field_finder_ = CharacterFinder(characters);
+  // An unquoted field only ends at the delimiter.
+  if (!read_config_.delimiter->empty()) {
+    unquoted_field_finder_ = CharacterFinder(std::string_view(read_config_.delimiter->data(), 1));
+  }
+}
+
 void Reader::InitializeStream() {
   if (!std::filesystem::exists(path_)) {
     throw CsvReadException("CSV file not found: {}", path_.string());
@@ -127,8 +200,14 @@ Reader::ParsingResult Reader::ParseRow(utils::MemoryResource *mem) {
             state = CsvParserState::NEXT_FIELD;
             line_string_view.remove_prefix(read_config_.delimiter->size());
           } else {
-            // The current field is a regular field.
-            const auto delimiter_idx = line_string_view.find(*read_config_.delimiter);
+            // The current field is a regular field. Only the first character
+            // of the delimiter is searched for, the rest is checked at the
+            // candidate positions.
+            auto delimiter_idx = unquoted_field_finder_.Find(line_string_view);
+            while (delimiter_idx != std::string_view::npos &&
+                   !utils::StartsWith(line_string_view.substr(delimiter_idx), *read_config_.delimiter)) {
+              delimiter_idx = unquoted_field_finder_.Find(line_string_view, delimiter_idx + 1);
+            }
             row.emplace_back(line_string_view.substr(0, delimiter_idx));
             if (delimiter_idx == std::string_view::npos) {
               state = CsvParserState::DONE;
@@ -154,8 +233,11 @@ Reader::ParsingResult Reader::ParseRow(utils::MemoryResource *mem) {
             state = CsvParserState::EXPECT_DELIMITER;
             line_string_view.remove_prefix(read_config_.quote->size());
           } else {
-            column.push_back(c);
-            line_string_view.remove_prefix(1);
+            // Copy the run of ordinary characters up to the next quote, line
+            // break or null byte at once.
+            const auto run_end = std::min(quoted_field_finder_.Find(line_string_view, 1), line_string_view.size());
+            column += line_string_view.substr(0, run_end);
+            line_string_view.remove_prefix(run_end);
           }
           break;
         }
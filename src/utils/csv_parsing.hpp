@@ -18,11 +18,13 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "utils/exceptions.hpp"
@@ -36,6 +38,34 @@ class CsvReadException : public utils::BasicException {
   using utils::BasicException::BasicException;
 };
 
+/// Finds the next occurrence of any character from a small set in a string.
+///
+/// CSV parsers use it to find the characters that end a run of ordinary field
+/// characters (the first characters of the delimiter and the quote, line
+/// breaks and null bytes) and copy the whole run at once instead of looking
+/// at one character at a time. When the CPU supports AVX2, 32 bytes are
+/// compared against the whole set at once, otherwise a lookup table is used.
+class CharacterFinder {
+ public:
+  static constexpr size_t kMaxCharacters = 8;
+
+  CharacterFinder() = default;
+  /// @throw CsvReadException if there are more than `kMaxCharacters` characters
+  explicit CharacterFinder(std::string_view characters);
+
+  /// Returns the position of the first character from the set at or after
+  /// `pos`, or `std::string_view::npos` if there is none.
+  size_t Find(std::string_view data, size_t pos = 0) const;
+
+  /// Same as `Find`, but never uses SIMD instructions.
+  size_t FindScalar(std::string_view data, size_t pos = 0) const;
+
+ private:
+  std::array<char, kMaxCharacters> characters_{};
+  size_t size_{0};
+  std::array<bool, 256> lookup_{};
+};
+
 class Reader {
  public:
   struct Config {
@@ -60,6 +90,7 @@ class Reader {
     read_config_.ignore_bad = cfg.ignore_bad;
     read_config_.delimiter = cfg.delimiter ? std::move(*cfg.delimiter) : utils::pmr::string{",", memory_};
     read_config_.quote = cfg.quote ? std::move(*cfg.quote) : utils::pmr::string{"\"", memory_};
+    InitializeFinder();
     InitializeStream();
     TryInitializeHeader();
   }
@@ -93,6 +124,10 @@ class Reader {
   uint64_t line_count_{1};
   uint16_t number_of_columns_{0};
   Header header_{memory_};
+  CharacterFinder quoted_field_finder_;
+  CharacterFinder unquoted_field_finder_;
+
+  void InitializeFinder();
 
   void InitializeStream();
 
@@ -24,6 +24,7 @@
   M(ScanAllByLabelPropertyRangeOperator, "Number of times ScanAllByLabelPropertyRange operator was used.") \
   M(ScanAllByLabelPropertyValueOperator, "Number of times ScanAllByLabelPropertyValue operator was used.") \
   M(ScanAllByLabelPropertyOperator, "Number of times ScanAllByLabelProperty operator was used.")           \
+  M(ScanAllByLabelPropertiesOperator, "Number of times ScanAllByLabelProperties operator was used.")       \
   M(ScanAllByIdOperator, "Number of times ScanAllById operator was used.")                                 \
   M(ExpandOperator, "Number of times Expand operator was used.")                                           \
   M(ExpandVariableOperator, "Number of times ExpandVariable operator was used.")                           \
@@ -49,14 +50,33 @@
   M(UnionOperator, "Number of times Union operator was used.")                                             \
   M(CartesianOperator, "Number of times Cartesian operator was used.")                                     \
   M(CallProcedureOperator, "Number of times CallProcedure operator was used.")                             \
+  M(GatherOperator, "Number of times Gather operator was used.")                                           \
+  M(ScanAllEdgesByTypeOperator, "Number of times ScanAllEdgesByType operator was used.")                   \
+  M(ScanAllEdgesByTypePropertyOperator, "Number of times ScanAllEdgesByTypeProperty operator was used.")   \
                                                                                                            \
   M(FailedQuery, "Number of times executing a query failed.")                                              \
   M(LabelIndexCreated, "Number of times a label index was created.")                                       \
   M(LabelPropertyIndexCreated, "Number of times a label property index was created.")                      \
+  M(LabelPropertyCompositeIndexCreated, "Number of times a composite index was created.")                  \
+  M(LabelPropertyHashIndexCreated, "Number of times a hash index was created.")                            \
+  M(EdgeTypeIndexCreated, "Number of times an edge type index was created.")                               \
+  M(EdgeTypePropertyIndexCreated, "Number of times an edge type property index was created.")              \
   M(StreamsCreated, "Number of Streams created.")                                                          \
   M(MessagesConsumed, "Number of consumed streamed messages.")                                             \
   M(TriggersCreated, "Number of Triggers created.")                                                        \
-  M(TriggersExecuted, "Number of Triggers executed.")
+  M(TriggersExecuted, "Number of Triggers executed.")                                                      \
+                                                                                                           \
+  M(AstCacheHit, "Number of times a parsed query was found in the AST cache.")                             \
+  M(AstCacheMiss, "Number of times a query had to be parsed because it wasn't in the AST cache.")          \
+  M(AstCacheEviction, "Number of ASTs evicted from the full AST cache.")                                   \
+  M(PlanCacheHit, "Number of times a query plan was found in the plan cache.")                             \
+  M(PlanCacheMiss, "Number of times a query had to be planned because it wasn't in the plan cache.")       \
+  M(PlanCacheEviction, "Number of query plans evicted from the full plan cache.")                          \
+                                                                                                           \
+  M(GcUnlinkedTransactions, "Number of committed transactions whose deltas were unlinked by the GC.")      \
+  M(GcUnlinkBudgetExceeded, "Number of GC cycles that ran out of time while unlinking deltas.")            \
+  M(GcRemovedVertices, "Number of deleted vertices removed from the storage by the GC.")                   \
+  M(GcRemovedEdges, "Number of deleted edges removed from the storage by the GC.")
 
 namespace EventCounter {
 
@@ -12,6 +12,7 @@
 #include "utils/file.hpp"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -21,6 +22,7 @@
 #include <mutex>
 #include <shared_mutex>
 #include <type_traits>
+#include <utility>
 
 #include "utils/logging.hpp"
 
@@ -288,6 +290,89 @@ bool InputFile::LoadBuffer() {
   return true;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : is_open_(std::exchange(other.is_open_, false)),
+      path_(std::move(other.path_)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  Close();
+
+  is_open_ = std::exchange(other.is_open_, false);
+  path_ = std::move(other.path_);
+  data_ = std::exchange(other.data_, nullptr);
+  size_ = std::exchange(other.size_, 0);
+
+  return *this;
+}
+
+bool MappedFile::Open(const std::filesystem::path &path) {
+  if (IsOpen()) return false;
+
+  int fd = -1;
+  while (true) {
+    fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    }
+    break;
+  }
+  if (fd == -1) return false;
+
+  // The mapping stays valid after the file descriptor is closed.
+  struct stat file_stat;
+  void *data = nullptr;
+  bool success = fstat(fd, &file_stat) == 0;
+  // Empty files can't be mapped, but there is nothing to read from them
+  // anyway.
+  if (success && file_stat.st_size > 0) {
+    data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    success = data != MAP_FAILED;
+  }
+  close(fd);
+  if (!success) return false;
+
+  is_open_ = true;
+  path_ = path;
+  data_ = static_cast<uint8_t *>(data);
+  size_ = file_stat.st_size;
+
+  if (data_ != nullptr) {
+    // The advice is only a hint, so the errors are ignored.
+    madvise(data_, size_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    madvise(data_, size_, MADV_HUGEPAGE);
+#endif
+  }
+
+  return true;
+}
+
+bool MappedFile::IsOpen() const { return is_open_; }
+
+const std::filesystem::path &MappedFile::path() const { return path_; }
+
+const uint8_t *MappedFile::data() const { return data_; }
+
+size_t MappedFile::GetSize() const { return size_; }
+
+void MappedFile::Close() noexcept {
+  if (!IsOpen()) return;
+
+  if (data_ != nullptr && munmap(data_, size_) != 0) {
+    spdlog::error("While trying to unmap {} an error occured: {} ({})", path_, strerror(errno), errno);
+  }
+
+  is_open_ = false;
+  path_ = "";
+  data_ = nullptr;
+  size_ = 0;
+}
+
 OutputFile::~OutputFile() {
   if (IsOpen()) Close();
 }
@@ -473,6 +558,15 @@ void OutputFile::Sync() {
   written_since_last_sync_ = 0;
 }
 
+int OutputFile::FlushAndDuplicate() {
+  FlushBuffer(true);
+
+  int fd = dup(fd_);
+  MG_ASSERT(fd != -1, "While trying to duplicate the descriptor of {}, an error occurred: {} ({}).", path_,
+            strerror(errno), errno);
+  return fd;
+}
+
 void OutputFile::Close() noexcept {
   FlushBuffer(true);
 
@@ -561,4 +655,30 @@ void OutputFile::TryFlushing() {
   }
 }
 
+void SyncDataAndClose(int fd, const std::filesystem::path &path) {
+  int ret = 0;
+  while (true) {
+    ret = fdatasync(fd);
+    if (ret == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    } else {
+      break;
+    }
+  }
+  // The same reasoning as in `OutputFile::Sync` applies, any error here means
+  // that some of the written data could have been lost.
+  MG_ASSERT(ret == 0, "While trying to sync {}, an error occurred: {} ({}).", path, strerror(errno), errno);
+
+  while (true) {
+    ret = close(fd);
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    } else {
+      break;
+    }
+  }
+  MG_ASSERT(ret == 0, "While trying to close {}, an error occurred: {} ({}).", path, strerror(errno), errno);
+}
+
 }  // namespace memgraph::utils
@@ -143,6 +143,52 @@ class InputFile {
   size_t buffer_position_{0};
 };
 
+/// This class maps a whole file into memory for reading. Reading the mapped
+/// data doesn't require any system calls or copying into an intermediate
+/// buffer, which makes it suitable for decoding large files that are read
+/// once, e.g. snapshots during recovery. The mapping is advised to be read
+/// sequentially and to be backed by huge pages when the kernel supports it.
+///
+/// The mapping can be read by many threads concurrently. The file mustn't be
+/// truncated while it is mapped.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+
+  /// This method opens and maps the file. If the file can't be opened or
+  /// mapped it returns `false`.
+  bool Open(const std::filesystem::path &path);
+
+  /// Returns a boolean indicating whether a file is mapped.
+  bool IsOpen() const;
+
+  /// Returns the path to the currently mapped file. If a file isn't mapped the
+  /// path is empty.
+  const std::filesystem::path &path() const;
+
+  /// Returns the mapped data of the file.
+  const uint8_t *data() const;
+
+  /// This method gets the size of the file.
+  size_t GetSize() const;
+
+  /// Unmaps the currently mapped file.
+  void Close() noexcept;
+
+ private:
+  bool is_open_{false};
+  std::filesystem::path path_;
+  uint8_t *data_{nullptr};
+  size_t size_{0};
+};
+
 /// This class implements a file handler that is used for mission critical files
 /// that need to be written and synced to permanent storage. Typical usage for
 /// this class is in implementation of write-ahead logging or anything similar
@@ -232,6 +278,13 @@ class OutputFile {
   /// and misuse it crashes the program.
   void Sync();
 
+  /// Writes the internal buffer to the currently opened file and returns a
+  /// duplicate of its file descriptor. The data written so far can then be
+  /// synced with `SyncDataAndClose` without holding on to this object, even
+  /// if the file is closed in the meantime. On failure and misuse it crashes
+  /// the program.
+  int FlushAndDuplicate();
+
   /// Closes the currently opened file. It doesn't perform a `Sync` on the
   /// file. On failure and misuse it crashes the program.
   void Close() noexcept;
@@ -269,4 +322,9 @@ class OutputFile {
   utils::RWLock flush_lock_{RWLock::Priority::WRITE};
 };
 
+/// Syncs the data of the file referred to by the descriptor using `fdatasync`
+/// and closes the descriptor. The `path` is only used for error messages. On
+/// failure it crashes the program, see `OutputFile::Sync`.
+void SyncDataAndClose(int fd, const std::filesystem::path &path);
+
 }  // namespace memgraph::utils
@@ -20,6 +20,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "utils/bound.hpp"
 #include "utils/linux.hpp"
@@ -736,6 +737,19 @@ class SkipList final {
       return skiplist_->template estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    /// Returns up to `max_partitions - 1` items that split the list into
+    /// ranges of approximately equal size. The items are sampled from the
+    /// highest layer that still has enough nodes, so the cost is proportional
+    /// to the number of partitions and not to the size of the list. Items
+    /// that are inserted or removed concurrently may end up in either of the
+    /// neighbouring ranges.
+    ///
+    /// @return ordered vector of iterators to the first item of every range
+    ///         except the first one
+    std::vector<Iterator> partition_points(uint64_t max_partitions) const {
+      return skiplist_->partition_points(max_partitions);
+    }
+
     /// Removes the key from the list.
     ///
     /// @return bool indicating whether the removal was successful
@@ -1020,6 +1034,39 @@ class SkipList final {
     return Iterator{nullptr};
   }
 
+  std::vector<Iterator> partition_points(uint64_t max_partitions) const {
+    std::vector<Iterator> points;
+    uint64_t size = size_.load(std::memory_order_acquire);
+    if (max_partitions <= 1 || size < max_partitions) return points;
+
+    // Here we assume that the list is perfectly balanced, i.e. that layer `L`
+    // has `size / 2^L` nodes. We pick a layer with roughly
+    // `kSamplesPerPartition` nodes per partition so that the distances between
+    // neighbouring nodes even out, and sample evenly spaced nodes from it.
+    const uint64_t kSamplesPerPartition = 8;
+    int layer = static_cast<int>(
+        std::min(utils::Log2(size / (max_partitions * kSamplesPerPartition)), kSkipListMaxHeight - 1));
+    std::vector<TNode *> candidates;
+    for (; layer >= 0; --layer) {
+      candidates.clear();
+      TNode *curr = head_->nexts[layer].load(std::memory_order_acquire);
+      while (curr != nullptr) {
+        if (curr->fully_linked.load(std::memory_order_acquire) && !curr->marked.load(std::memory_order_acquire)) {
+          candidates.push_back(curr);
+        }
+        curr = curr->nexts[layer].load(std::memory_order_acquire);
+      }
+      if (candidates.size() >= max_partitions) break;
+    }
+    if (candidates.size() < max_partitions) return points;
+
+    points.reserve(max_partitions - 1);
+    for (uint64_t i = 1; i < max_partitions; ++i) {
+      points.push_back(Iterator{candidates[i * candidates.size() / max_partitions]});
+    }
+    return points;
+  }
+
   template <typename TKey>
   uint64_t estimate_count(const TKey &key, int max_layer_for_estimation) const {
     MG_ASSERT(max_layer_for_estimation >= 1 && max_layer_for_estimation <= kSkipListMaxHeight,
@@ -144,6 +144,8 @@ class InteractiveDbAccessor {
   auto NameToProperty(const std::string &name) { return dba_->NameToProperty(name); }
   auto NameToEdgeType(const std::string &name) { return dba_->NameToEdgeType(name); }
 
+  auto GetGraphStatistics() { return dba_->GetGraphStatistics(); }
+
   int64_t VerticesCount() { return vertices_count_; }
 
   int64_t VerticesCount(memgraph::storage::LabelId label_id) {
@@ -213,6 +215,43 @@ class InteractiveDbAccessor {
     return label_property_index_.at(key);
   }
 
+  // Hash indices aren't part of the saved planning state, so the planner never
+  // picks them in interactive mode.
+  bool LabelPropertyHashIndexExists(memgraph::storage::LabelId, memgraph::storage::PropertyId) { return false; }
+
+  // Property columns aren't part of the saved planning state either.
+  bool PropertyColumnExists(memgraph::storage::LabelId, memgraph::storage::PropertyId) { return false; }
+
+  // Composite indices aren't part of the saved planning state, so the planner
+  // never picks them in interactive mode.
+  bool LabelPropertyCompositeIndexExists(memgraph::storage::LabelId,
+                                         const std::vector<memgraph::storage::PropertyId> &) {
+    return false;
+  }
+
+  std::vector<std::vector<memgraph::storage::PropertyId>> LabelPropertyCompositeIndices(memgraph::storage::LabelId) {
+    return {};
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId, const std::vector<memgraph::storage::PropertyId> &,
+                        const std::vector<memgraph::storage::PropertyValue> &) {
+    return 0;
+  }
+
+  // Edge indices aren't part of the saved planning state either.
+  bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId) { return false; }
+
+  bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId) { return false; }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId) { return 0; }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId) { return 0; }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId,
+                     const memgraph::storage::PropertyValue &) {
+    return 0;
+  }
+
   // Save the cached vertex counts to a stream.
   void Save(std::ostream &out) {
     out << "vertex-count " << vertices_count_ << std::endl;
@@ -9,11 +9,17 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <random>
+
+#include <gflags/gflags.h>
+
 #include "bfs_common.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
 
+DECLARE_uint64(query_bfs_workers);
+
 class SingleNodeDb : public Database {
  public:
   SingleNodeDb() : db_() {}
@@ -111,3 +117,120 @@ INSTANTIATE_TEST_CASE_P(FilterLambda, SingleNodeBfsTest,
                                          testing::Values(FilterLambdaType::NONE, FilterLambdaType::USE_FRAME,
                                                          FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
                                                          FilterLambdaType::ERROR)));
+
+// Runs breadth-first expansions on a random graph whose frontiers are large
+// enough to be expanded by the BFS workers, with and without the workers.
+// The workers must not change the results nor their order.
+class ParallelBfsTest : public ::testing::Test {
+ protected:
+  static constexpr int kRandomVertexCount = 3000;
+  static constexpr int kSourceCount = 10;
+  static constexpr int kHubDegree = 1200;
+
+  void SetUp() override {
+    auto storage_dba = db_.Access();
+    DbAccessor dba(&storage_dba);
+    std::mt19937 gen(42);
+    std::vector<VertexAccessor> vertices;
+    for (int64_t id = 0; id < kRandomVertexCount; ++id) {
+      auto vertex = dba.InsertVertex();
+      ASSERT_TRUE(vertex.SetProperty(dba.NameToProperty("id"), memgraph::storage::PropertyValue(id)).HasValue());
+      vertices.push_back(vertex);
+    }
+    auto type = dba.NameToEdgeType("type");
+    auto random_vertex = [&] { return &vertices[gen() % kRandomVertexCount]; };
+    for (int i = 0; i < 3 * kRandomVertexCount; ++i) {
+      ASSERT_TRUE(dba.InsertEdge(random_vertex(), random_vertex(), type).HasValue());
+    }
+    // The sources and the sinks are hubs, so the frontiers are large right
+    // after the first expansion.
+    for (int i = 0; i < kSourceCount; ++i) {
+      for (int j = 0; j < kHubDegree; ++j) {
+        ASSERT_TRUE(dba.InsertEdge(&vertices[i], random_vertex(), type).HasValue());
+        ASSERT_TRUE(dba.InsertEdge(random_vertex(), &vertices[kRandomVertexCount - 1 - i], type).HasValue());
+      }
+    }
+    ASSERT_FALSE(dba.Commit().HasError());
+  }
+
+  void TearDown() override { FLAGS_query_bfs_workers = 0; }
+
+  // Returns the gids of the source, the sink and the path edges of each row.
+  // The `batched` cursor is used by consumers which pull all rows.
+  std::vector<std::vector<int64_t>> RunBfs(uint64_t workers, bool known_sink, bool use_filter_lambda,
+                                           bool batched = true) {
+    FLAGS_query_bfs_workers = workers;
+    auto storage_dba = db_.Access();
+    DbAccessor dba(&storage_dba);
+    AstStorage storage;
+    ExecutionContext context{&dba};
+    auto source_sym = context.symbol_table.CreateSymbol("source", true);
+    auto sink_sym = context.symbol_table.CreateSymbol("sink", true);
+    auto edges_sym = context.symbol_table.CreateSymbol("edges", true);
+    auto inner_node_sym = context.symbol_table.CreateSymbol("inner_node", true);
+    auto inner_edge_sym = context.symbol_table.CreateSymbol("inner_edge", true);
+
+    auto source_id = PROPERTY_LOOKUP(IDENT("source")->MapTo(source_sym), PROPERTY_PAIR("id"));
+    std::shared_ptr<LogicalOperator> input_op = std::make_shared<ScanAll>(nullptr, source_sym);
+    input_op = std::make_shared<Filter>(input_op, LESS(source_id, LITERAL(kSourceCount)));
+    if (known_sink) {
+      input_op = std::make_shared<ScanAll>(input_op, sink_sym);
+      auto sink_id = PROPERTY_LOOKUP(IDENT("sink")->MapTo(sink_sym), PROPERTY_PAIR("id"));
+      input_op = std::make_shared<Filter>(input_op, GREATER_EQ(sink_id, LITERAL(kRandomVertexCount - kSourceCount)));
+    }
+    Expression *filter_expr = nullptr;
+    if (use_filter_lambda) {
+      auto inner_node_id = PROPERTY_LOOKUP(IDENT("inner_node")->MapTo(inner_node_sym), PROPERTY_PAIR("id"));
+      filter_expr = NEQ(storage.Create<ModOperator>(inner_node_id, LITERAL(7)), LITERAL(3));
+    }
+    auto bfs_op = std::make_shared<ExpandVariable>(
+        input_op, source_sym, sink_sym, edges_sym, EdgeAtom::Type::BREADTH_FIRST, EdgeAtom::Direction::BOTH,
+        std::vector<memgraph::storage::EdgeTypeId>{}, false, nullptr, nullptr, known_sink,
+        ExpansionLambda{inner_edge_sym, inner_node_sym, filter_expr}, std::nullopt, std::nullopt);
+    context.evaluation_context.properties = NamesToProperties(storage.properties_, &dba);
+
+    auto cursor = batched ? bfs_op->MakeBatchedCursor(memgraph::utils::NewDeleteResource())
+                          : bfs_op->MakeCursor(memgraph::utils::NewDeleteResource());
+    Frame frame(context.symbol_table.max_position());
+    std::vector<std::vector<int64_t>> rows;
+    while (cursor->Pull(frame, context)) {
+      auto &gids = rows.emplace_back();
+      gids.push_back(frame[source_sym].ValueVertex().CypherId());
+      gids.push_back(frame[sink_sym].ValueVertex().CypherId());
+      for (const auto &edge : frame[edges_sym].ValueList()) gids.push_back(edge.ValueEdge().CypherId());
+    }
+    return rows;
+  }
+
+  memgraph::storage::Storage db_;
+};
+
+TEST_F(ParallelBfsTest, SingleSource) {
+  auto serial = RunBfs(0, false, false);
+  ASSERT_GT(serial.size(), kRandomVertexCount);
+  EXPECT_EQ(RunBfs(4, false, false), serial);
+}
+
+TEST_F(ParallelBfsTest, SingleSourceUnbatched) {
+  auto serial = RunBfs(0, false, false);
+  ASSERT_GT(serial.size(), kRandomVertexCount);
+  EXPECT_EQ(RunBfs(4, false, false, false), serial);
+}
+
+TEST_F(ParallelBfsTest, SingleSourceWithFilterLambda) {
+  auto serial = RunBfs(0, false, true);
+  ASSERT_FALSE(serial.empty());
+  EXPECT_EQ(RunBfs(4, false, true), serial);
+}
+
+TEST_F(ParallelBfsTest, SourceAndSink) {
+  auto serial = RunBfs(0, true, false);
+  ASSERT_FALSE(serial.empty());
+  EXPECT_EQ(RunBfs(4, true, false), serial);
+}
+
+TEST_F(ParallelBfsTest, SourceAndSinkWithFilterLambda) {
+  auto serial = RunBfs(0, true, true);
+  ASSERT_FALSE(serial.empty());
+  EXPECT_EQ(RunBfs(4, true, true), serial);
+}
@@ -26,6 +26,7 @@ static const char *kInvalidQuery = "invalid query";
 static const char *kQueryReturn42 = "RETURN 42";
 static const char *kQueryReturnMultiple = "UNWIND [1,2,3] as n RETURN n";
 static const char *kQueryEmpty = "no results";
+static const char *kUnreachableBookmark = "unreachable";
 
 class TestSessionData {};
 
@@ -37,7 +38,8 @@ class TestSession : public Session<TestInputStream, TestOutputStream> {
       : Session<TestInputStream, TestOutputStream>(input_stream, output_stream) {}
 
   std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, Value> &params) override {
+      const std::string &query, const std::map<std::string, Value> &params,
+      const std::map<std::string, Value> &extra) override {
     if (query == kQueryReturn42 || query == kQueryEmpty || query == kQueryReturnMultiple) {
       query_ = query;
       return {{"result_name"}, {}};
@@ -76,8 +78,16 @@ class TestSession : public Session<TestInputStream, TestOutputStream> {
 
   std::map<std::string, Value> Discard(std::optional<int>, std::optional<int>) override { return {}; }
 
-  void BeginTransaction() override {}
-  void CommitTransaction() override {}
+  void BeginTransaction(const std::map<std::string, Value> &extra) override {
+    if (!extra.count("bookmarks")) return;
+    const auto &bookmark = extra.at("bookmarks").ValueList().at(0).ValueString();
+    if (bookmark == kUnreachableBookmark) throw ClientError("bookmark wasn't reached");
+    bookmark_ = bookmark;
+  }
+  std::map<std::string, Value> CommitTransaction() override {
+    if (bookmark_.empty()) return {};
+    return {{"bookmark", bookmark_}};
+  }
   void RollbackTransaction() override {}
 
   void Abort() override {}
@@ -88,6 +98,7 @@ class TestSession : public Session<TestInputStream, TestOutputStream> {
 
  private:
   std::string query_;
+  std::string bookmark_;
 };
 
 // TODO: This could be done in fixture.
@@ -139,6 +150,12 @@ constexpr uint8_t pull_one_req[] = {0xb1, 0x3f, 0xa1, 0x81, 0x6e, 0x01};
 constexpr uint8_t reset_req[] = {0xb0, 0x0f};
 constexpr uint8_t goodbye[] = {0xb0, 0x02};
 constexpr uint8_t rollback[] = {0xb0, 0x13};
+constexpr uint8_t begin_with_bookmark[] = {0xb1, 0x11, 0xa1, 0x89, 0x62, 0x6f, 0x6f, 0x6b, 0x6d, 0x61,
+                                           0x72, 0x6b, 0x73, 0x91, 0x82, 0x62, 0x31};
+constexpr uint8_t begin_with_unreachable_bookmark[] = {0xb1, 0x11, 0xa1, 0x89, 0x62, 0x6f, 0x6f, 0x6b, 0x6d,
+                                                       0x61, 0x72, 0x6b, 0x73, 0x91, 0x8b, 0x75, 0x6e, 0x72,
+                                                       0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65};
+constexpr uint8_t commit[] = {0xb0, 0x12};
 }  // namespace v4
 
 namespace v4_1 {
@@ -990,3 +1007,39 @@ TEST(BoltSession, Rollback) {
     ASSERT_THROW(ExecuteCommand(input_stream, session, v4::rollback, sizeof(v4::rollback)), SessionException);
   }
 }
+
+TEST(BoltSession, Bookmarks) {
+  // The bookmarks are passed to the session and the bookmark of the committed
+  // transaction is sent in the metadata.
+  {
+    INIT_VARS;
+
+    ExecuteHandshake(input_stream, session, output, v4::handshake_req, v4::handshake_resp);
+    ExecuteInit(input_stream, session, output, true);
+    ExecuteCommand(input_stream, session, v4::begin_with_bookmark, sizeof(v4::begin_with_bookmark));
+    ASSERT_EQ(session.state_, State::Idle);
+    CheckSuccessMessage(output);
+
+    ExecuteCommand(input_stream, session, v4::commit, sizeof(v4::commit));
+    ASSERT_EQ(session.state_, State::Idle);
+    CheckSuccessMessage(output, false);
+    const std::string response(output.begin(), output.end());
+    ASSERT_NE(response.find("bookmark"), std::string::npos);
+    ASSERT_NE(response.find("b1"), std::string::npos);
+  }
+  // The transaction isn't started and only the failure is sent if the
+  // bookmark isn't reached.
+  {
+    INIT_VARS;
+
+    ExecuteHandshake(input_stream, session, output, v4::handshake_req, v4::handshake_resp);
+    ExecuteInit(input_stream, session, output, true);
+    ExecuteCommand(input_stream, session, v4::begin_with_unreachable_bookmark,
+                   sizeof(v4::begin_with_unreachable_bookmark));
+    ASSERT_EQ(session.state_, State::Error);
+    // The response is a single chunk with the failure message.
+    ASSERT_GE(output.size(), 2);
+    ASSERT_EQ(output.size(), ((output[0] << 8) | output[1]) + 4);
+    CheckFailureMessage(output);
+  }
+}
@@ -10,10 +10,12 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <limits>
 #include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -1713,9 +1715,102 @@ TEST_P(CypherMainVisitorTest, DropIndexWithoutProperties) {
   EXPECT_THROW(ast_generator.ParseQuery("dRoP InDeX oN :mirko()"), SyntaxException);
 }
 
+TEST_P(CypherMainVisitorTest, CreateIndexWithMultipleProperties) {
+  auto &ast_generator = *GetParam();
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("Create InDeX oN :mirko(slavko, pero)"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::CREATE);
+  EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko"), ast_generator.Prop("pero")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
 TEST_P(CypherMainVisitorTest, DropIndexWithMultipleProperties) {
   auto &ast_generator = *GetParam();
-  EXPECT_THROW(ast_generator.ParseQuery("dRoP InDeX oN :mirko(slavko, pero)"), SyntaxException);
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("dRoP InDeX oN :mirko(slavko, pero)"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::DROP);
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko"), ast_generator.Prop("pero")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, CreateHashIndex) {
+  auto &ast_generator = *GetParam();
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("Create InDeX oN :mirko(slavko) uSiNg HaSh"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::CREATE);
+  EXPECT_EQ(index_query->index_type_, IndexQuery::IndexType::HASH);
+  EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, DropHashIndex) {
+  auto &ast_generator = *GetParam();
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("dRoP InDeX oN :mirko(slavko) USING HASH"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::DROP);
+  EXPECT_EQ(index_query->index_type_, IndexQuery::IndexType::HASH);
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, CreateEdgeIndex) {
+  auto &ast_generator = *GetParam();
+  auto *index_query = dynamic_cast<EdgeIndexQuery *>(ast_generator.ParseQuery("Create EdGe InDeX oN :mirko"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, EdgeIndexQuery::Action::CREATE);
+  EXPECT_EQ(index_query->edge_type_, ast_generator.EdgeType("mirko"));
+  EXPECT_TRUE(index_query->properties_.empty());
+}
+
+TEST_P(CypherMainVisitorTest, DropEdgeIndexWithProperty) {
+  auto &ast_generator = *GetParam();
+  auto *index_query = dynamic_cast<EdgeIndexQuery *>(ast_generator.ParseQuery("dRoP EdGe InDeX oN :mirko(slavko)"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, EdgeIndexQuery::Action::DROP);
+  EXPECT_EQ(index_query->edge_type_, ast_generator.EdgeType("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, CreateEdgeIndexWithMultipleProperties) {
+  auto &ast_generator = *GetParam();
+  EXPECT_THROW(ast_generator.ParseQuery("CREATE EDGE INDEX ON :mirko(slavko, pero)"), SyntaxException);
+}
+
+TEST_P(CypherMainVisitorTest, CreatePropertyColumns) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<PropertyColumnsQuery *>(
+      ast_generator.ParseQuery("CrEaTe PrOpErTy CoLuMnS oN :mirko(slavko INT, pero float, jozo Boolean)"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->action_, PropertyColumnsQuery::Action::CREATE);
+  EXPECT_EQ(query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko"), ast_generator.Prop("pero"),
+                                              ast_generator.Prop("jozo")};
+  EXPECT_EQ(query->properties_, expected_properties);
+  std::vector<PropertyColumnsQuery::ColumnType> expected_types{PropertyColumnsQuery::ColumnType::INT,
+                                                               PropertyColumnsQuery::ColumnType::DOUBLE,
+                                                               PropertyColumnsQuery::ColumnType::BOOL};
+  EXPECT_EQ(query->column_types_, expected_types);
+}
+
+TEST_P(CypherMainVisitorTest, CreatePropertyColumnsInvalid) {
+  auto &ast_generator = *GetParam();
+  EXPECT_THROW(ast_generator.ParseQuery("CREATE PROPERTY COLUMNS ON :mirko(slavko STRING)"), SemanticException);
+  EXPECT_THROW(ast_generator.ParseQuery("CREATE PROPERTY COLUMNS ON :mirko(slavko INT, slavko FLOAT)"),
+               SemanticException);
+  EXPECT_THROW(ast_generator.ParseQuery("CREATE PROPERTY COLUMNS ON :mirko(slavko)"), SyntaxException);
+  EXPECT_THROW(ast_generator.ParseQuery("CREATE PROPERTY COLUMNS ON :mirko()"), SyntaxException);
+}
+
+TEST_P(CypherMainVisitorTest, DropPropertyColumns) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<PropertyColumnsQuery *>(ast_generator.ParseQuery("dRoP pRoPeRtY cOlUmNs On :mirko"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->action_, PropertyColumnsQuery::Action::DROP);
+  EXPECT_EQ(query->label_, ast_generator.Label("mirko"));
+  EXPECT_TRUE(query->properties_.empty());
 }
 
 TEST_P(CypherMainVisitorTest, ReturnAll) {
@@ -4080,6 +4175,26 @@ TEST_P(CypherMainVisitorTest, SettingQuery) {
                          TypedValue{"setting"}, TypedValue{"value"});
 }
 
+TEST_P(CypherMainVisitorTest, AnalyzeGraphQuery) {
+  auto &ast_generator = *GetParam();
+
+  TestInvalidQuery("ANALYZE", ast_generator);
+  TestInvalidQuery("ANALYZE GRAPHS", ast_generator);
+  TestInvalidQuery("ANALYZE GRAPH DELETE", ast_generator);
+  TestInvalidQuery("ANALYZE GRAPH STATISTICS", ast_generator);
+
+  {
+    auto *query = dynamic_cast<AnalyzeGraphQuery *>(ast_generator.ParseQuery("ANALYZE GRAPH"));
+    ASSERT_TRUE(query);
+    EXPECT_EQ(query->action_, AnalyzeGraphQuery::Action::ANALYZE);
+  }
+  {
+    auto *query = dynamic_cast<AnalyzeGraphQuery *>(ast_generator.ParseQuery("ANALYZE GRAPH DELETE STATISTICS"));
+    ASSERT_TRUE(query);
+    EXPECT_EQ(query->action_, AnalyzeGraphQuery::Action::DELETE_STATISTICS);
+  }
+}
+
 TEST_P(CypherMainVisitorTest, VersionQuery) {
   auto &ast_generator = *GetParam();
 
@@ -4088,3 +4203,37 @@ TEST_P(CypherMainVisitorTest, VersionQuery) {
   TestInvalidQuery("SHOW VERSIONS", ast_generator);
   ASSERT_NO_THROW(ast_generator.ParseQuery("SHOW VERSION"));
 }
+
+TEST(CypherParser, ConcurrentParsing) {
+  // Every thread parses with its own DFA cache, so the parsers can run at the
+  // same time without a lock.
+  const std::vector<std::string> queries{"MATCH (n:Label {prop: 42})-[r:TYPE*1..3]->(m) WHERE n.x > m.y RETURN n, r, m",
+                                         "CREATE (a:A)-[:E {w: 1.5}]->(b:B) SET a.list = [1, 2, 3] RETURN a",
+                                         "UNWIND range(1, 10) AS x WITH x WHERE x % 2 = 0 RETURN collect(x) AS xs",
+                                         "MATCH (n) OPTIONAL MATCH (n)<-[e]-() RETURN count(DISTINCT e) ORDER BY 1"};
+  std::atomic<uint64_t> parsed{0};
+  std::atomic<uint64_t> syntax_errors{0};
+  constexpr auto kThreads = 8;
+  constexpr auto kIterations = 50;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < kIterations; ++j) {
+        AstStorage ast_storage;
+        ParsingContext context;
+        ::frontend::opencypher::Parser parser(queries[(i + j) % queries.size()]);
+        CypherMainVisitor visitor(context, &ast_storage);
+        visitor.visit(parser.tree());
+        if (dynamic_cast<CypherQuery *>(visitor.query())) ++parsed;
+        try {
+          ::frontend::opencypher::Parser invalid("MATCH (n RETURN n");
+        } catch (const SyntaxException &) {
+          ++syntax_errors;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(parsed, kThreads * kIterations);
+  EXPECT_EQ(syntax_errors, kThreads * kIterations);
+}
@@ -22,14 +22,22 @@
 #include "query/config.hpp"
 #include "query/exceptions.hpp"
 #include "query/interpreter.hpp"
+#include "query/query_cache.hpp"
 #include "query/stream.hpp"
 #include "query/typed_value.hpp"
 #include "query_common.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/csv_parsing.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
 
+namespace EventCounter {
+extern const Event PlanCacheHit;
+extern const Event PlanCacheMiss;
+extern const Event PlanCacheEviction;
+}  // namespace EventCounter
+
 namespace {
 
 auto ToEdgeList(const memgraph::communication::bolt::Value &v) {
@@ -607,8 +615,8 @@ TEST_F(InterpreterTest, UniqueConstraintTest) {
 TEST_F(InterpreterTest, ExplainQuery) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   auto stream = Interpret("EXPLAIN MATCH (n) RETURN *;");
   ASSERT_EQ(stream.GetHeader().size(), 1U);
   EXPECT_EQ(stream.GetHeader().front(), "QUERY PLAN");
@@ -621,19 +629,19 @@ TEST_F(InterpreterTest, ExplainQuery) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
 }
 
 TEST_F(InterpreterTest, ExplainQueryMultiplePulls) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   auto [stream, qid] = Prepare("EXPLAIN MATCH (n) RETURN *;");
   ASSERT_EQ(stream.GetHeader().size(), 1U);
   EXPECT_EQ(stream.GetHeader().front(), "QUERY PLAN");
@@ -656,19 +664,19 @@ TEST_F(InterpreterTest, ExplainQueryMultiplePulls) {
   ASSERT_EQ(stream.GetResults()[2].size(), 1U);
   EXPECT_EQ(stream.GetResults()[2].front().ValueString(), *expected_it);
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
 }
 
 TEST_F(InterpreterTest, ExplainQueryInMulticommandTransaction) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   Interpret("BEGIN");
   auto stream = Interpret("EXPLAIN MATCH (n) RETURN *;");
   Interpret("COMMIT");
@@ -683,19 +691,19 @@ TEST_F(InterpreterTest, ExplainQueryInMulticommandTransaction) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
 }
 
 TEST_F(InterpreterTest, ExplainQueryWithParams) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   auto stream =
       Interpret("EXPLAIN MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue(42)}});
   ASSERT_EQ(stream.GetHeader().size(), 1U);
@@ -709,19 +717,75 @@ TEST_F(InterpreterTest, ExplainQueryWithParams) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue("something else")}});
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
+}
+
+TEST(QueryCache, EvictsLeastRecentlyUsed) {
+  const auto count = [](auto event) { return EventCounter::global_counters[event].load(); };
+  const auto hits = count(EventCounter::PlanCacheHit);
+  const auto misses = count(EventCounter::PlanCacheMiss);
+  const auto evictions = count(EventCounter::PlanCacheEviction);
+
+  memgraph::query::QueryCache<int> cache(
+      100, {EventCounter::PlanCacheHit, EventCounter::PlanCacheMiss, EventCounter::PlanCacheEviction});
+  cache.Insert(1, std::make_shared<int>(1), 40);
+  cache.Insert(2, std::make_shared<int>(2), 40);
+  EXPECT_EQ(cache.Size(), 2U);
+  EXPECT_EQ(cache.SizeBytes(), 80U);
+
+  // The first entry becomes the most recently used one.
+  ASSERT_TRUE(cache.Find(1));
+  EXPECT_EQ(*cache.Find(1), 1);
+  cache.Insert(3, std::make_shared<int>(3), 40);
+  EXPECT_EQ(cache.Size(), 2U);
+  EXPECT_EQ(cache.SizeBytes(), 80U);
+  EXPECT_FALSE(cache.Find(2));
+  EXPECT_TRUE(cache.Find(3));
+
+  // The existing entry is kept when the same key is inserted again.
+  EXPECT_EQ(*cache.Insert(3, std::make_shared<int>(4), 40), 3);
+
+  // An entry larger than the whole cache isn't cached.
+  EXPECT_EQ(*cache.Insert(5, std::make_shared<int>(5), 200), 5);
+  EXPECT_FALSE(cache.Find(5));
+
+  // Stale entries are removed.
+  EXPECT_FALSE(cache.Find(3, [](int value) { return value == 3; }));
+  EXPECT_EQ(cache.Size(), 1U);
+  EXPECT_EQ(cache.SizeBytes(), 40U);
+
+  cache.Clear();
+  EXPECT_EQ(cache.Size(), 0U);
+  EXPECT_EQ(cache.SizeBytes(), 0U);
+
+  EXPECT_EQ(count(EventCounter::PlanCacheHit) - hits, 3U);
+  EXPECT_EQ(count(EventCounter::PlanCacheMiss) - misses, 3U);
+  EXPECT_EQ(count(EventCounter::PlanCacheEviction) - evictions, 1U);
+}
+
+TEST_F(InterpreterTest, ConstraintQueryInvalidatesPlanCache) {
+  const auto &interpreter_context = default_interpreter.interpreter_context;
+
+  Interpret("MATCH (n:A) RETURN n;");
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  Interpret("CREATE CONSTRAINT ON (n:A) ASSERT EXISTS (n.a);");
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  Interpret("MATCH (n:A) RETURN n;");
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  Interpret("DROP CONSTRAINT ON (n:A) ASSERT EXISTS (n.a);");
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
 }
 
 TEST_F(InterpreterTest, ProfileQuery) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   auto stream = Interpret("PROFILE MATCH (n) RETURN *;");
   std::vector<std::string> expected_header{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
   EXPECT_EQ(stream.GetHeader(), expected_header);
@@ -734,19 +798,35 @@ TEST_F(InterpreterTest, ProfileQuery) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for PROFILE ... and for inner MATCH ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
+}
+
+TEST_F(InterpreterTest, ProfileQueryBatchedHits) {
+  Interpret("UNWIND range(0, 5) AS i CREATE ({x: i});");
+  // ORDER BY pulls all rows, so ScanAll and Filter are pulled in batches, but
+  // every row still counts as a hit. The last, empty pull of each operator
+  // counts as well, the same as when rows are pulled one by one.
+  auto stream = Interpret("PROFILE MATCH (n) WHERE n.x > 1 RETURN n ORDER BY n.x;");
+  std::vector<std::pair<std::string, int64_t>> expected_hits{
+      {"* OrderBy", 5}, {"* Produce", 5}, {"* Filter", 5}, {"* ScanAll", 7}};
+  ASSERT_EQ(stream.GetResults().size(), expected_hits.size() + 1);
+  for (size_t i = 0; i < expected_hits.size(); ++i) {
+    const auto &row = stream.GetResults()[i];
+    EXPECT_EQ(row[0].ValueString(), expected_hits[i].first);
+    EXPECT_EQ(row[1].ValueInt(), expected_hits[i].second);
+  }
 }
 
 TEST_F(InterpreterTest, ProfileQueryMultiplePulls) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   auto [stream, qid] = Prepare("PROFILE MATCH (n) RETURN *;");
   std::vector<std::string> expected_header{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
   EXPECT_EQ(stream.GetHeader(), expected_header);
@@ -772,12 +852,12 @@ TEST_F(InterpreterTest, ProfileQueryMultiplePulls) {
   ASSERT_EQ(stream.GetResults()[2][0].ValueString(), *expected_it);
 
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for PROFILE ... and for inner MATCH ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
 }
 
 TEST_F(InterpreterTest, ProfileQueryInMulticommandTransaction) {
@@ -789,8 +869,8 @@ TEST_F(InterpreterTest, ProfileQueryInMulticommandTransaction) {
 TEST_F(InterpreterTest, ProfileQueryWithParams) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   auto stream =
       Interpret("PROFILE MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue(42)}});
   std::vector<std::string> expected_header{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
@@ -804,19 +884,19 @@ TEST_F(InterpreterTest, ProfileQueryWithParams) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for PROFILE ... and for inner MATCH ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue("something else")}});
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
 }
 
 TEST_F(InterpreterTest, ProfileQueryWithLiterals) {
   const auto &interpreter_context = default_interpreter.interpreter_context;
 
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 0U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 0U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 0U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 0U);
   auto stream = Interpret("PROFILE UNWIND range(1, 1000) AS x CREATE (:Node {id: x});", {});
   std::vector<std::string> expected_header{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
   EXPECT_EQ(stream.GetHeader(), expected_header);
@@ -829,12 +909,12 @@ TEST_F(InterpreterTest, ProfileQueryWithLiterals) {
     ++expected_it;
   }
   // We should have a plan cache for UNWIND ...
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   // We should have AST cache for PROFILE ... and for inner UNWIND ...
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
   Interpret("UNWIND range(42, 4242) AS x CREATE (:Node {id: x});", {});
-  EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
-  EXPECT_EQ(interpreter_context.ast_cache.size(), 2U);
+  EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
+  EXPECT_EQ(interpreter_context.ast_cache.Size(), 2U);
 }
 
 TEST_F(InterpreterTest, Transactions) {
@@ -1059,8 +1139,8 @@ TEST_F(InterpreterTest, CacheableQueries) {
   {
     SCOPED_TRACE("Cacheable query");
     Interpret("RETURN 1");
-    EXPECT_EQ(interpreter_context.ast_cache.size(), 1U);
-    EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+    EXPECT_EQ(interpreter_context.ast_cache.Size(), 1U);
+    EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   }
 
   {
@@ -1068,8 +1148,8 @@ TEST_F(InterpreterTest, CacheableQueries) {
     // Queries which are calling procedure should not be cached because the
     // result signature could be changed
     Interpret("CALL mg.load_all()");
-    EXPECT_EQ(interpreter_context.ast_cache.size(), 1U);
-    EXPECT_EQ(interpreter_context.plan_cache.size(), 1U);
+    EXPECT_EQ(interpreter_context.ast_cache.Size(), 1U);
+    EXPECT_EQ(interpreter_context.plan_cache.Size(), 1U);
   }
 }
 
@@ -181,6 +181,59 @@ TEST_F(QueryCostEstimator, ExpandVariable) {
   EXPECT_COST(CardParam::kExpandVariable * CostParam::kExpandVariable);
 }
 
+TEST_F(QueryCostEstimator, ExpandWithGraphStatistics) {
+  auto edge_type = db.NameToEdgeType("edge_type");
+  {
+    auto acc = db.Access();
+    auto hub = acc.CreateVertex();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_TRUE(acc.CreateEdge(&vertex, &hub, edge_type).HasValue());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  db.AnalyzeGraph();
+  dba.reset();
+  storage_dba.emplace(db.Access());
+  dba.emplace(&*storage_dba);
+
+  auto make_expand = [&] {
+    MakeOp<Expand>(last_op_, NextSymbol(), NextSymbol(), NextSymbol(), EdgeAtom::Direction::IN,
+                   std::vector<memgraph::storage::EdgeTypeId>{edge_type}, false, memgraph::storage::View::OLD);
+  };
+  make_expand();
+  EXPECT_COST(CostParam::kExpand);
+  // Every vertex with incoming edges of the type has 10 of them.
+  make_expand();
+  EXPECT_COST(CostParam::kExpand + 10 * CostParam::kExpand);
+}
+
+TEST_F(QueryCostEstimator, ExpandUnseenEdgeTypeWithGraphStatistics) {
+  auto edge_type = db.NameToEdgeType("edge_type");
+  auto unseen_edge_type = db.NameToEdgeType("unseen_edge_type");
+  {
+    auto acc = db.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    ASSERT_TRUE(acc.CreateEdge(&from, &to, edge_type).HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  db.AnalyzeGraph();
+  dba.reset();
+  storage_dba.emplace(db.Access());
+  dba.emplace(&*storage_dba);
+
+  auto make_expand = [&] {
+    MakeOp<Expand>(last_op_, NextSymbol(), NextSymbol(), NextSymbol(), EdgeAtom::Direction::OUT,
+                   std::vector<memgraph::storage::EdgeTypeId>{unseen_edge_type}, false, memgraph::storage::View::OLD);
+  };
+  make_expand();
+  EXPECT_COST(CostParam::kExpand);
+  // Edges of the type could have been created after the graph was analyzed.
+  make_expand();
+  EXPECT_COST(CostParam::kExpand + CardParam::kExpand * CostParam::kExpand);
+}
+
 // Helper for testing an operations cost and cardinality.
 // Only for operations that first increment cost, then modify cardinality.
 // Intentially a macro (instead of function) for better test feedback.
@@ -1019,6 +1019,52 @@ TYPED_TEST(TestPlanner, MultiPropertyIndexScan) {
             ExpectScanAllByLabelPropertyValue(label2, prop2, lit_2), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, CompositePropertyIndexScan) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.b = 2 AND n.c > 3 AND n.d = 4
+  //      RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR("a");
+  auto b = PROPERTY_PAIR("b");
+  auto c = PROPERTY_PAIR("c");
+  auto d = PROPERTY_PAIR("d");
+  // The composite index is preferred over the smaller single property index,
+  // because it takes more filters into account.
+  dba.SetIndexCount(label, a.second, 0);
+  dba.SetIndexCount(label, {a.second, b.second, c.second}, 10);
+  AstStorage storage;
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(AND(AND(EQ(PROPERTY_LOOKUP("n", a), LITERAL(1)), EQ(PROPERTY_LOOKUP("n", b), LITERAL(2))),
+                AND(GREATER(PROPERTY_LOOKUP("n", c), LITERAL(3)), EQ(PROPERTY_LOOKUP("n", d), LITERAL(4))))),
+      RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByLabelProperties(label, {a.second, b.second, c.second}, 2, true), ExpectFilter(),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, CompositePropertyIndexNeedsTwoFilters) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.c = 3 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR("a");
+  auto b = PROPERTY_PAIR("b");
+  auto c = PROPERTY_PAIR("c");
+  dba.SetIndexCount(label, {a.second, b.second, c.second}, 10);
+  AstStorage storage;
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                   WHERE(AND(EQ(PROPERTY_LOOKUP("n", a), LITERAL(1)), EQ(PROPERTY_LOOKUP("n", c), LITERAL(3)))),
+                   RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // Only the leading property is filtered by equality, so the index isn't
+  // better than a plain scan.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, WhereIndexedLabelPropertyRange) {
   // Test MATCH (n :label) WHERE n.property REL_OP 42 RETURN n
   // REL_OP is one of: `<`, `<=`, `>`, `>=`
@@ -1082,6 +1128,54 @@ TYPED_TEST(TestPlanner, WherePreferEqualityIndexOverRange) {
             ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, WhereHashIndexedLabelPropertyEquality) {
+  // Test MATCH (n :label) WHERE n.property = 42 RETURN n
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR("property");
+  dba.SetHashIndexCount(label, property.second, 1);
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(EQ(PROPERTY_LOOKUP("n", property), lit_42)), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelPropertyValue(label, property, lit_42), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, WhereHashIndexedLabelPropertyRange) {
+  // Test MATCH (n :label) WHERE n.property > 42 RETURN n
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR("property");
+  dba.SetHashIndexCount(label, property.second, 1);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(GREATER(PROPERTY_LOOKUP("n", property), LITERAL(42))), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // A hash index can't be used for a range.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, WherePropertyColumnRange) {
+  // Test MATCH (n :label) WHERE n.property > 42 RETURN n
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR("property");
+  dba.SetPropertyColumnCount(label, property.second, 1);
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(GREATER(PROPERTY_LOOKUP("n", property), lit_42)), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // Without an index the storage scans the property column.
+  Bound lower_bound(lit_42, Bound::Type::EXCLUSIVE);
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByLabelPropertyRange(label, property.second, lower_bound, std::nullopt), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, UnableToUsePropertyIndex) {
   // Test MATCH (n: label) WHERE n.property = n.property RETURN n
   FakeDbAccessor dba;
@@ -1481,6 +1575,61 @@ TYPED_TEST(TestPlanner, BfsToExisting) {
   CheckPlan<TypeParam>(query, storage, ExpectScanAll(), ExpectScanAllById(), ExpectExpandBfs(), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, MatchEdgeTypeIndex) {
+  // Test MATCH (n)-[r :rel]->(m) RETURN r
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto relationship = "rel";
+  dba.SetEdgeIndexCount(dba.NameToEdgeType(relationship), 1);
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {relationship}), NODE("m"))), RETURN("r")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllEdgesByType(), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, MatchEdgeTypeIndexNotUsed) {
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto relationship = "rel";
+  auto label = dba.Label("label");
+  dba.SetEdgeIndexCount(dba.NameToEdgeType(relationship), 1);
+  dba.SetIndexCount(label, 1);
+  {
+    // Test MATCH (n)-[r :rel]-(m) RETURN r
+    auto *query = QUERY(
+        SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::BOTH, {relationship}), NODE("m"))), RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectExpand(), ExpectProduce());
+  }
+  {
+    // Test MATCH (n :label)-[r :rel]->(m) RETURN r
+    auto *query = QUERY(SINGLE_QUERY(
+        MATCH(PATTERN(NODE("n", "label"), EDGE("r", Direction::OUT, {relationship}), NODE("m"))), RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectExpand(), ExpectProduce());
+  }
+}
+
+TYPED_TEST(TestPlanner, MatchEdgeTypePropertyIndex) {
+  // Test MATCH (n)<-[r :rel]-(m) WHERE r.prop = 42 RETURN r
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto relationship = "rel";
+  auto edge_type = dba.NameToEdgeType(relationship);
+  auto prop = PROPERTY_PAIR("prop");
+  dba.SetEdgeIndexCount(edge_type, 10);
+  dba.SetEdgeIndexCount(edge_type, prop.second, 1);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::IN, {relationship}), NODE("m"))),
+                                   WHERE(EQ(PROPERTY_LOOKUP("r", prop), LITERAL(42))), RETURN("r")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // The property filter is taken over by the index scan.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllEdgesByTypeProperty(edge_type, prop.second), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, LabelPropertyInListValidOptimization) {
   // Test MATCH (n:label) WHERE n.property IN ['a'] RETURN n
   AstStorage storage;
@@ -10,8 +10,10 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -387,6 +389,84 @@ TEST(QueryPlan, AggregateNoInput) {
   EXPECT_EQ(1, results[0][0].ValueInt());
 }
 
+TEST(QueryPlan, AggregateFilteredManyRows) {
+  // Aggregate over enough filtered rows that the input is pulled in several
+  // batches.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto prop = dba.NameToProperty("prop");
+  for (int i = 0; i < 3000; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), prop);
+  auto filter = std::make_shared<Filter>(n.op_, LESS(n_p, LITERAL(2000)));
+  auto produce = MakeAggregationProduce(filter, symbol_table, storage, {n_p, n_p},
+                                        {Aggregation::Op::COUNT, Aggregation::Op::SUM}, {}, {});
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(1, results.size());
+  ASSERT_EQ(2, results[0].size());
+  EXPECT_EQ(2000, results[0][0].ValueInt());
+  EXPECT_EQ(1999 * 2000 / 2, results[0][1].ValueInt());
+}
+
+TEST(QueryPlan, AggregateSpilled) {
+  // Group by enough distinct values that the groups which don't fit under the
+  // spill threshold are spilled to disk and aggregated afterwards.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto prop = dba.NameToProperty("prop");
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(i % 100)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), prop);
+  auto produce = MakeAggregationProduce(
+      n.op_, symbol_table, storage, {nullptr, n_p, n_p, IDENT("n")->MapTo(n.sym_)},
+      {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::AVG, Aggregation::Op::COLLECT_LIST}, {n_p}, {});
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_tests_unit_query_plan_aggregate_spill";
+  std::filesystem::remove_all(spill_directory);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  context.spill_directory = spill_directory;
+  context.spill_threshold_bytes = 1024;
+  auto results = CollectProduce(*produce, &context);
+  EXPECT_TRUE(std::filesystem::exists(spill_directory));
+  ASSERT_EQ(100, results.size());
+  std::set<int64_t> groups;
+  for (const auto &row : results) {
+    ASSERT_EQ(5, row.size());
+    const auto group = row[4].ValueInt();
+    groups.insert(group);
+    EXPECT_EQ(10, row[0].ValueInt());
+    EXPECT_EQ(10 * group, row[1].ValueInt());
+    EXPECT_DOUBLE_EQ(group, row[2].ValueDouble());
+    ASSERT_EQ(10, row[3].ValueList().size());
+    for (const auto &vertex : row[3].ValueList()) {
+      auto value = vertex.ValueVertex().GetProperty(memgraph::storage::View::OLD, prop);
+      ASSERT_TRUE(value.HasValue());
+      EXPECT_EQ(group, value->ValueInt());
+    }
+  }
+  EXPECT_EQ(100, groups.size());
+  std::filesystem::remove_all(spill_directory);
+}
+
 TEST(QueryPlan, AggregateCountEdgeCases) {
   // tests for detected bugs in the COUNT aggregation behavior
   // ensure that COUNT returns correctly for
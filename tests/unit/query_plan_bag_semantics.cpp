@@ -15,6 +15,7 @@
 //
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
 #include <vector>
@@ -246,6 +247,58 @@ TEST(QueryPlan, OrderByMultiple) {
   }
 }
 
+TEST(QueryPlan, OrderBySpilled) {
+  // Order enough rows that they are spilled to disk in several sorted runs
+  // which are merged into the results.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto p1 = dba.NameToProperty("p1");
+  auto p2 = dba.NameToProperty("p2");
+
+  // all the variations of N values in two properties, in a permuted order
+  const int N = 20;
+  for (int i = 0; i < N * N; ++i) {
+    const auto value = i * 7 % (N * N);
+    auto v = dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(p1, memgraph::storage::PropertyValue(value % N)).HasValue());
+    ASSERT_TRUE(v.SetProperty(p2, memgraph::storage::PropertyValue(value / N)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_p1 = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), p1);
+  auto n_p2 = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), p2);
+  auto order_by = std::make_shared<plan::OrderBy>(n.op_,
+                                                  std::vector<SortItem>{
+                                                      {Ordering::ASC, n_p1},
+                                                      {Ordering::DESC, n_p2},
+                                                  },
+                                                  std::vector<Symbol>{n.sym_});
+  auto n_p1_ne = NEXPR("n.p1", n_p1)->MapTo(symbol_table.CreateSymbol("n.p1", true));
+  auto n_p2_ne = NEXPR("n.p2", n_p2)->MapTo(symbol_table.CreateSymbol("n.p2", true));
+  auto produce = MakeProduce(order_by, n_p1_ne, n_p2_ne);
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_tests_unit_query_plan_order_by_spill";
+  std::filesystem::remove_all(spill_directory);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  context.spill_directory = spill_directory;
+  context.spill_threshold_bytes = 4096;
+  auto results = CollectProduce(*produce, &context);
+  EXPECT_TRUE(std::filesystem::exists(spill_directory));
+  ASSERT_EQ(N * N, results.size());
+  for (int j = 0; j < N * N; ++j) {
+    ASSERT_EQ(results[j][0].type(), TypedValue::Type::Int);
+    EXPECT_EQ(results[j][0].ValueInt(), j / N);
+    ASSERT_EQ(results[j][1].type(), TypedValue::Type::Int);
+    EXPECT_EQ(results[j][1].ValueInt(), N - 1 - j % N);
+  }
+  std::filesystem::remove_all(spill_directory);
+}
+
 TEST(QueryPlan, OrderByExceptions) {
   memgraph::storage::Storage db;
   auto storage_dba = db.Access();
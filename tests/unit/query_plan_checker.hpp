@@ -62,6 +62,8 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(ScanAllByLabelPropertyRange);
   PRE_VISIT(ScanAllByLabelProperty);
   PRE_VISIT(ScanAllById);
+  PRE_VISIT(ScanAllEdgesByType);
+  PRE_VISIT(ScanAllEdgesByTypeProperty);
   PRE_VISIT(Expand);
   PRE_VISIT(ExpandVariable);
   PRE_VISIT(Filter);
@@ -134,6 +136,7 @@ using ExpectDelete = OpChecker<Delete>;
 using ExpectScanAll = OpChecker<ScanAll>;
 using ExpectScanAllByLabel = OpChecker<ScanAllByLabel>;
 using ExpectScanAllById = OpChecker<ScanAllById>;
+using ExpectScanAllEdgesByType = OpChecker<ScanAllEdgesByType>;
 using ExpectExpand = OpChecker<Expand>;
 using ExpectFilter = OpChecker<Filter>;
 using ExpectConstructNamedPath = OpChecker<ConstructNamedPath>;
@@ -265,6 +268,21 @@ class ExpectScanAllByLabelPropertyValue : public OpChecker<ScanAllByLabelPropert
   memgraph::query::Expression *expression_;
 };
 
+class ExpectScanAllEdgesByTypeProperty : public OpChecker<ScanAllEdgesByTypeProperty> {
+ public:
+  ExpectScanAllEdgesByTypeProperty(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property)
+      : edge_type_(edge_type), property_(property) {}
+
+  void ExpectOp(ScanAllEdgesByTypeProperty &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.edge_type_, edge_type_);
+    EXPECT_EQ(scan_all.property_, property_);
+  }
+
+ private:
+  memgraph::storage::EdgeTypeId edge_type_;
+  memgraph::storage::PropertyId property_;
+};
+
 class ExpectScanAllByLabelPropertyRange : public OpChecker<ScanAllByLabelPropertyRange> {
  public:
   ExpectScanAllByLabelPropertyRange(memgraph::storage::LabelId label, memgraph::storage::PropertyId property,
@@ -312,6 +330,27 @@ class ExpectScanAllByLabelProperty : public OpChecker<ScanAllByLabelProperty> {
   memgraph::storage::PropertyId property_;
 };
 
+class ExpectScanAllByLabelProperties : public OpChecker<ScanAllByLabelProperties> {
+ public:
+  ExpectScanAllByLabelProperties(memgraph::storage::LabelId label,
+                                 const std::vector<memgraph::storage::PropertyId> &properties, size_t prefix_size,
+                                 bool has_range)
+      : label_(label), properties_(properties), prefix_size_(prefix_size), has_range_(has_range) {}
+
+  void ExpectOp(ScanAllByLabelProperties &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.properties_, properties_);
+    EXPECT_EQ(scan_all.expressions_.size(), prefix_size_);
+    EXPECT_EQ(scan_all.lower_bound_ || scan_all.upper_bound_, has_range_);
+  }
+
+ private:
+  memgraph::storage::LabelId label_;
+  std::vector<memgraph::storage::PropertyId> properties_;
+  size_t prefix_size_;
+  bool has_range_;
+};
+
 class ExpectCartesian : public OpChecker<Cartesian> {
  public:
   ExpectCartesian(const std::list<std::unique_ptr<BaseOpChecker>> &left,
@@ -394,6 +433,20 @@ class FakeDbAccessor {
         return std::get<2>(index);
       }
     }
+    auto found = label_property_hash_index_.find({label, property});
+    if (found != label_property_hash_index_.end()) return found->second;
+    auto found_column = property_columns_.find({label, property});
+    if (found_column != property_columns_.end()) return found_column->second;
+    return 0;
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                        const std::vector<memgraph::storage::PropertyValue> &) const {
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        return std::get<2>(index);
+      }
+    }
     return 0;
   }
 
@@ -410,6 +463,59 @@ class FakeDbAccessor {
     return false;
   }
 
+  bool LabelPropertyHashIndexExists(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) const {
+    return label_property_hash_index_.find({label, property}) != label_property_hash_index_.end();
+  }
+
+  bool PropertyColumnExists(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) const {
+    return property_columns_.find({label, property}) != property_columns_.end();
+  }
+
+  bool LabelPropertyCompositeIndexExists(memgraph::storage::LabelId label,
+                                         const std::vector<memgraph::storage::PropertyId> &properties) const {
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::vector<std::vector<memgraph::storage::PropertyId>> LabelPropertyCompositeIndices(
+      memgraph::storage::LabelId label) const {
+    std::vector<std::vector<memgraph::storage::PropertyId>> indices;
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label) indices.push_back(std::get<1>(index));
+    }
+    return indices;
+  }
+
+  bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type) const {
+    return edge_type_index_.find(edge_type) != edge_type_index_.end();
+  }
+
+  bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId edge_type,
+                                   memgraph::storage::PropertyId property) const {
+    return edge_type_property_index_.find({edge_type, property}) != edge_type_property_index_.end();
+  }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type) const {
+    auto found = edge_type_index_.find(edge_type);
+    if (found != edge_type_index_.end()) return found->second;
+    return 0;
+  }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property) const {
+    auto found = edge_type_property_index_.find({edge_type, property});
+    if (found != edge_type_property_index_.end()) return found->second;
+    return 0;
+  }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property,
+                     const memgraph::storage::PropertyValue &) const {
+    return EdgesCount(edge_type, property);
+  }
+
   void SetIndexCount(memgraph::storage::LabelId label, int64_t count) { label_index_[label] = count; }
 
   void SetIndexCount(memgraph::storage::LabelId label, memgraph::storage::PropertyId property, int64_t count) {
@@ -422,6 +528,40 @@ class FakeDbAccessor {
     label_property_index_.emplace_back(label, property, count);
   }
 
+  void SetIndexCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                     int64_t count) {
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        std::get<2>(index) = count;
+        return;
+      }
+    }
+    label_property_composite_index_.emplace_back(label, properties, count);
+  }
+
+  void SetHashIndexCount(memgraph::storage::LabelId label, memgraph::storage::PropertyId property, int64_t count) {
+    label_property_hash_index_[{label, property}] = count;
+  }
+
+  void SetPropertyColumnCount(memgraph::storage::LabelId label, memgraph::storage::PropertyId property, int64_t count) {
+    property_columns_[{label, property}] = count;
+  }
+
+  void SetEdgeIndexCount(memgraph::storage::EdgeTypeId edge_type, int64_t count) {
+    edge_type_index_[edge_type] = count;
+  }
+
+  void SetEdgeIndexCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property,
+                         int64_t count) {
+    edge_type_property_index_[{edge_type, property}] = count;
+  }
+
+  std::shared_ptr<const memgraph::storage::GraphStatistics> GetGraphStatistics() const { return graph_statistics_; }
+
+  void SetGraphStatistics(std::shared_ptr<const memgraph::storage::GraphStatistics> statistics) {
+    graph_statistics_ = std::move(statistics);
+  }
+
   memgraph::storage::LabelId NameToLabel(const std::string &name) {
     auto found = labels_.find(name);
     if (found != labels_.end()) return found->second;
@@ -460,6 +600,13 @@ class FakeDbAccessor {
 
   std::unordered_map<memgraph::storage::LabelId, int64_t> label_index_;
   std::vector<std::tuple<memgraph::storage::LabelId, memgraph::storage::PropertyId, int64_t>> label_property_index_;
+  std::vector<std::tuple<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>, int64_t>>
+      label_property_composite_index_;
+  std::map<std::pair<memgraph::storage::LabelId, memgraph::storage::PropertyId>, int64_t> label_property_hash_index_;
+  std::map<std::pair<memgraph::storage::LabelId, memgraph::storage::PropertyId>, int64_t> property_columns_;
+  std::unordered_map<memgraph::storage::EdgeTypeId, int64_t> edge_type_index_;
+  std::map<std::pair<memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId>, int64_t> edge_type_property_index_;
+  std::shared_ptr<const memgraph::storage::GraphStatistics> graph_statistics_;
 };
 
 }  // namespace memgraph::query::plan
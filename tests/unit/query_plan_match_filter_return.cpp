@@ -9,14 +9,18 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <set>
 #include <unordered_map>
 #include <variant>
 #include <vector>
 
 #include <fmt/format.h>
+#include <gflags/gflags.h>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -28,12 +32,15 @@
 #include "query/context.hpp"
 #include "query/exceptions.hpp"
 #include "query/plan/operator.hpp"
+#include "query/plan/rewrite/parallel_scan.hpp"
 
 #include "query_plan_common.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
 
+DECLARE_uint64(query_bfs_workers);
+
 class MatchReturnFixture : public testing::Test {
  protected:
   memgraph::storage::Storage db;
@@ -245,6 +252,176 @@ TEST(QueryPlan, NodeFilterMultipleLabels) {
   EXPECT_EQ(results.size(), 2);
 }
 
+TEST(QueryPlan, NodeFilterManyRows) {
+  // Scan and filter enough vertices that the rows are pulled in several
+  // batches and check that none are lost or duplicated. Produce only pulls in
+  // batches when its consumer pulls all rows, like ORDER BY does.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto property = PROPERTY_PAIR("property");
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(property.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto *filter_expr = LESS(LITERAL(999), PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), property));
+  auto node_filter = std::make_shared<Filter>(n.op_, filter_expr);
+  auto output_sym = symbol_table.CreateSymbol("named_expression_1", true);
+  auto output = NEXPR("x", PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), property))->MapTo(output_sym);
+  auto produce = MakeProduce(node_filter, output);
+  auto order_by = std::make_shared<OrderBy>(
+      produce, std::vector<SortItem>{{Ordering::ASC, IDENT("x")->MapTo(output_sym)}}, std::vector<Symbol>{output_sym});
+
+  auto context = MakeContext(storage, symbol_table, &dba);
+  Frame frame(context.symbol_table.max_position());
+  auto cursor = order_by->MakeCursor(memgraph::utils::NewDeleteResource());
+  int64_t expected = 1000;
+  while (cursor->Pull(frame, context)) {
+    EXPECT_EQ(frame[output_sym].ValueInt(), expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 5000);
+}
+
+TEST(QueryPlan, NodeFilterLimitDoesntPullAhead) {
+  // MATCH (n) WHERE 10 / n.property > 0 RETURN n.property LIMIT 10
+  // Only one vertex far past the limit divides by zero. The rows past the
+  // limit must never be filtered, so the query succeeds.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto property = PROPERTY_PAIR("property");
+  for (int i = 0; i < 2000; ++i) {
+    const int64_t value = i == 1500 ? 0 : 1;
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(property.second, memgraph::storage::PropertyValue(value)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto *division = storage.Create<DivisionOperator>(LITERAL(10), PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), property));
+  auto *filter_expr = LESS(LITERAL(0), division);
+  auto node_filter = std::make_shared<Filter>(n.op_, filter_expr);
+  auto output = NEXPR("x", PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), property))
+                    ->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(node_filter, output);
+  auto limit = std::make_shared<Limit>(produce, LITERAL(10));
+
+  auto context = MakeContext(storage, symbol_table, &dba);
+  EXPECT_EQ(PullAll(*limit, &context), 10);
+}
+
+TEST(QueryPlan, GatherNodeFilter) {
+  // Split a filtered scan between several workers and check that every
+  // matching vertex is returned exactly once.
+  FLAGS_query_parallel_scan_workers = 4;
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto property = PROPERTY_PAIR("property");
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(property.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto *filter_expr = LESS(LITERAL(999), PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), property));
+  auto node_filter = std::make_shared<Filter>(n.op_, filter_expr);
+  auto gather = std::make_shared<Gather>(node_filter, 4);
+  auto output = NEXPR("x", PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), property))
+                    ->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(gather, output);
+
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 4000);
+  std::vector<int64_t> values;
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 1);
+    values.push_back(row[0].ValueInt());
+  }
+  std::sort(values.begin(), values.end());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i], static_cast<int64_t>(1000 + i));
+  }
+  FLAGS_query_parallel_scan_workers = 0;
+}
+
+TEST(QueryPlan, GatherPartialAggregation) {
+  // MATCH (n) RETURN n.group, count(n.value), sum(n.value), min(n.value), max(n.value)
+  // The workers aggregate their own vertices and the partial aggregations are
+  // merged after the Gather.
+  FLAGS_query_parallel_scan_workers = 4;
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto group = PROPERTY_PAIR("group");
+  auto value = PROPERTY_PAIR("value");
+  constexpr int64_t kVertexCount = 5000;
+  for (int64_t i = 0; i < kVertexCount; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(group.second, memgraph::storage::PropertyValue(i % 3)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(value.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  std::vector<Aggregate::Element> aggregations;
+  std::vector<NamedExpression *> outputs{NEXPR("group", PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), group))
+                                             ->MapTo(symbol_table.CreateSymbol("named_expression_0", true))};
+  for (const auto op : {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::MIN, Aggregation::Op::MAX}) {
+    const auto index = aggregations.size() + 1;
+    auto aggregation_sym = symbol_table.CreateSymbol(fmt::format("aggregation_{}", index), false);
+    aggregations.push_back({PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), value), nullptr, op, aggregation_sym});
+    outputs.push_back(NEXPR(fmt::format("x{}", index), IDENT("aggregation")->MapTo(aggregation_sym))
+                          ->MapTo(symbol_table.CreateSymbol(fmt::format("named_expression_{}", index), true)));
+  }
+  auto aggregate = std::make_shared<Aggregate>(
+      n.op_, aggregations, std::vector<Expression *>{PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), group)},
+      std::vector<Symbol>{n.sym_});
+  std::unique_ptr<LogicalOperator> plan = std::make_unique<Produce>(aggregate, outputs);
+  plan = RewriteWithParallelScan(std::move(plan), 4, &symbol_table, &storage);
+  ASSERT_EQ(plan->input()->GetTypeInfo(), Aggregate::kType);
+  ASSERT_EQ(plan->input()->input()->GetTypeInfo(), Gather::kType);
+  ASSERT_EQ(plan->input()->input()->input()->GetTypeInfo(), Aggregate::kType);
+
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(static_cast<const Produce &>(*plan), &context);
+  ASSERT_EQ(results.size(), 3);
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 5);
+    const auto group_value = row[0].ValueInt();
+    int64_t count = 0;
+    int64_t sum = 0;
+    for (int64_t i = group_value; i < kVertexCount; i += 3) {
+      ++count;
+      sum += i;
+    }
+    EXPECT_EQ(row[1].ValueInt(), count);
+    EXPECT_EQ(row[2].ValueInt(), sum);
+    EXPECT_EQ(row[3].ValueInt(), group_value);
+    EXPECT_EQ(row[4].ValueInt(), group_value + 3 * (count - 1));
+  }
+  FLAGS_query_parallel_scan_workers = 0;
+}
+
 TEST(QueryPlan, Cartesian) {
   memgraph::storage::Storage db;
   auto storage_dba = db.Access();
@@ -1197,6 +1374,35 @@ TEST_F(QueryPlanExpandWeightedShortestPath, UpperBound) {
   }
 }
 
+TEST_F(QueryPlanExpandWeightedShortestPath, DeltaStepping) {
+  // Without a filter lambda and an upper bound the paths are found by the
+  // delta-stepping search on the BFS workers.
+  FLAGS_query_bfs_workers = 4;
+  auto results = ExpandWShortest(EdgeAtom::Direction::BOTH, std::nullopt, nullptr);
+  auto n0 = MakeScanAll(storage, symbol_table, "n0");
+  auto existing_node_results = ExpandWShortest(EdgeAtom::Direction::OUT, std::nullopt, nullptr, std::nullopt, &n0);
+  FLAGS_query_bfs_workers = 0;
+
+  ASSERT_EQ(results.size(), 4);
+  EXPECT_EQ(GetProp(results[0].vertex), 2);
+  EXPECT_EQ(results[0].path.size(), 1);
+  EXPECT_EQ(results[0].total_weight, 3);
+  EXPECT_EQ(GetProp(results[1].vertex), 1);
+  EXPECT_EQ(results[1].path.size(), 1);
+  EXPECT_EQ(results[1].total_weight, 5);
+  EXPECT_EQ(GetProp(results[2].vertex), 3);
+  EXPECT_EQ(results[2].path.size(), 2);
+  EXPECT_EQ(results[2].total_weight, 6);
+  EXPECT_EQ(GetProp(results[3].vertex), 4);
+  ASSERT_EQ(results[3].path.size(), 3);
+  EXPECT_EQ(GetDoubleProp(results[3].path[0]), 3);
+  EXPECT_EQ(GetDoubleProp(results[3].path[1]), 3);
+  EXPECT_EQ(GetDoubleProp(results[3].path[2]), 3);
+  EXPECT_EQ(results[3].total_weight, 9);
+
+  EXPECT_EQ(existing_node_results.size(), 20);
+}
+
 TEST_F(QueryPlanExpandWeightedShortestPath, NonNumericWeight) {
   auto new_vertex = dba.InsertVertex();
   ASSERT_TRUE(new_vertex.SetProperty(prop.second, memgraph::storage::PropertyValue(5)).HasValue());
@@ -1625,6 +1831,41 @@ TEST(QueryPlan, Distinct) {
       {TypedValue(3), TypedValue("two"), TypedValue(), TypedValue(true), TypedValue(false), TypedValue("TWO")}, false);
 }
 
+TEST(QueryPlan, DistinctSpilled) {
+  // MATCH (n), (m) RETURN DISTINCT n
+  // with the rows which don't fit under the spill threshold spilled to disk
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+  for (int i = 0; i < 50; ++i) dba.InsertVertex();
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto m = MakeScanAll(storage, symbol_table, "m", n.op_);
+  auto distinct = std::make_shared<plan::Distinct>(m.op_, std::vector<Symbol>{n.sym_});
+  auto n_ne = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("n_ne", true));
+  auto produce = MakeProduce(distinct, n_ne);
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_tests_unit_query_plan_distinct_spill";
+  std::filesystem::remove_all(spill_directory);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  context.spill_directory = spill_directory;
+  context.spill_threshold_bytes = 256;
+  auto results = CollectProduce(*produce, &context);
+  EXPECT_TRUE(std::filesystem::exists(spill_directory));
+  ASSERT_EQ(50, results.size());
+  std::set<memgraph::storage::Gid> gids;
+  for (const auto &row : results) {
+    ASSERT_EQ(1, row.size());
+    gids.insert(row[0].ValueVertex().Gid());
+  }
+  EXPECT_EQ(50, gids.size());
+  std::filesystem::remove_all(spill_directory);
+}
+
 TEST(QueryPlan, ScanAllByLabel) {
   memgraph::storage::Storage db;
   auto label = db.NameToLabel("label");
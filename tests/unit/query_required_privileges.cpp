@@ -162,6 +162,11 @@ TEST_F(TestPrivilegeExtractor, FreeMemoryQuery) {
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::FREE_MEMORY));
 }
 
+TEST_F(TestPrivilegeExtractor, AnalyzeGraphQuery) {
+  auto *query = storage.Create<AnalyzeGraphQuery>();
+  EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::INDEX));
+}
+
 TEST_F(TestPrivilegeExtractor, TriggerQuery) {
   auto *query = storage.Create<TriggerQuery>();
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::TRIGGER));
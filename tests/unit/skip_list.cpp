@@ -854,3 +854,45 @@ TEST(SkipList, EstimateAverageNumberOfEquals5) {
     ASSERT_EQ(count, kMaxElements);
   }
 }
+
+TEST(SkipList, PartitionPoints) {
+  memgraph::utils::SkipList<int64_t> list;
+
+  // An empty list and a single partition don't need any split points.
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.partition_points(8).empty());
+    for (int64_t i = 0; i < 100000; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+    ASSERT_TRUE(acc.partition_points(1).empty());
+    ASSERT_TRUE(acc.partition_points(0).empty());
+  }
+
+  for (uint64_t partitions : {2, 3, 8, 64}) {
+    auto acc = list.access();
+    auto points = acc.partition_points(partitions);
+    ASSERT_EQ(points.size(), partitions - 1);
+
+    // Every range has to contain at least a single item and no range should
+    // be much larger than the others.
+    std::vector<int64_t> bounds{0};
+    for (const auto &point : points) bounds.push_back(*point);
+    bounds.push_back(100000);
+    for (size_t i = 1; i < bounds.size(); ++i) {
+      ASSERT_LT(bounds[i - 1], bounds[i]);
+      ASSERT_LT(bounds[i] - bounds[i - 1], 100000 / static_cast<int64_t>(partitions) * 4);
+    }
+  }
+
+  // Removed items are never used as split points.
+  {
+    auto acc = list.access();
+    for (int64_t i = 0; i < 100000; i += 2) {
+      ASSERT_TRUE(acc.remove(i));
+    }
+    for (const auto &point : acc.partition_points(16)) {
+      ASSERT_EQ(*point % 2, 1);
+    }
+  }
+}
@@ -12,7 +12,12 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <limits>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
 
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/storage.hpp"
@@ -209,6 +214,59 @@ TEST(StorageV2, SnapshotIsolation) {
   acc3.Abort();
 }
 
+// Transactions start without taking the engine lock, so a transaction that
+// starts while another one commits must still see either none or all of its
+// changes for its whole duration.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, SnapshotIsolationWithConcurrentStarts) {
+  memgraph::storage::Storage store;
+  auto property = store.NameToProperty("property");
+
+  memgraph::storage::Gid gid;
+  {
+    auto acc = store.Access();
+    auto vertex = acc.CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(0)).HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  const int64_t kCommits = 2000;
+  std::atomic<bool> done{false};
+  std::atomic<bool> failed{false};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&] {
+      int64_t last_value = 0;
+      while (!done.load()) {
+        auto acc = store.Access();
+        auto vertex = acc.FindVertex(gid, memgraph::storage::View::OLD);
+        auto first = vertex->GetProperty(property, memgraph::storage::View::OLD)->ValueInt();
+        std::this_thread::yield();
+        auto second = vertex->GetProperty(property, memgraph::storage::View::OLD)->ValueInt();
+        // Values can only grow across transactions and can't change within one.
+        if (first != second || first < last_value) failed.store(true);
+        last_value = first;
+      }
+    });
+  }
+  for (int64_t i = 1; i <= kCommits; ++i) {
+    auto acc = store.Access();
+    auto vertex = acc.FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex->SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  done.store(true);
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  EXPECT_FALSE(failed.load());
+
+  auto acc = store.Access();
+  auto vertex = acc.FindVertex(gid, memgraph::storage::View::OLD);
+  EXPECT_EQ(vertex->GetProperty(property, memgraph::storage::View::OLD)->ValueInt(), kCommits);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST(StorageV2, AccessorMove) {
   memgraph::storage::Storage store;
@@ -242,6 +300,93 @@ TEST(StorageV2, AccessorMove) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, VerticesPartitions) {
+  memgraph::storage::Storage store;
+  const uint64_t kVerticesCount = 10000;
+  {
+    auto acc = store.Access();
+    for (uint64_t i = 0; i < kVerticesCount; ++i) {
+      acc.CreateVertex();
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    auto acc = store.Access();
+    auto points = acc.VerticesPartitionPoints(4);
+    ASSERT_EQ(points.size(), 3);
+
+    // Scanning the ranges between the split points visits every vertex exactly
+    // once.
+    std::vector<std::optional<memgraph::storage::Gid>> bounds{std::nullopt};
+    bounds.insert(bounds.end(), points.begin(), points.end());
+    bounds.emplace_back(std::nullopt);
+    std::set<memgraph::storage::Gid> gids;
+    for (size_t i = 1; i < bounds.size(); ++i) {
+      uint64_t count = 0;
+      for (auto vertex : acc.VerticesInRange(bounds[i - 1], bounds[i], memgraph::storage::View::OLD)) {
+        if (bounds[i - 1]) ASSERT_GE(vertex.Gid(), *bounds[i - 1]);
+        if (bounds[i]) ASSERT_LT(vertex.Gid(), *bounds[i]);
+        ASSERT_TRUE(gids.insert(vertex.Gid()).second);
+        ++count;
+      }
+      ASSERT_GT(count, 0);
+    }
+    ASSERT_EQ(gids.size(), kVerticesCount);
+    acc.Abort();
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, AnalyzeGraph) {
+  memgraph::storage::Storage store;
+  auto label_a = store.NameToLabel("A");
+  auto label_b = store.NameToLabel("B");
+  auto property = store.NameToProperty("x");
+  auto edge_type = store.NameToEdgeType("T");
+  ASSERT_EQ(store.GetGraphStatistics(), nullptr);
+  {
+    auto acc = store.Access();
+    auto target = acc.CreateVertex();
+    ASSERT_TRUE(target.AddLabel(label_b).HasValue());
+    for (int64_t i = 0; i < 10; ++i) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_TRUE(vertex.AddLabel(label_a).HasValue());
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i % 5)).HasValue());
+      ASSERT_TRUE(acc.CreateEdge(&vertex, &target, edge_type).HasValue());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  auto statistics = store.AnalyzeGraph();
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_EQ(store.Access().GetGraphStatistics(), statistics);
+  EXPECT_EQ(statistics->vertex_count, 11);
+  EXPECT_EQ(statistics->edge_count, 10);
+  EXPECT_EQ(statistics->label_counts.at(label_a), 10);
+  EXPECT_EQ(statistics->label_counts.at(label_b), 1);
+
+  const auto &property_statistics = statistics->label_properties.at({label_a, property});
+  EXPECT_EQ(property_statistics.count, 10);
+  EXPECT_EQ(property_statistics.distinct_values, 5);
+  EXPECT_DOUBLE_EQ(property_statistics.EqualSelectivity(), 0.2);
+  EXPECT_DOUBLE_EQ(property_statistics.RangeSelectivity(
+                       std::nullopt, memgraph::utils::MakeBoundExclusive(memgraph::storage::PropertyValue(2))),
+                   0.4);
+  EXPECT_DOUBLE_EQ(property_statistics.RangeSelectivity(
+                       memgraph::utils::MakeBoundInclusive(memgraph::storage::PropertyValue("a")), std::nullopt),
+                   0.05);
+  EXPECT_EQ(statistics->label_properties.count({label_b, property}), 0);
+
+  const auto &edge_type_statistics = statistics->edge_types.at(edge_type);
+  EXPECT_EQ(edge_type_statistics.count, 10);
+  EXPECT_EQ(edge_type_statistics.from_vertices, 10);
+  EXPECT_EQ(edge_type_statistics.to_vertices, 1);
+
+  store.ClearGraphStatistics();
+  ASSERT_EQ(store.GetGraphStatistics(), nullptr);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST(StorageV2, VertexDeleteCommit) {
   memgraph::storage::Storage store;
@@ -2593,3 +2738,73 @@ TEST(StorageV2, DeletedVertexAccessor) {
     ASSERT_EQ(property_value, *maybe_property);
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, BulkLoadConcurrent) {
+  memgraph::storage::Storage store;
+  const auto label = store.NameToLabel("label");
+  const auto property = store.NameToProperty("property");
+  const auto edge_type = store.NameToEdgeType("edge_type");
+  constexpr int kThreads = 4;
+  constexpr int kVerticesPerThread = 1000;
+
+  {
+    auto bulk_load = store.BulkLoad();
+    ASSERT_FALSE(bulk_load.HasError());
+    auto &acc = *bulk_load;
+    auto first_gid = acc.ReserveVertexGids(kThreads * kVerticesPerThread);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&, i] {
+        // The vertices of each thread are connected to the vertices of the
+        // next one, so that multiple threads add edges to the same vertices.
+        for (int j = i; j < kThreads * kVerticesPerThread; j += kThreads) {
+          acc.CreateVertex(memgraph::storage::Gid::FromUint(first_gid.AsUint() + j), {label},
+                           {{property, memgraph::storage::PropertyValue(j)}});
+        }
+      });
+    }
+    for (auto &thread : threads) thread.join();
+    threads.clear();
+    for (int i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&, i] {
+        for (int j = i; j < kThreads * kVerticesPerThread; j += kThreads) {
+          auto from = memgraph::storage::Gid::FromUint(first_gid.AsUint() + j);
+          auto to = memgraph::storage::Gid::FromUint(first_gid.AsUint() + (j + 1) % (kThreads * kVerticesPerThread));
+          ASSERT_FALSE(acc.CreateEdge(from, to, edge_type, {}).HasError());
+        }
+      });
+    }
+    for (auto &thread : threads) thread.join();
+    acc.Finish();
+  }
+
+  auto acc = store.Access();
+  for (int j = 0; j < kThreads * kVerticesPerThread; ++j) {
+    auto vertex = acc.FindVertex(memgraph::storage::Gid::FromUint(j), memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(j));
+    ASSERT_EQ(*vertex->HasLabel(label, memgraph::storage::View::OLD), true);
+    ASSERT_EQ(vertex->OutEdges(memgraph::storage::View::OLD)->size(), 1U);
+    ASSERT_EQ(vertex->InEdges(memgraph::storage::View::OLD)->size(), 1U);
+  }
+  ASSERT_EQ(store.GetInfo().edge_count, kThreads * kVerticesPerThread);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, WaitForCommitTimestampOnMain) {
+  memgraph::storage::Storage store;
+  const auto commit_timestamp = store.LastCommitTimestamp() + 1;
+  const auto start = std::chrono::steady_clock::now();
+  std::thread waiter([&] { ASSERT_TRUE(store.WaitForCommitTimestamp(commit_timestamp, std::chrono::seconds(60))); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  {
+    auto acc = store.Access();
+    acc.CreateVertex();
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  waiter.join();
+  // The commit wakes up the waiter instead of letting it wait for the timeout.
+  ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(30));
+  ASSERT_GE(store.LastCommitTimestamp(), commit_timestamp);
+}
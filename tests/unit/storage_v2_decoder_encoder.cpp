@@ -355,6 +355,16 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
         case memgraph::storage::durability::Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTIES_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTIES_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_PROPERTY_COLUMNS_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_PROPERTY_COLUMNS_DROP:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_PROPERTY_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_DROP:
         case memgraph::storage::durability::Marker::VALUE_FALSE:
         case memgraph::storage::durability::Marker::VALUE_TRUE:
           valid_marker = false;
@@ -693,6 +693,116 @@ TEST_P(DurabilityTest, SnapshotOnExit) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotParallelBatches) {
+  // Create snapshot.
+  {
+    memgraph::storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                                      .durability = {.storage_directory = storage_directory,
+                                                     .snapshot_on_exit = true,
+                                                     .items_per_batch = 13,
+                                                     .snapshot_thread_count = 4}});
+    CreateBaseDataset(&store, GetParam());
+    VerifyDataset(&store, DatasetType::ONLY_BASE, GetParam());
+    CreateExtendedDataset(&store);
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_EQ(GetWalsList().size(), 0);
+  ASSERT_EQ(GetBackupWalsList().size(), 0);
+
+  // Check batches.
+  {
+    auto info = memgraph::storage::durability::ReadSnapshotInfo(*GetSnapshotsList().begin());
+    ASSERT_EQ(info.vertices_count, kNumBaseVertices + kNumExtendedVertices);
+    ASSERT_EQ(info.vertex_batches.size(), (kNumBaseVertices + kNumExtendedVertices + 12) / 13);
+    uint64_t vertices_count = 0;
+    for (const auto &batch : info.vertex_batches) {
+      ASSERT_LE(batch.count, 13);
+      vertices_count += batch.count;
+    }
+    ASSERT_EQ(vertices_count, info.vertices_count);
+    uint64_t edges_count = 0;
+    for (const auto &batch : info.edge_batches) {
+      ASSERT_LE(batch.count, 13);
+      edges_count += batch.count;
+    }
+    ASSERT_EQ(edges_count, info.edges_count);
+    if (GetParam()) {
+      ASSERT_EQ(info.edges_count, kNumBaseEdges + kNumExtendedEdges);
+    } else {
+      ASSERT_TRUE(info.edge_batches.empty());
+    }
+  }
+
+  // Recover snapshot using a single thread.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .recover_on_startup = true, .recovery_thread_count = 1}});
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // Recover snapshot using buffered reads instead of mapping it into memory.
+  {
+    memgraph::storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                                      .durability = {.storage_directory = storage_directory,
+                                                     .recover_on_startup = true,
+                                                     .recovery_thread_count = 8,
+                                                     .snapshot_recovery_mmap = false}});
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // Recover snapshot using multiple threads.
+  memgraph::storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true, .recovery_thread_count = 8}});
+  VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+
+  // Try to use the storage.
+  {
+    auto acc = store.Access();
+    auto vertex = acc.CreateVertex();
+    auto edge = acc.CreateEdge(&vertex, &vertex, store.NameToEdgeType("et"));
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotStaleBatchFilesRemoved) {
+  // Create snapshot.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .snapshot_on_exit = true, .items_per_batch = 13}});
+    CreateBaseDataset(&store, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // Leave batch files behind as if the process crashed while creating another
+  // snapshot.
+  const auto snapshot = *GetSnapshotsList().begin();
+  for (const auto *suffix : {"_edges_batch_0", "_vertices_batch_1"}) {
+    memgraph::utils::OutputFile file;
+    file.Open(snapshot.string() + suffix, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    const uint8_t data[] = {1, 2, 3};
+    file.Write(data, sizeof(data));
+    file.Close();
+  }
+  ASSERT_EQ(GetSnapshotsList().size(), 3);
+
+  // Recover snapshot.
+  memgraph::storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  VerifyDataset(&store, DatasetType::ONLY_BASE, GetParam());
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, SnapshotPeriodic) {
   // Create snapshot.
@@ -1179,6 +1289,323 @@ TEST_P(DurabilityTest, WalBasic) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, CompositeIndices) {
+  auto create_dataset = [](memgraph::storage::Storage *store) {
+    auto label = store->NameToLabel("composite");
+    auto prop_a = store->NameToProperty("a");
+    auto prop_b = store->NameToProperty("b");
+    {
+      auto acc = store->Access();
+      for (int64_t i = 0; i < 10; ++i) {
+        auto vertex = acc.CreateVertex();
+        ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+        ASSERT_TRUE(vertex.SetProperty(prop_a, memgraph::storage::PropertyValue(i % 2)).HasValue());
+        ASSERT_TRUE(vertex.SetProperty(prop_b, memgraph::storage::PropertyValue(i)).HasValue());
+      }
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    ASSERT_TRUE(store->CreateCompositeIndex(label, {prop_a, prop_b}));
+    ASSERT_TRUE(store->CreateCompositeIndex(label, {prop_b, prop_a}));
+    ASSERT_TRUE(store->DropCompositeIndex(label, {prop_b, prop_a}));
+  };
+  auto verify_dataset = [](memgraph::storage::Storage *store) {
+    auto label = store->NameToLabel("composite");
+    auto prop_a = store->NameToProperty("a");
+    auto prop_b = store->NameToProperty("b");
+    // The order of the properties must be kept.
+    std::vector<memgraph::storage::PropertyId> properties{prop_a, prop_b};
+    ASSERT_THAT(store->ListAllIndices().label_property_composite,
+                UnorderedElementsAre(std::make_pair(label, properties)));
+    auto acc = store->Access();
+    ASSERT_EQ(acc.ApproximateVertexCount(label, properties, {memgraph::storage::PropertyValue(1)}), 5);
+  };
+
+  // Create WALs.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    create_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs and create a snapshot.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .recover_on_startup = true,
+                        .snapshot_on_exit = true}});
+    verify_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // Recover the snapshot without the WALs.
+  std::filesystem::remove_all(storage_directory / memgraph::storage::durability::kWalDirectory);
+  memgraph::storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  verify_dataset(&store);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, PropertyColumns) {
+  auto create_dataset = [](memgraph::storage::Storage *store) {
+    auto label = store->NameToLabel("columns");
+    auto other_label = store->NameToLabel("other");
+    auto prop_a = store->NameToProperty("a");
+    auto prop_b = store->NameToProperty("b");
+    {
+      auto acc = store->Access();
+      for (int64_t i = 0; i < 10; ++i) {
+        auto vertex = acc.CreateVertex();
+        ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+        ASSERT_TRUE(vertex.SetProperty(prop_a, memgraph::storage::PropertyValue(i)).HasValue());
+        ASSERT_TRUE(vertex.SetProperty(prop_b, memgraph::storage::PropertyValue(i * 0.5)).HasValue());
+      }
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    ASSERT_TRUE(store->CreatePropertyColumns(label, {{prop_a, memgraph::storage::PropertyValue::Type::Int},
+                                                     {prop_b, memgraph::storage::PropertyValue::Type::Double}}));
+    ASSERT_TRUE(store->CreatePropertyColumns(other_label, {{prop_a, memgraph::storage::PropertyValue::Type::Bool}}));
+    ASSERT_TRUE(store->DropPropertyColumns(other_label));
+  };
+  auto verify_dataset = [](memgraph::storage::Storage *store) {
+    auto label = store->NameToLabel("columns");
+    auto prop_a = store->NameToProperty("a");
+    auto prop_b = store->NameToProperty("b");
+    memgraph::storage::PropertyColumns::Schema schema{{prop_a, memgraph::storage::PropertyValue::Type::Int},
+                                                      {prop_b, memgraph::storage::PropertyValue::Type::Double}};
+    ASSERT_THAT(store->ListAllIndices().property_columns, UnorderedElementsAre(std::make_pair(label, schema)));
+    auto acc = store->Access();
+    size_t count = 0;
+    for ([[maybe_unused]] auto vertex :
+         acc.Vertices(label, prop_b, memgraph::utils::MakeBoundInclusive(memgraph::storage::PropertyValue(2.0)),
+                      std::nullopt, memgraph::storage::View::OLD)) {
+      ++count;
+    }
+    ASSERT_EQ(count, 6);
+  };
+
+  // Create WALs.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    create_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs and create a snapshot.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .recover_on_startup = true,
+                        .snapshot_on_exit = true}});
+    verify_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // Recover the snapshot without the WALs.
+  std::filesystem::remove_all(storage_directory / memgraph::storage::durability::kWalDirectory);
+  memgraph::storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  verify_dataset(&store);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, EdgeIndices) {
+  auto create_dataset = [this](memgraph::storage::Storage *store) {
+    auto edge_type = store->NameToEdgeType("indexed");
+    auto other_edge_type = store->NameToEdgeType("other");
+    auto property = store->NameToProperty("weight");
+    {
+      auto acc = store->Access();
+      auto from = acc.CreateVertex();
+      auto to = acc.CreateVertex();
+      for (int64_t i = 0; i < 10; ++i) {
+        auto edge = acc.CreateEdge(&from, &to, i % 2 == 0 ? edge_type : other_edge_type);
+        ASSERT_TRUE(edge.HasValue());
+      }
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    ASSERT_TRUE(store->CreateEdgeIndex(edge_type));
+    ASSERT_TRUE(store->CreateEdgeIndex(other_edge_type));
+    ASSERT_TRUE(store->DropEdgeIndex(other_edge_type));
+    // Edge type+property indices exist only when edges have properties.
+    ASSERT_EQ(store->CreateEdgeIndex(edge_type, property), GetParam());
+    ASSERT_EQ(store->CreateEdgeIndex(other_edge_type, property), GetParam());
+    ASSERT_EQ(store->DropEdgeIndex(other_edge_type, property), GetParam());
+  };
+  auto verify_dataset = [this](memgraph::storage::Storage *store) {
+    auto edge_type = store->NameToEdgeType("indexed");
+    auto property = store->NameToProperty("weight");
+    auto info = store->ListAllIndices();
+    ASSERT_THAT(info.edge_type, UnorderedElementsAre(edge_type));
+    if (GetParam()) {
+      ASSERT_THAT(info.edge_type_property, UnorderedElementsAre(std::make_pair(edge_type, property)));
+    } else {
+      ASSERT_TRUE(info.edge_type_property.empty());
+    }
+  };
+
+  // Create WALs.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    create_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs and create a snapshot.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .recover_on_startup = true,
+                        .snapshot_on_exit = true}});
+    verify_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // Recover the snapshot without the WALs.
+  std::filesystem::remove_all(storage_directory / memgraph::storage::durability::kWalDirectory);
+  memgraph::storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  verify_dataset(&store);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, HashIndices) {
+  auto create_dataset = [](memgraph::storage::Storage *store) {
+    auto label = store->NameToLabel("hashed");
+    auto prop = store->NameToProperty("key");
+    auto other_prop = store->NameToProperty("other");
+    {
+      auto acc = store->Access();
+      for (int64_t i = 0; i < 10; ++i) {
+        auto vertex = acc.CreateVertex();
+        ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+        ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i % 3)).HasValue());
+      }
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    ASSERT_TRUE(store->CreateHashIndex(label, prop));
+    ASSERT_TRUE(store->CreateHashIndex(label, other_prop));
+    ASSERT_TRUE(store->DropHashIndex(label, other_prop));
+  };
+  auto verify_dataset = [](memgraph::storage::Storage *store) {
+    auto label = store->NameToLabel("hashed");
+    auto prop = store->NameToProperty("key");
+    ASSERT_THAT(store->ListAllIndices().label_property_hash, UnorderedElementsAre(std::make_pair(label, prop)));
+    auto acc = store->Access();
+    size_t count = 0;
+    for ([[maybe_unused]] auto vertex :
+         acc.Vertices(label, prop, memgraph::storage::PropertyValue(1), memgraph::storage::View::OLD)) {
+      ++count;
+    }
+    ASSERT_EQ(count, 3);
+  };
+
+  // Create WALs.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    create_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs and create a snapshot.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .recover_on_startup = true,
+                        .snapshot_on_exit = true}});
+    verify_dataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // Recover the snapshot without the WALs.
+  std::filesystem::remove_all(storage_directory / memgraph::storage::durability::kWalDirectory);
+  memgraph::storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  verify_dataset(&store);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalParallelRecovery) {
+  // Create WALs.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    CreateBaseDataset(&store, GetParam());
+    CreateExtendedDataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs using a single thread.
+  {
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .recover_on_startup = true, .recovery_thread_count = 1}});
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // Recover WALs using multiple threads.
+  memgraph::storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true, .recovery_thread_count = 8}});
+  VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+
+  // Try to use the storage.
+  {
+    auto acc = store.Access();
+    auto vertex = acc.CreateVertex();
+    auto edge = acc.CreateEdge(&vertex, &vertex, store.NameToEdgeType("et"));
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalBackup) {
   // Create WALs.
@@ -1220,6 +1647,57 @@ TEST_P(DurabilityTest, WalBackup) {
   ASSERT_EQ(GetBackupWalsList().size(), num_wals);
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommit) {
+  static constexpr uint64_t kNumThreads = 8;
+  static constexpr uint64_t kNumTransactions = 200;
+
+  for (auto visible_before_durable : {false, true}) {
+    std::filesystem::remove_all(storage_directory);
+
+    // Create WALs from concurrently committing transactions.
+    {
+      memgraph::storage::Storage store(
+          {.items = {.properties_on_edges = GetParam()},
+           .durability = {
+               .storage_directory = storage_directory,
+               .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+               .snapshot_interval = std::chrono::minutes(20),
+               .wal_file_size_kibibytes = 1,
+               .wal_group_commit = true,
+               .wal_group_commit_visible_before_durable = visible_before_durable}});
+      std::vector<std::thread> threads;
+      threads.reserve(kNumThreads);
+      for (uint64_t i = 0; i < kNumThreads; ++i) {
+        threads.emplace_back([&store] {
+          for (uint64_t j = 0; j < kNumTransactions; ++j) {
+            auto acc = store.Access();
+            acc.CreateVertex();
+            ASSERT_FALSE(acc.Commit().HasError());
+          }
+        });
+      }
+      ASSERT_TRUE(store.CreateIndex(store.NameToLabel("label")));
+      for (auto &thread : threads) thread.join();
+    }
+
+    ASSERT_EQ(GetSnapshotsList().size(), 0);
+    ASSERT_GE(GetWalsList().size(), 2);
+
+    // Recover WALs.
+    memgraph::storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+    ASSERT_EQ(store.ListAllIndices().label.size(), 1);
+    {
+      auto acc = store.Access();
+      uint64_t count = 0;
+      for ([[maybe_unused]] auto vertex : acc.Vertices(memgraph::storage::View::OLD)) ++count;
+      ASSERT_EQ(count, kNumThreads * kNumTransactions);
+    }
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalAppendToExisting) {
   // Create WALs.
@@ -5389,3 +5389,82 @@ TEST(StorageWithProperties, EdgeNonexistentPropertyAPI) {
 
   ASSERT_FALSE(acc.Commit().HasError());
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, EdgesFilteredByType) {
+  memgraph::storage::Storage store({.items = {.properties_on_edges = GetParam()}});
+  memgraph::storage::Gid gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  memgraph::storage::Gid gid_other = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  auto et1 = store.NameToEdgeType("et1");
+  auto et2 = store.NameToEdgeType("et2");
+  auto et3 = store.NameToEdgeType("et3");
+
+  // Create a hub with 10 edges of `et1`, 20 of `et2` and 30 of `et3` in both
+  // directions, interleaving the types.
+  {
+    auto acc = store.Access();
+    auto hub = acc.CreateVertex();
+    auto other = acc.CreateVertex();
+    gid_hub = hub.Gid();
+    gid_other = other.Gid();
+    for (int i = 0; i < 30; ++i) {
+      for (auto edge_type : {et1, et2, et3}) {
+        if (edge_type == et1 && i >= 10) continue;
+        if (edge_type == et2 && i >= 20) continue;
+        ASSERT_TRUE(acc.CreateEdge(&hub, &other, edge_type).HasValue());
+        ASSERT_TRUE(acc.CreateEdge(&other, &hub, edge_type).HasValue());
+      }
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  auto check = [&](memgraph::storage::View view, size_t count1, size_t count2, size_t count3) {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, view);
+    ASSERT_TRUE(hub);
+    auto other = acc.FindVertex(gid_other, view);
+    ASSERT_TRUE(other);
+    for (auto edges : {hub->OutEdges(view, {et2}), hub->InEdges(view, {et2})}) {
+      ASSERT_TRUE(edges.HasValue());
+      ASSERT_EQ(edges->size(), count2);
+      for (const auto &edge : *edges) ASSERT_EQ(edge.EdgeType(), et2);
+    }
+    ASSERT_EQ(hub->OutEdges(view, {et3, et1})->size(), count1 + count3);
+    ASSERT_EQ(hub->OutEdges(view, {et1, et1})->size(), count1);
+    ASSERT_EQ(hub->InEdges(view, {et3}, &*other)->size(), count3);
+    ASSERT_EQ(hub->InEdges(view, {et3}, &*hub)->size(), 0);
+    ASSERT_EQ(hub->OutEdges(view)->size(), count1 + count2 + count3);
+    ASSERT_EQ(*hub->OutDegree(view), count1 + count2 + count3);
+  };
+  check(memgraph::storage::View::OLD, 10, 20, 30);
+
+  // Delete all `et2` edges and check both views before the commit.
+  {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    for (auto edges : {hub->OutEdges(memgraph::storage::View::OLD, {et2}),
+                       hub->InEdges(memgraph::storage::View::OLD, {et2})}) {
+      ASSERT_TRUE(edges.HasValue());
+      for (auto &edge : *edges) ASSERT_TRUE(acc.DeleteEdge(&edge).HasValue());
+    }
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::OLD, {et2})->size(), 20);
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::NEW, {et2})->size(), 0);
+    ASSERT_EQ(hub->InEdges(memgraph::storage::View::NEW, {et2, et3})->size(), 30);
+    acc.Abort();
+  }
+  check(memgraph::storage::View::OLD, 10, 20, 30);
+
+  {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    for (auto edges : {hub->OutEdges(memgraph::storage::View::OLD, {et2}),
+                       hub->InEdges(memgraph::storage::View::OLD, {et2})}) {
+      ASSERT_TRUE(edges.HasValue());
+      for (auto &edge : *edges) ASSERT_TRUE(acc.DeleteEdge(&edge).HasValue());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  check(memgraph::storage::View::OLD, 10, 0, 30);
+}
@@ -198,3 +198,88 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// The GC splits unlinking and index clean-up between several threads and
+// continues unlinking in the next cycle once it runs out of time.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, ParallelIncremental) {
+  memgraph::storage::Storage storage(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
+                                       .interval = std::chrono::milliseconds(100),
+                                       .thread_count = 4,
+                                       .unlink_time_budget = std::chrono::milliseconds(1)}});
+  auto label = storage.NameToLabel("label");
+  auto property = storage.NameToProperty("property");
+  ASSERT_TRUE(storage.CreateIndex(label));
+  ASSERT_TRUE(storage.CreateIndex(label, property));
+
+  std::vector<memgraph::storage::Gid> vertices;
+  for (uint64_t i = 0; i < 200; ++i) {
+    auto acc = storage.Access();
+    for (uint64_t j = 0; j < 10; ++j) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(static_cast<int64_t>(j))).HasValue());
+      vertices.push_back(vertex.Gid());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    auto acc = storage.Access();
+    for (uint64_t i = 0; i < vertices.size(); i += 2) {
+      auto vertex = acc.FindVertex(vertices[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_TRUE(acc.DeleteVertex(&*vertex).HasValue());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  // Wait until the GC removes all of the deleted vertices.
+  const auto expected_count = static_cast<int64_t>(vertices.size() / 2);
+  for (int i = 0; i < 100 && storage.Access().ApproximateVertexCount() != expected_count; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  auto acc = storage.Access();
+  EXPECT_EQ(acc.ApproximateVertexCount(), expected_count);
+  EXPECT_EQ(acc.ApproximateVertexCount(label), expected_count);
+  EXPECT_EQ(acc.ApproximateVertexCount(label, property), expected_count);
+  for (uint64_t i = 0; i < vertices.size(); ++i) {
+    EXPECT_EQ(acc.FindVertex(vertices[i], memgraph::storage::View::OLD).has_value(), i % 2 != 0);
+  }
+}
+
+// Deltas are linked into the version chains by address, so they must stay in
+// place while the buffer grows.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, DeltaBufferStableAddresses) {
+  std::atomic<uint64_t> timestamp{0};
+  memgraph::storage::DeltaBuffer buffer;
+  std::vector<memgraph::storage::Delta *> addresses;
+  const uint64_t count = 3 * memgraph::storage::DeltaBuffer::kMaxChunkSize;
+  for (uint64_t i = 0; i < count; ++i) {
+    auto &delta = buffer.emplace_back(memgraph::storage::Delta::SetPropertyTag(),
+                                      memgraph::storage::PropertyId::FromUint(i),
+                                      memgraph::storage::PropertyValue(std::string(32, 'x')), &timestamp, i);
+    addresses.push_back(&delta);
+  }
+  ASSERT_EQ(buffer.size(), count);
+
+  // Moving the buffer, as done when the transaction's undo buffer is handed
+  // over to the GC, must not move the deltas either.
+  memgraph::storage::DeltaBuffer moved(std::move(buffer));
+  EXPECT_TRUE(buffer.empty());
+  ASSERT_EQ(moved.size(), count);
+  uint64_t i = 0;
+  for (auto &delta : moved) {
+    ASSERT_EQ(&delta, addresses[i]);
+    ASSERT_EQ(delta.command_id, i);
+    ASSERT_EQ(delta.property.value, memgraph::storage::PropertyValue(std::string(32, 'x')));
+    ++i;
+  }
+  EXPECT_EQ(i, count);
+
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(moved.begin(), moved.end());
+}
@@ -48,6 +48,14 @@ class IndexTest : public testing::Test {
     return vertex;
   }
 
+  static size_t CountEdges(EdgesIterable edges) {
+    size_t count = 0;
+    for ([[maybe_unused]] auto edge : edges) {
+      ++count;
+    }
+    return count;
+  }
+
   template <class TIterable>
   std::vector<int64_t> GetIds(TIterable iterable, View view = View::OLD) {
     std::vector<int64_t> ret;
@@ -830,3 +838,677 @@ TEST_F(IndexTest, LabelPropertyIndexMixedIteration) {
   // Iteration without any bounds should return all items of the index.
   verify(std::nullopt, std::nullopt, values);
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, PropertyColumnsCreateAndDrop) {
+  EXPECT_THAT(storage.ListAllIndices().property_columns, IsEmpty());
+  EXPECT_FALSE(storage.CreatePropertyColumns(label1, {}));
+  EXPECT_FALSE(storage.CreatePropertyColumns(label1, {{prop_val, PropertyValue::Type::String}}));
+  EXPECT_FALSE(storage.CreatePropertyColumns(
+      label1, {{prop_val, PropertyValue::Type::Int}, {prop_val, PropertyValue::Type::Double}}));
+  EXPECT_TRUE(storage.CreatePropertyColumns(label1, {{prop_val, PropertyValue::Type::Int}}));
+  EXPECT_FALSE(storage.CreatePropertyColumns(label1, {{prop_id, PropertyValue::Type::Int}}));
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.PropertyColumnExists(label1, prop_val));
+    EXPECT_FALSE(acc.PropertyColumnExists(label1, prop_id));
+    EXPECT_FALSE(acc.PropertyColumnExists(label2, prop_val));
+  }
+  EXPECT_EQ(storage.ListAllIndices().property_columns.size(), 1);
+  EXPECT_TRUE(storage.DropPropertyColumns(label1));
+  EXPECT_FALSE(storage.DropPropertyColumns(label1));
+  EXPECT_THAT(storage.ListAllIndices().property_columns, IsEmpty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, PropertyColumnsScan) {
+  using memgraph::utils::MakeBoundExclusive;
+  using memgraph::utils::MakeBoundInclusive;
+
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(i % 2 ? label1 : label2));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  // Existing vertices are copied into the columns on creation.
+  EXPECT_TRUE(storage.CreatePropertyColumns(
+      label1, {{prop_val, PropertyValue::Type::Int}, {prop_id, PropertyValue::Type::Int}}));
+
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(1, 3, 5, 7, 9));
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, MakeBoundExclusive(PropertyValue(3)),
+                                                    MakeBoundInclusive(PropertyValue(7.0)), View::OLD)),
+                UnorderedElementsAre(5, 7));
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, std::nullopt,
+                                                    MakeBoundExclusive(PropertyValue(5)), View::OLD)),
+                UnorderedElementsAre(1, 3));
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, MakeBoundInclusive(PropertyValue(1)),
+                                                    MakeBoundInclusive(PropertyValue("x")), View::OLD)),
+                IsEmpty());
+  }
+
+  // New vertices, values of a different type and removed properties are
+  // reflected in the scan, and uncommitted changes are seen only with the
+  // `NEW` view.
+  {
+    auto acc = storage.Access();
+    for (int i = 10; i < 14; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i)));
+    }
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      auto id = vertex.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id == 1) {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue("one")));
+      } else if (id == 3) {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue()));
+      } else if (id == 5) {
+        ASSERT_NO_ERROR(vertex.RemoveLabel(label1));
+      }
+    }
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(1, 3, 5, 7, 9));
+    EXPECT_THAT(
+        GetIds(acc.VerticesByPropertyColumn(label1, prop_val, std::nullopt, std::nullopt, View::NEW), View::NEW),
+        UnorderedElementsAre(1, 7, 9, 10, 11, 12, 13));
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, MakeBoundInclusive(PropertyValue(0)),
+                                                    std::nullopt, View::NEW),
+                       View::NEW),
+                UnorderedElementsAre(7, 9, 10, 11, 12, 13));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  // Once the garbage collector unlinks the deltas the values are read from the
+  // columns directly.
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(1, 7, 9, 10, 11, 12, 13));
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, MakeBoundInclusive(PropertyValue("a")),
+                                                    std::nullopt, View::OLD)),
+                UnorderedElementsAre(1));
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_id, MakeBoundInclusive(PropertyValue(9)),
+                                                    std::nullopt, View::OLD)),
+                UnorderedElementsAre(9, 10, 11, 12, 13));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, PropertyColumnsAbortAndDelete) {
+  using memgraph::utils::MakeBoundInclusive;
+
+  EXPECT_TRUE(storage.CreatePropertyColumns(label1, {{prop_val, PropertyValue::Type::Double}}));
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 5; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i * 1.5)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  storage.FreeMemory();
+
+  // Aborted changes must not be visible in the columns.
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(100.0)));
+    }
+    acc.Abort();
+  }
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, MakeBoundInclusive(PropertyValue(3)),
+                                                    std::nullopt, View::OLD)),
+                UnorderedElementsAre(2, 3, 4));
+  }
+
+  // Rows of deleted vertices are released and reused.
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      if (vertex.GetProperty(prop_id, View::OLD)->ValueInt() % 2 == 0) {
+        ASSERT_NO_ERROR(acc.DeleteVertex(&vertex));
+      }
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    auto vertex = CreateVertex(&acc);
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(7.5)));
+    ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.VerticesByPropertyColumn(label1, prop_val, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(1, 3, 5));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, PropertyColumnsLabelRemovalAndScanFallback) {
+  using memgraph::utils::MakeBoundInclusive;
+
+  EXPECT_TRUE(storage.CreatePropertyColumns(label1, {{prop_val, PropertyValue::Type::Int}}));
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 6; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, prop_val), 6);
+  }
+
+  // Rows of vertices that lose the label are released by the GC.
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      if (vertex.GetProperty(prop_id, View::OLD)->ValueInt() < 3) {
+        ASSERT_NO_ERROR(vertex.RemoveLabel(label1));
+      }
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, prop_val), 3);
+    // Without a label-property index the regular scans read the column.
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, View::OLD)), UnorderedElementsAre(3, 4, 5));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(4), View::OLD)), UnorderedElementsAre(4));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, MakeBoundInclusive(PropertyValue(0)),
+                                    MakeBoundInclusive(PropertyValue(3)), View::OLD)),
+                UnorderedElementsAre(3));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyCompositeIndexCreateAndDrop) {
+  EXPECT_FALSE(storage.CreateCompositeIndex(label1, {prop_val}));
+  EXPECT_FALSE(storage.CreateCompositeIndex(label1, {prop_val, prop_val}));
+  EXPECT_TRUE(storage.CreateCompositeIndex(label1, {prop_val, prop_id}));
+  EXPECT_FALSE(storage.CreateCompositeIndex(label1, {prop_val, prop_id}));
+  // The order of the properties matters.
+  EXPECT_TRUE(storage.CreateCompositeIndex(label1, {prop_id, prop_val}));
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.LabelPropertyCompositeIndexExists(label1, {prop_val, prop_id}));
+    EXPECT_TRUE(acc.LabelPropertyCompositeIndexExists(label1, {prop_id, prop_val}));
+    EXPECT_FALSE(acc.LabelPropertyCompositeIndexExists(label2, {prop_val, prop_id}));
+    // Composite indices don't act as single property indices.
+    EXPECT_FALSE(acc.LabelPropertyIndexExists(label1, prop_val));
+  }
+  EXPECT_EQ(storage.ListAllIndices().label_property_composite.size(), 2);
+
+  EXPECT_TRUE(storage.DropCompositeIndex(label1, {prop_val, prop_id}));
+  EXPECT_FALSE(storage.DropCompositeIndex(label1, {prop_val, prop_id}));
+  EXPECT_THAT(storage.ListAllIndices().label_property_composite,
+              UnorderedElementsAre(std::make_pair(label1, std::vector<PropertyId>{prop_id, prop_val})));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyCompositeIndexBasic) {
+  using memgraph::utils::MakeBoundExclusive;
+  using memgraph::utils::MakeBoundInclusive;
+
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i % 3)));
+    }
+    // Vertices without all of the properties aren't indexed.
+    auto vertex = CreateVertex(&acc);
+    ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  // Existing vertices are indexed on creation.
+  EXPECT_TRUE(storage.CreateCompositeIndex(label1, {prop_val, prop_id}));
+  const std::vector<PropertyId> properties{prop_val, prop_id};
+
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, properties, {}), 10);
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {}, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(1)}, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(1), PropertyValue(4)}, std::nullopt,
+                                    std::nullopt, View::OLD)),
+                UnorderedElementsAre(4));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(2)}, MakeBoundExclusive(PropertyValue(2)),
+                                    MakeBoundInclusive(PropertyValue(8)), View::OLD)),
+                UnorderedElementsAre(5, 8));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(0)}, MakeBoundInclusive(PropertyValue(6)),
+                                    std::nullopt, View::OLD)),
+                UnorderedElementsAre(6, 9));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(0)}, MakeBoundInclusive(PropertyValue("a")),
+                                    std::nullopt, View::OLD)),
+                IsEmpty());
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue()}, std::nullopt, std::nullopt, View::OLD)),
+                IsEmpty());
+  }
+
+  // Changes are seen only with the `NEW` view until they are committed.
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      auto id = vertex.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id == 4) {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(2)));
+      } else if (id == 7) {
+        ASSERT_NO_ERROR(vertex.RemoveLabel(label1));
+      } else if (id == 10) {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(1)));
+      }
+    }
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(1)}, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(1)}, std::nullopt, std::nullopt, View::NEW),
+                       View::NEW),
+                UnorderedElementsAre(1, 10));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(2)}, std::nullopt, std::nullopt, View::NEW),
+                       View::NEW),
+                UnorderedElementsAre(2, 4, 5, 8));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(1)}, std::nullopt, std::nullopt, View::OLD)),
+                UnorderedElementsAre(1, 10));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {PropertyValue(2)}, MakeBoundInclusive(PropertyValue(4)),
+                                    MakeBoundExclusive(PropertyValue(8)), View::OLD)),
+                UnorderedElementsAre(4, 5));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyHashIndexCreateAndDrop) {
+  EXPECT_TRUE(storage.CreateHashIndex(label1, prop_val));
+  EXPECT_FALSE(storage.CreateHashIndex(label1, prop_val));
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.LabelPropertyHashIndexExists(label1, prop_val));
+    EXPECT_FALSE(acc.LabelPropertyHashIndexExists(label2, prop_val));
+    // Hash indices don't act as label-property indices.
+    EXPECT_FALSE(acc.LabelPropertyIndexExists(label1, prop_val));
+  }
+  EXPECT_THAT(storage.ListAllIndices().label_property_hash, UnorderedElementsAre(std::make_pair(label1, prop_val)));
+
+  EXPECT_TRUE(storage.DropHashIndex(label1, prop_val));
+  EXPECT_FALSE(storage.DropHashIndex(label1, prop_val));
+  EXPECT_THAT(storage.ListAllIndices().label_property_hash, IsEmpty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyHashIndexBasic) {
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(i % 2 ? label1 : label2));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i % 3)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  // Existing vertices are indexed when the index is created.
+  ASSERT_TRUE(storage.CreateHashIndex(label1, prop_val));
+
+  auto acc = storage.Access();
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(0), View::OLD)), UnorderedElementsAre(3, 9));
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(1), View::OLD)), UnorderedElementsAre(1, 7));
+  // Integers and doubles which compare equal are found by each other.
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(2.0), View::OLD)), UnorderedElementsAre(5));
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(3), View::OLD)), IsEmpty());
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(), View::OLD)), IsEmpty());
+
+  for (auto vertex : acc.Vertices(View::OLD)) {
+    if (vertex.GetProperty(prop_id, View::OLD)->ValueInt() % 2 == 0) {
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    } else {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue("value")));
+    }
+  }
+
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(0), View::OLD)), UnorderedElementsAre(3, 9));
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(0), View::NEW), View::NEW),
+              UnorderedElementsAre(0, 6));
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("value"), View::OLD)), IsEmpty());
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("value"), View::NEW), View::NEW),
+              UnorderedElementsAre(1, 3, 5, 7, 9));
+
+  acc.Abort();
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(0), View::NEW), View::NEW),
+                UnorderedElementsAre(3, 9));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("value"), View::NEW), View::NEW), IsEmpty());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyHashIndexTransactionalIsolation) {
+  storage.CreateHashIndex(label1, prop_val);
+
+  auto acc_before = storage.Access();
+  auto acc = storage.Access();
+
+  for (int i = 0; i < 5; ++i) {
+    auto vertex = CreateVertex(&acc);
+    ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(42)));
+  }
+
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(42), View::NEW), View::NEW),
+              UnorderedElementsAre(0, 1, 2, 3, 4));
+  EXPECT_THAT(GetIds(acc_before.Vertices(label1, prop_val, PropertyValue(42), View::NEW), View::NEW), IsEmpty());
+
+  ASSERT_NO_ERROR(acc.Commit());
+
+  auto acc_after_commit = storage.Access();
+  EXPECT_THAT(GetIds(acc_before.Vertices(label1, prop_val, PropertyValue(42), View::NEW), View::NEW), IsEmpty());
+  EXPECT_THAT(GetIds(acc_after_commit.Vertices(label1, prop_val, PropertyValue(42), View::NEW), View::NEW),
+              UnorderedElementsAre(0, 1, 2, 3, 4));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyHashIndexCountEstimate) {
+  storage.CreateHashIndex(label1, prop_val);
+  {
+    auto acc = storage.Access();
+    for (int i = 1; i <= 10; ++i) {
+      for (int j = 0; j < i; ++j) {
+        auto vertex = CreateVertex(&acc);
+        ASSERT_NO_ERROR(vertex.AddLabel(label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i)));
+      }
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, prop_val), 55);
+    for (int i = 1; i <= 10; ++i) {
+      EXPECT_EQ(acc.ApproximateVertexCount(label1, prop_val, PropertyValue(i)), i);
+    }
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, prop_val, PropertyValue()), 6);
+
+    // Remove the property from all vertices so that the entries become
+    // obsolete.
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue()));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, prop_val), 0);
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, prop_val, PropertyValue(10)), 0);
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue(10), View::OLD)), IsEmpty());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, EdgeTypeIndexBasic) {
+  EdgeTypeId edge_type1;
+  EdgeTypeId edge_type2;
+  {
+    auto acc = storage.Access();
+    edge_type1 = acc.NameToEdgeType("edge_type1");
+    edge_type2 = acc.NameToEdgeType("edge_type2");
+    auto from = CreateVertex(&acc);
+    auto to = CreateVertex(&acc);
+    for (int i = 0; i < 4; ++i) {
+      auto edge = acc.CreateEdge(&from, &to, i % 2 == 0 ? edge_type1 : edge_type2);
+      ASSERT_NO_ERROR(edge);
+      ASSERT_NO_ERROR(edge->SetProperty(prop_id, PropertyValue(i)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  EXPECT_TRUE(storage.CreateEdgeIndex(edge_type1));
+  EXPECT_FALSE(storage.CreateEdgeIndex(edge_type1));
+  EXPECT_THAT(storage.ListAllIndices().edge_type, UnorderedElementsAre(edge_type1));
+
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.EdgeTypeIndexExists(edge_type1));
+    EXPECT_FALSE(acc.EdgeTypeIndexExists(edge_type2));
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1), 2);
+    EXPECT_THAT(GetIds(acc.Edges(edge_type1, View::OLD)), UnorderedElementsAre(0, 2));
+  }
+
+  // New and deleted edges are seen only with the `NEW` view until the
+  // transaction commits.
+  {
+    auto acc = storage.Access();
+    auto from = acc.FindVertex(Gid::FromUint(0), View::OLD);
+    ASSERT_TRUE(from);
+    auto to = acc.FindVertex(Gid::FromUint(1), View::OLD);
+    ASSERT_TRUE(to);
+    auto edge = acc.CreateEdge(&*from, &*to, edge_type1);
+    ASSERT_NO_ERROR(edge);
+    ASSERT_NO_ERROR(edge->SetProperty(prop_id, PropertyValue(4)));
+    for (auto existing : acc.Edges(edge_type1, View::OLD)) {
+      if (existing.GetProperty(prop_id, View::OLD)->ValueInt() == 0) {
+        ASSERT_NO_ERROR(acc.DeleteEdge(&existing));
+      }
+    }
+    EXPECT_THAT(GetIds(acc.Edges(edge_type1, View::OLD)), UnorderedElementsAre(0, 2));
+    EXPECT_THAT(GetIds(acc.Edges(edge_type1, View::NEW), View::NEW), UnorderedElementsAre(2, 4));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.Edges(edge_type1, View::OLD)), UnorderedElementsAre(2, 4));
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1), 2);
+  }
+
+  EXPECT_TRUE(storage.DropEdgeIndex(edge_type1));
+  EXPECT_FALSE(storage.DropEdgeIndex(edge_type1));
+  EXPECT_THAT(storage.ListAllIndices().edge_type, IsEmpty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, EdgeTypeIndexWithoutPropertiesOnEdges) {
+  Storage storage_without_properties({.items = {.properties_on_edges = false}});
+  EdgeTypeId edge_type;
+  {
+    auto acc = storage_without_properties.Access();
+    edge_type = acc.NameToEdgeType("edge_type");
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    ASSERT_NO_ERROR(acc.CreateEdge(&from, &to, edge_type));
+    ASSERT_NO_ERROR(acc.CreateEdge(&to, &from, edge_type));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  EXPECT_TRUE(storage_without_properties.CreateEdgeIndex(edge_type));
+  // Edges don't have properties, so they can't be indexed by them.
+  EXPECT_FALSE(storage_without_properties.CreateEdgeIndex(edge_type, prop_id));
+
+  {
+    auto acc = storage_without_properties.Access();
+    std::vector<EdgeAccessor> found;
+    for (auto edge : acc.Edges(edge_type, View::OLD)) {
+      found.push_back(edge);
+    }
+    ASSERT_EQ(found.size(), 2);
+    ASSERT_NO_ERROR(acc.DeleteEdge(&found[0]));
+    EXPECT_EQ(CountEdges(acc.Edges(edge_type, View::NEW)), 1);
+    EXPECT_EQ(CountEdges(acc.Edges(edge_type, View::OLD)), 2);
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  storage_without_properties.FreeMemory();
+  {
+    auto acc = storage_without_properties.Access();
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type), 1);
+    EXPECT_EQ(CountEdges(acc.Edges(edge_type, View::OLD)), 1);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, EdgeTypePropertyIndexBasic) {
+  using memgraph::utils::MakeBoundExclusive;
+  using memgraph::utils::MakeBoundInclusive;
+
+  EdgeTypeId edge_type;
+  {
+    auto acc = storage.Access();
+    edge_type = acc.NameToEdgeType("edge_type");
+    auto from = CreateVertex(&acc);
+    auto to = CreateVertex(&acc);
+    for (int i = 0; i < 10; ++i) {
+      auto edge = acc.CreateEdge(&from, &to, edge_type);
+      ASSERT_NO_ERROR(edge);
+      ASSERT_NO_ERROR(edge->SetProperty(prop_id, PropertyValue(i)));
+      ASSERT_NO_ERROR(edge->SetProperty(prop_val, PropertyValue(i % 3)));
+    }
+    // Edges without the property aren't indexed.
+    auto edge = acc.CreateEdge(&from, &to, edge_type);
+    ASSERT_NO_ERROR(edge);
+    ASSERT_NO_ERROR(edge->SetProperty(prop_id, PropertyValue(10)));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  EXPECT_TRUE(storage.CreateEdgeIndex(edge_type, prop_val));
+  EXPECT_FALSE(storage.CreateEdgeIndex(edge_type, prop_val));
+  EXPECT_THAT(storage.ListAllIndices().edge_type_property, UnorderedElementsAre(std::make_pair(edge_type, prop_val)));
+
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.EdgeTypePropertyIndexExists(edge_type, prop_val));
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type, prop_val), 10);
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, PropertyValue(1), View::OLD)), UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, MakeBoundExclusive(PropertyValue(0)),
+                                 MakeBoundInclusive(PropertyValue(1)), View::OLD)),
+                UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, MakeBoundInclusive(PropertyValue(2)), std::nullopt, View::OLD)),
+                UnorderedElementsAre(2, 5, 8));
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, MakeBoundInclusive(PropertyValue("a")), std::nullopt,
+                                 View::OLD)),
+                IsEmpty());
+  }
+
+  // Changes are seen only with the `NEW` view until they are committed.
+  {
+    auto acc = storage.Access();
+    for (auto edge : acc.Edges(edge_type, prop_val, MakeBoundInclusive(PropertyValue(0)), std::nullopt, View::OLD)) {
+      auto id = edge.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id == 4) {
+        ASSERT_NO_ERROR(edge.SetProperty(prop_val, PropertyValue(2)));
+      } else if (id == 7) {
+        ASSERT_NO_ERROR(acc.DeleteEdge(&edge));
+      }
+    }
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, PropertyValue(1), View::OLD)), UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, PropertyValue(1), View::NEW), View::NEW),
+                UnorderedElementsAre(1));
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, PropertyValue(2), View::NEW), View::NEW),
+                UnorderedElementsAre(2, 4, 5, 8));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, PropertyValue(1), View::OLD)), UnorderedElementsAre(1));
+    EXPECT_THAT(GetIds(acc.Edges(edge_type, prop_val, PropertyValue(2), View::OLD)), UnorderedElementsAre(2, 4, 5, 8));
+  }
+
+  EXPECT_TRUE(storage.DropEdgeIndex(edge_type, prop_val));
+  EXPECT_FALSE(storage.DropEdgeIndex(edge_type, prop_val));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, BulkLoad) {
+  EdgeTypeId edge_type;
+  {
+    auto acc = storage.Access();
+    edge_type = acc.NameToEdgeType("edge_type");
+    auto vertex = CreateVertex(&acc);
+    ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(10)));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  ASSERT_TRUE(storage.CreateIndex(label1));
+  ASSERT_TRUE(storage.CreateIndex(label1, prop_val));
+  ASSERT_TRUE(storage.CreateHashIndex(label2, prop_val));
+  ASSERT_TRUE(storage.CreateEdgeIndex(edge_type, prop_val));
+
+  {
+    auto bulk_load = storage.BulkLoad();
+    ASSERT_FALSE(bulk_load.HasError());
+    auto &acc = *bulk_load;
+    std::vector<Gid> gids;
+    // The values are decreasing so that the entries have to be sorted.
+    for (int i = 1; i < 10; ++i) {
+      gids.push_back(acc.CreateVertex({i % 2 ? label1 : label2},
+                                      {{prop_id, PropertyValue(i)}, {prop_val, PropertyValue(10 - i)}}));
+    }
+    for (int i = 0; i + 1 < static_cast<int>(gids.size()); ++i) {
+      auto edge = acc.CreateEdge(gids[i], gids[i + 1], edge_type, {{prop_val, PropertyValue(i)}});
+      ASSERT_NO_ERROR(edge);
+    }
+    auto edge = acc.CreateEdge(gids[0], Gid::FromUint(100), edge_type, {});
+    ASSERT_TRUE(edge.HasError());
+    EXPECT_EQ(edge.GetError(), Error::NONEXISTENT_OBJECT);
+    acc.Finish();
+  }
+
+  auto acc = storage.Access();
+  EXPECT_THAT(GetIds(acc.Vertices(View::OLD)), UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+  EXPECT_THAT(GetIds(acc.Vertices(label1, View::OLD)), UnorderedElementsAre(0, 1, 3, 5, 7, 9));
+  EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, View::OLD)), testing::ElementsAre(9, 7, 5, 3, 1, 0));
+  EXPECT_THAT(GetIds(acc.Vertices(label2, prop_val, PropertyValue(4), View::OLD)), UnorderedElementsAre(6));
+  EXPECT_EQ(CountEdges(acc.Edges(edge_type, prop_val, std::nullopt, std::nullopt, View::OLD)), 8U);
+
+  auto vertex = acc.FindVertex(Gid::FromUint(1), View::OLD);
+  ASSERT_TRUE(vertex);
+  EXPECT_EQ(vertex->OutEdges(View::OLD)->size(), 1U);
+  EXPECT_EQ(vertex->InEdges(View::OLD)->size(), 0U);
+  EXPECT_EQ(*vertex->GetProperty(prop_val, View::OLD), PropertyValue(9));
+  EXPECT_EQ(storage.GetInfo().edge_count, 8U);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, BulkLoadWithConstraints) {
+  auto constraint = storage.CreateExistenceConstraint(label1, prop_id);
+  ASSERT_FALSE(constraint.HasError());
+  auto bulk_load = storage.BulkLoad();
+  ASSERT_TRUE(bulk_load.HasError());
+  EXPECT_EQ(bulk_load.GetError(), Storage::BulkLoadError::CONSTRAINTS_EXIST);
+  // The storage lock must be released.
+  auto acc = storage.Access();
+  ASSERT_NO_ERROR(acc.Commit());
+}
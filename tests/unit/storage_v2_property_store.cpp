@@ -649,3 +649,37 @@ TEST(PropertyStore, IsPropertyEqualTemporalData) {
   ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue(memgraph::storage::TemporalData{
                                                memgraph::storage::TemporalType::Date, 30})));
 }
+
+TEST(PropertyStore, InitProperties) {
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> data;
+  for (size_t i = 0; i < std::size(kSampleValues); ++i) {
+    data.emplace(memgraph::storage::PropertyId::FromUint(i), kSampleValues[i]);
+  }
+
+  memgraph::storage::PropertyStore props;
+  ASSERT_TRUE(props.InitProperties(data));
+  for (const auto &[prop, value] : data) {
+    ASSERT_EQ(props.GetProperty(prop), value);
+    TestIsPropertyEqual(props, prop, value);
+  }
+  // `Null` values aren't stored.
+  data.erase(memgraph::storage::PropertyId::FromUint(0));
+  ASSERT_EQ(props.Properties(), data);
+
+  // The store must be empty.
+  ASSERT_FALSE(props.InitProperties({}));
+  ASSERT_EQ(props.Properties(), data);
+
+  // The store can be modified as usual afterwards.
+  auto prop = memgraph::storage::PropertyId::FromUint(3);
+  ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue("changed")));
+  ASSERT_EQ(props.GetProperty(prop), memgraph::storage::PropertyValue("changed"));
+  ASSERT_TRUE(props.ClearProperties());
+
+  // Small properties are kept in the local buffer.
+  ASSERT_TRUE(props.InitProperties({{prop, memgraph::storage::PropertyValue(42)}}));
+  ASSERT_EQ(props.GetProperty(prop), memgraph::storage::PropertyValue(42));
+  ASSERT_TRUE(props.ClearProperties());
+  ASSERT_TRUE(props.InitProperties({}));
+  ASSERT_TRUE(props.Properties().empty());
+}
@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 
@@ -504,6 +505,61 @@ TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
                                     memgraph::storage::replication::ReplicationMode::ASYNC)
                    .HasError());
 
+  constexpr size_t vertices_create_num = 10;
+  std::vector<memgraph::storage::Gid> created_vertices;
+  for (size_t i = 0; i < vertices_create_num; ++i) {
+    auto acc = main_store.Access();
+    auto v = acc.CreateVertex();
+    created_vertices.push_back(v.Gid());
+    ASSERT_FALSE(acc.Commit().HasError());
+
+    // The transactions committed while the previous ones are being sent are
+    // queued for the replica.
+    ASSERT_THAT(main_store.GetReplicaState("REPLICA_ASYNC"),
+                testing::AnyOf(memgraph::storage::replication::ReplicaState::REPLICATING,
+                               memgraph::storage::replication::ReplicaState::READY));
+  }
+
+  while (main_store.GetReplicaState("REPLICA_ASYNC") != memgraph::storage::replication::ReplicaState::READY) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  ASSERT_TRUE(std::all_of(created_vertices.begin(), created_vertices.end(), [&](const auto vertex_gid) {
+    auto acc = replica_store_async.Access();
+    auto v = acc.FindVertex(vertex_gid, memgraph::storage::View::OLD);
+    const bool exists = v.has_value();
+    EXPECT_FALSE(acc.Commit().HasError());
+    return exists;
+  }));
+}
+
+TEST_F(ReplicationTest, AsynchronousReplicationWithoutPendingBatches) {
+  memgraph::storage::Storage main_store(
+      {.items = {.properties_on_edges = true},
+       .durability =
+           {
+               .storage_directory = storage_directory,
+               .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+           },
+       .replication = {.batch_size_kibibytes = 0, .max_pending_batches = 0}});
+
+  memgraph::storage::Storage replica_store_async(
+      {.items = {.properties_on_edges = true},
+       .durability = {
+           .storage_directory = storage_directory,
+           .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+       }});
+
+  replica_store_async.SetReplicaRole(memgraph::io::network::Endpoint{"127.0.0.1", 20000});
+
+  ASSERT_FALSE(main_store
+                   .RegisterReplica("REPLICA_ASYNC", memgraph::io::network::Endpoint{"127.0.0.1", 20000},
+                                    memgraph::storage::replication::ReplicationMode::ASYNC)
+                   .HasError());
+
+  // Without room for pending batches, the replica misses the transactions
+  // committed while the first one is being sent and recovers them from the
+  // durability files.
   constexpr size_t vertices_create_num = 10;
   std::vector<memgraph::storage::Gid> created_vertices;
   for (size_t i = 0; i < vertices_create_num; ++i) {
@@ -532,6 +588,159 @@ TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
   }));
 }
 
+TEST_F(ReplicationTest, SynchronousReplicationOfCompressedBatches) {
+  memgraph::storage::Storage main_store(
+      {.items = {.properties_on_edges = true},
+       .durability =
+           {
+               .storage_directory = storage_directory,
+               .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+           },
+       .replication = {.batch_size_kibibytes = 16, .compress_batches = true, .visible_before_sync_ack = true}});
+
+  memgraph::storage::Storage replica_store(
+      {.items = {.properties_on_edges = true},
+       .durability = {
+           .storage_directory = storage_directory,
+           .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+       }});
+  replica_store.SetReplicaRole(memgraph::io::network::Endpoint{"127.0.0.1", 10000});
+
+  ASSERT_FALSE(main_store
+                   .RegisterReplica("REPLICA", memgraph::io::network::Endpoint{"127.0.0.1", 10000},
+                                    memgraph::storage::replication::ReplicationMode::SYNC)
+                   .HasError());
+
+  // With the visibility relaxed, concurrent commits are coalesced into batches
+  // and every commit still returns only after the replica applied it.
+  constexpr size_t thread_count = 8;
+  constexpr size_t vertices_per_thread = 50;
+  const auto property = main_store.NameToProperty("property");
+  const memgraph::storage::PropertyValue value(std::string(1000, 'a'));
+  std::vector<std::vector<memgraph::storage::Gid>> created_vertices(thread_count);
+  std::atomic<bool> missing_on_replica{false};
+  {
+    std::vector<std::jthread> threads;
+    for (size_t i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&, i] {
+        for (size_t j = 0; j < vertices_per_thread; ++j) {
+          {
+            auto acc = main_store.Access();
+            auto v = acc.CreateVertex();
+            created_vertices[i].push_back(v.Gid());
+            MG_ASSERT(v.SetProperty(property, value).HasValue());
+            MG_ASSERT(!acc.Commit().HasError());
+          }
+          auto acc = replica_store.Access();
+          if (!acc.FindVertex(created_vertices[i].back(), memgraph::storage::View::OLD)) missing_on_replica = true;
+          MG_ASSERT(!acc.Commit().HasError());
+        }
+      });
+    }
+  }
+  ASSERT_FALSE(missing_on_replica);
+
+  auto acc = replica_store.Access();
+  for (const auto &vertices : created_vertices) {
+    for (const auto gid : vertices) {
+      const auto v = acc.FindVertex(gid, memgraph::storage::View::OLD);
+      ASSERT_TRUE(v);
+      ASSERT_EQ(*v->GetProperty(replica_store.NameToProperty("property"), memgraph::storage::View::OLD), value);
+    }
+  }
+  ASSERT_FALSE(acc.Commit().HasError());
+}
+
+TEST_F(ReplicationTest, CompressedBatchesLargerThanReplicaBatchSize) {
+  memgraph::storage::Storage main_store(
+      {.items = {.properties_on_edges = true},
+       .durability =
+           {
+               .storage_directory = storage_directory,
+               .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+           },
+       .replication = {.compress_batches = true}});
+
+  memgraph::storage::Storage replica_store(
+      {.items = {.properties_on_edges = true},
+       .durability =
+           {
+               .storage_directory = storage_directory,
+               .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+           },
+       .replication = {.batch_size_kibibytes = 1}});
+  replica_store.SetReplicaRole(memgraph::io::network::Endpoint{"127.0.0.1", 10000});
+
+  ASSERT_FALSE(main_store
+                   .RegisterReplica("REPLICA", memgraph::io::network::Endpoint{"127.0.0.1", 10000},
+                                    memgraph::storage::replication::ReplicationMode::SYNC)
+                   .HasError());
+
+  // The replica only limits compressed batches to the protocol limit, not to
+  // its own batch size.
+  const auto property = main_store.NameToProperty("property");
+  const memgraph::storage::PropertyValue value(std::string(100 * 1024, 'a'));
+  memgraph::storage::Gid vertex_gid;
+  {
+    auto acc = main_store.Access();
+    auto v = acc.CreateVertex();
+    vertex_gid = v.Gid();
+    ASSERT_TRUE(v.SetProperty(property, value).HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  ASSERT_EQ(main_store.GetReplicaState("REPLICA"), memgraph::storage::replication::ReplicaState::READY);
+
+  auto acc = replica_store.Access();
+  const auto v = acc.FindVertex(vertex_gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(v);
+  ASSERT_EQ(*v->GetProperty(replica_store.NameToProperty("property"), memgraph::storage::View::OLD), value);
+  ASSERT_FALSE(acc.Commit().HasError());
+}
+
+TEST_F(ReplicationTest, WaitForCommitTimestampOnReplica) {
+  memgraph::storage::Storage main_store(
+      {.items = {.properties_on_edges = true},
+       .durability = {
+           .storage_directory = storage_directory,
+           .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+       }});
+
+  memgraph::storage::Storage replica_store_async(
+      {.items = {.properties_on_edges = true},
+       .durability = {
+           .storage_directory = storage_directory,
+           .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+       }});
+
+  replica_store_async.SetReplicaRole(memgraph::io::network::Endpoint{"127.0.0.1", 20000});
+
+  ASSERT_FALSE(main_store
+                   .RegisterReplica("REPLICA_ASYNC", memgraph::io::network::Endpoint{"127.0.0.1", 20000},
+                                    memgraph::storage::replication::ReplicationMode::ASYNC)
+                   .HasError());
+
+  // Every write on the MAIN is visible on the REPLICA once it reaches the
+  // commit timestamp of the write.
+  for (size_t i = 0; i < 10; ++i) {
+    memgraph::storage::Gid vertex_gid;
+    {
+      auto acc = main_store.Access();
+      vertex_gid = acc.CreateVertex().Gid();
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    const auto commit_timestamp = main_store.LastCommitTimestamp();
+    ASSERT_TRUE(replica_store_async.WaitForCommitTimestamp(commit_timestamp, std::chrono::seconds(10)));
+    ASSERT_GE(replica_store_async.LastCommitTimestamp(), commit_timestamp);
+    auto acc = replica_store_async.Access();
+    ASSERT_TRUE(acc.FindVertex(vertex_gid, memgraph::storage::View::OLD));
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  // The wait times out if the MAIN didn't commit anything with the timestamp.
+  ASSERT_FALSE(replica_store_async.WaitForCommitTimestamp(main_store.LastCommitTimestamp() + 1000,
+                                                          std::chrono::milliseconds(10)));
+}
+
 TEST_F(ReplicationTest, EpochTest) {
   memgraph::storage::Storage main_store(
       {.items = {.properties_on_edges = true},
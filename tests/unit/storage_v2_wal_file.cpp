@@ -14,6 +14,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <string_view>
 
@@ -46,6 +47,26 @@ memgraph::storage::durability::WalDeltaData::Type StorageGlobalOperationToWalDel
       return memgraph::storage::durability::WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE;
     case memgraph::storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
       return memgraph::storage::durability::WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTIES_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTIES_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTIES_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTIES_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::PROPERTY_COLUMNS_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::PROPERTY_COLUMNS_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::PROPERTY_COLUMNS_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::PROPERTY_COLUMNS_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_DROP;
   }
 }
 
@@ -199,11 +220,11 @@ class DeltaGenerator final {
   }
 
   void AppendOperation(memgraph::storage::durability::StorageGlobalOperation operation, const std::string &label,
-                       const std::set<std::string> properties = {}) {
+                       const std::vector<std::string> properties = {}) {
     auto label_id = memgraph::storage::LabelId::FromUint(mapper_.NameToId(label));
-    std::set<memgraph::storage::PropertyId> property_ids;
+    std::vector<memgraph::storage::PropertyId> property_ids;
     for (const auto &property : properties) {
-      property_ids.insert(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
+      property_ids.push_back(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
     }
     wal_file_.AppendOperation(operation, label_id, property_ids, timestamp_);
     if (valid_) {
@@ -213,18 +234,76 @@ class DeltaGenerator final {
       switch (operation) {
         case memgraph::storage::durability::StorageGlobalOperation::LABEL_INDEX_CREATE:
         case memgraph::storage::durability::StorageGlobalOperation::LABEL_INDEX_DROP:
+        case memgraph::storage::durability::StorageGlobalOperation::PROPERTY_COLUMNS_DROP:
           data.operation_label.label = label;
           break;
         case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE:
         case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_INDEX_DROP:
         case memgraph::storage::durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP:
+        case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_HASH_INDEX_DROP:
           data.operation_label_property.label = label;
           data.operation_label_property.property = *properties.begin();
         case memgraph::storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
           data.operation_label_properties.label = label;
-          data.operation_label_properties.properties = properties;
+          data.operation_label_properties.properties = {properties.begin(), properties.end()};
+          break;
+        case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTIES_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTIES_INDEX_DROP:
+          data.operation_label_property_list.label = label;
+          data.operation_label_property_list.properties = properties;
+          break;
+        case memgraph::storage::durability::StorageGlobalOperation::PROPERTY_COLUMNS_CREATE:
+          LOG_FATAL("Use AppendPropertyColumnsOperation!");
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_INDEX_DROP:
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_DROP:
+          LOG_FATAL("Use AppendEdgeIndexOperation!");
+      }
+      data_.emplace_back(timestamp_, data);
+    }
+  }
+
+  void AppendPropertyColumnsOperation(
+      const std::string &label,
+      const std::vector<std::pair<std::string, memgraph::storage::PropertyValue::Type>> &columns) {
+    auto label_id = memgraph::storage::LabelId::FromUint(mapper_.NameToId(label));
+    std::vector<std::pair<memgraph::storage::PropertyId, memgraph::storage::PropertyValue::Type>> schema;
+    for (const auto &[property, type] : columns) {
+      schema.emplace_back(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)), type);
+    }
+    wal_file_.AppendOperation(memgraph::storage::durability::StorageGlobalOperation::PROPERTY_COLUMNS_CREATE,
+                              label_id, schema, timestamp_);
+    if (valid_) {
+      UpdateStats(timestamp_, 1);
+      memgraph::storage::durability::WalDeltaData data;
+      data.type = memgraph::storage::durability::WalDeltaData::Type::PROPERTY_COLUMNS_CREATE;
+      data.operation_label_property_columns.label = label;
+      data.operation_label_property_columns.properties = columns;
+      data_.emplace_back(timestamp_, data);
+    }
+  }
+
+  void AppendEdgeIndexOperation(memgraph::storage::durability::StorageGlobalOperation operation,
+                                const std::string &edge_type, const std::vector<std::string> properties = {}) {
+    auto edge_type_id = memgraph::storage::EdgeTypeId::FromUint(mapper_.NameToId(edge_type));
+    std::vector<memgraph::storage::PropertyId> property_ids;
+    for (const auto &property : properties) {
+      property_ids.push_back(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
+    }
+    wal_file_.AppendOperation(operation, edge_type_id, property_ids, timestamp_);
+    if (valid_) {
+      UpdateStats(timestamp_, 1);
+      memgraph::storage::durability::WalDeltaData data;
+      data.type = StorageGlobalOperationToWalDeltaDataType(operation);
+      if (properties.empty()) {
+        data.operation_edge_type.edge_type = edge_type;
+      } else {
+        data.operation_edge_type_property.edge_type = edge_type;
+        data.operation_edge_type_property.property = properties.front();
       }
       data_.emplace_back(timestamp_, data);
     }
@@ -514,6 +593,19 @@ GENERATE_SIMPLE_TEST(AllGlobalOperations, {
   OPERATION(EXISTENCE_CONSTRAINT_DROP, "hello", {"world"});
   OPERATION(UNIQUE_CONSTRAINT_CREATE, "hello", {"world", "and", "universe"});
   OPERATION(UNIQUE_CONSTRAINT_DROP, "hello", {"world", "and", "universe"});
+  OPERATION(LABEL_PROPERTIES_INDEX_CREATE, "hello", {"world", "and", "universe"});
+  OPERATION(LABEL_PROPERTIES_INDEX_DROP, "hello", {"world", "and", "universe"});
+  gen.AppendPropertyColumnsOperation("hello", {{"world", memgraph::storage::PropertyValue::Type::Int},
+                                               {"and", memgraph::storage::PropertyValue::Type::Double}});
+  OPERATION(PROPERTY_COLUMNS_DROP, "hello");
+  OPERATION(LABEL_PROPERTY_HASH_INDEX_CREATE, "hello", {"world"});
+  OPERATION(LABEL_PROPERTY_HASH_INDEX_DROP, "hello", {"world"});
+  gen.AppendEdgeIndexOperation(memgraph::storage::durability::StorageGlobalOperation::EDGE_INDEX_CREATE, "hello");
+  gen.AppendEdgeIndexOperation(memgraph::storage::durability::StorageGlobalOperation::EDGE_INDEX_DROP, "hello");
+  gen.AppendEdgeIndexOperation(memgraph::storage::durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_CREATE,
+                               "hello", {"world"});
+  gen.AppendEdgeIndexOperation(memgraph::storage::durability::StorageGlobalOperation::EDGE_PROPERTY_INDEX_DROP,
+                               "hello", {"world"});
 });
 
 // NOLINTNEXTLINE(hicpp-special-member-functions)
@@ -621,3 +713,37 @@ TEST_P(WalFileTest, PartialData) {
   ASSERT_EQ(pos, infos.size() - 2);
   AssertWalInfoEqual(infos[infos.size() - 1].second, memgraph::storage::durability::ReadWalInfo(current_file));
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(WalFileTest, RecoveryFailureWithThreads) {
+  {
+    DeltaGenerator gen(storage_directory, GetParam(), 5);
+    TRANSACTION(true, {
+      auto vertex = tx.CreateVertex();
+      tx.AddLabel(vertex, "hello");
+      tx.AddLabel(vertex, "hello");
+      for (uint64_t i = 0; i < 1000; ++i) {
+        auto other = tx.CreateVertex();
+        tx.AddLabel(other, "hello");
+        tx.SetProperty(other, "world", memgraph::storage::PropertyValue(static_cast<int64_t>(i)));
+      }
+    });
+  }
+
+  auto wal_files = GetFilesList();
+  ASSERT_EQ(wal_files.size(), 1);
+
+  // Adding the same label twice is invalid, which has to be reported by every
+  // number of recovery threads and mustn't leave any of them running.
+  for (uint64_t thread_count : {1, 2, 8}) {
+    memgraph::storage::durability::RecoveredIndicesAndConstraints indices_constraints;
+    memgraph::utils::SkipList<memgraph::storage::Vertex> vertices;
+    memgraph::utils::SkipList<memgraph::storage::Edge> edges;
+    memgraph::storage::NameIdMapper name_id_mapper;
+    std::atomic<uint64_t> edge_count{0};
+    ASSERT_THROW(memgraph::storage::durability::LoadWal(wal_files.front(), &indices_constraints, std::nullopt,
+                                                        &vertices, &edges, &name_id_mapper, &edge_count,
+                                                        {.properties_on_edges = GetParam()}, thread_count),
+                 memgraph::storage::durability::RecoveryFailure);
+  }
+}
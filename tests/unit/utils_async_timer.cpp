@@ -131,6 +131,24 @@ TEST(AsyncTimer, AssignToExpiredTimer) {
   EXPECT_NEAR(ElapsedMilis(before, fourth_check_point), 2 * kIntervalInMilis, kAbsoluteErrorInMilis);
 }
 
+TEST(AsyncTimer, Share) {
+  const auto before = Now();
+  AsyncTimer timer{kIntervalInSeconds};
+  auto shared_timer = timer.Share();
+  EXPECT_FALSE(shared_timer.IsExpired());
+
+  while (!shared_timer.IsExpired()) {
+    ASSERT_LT(ElapsedMilis(before, Now()), 2 * kIntervalInMilis);
+  }
+  EXPECT_TRUE(timer.IsExpired());
+  EXPECT_NEAR(ElapsedMilis(before, Now()), kIntervalInMilis, kAbsoluteErrorInMilis);
+
+  // Destroying the shared timer doesn't affect the original one.
+  { auto another_shared_timer = timer.Share(); }
+  EXPECT_TRUE(timer.IsExpired());
+  EXPECT_FALSE(AsyncTimer().Share().IsExpired());
+}
+
 TEST(AsyncTimer, DestroyTimerWhileItIsStillRunning) {
   { AsyncTimer timer_to_destroy{kIntervalInSeconds}; }
   const auto before = Now();
@@ -9,6 +9,8 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <random>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "utils/csv_parsing.hpp"
@@ -330,4 +332,96 @@ TEST_P(CsvReaderTest, EmptyColumns) {
   }
 }
 
+TEST_P(CsvReaderTest, LongQuotedFields) {
+  // create a file with quoted fields longer than the blocks that are searched
+  // at once, with quotes at and around the block boundaries;
+  // parser should return the unquoted fields
+  const auto filepath = csv_directory / "bla.csv";
+  auto writer = FileWriter(filepath, GetParam());
+
+  memgraph::utils::MemoryResource *mem(memgraph::utils::NewDeleteResource());
+
+  const memgraph::utils::pmr::string delimiter{",", mem};
+  const memgraph::utils::pmr::string quote{"\"", mem};
+
+  std::vector<std::vector<std::string>> expected_rows;
+  for (size_t quote_pos = 0; quote_pos < 70; ++quote_pos) {
+    auto field = std::string(quote_pos, 'a') + '"' + std::string(70 - quote_pos, 'b');
+    expected_rows.push_back({field, std::string(quote_pos + 1, ','), "c"});
+    auto escaped_field = memgraph::utils::Replace(field, "\"", "\"\"");
+    writer.WriteLine(fmt::format("\"{}\",\"{}\",c", escaped_field, expected_rows.back()[1]));
+  }
+
+  writer.Close();
+
+  const bool with_header = false;
+  const bool ignore_bad = false;
+  const memgraph::csv::Reader::Config cfg{with_header, ignore_bad, delimiter, quote};
+  auto reader = memgraph::csv::Reader(filepath, cfg);
+
+  for (const auto &expected_row : expected_rows) {
+    const auto parsed_row = reader.GetNextRow(mem);
+    ASSERT_TRUE(parsed_row.has_value());
+    ASSERT_EQ(*parsed_row, ToPmrColumns(expected_row));
+  }
+  ASSERT_FALSE(reader.GetNextRow(mem));
+}
+
+TEST_P(CsvReaderTest, LongUnquotedFields) {
+  // create a file with unquoted fields longer than the blocks that are
+  // searched at once, with parts of the delimiter at and around the block
+  // boundaries;
+  // parser should split the rows only at the whole delimiter
+  const auto filepath = csv_directory / "bla.csv";
+  auto writer = FileWriter(filepath, GetParam());
+
+  memgraph::utils::MemoryResource *mem(memgraph::utils::NewDeleteResource());
+
+  const memgraph::utils::pmr::string delimiter{"::", mem};
+  const memgraph::utils::pmr::string quote{"\"", mem};
+
+  std::vector<std::vector<std::string>> expected_rows;
+  for (size_t colon_pos = 0; colon_pos < 70; ++colon_pos) {
+    auto field = std::string(colon_pos, 'a') + ':' + std::string(70 - colon_pos, 'b');
+    expected_rows.push_back({field, std::string(colon_pos + 1, 'c'), field});
+    writer.WriteLine(CreateRow(expected_rows.back(), delimiter));
+  }
+
+  writer.Close();
+
+  const bool with_header = false;
+  const bool ignore_bad = false;
+  const memgraph::csv::Reader::Config cfg{with_header, ignore_bad, delimiter, quote};
+  auto reader = memgraph::csv::Reader(filepath, cfg);
+
+  for (const auto &expected_row : expected_rows) {
+    const auto parsed_row = reader.GetNextRow(mem);
+    ASSERT_TRUE(parsed_row.has_value());
+    ASSERT_EQ(*parsed_row, ToPmrColumns(expected_row));
+  }
+  ASSERT_FALSE(reader.GetNextRow(mem));
+}
+
 INSTANTIATE_TEST_CASE_P(NewlineParameterizedTest, CsvReaderTest, ::testing::Values("\n", "\r\n"));
+
+TEST(CharacterFinder, MatchesScalarSearch) {
+  const memgraph::csv::CharacterFinder finder(std::string{',', '"', '\n', '\r', '\0'});
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> length_dist(0, 200);
+  // Mostly ordinary characters so that long runs without a match are tested.
+  const std::string alphabet = std::string(60, 'x') + std::string{',', '"', '\n', '\r', '\0', '\xff'};
+  std::uniform_int_distribution<size_t> char_dist(0, alphabet.size() - 1);
+
+  for (int i = 0; i < 1000; ++i) {
+    std::string data(length_dist(gen), ' ');
+    for (auto &c : data) c = alphabet[char_dist(gen)];
+    for (size_t pos = 0; pos <= data.size(); ++pos) {
+      ASSERT_EQ(finder.Find(data, pos), finder.FindScalar(data, pos));
+    }
+  }
+
+  ASSERT_EQ(finder.Find(std::string(100, 'x')), std::string_view::npos);
+  ASSERT_EQ(finder.Find(std::string(100, 'x') + ','), 100);
+  ASSERT_EQ(memgraph::csv::CharacterFinder().Find(std::string(100, 'x')), std::string_view::npos);
+}
@@ -276,6 +276,43 @@ TEST_F(UtilsFileTest, OutputFileDescriptorLeackage) {
   }
 }
 
+TEST_F(UtilsFileTest, MappedFile) {
+  const auto path = storage / "existing_dir_777" / "existing_file_777";
+  {
+    memgraph::utils::OutputFile handle;
+    handle.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    handle.Write("hello world!\n");
+    handle.Close();
+  }
+
+  memgraph::utils::MappedFile mapped;
+  ASSERT_FALSE(mapped.IsOpen());
+  ASSERT_FALSE(mapped.Open(storage / "existing_dir_777" / "nonexistent_file"));
+  ASSERT_TRUE(mapped.Open(path));
+  ASSERT_FALSE(mapped.Open(path));
+  ASSERT_TRUE(mapped.IsOpen());
+  ASSERT_EQ(mapped.path(), path);
+  ASSERT_EQ(mapped.GetSize(), 13);
+  ASSERT_EQ(std::string_view(reinterpret_cast<const char *>(mapped.data()), mapped.GetSize()), "hello world!\n");
+
+  auto moved = std::move(mapped);
+  ASSERT_FALSE(mapped.IsOpen());
+  ASSERT_TRUE(moved.IsOpen());
+  ASSERT_EQ(moved.GetSize(), 13);
+  moved.Close();
+  ASSERT_FALSE(moved.IsOpen());
+
+  // Empty files are mapped without any data.
+  const auto empty_path = storage / "existing_dir_777" / "empty_file";
+  {
+    memgraph::utils::OutputFile handle;
+    handle.Open(empty_path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    handle.Close();
+  }
+  ASSERT_TRUE(mapped.Open(empty_path));
+  ASSERT_EQ(mapped.GetSize(), 0);
+}
+
 TEST_F(UtilsFileTest, ConcurrentReadingAndWritting) {
   const auto file_path = storage / "existing_dir_777" / "existing_file_777";
   memgraph::utils::OutputFile handle;